@@ -163,7 +163,7 @@ int main()
         // 6
         // Now decode the PDU as if we have just received it from the network.
         PDU_Factory pduFact;
-        auto_ptr<Header> pdu = pduFact.Decode( stream );
+        PduUniquePtr pdu = pduFact.Decode( stream );
 
         if( pdu.get() )
         {
@@ -56,7 +56,7 @@ PDU_FactoryLink16::~PDU_FactoryLink16()
 
 //////////////////////////////////////////////////////////////////////////
 
-auto_ptr<Header> PDU_FactoryLink16::Decode( const Header & H, KDataStream & Stream )throw( KException )
+PduUniquePtr PDU_FactoryLink16::Decode( const Header & H, KDataStream & Stream )throw( KException )
 {
     switch( H.GetPDUType() )
     {
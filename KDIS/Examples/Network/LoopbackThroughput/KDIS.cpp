@@ -0,0 +1,109 @@
+/**********************************************************************
+The following UNLICENSE statement applies to this example.
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <http://unlicense.org/>
+*********************************************************************/
+
+/*********************************************************************
+For Further Information on KDIS:
+http://p.sf.net/kdis/UserGuide
+
+This example measures how fast a Connection can decode and dispatch PDU with the network
+taken out of the picture. A LoopbackTransport is filled with a few datagrams and put in
+replay mode so GetNextPDU receives them over and over, the same sequence on every run.
+Pass the number of PDU to receive, the default is 1000000.
+*********************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include "KDIS/Extras/PDU_Statistics.h"
+#include "KDIS/Network/Connection.h"
+#include "KDIS/Network/LoopbackTransport.h"
+#include "KDIS/PDU/Bundle.h"
+#include "KDIS/PDU/Entity_Info_Interaction/Entity_State_PDU.h"
+#include "KDIS/PDU/Warfare/Fire_PDU.h"
+
+using namespace std;
+using namespace KDIS;
+using namespace PDU;
+using namespace UTILS;
+using namespace NETWORK;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+
+static KUINT32 EntityStates = 0;
+
+void OnEntityState( const Entity_State_PDU & )
+{
+    ++EntityStates;
+}
+
+int main( int argc, char * argv[] )
+{
+    const KUINT32 ui32Count = argc > 1 ? atoi( argv[1] ) : 1000000;
+
+    try
+    {
+        // Nothing is sent on the network, the address is not used.
+        Connection conn( "127.0.0.1", 3000, false, false, 0, true );
+        LoopbackTransport * pLoopback = new LoopbackTransport( 16 );
+        conn.SetTransport( pLoopback );
+        conn.AddPDUHandler( Entity_State_PDU_Type, OnEntityState );
+
+        // A single PDU, a bundle and a PDU that is not handled.
+        Entity_State_PDU Entity;
+        Entity.SetEntityIdentifier( EntityIdentifier( 1, 2, 3 ) );
+        conn.SendPDU( &Entity );
+
+        Bundle B;
+        B.AddPDU( PduPtr( new Entity_State_PDU( Entity ) ) );
+        B.AddPDU( PduPtr( new Entity_State_PDU( Entity ) ) );
+        conn.SendBundle( B );
+
+        Fire_PDU Fire;
+        conn.SendPDU( &Fire );
+
+        pLoopback->SetReplayEnabled( true );
+
+        const KUINT64 ui64Start = PDU_Statistics::GetTime();
+        for( KUINT32 i = 0; i < ui32Count; ++i )
+        {
+            conn.GetNextPDU();
+        }
+        const KUINT64 ui64Elapsed = PDU_Statistics::GetTime() - ui64Start;
+
+        cout << ui32Count << " PDU in " << ui64Elapsed / 1000000.0 << " ms, "
+             << ( ui64Elapsed ? ui32Count * 1e9 / ui64Elapsed : 0 ) << " PDU/s, "
+             << EntityStates << " Entity State PDU handled" << endl;
+    }
+    catch( exception & e )
+    {
+        cout << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -89,8 +89,9 @@ int main()
             pduBundle.AddPDU( EntityGenerator::GenerateEntityRef() );
         }
 
-        // Now send the bundle
-        myConnection.Send( pduBundle.Encode() );
+        // Now send the bundle, SendBundle hands the members to the socket without
+        // first copying them into a single stream.
+        myConnection.SendBundle( pduBundle );
 
         cout << "2: Sent Bundle, Size: " << pduBundle.GetLength() << endl;
     }
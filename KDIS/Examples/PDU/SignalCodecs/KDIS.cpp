@@ -0,0 +1,108 @@
+/**********************************************************************
+The following UNLICENSE statement applies to this example.
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <http://unlicense.org/>
+*********************************************************************/
+
+/*********************************************************************
+For Further Information on KDIS:
+http://p.sf.net/kdis/UserGuide
+
+This example measures the throughput of each AudioCodec conversion, the work done for every
+Signal PDU when mixing radio nets. Each codec converts the same block of 400 nets of 20ms,
+8kHz audio over and over. Pass the number of samples to convert per codec, the default is 100000000.
+*********************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include "KDIS/Extras/AudioCodec.h"
+#include "KDIS/Extras/PDU_Statistics.h"
+
+using namespace std;
+using namespace KDIS;
+using namespace UTILS;
+
+// 400 nets of 160 samples.
+static const KUINT32 BLOCK = 400 * 160;
+
+static vector<KOCTET> Encoded( BLOCK * 2 );
+static vector<KINT16> PCM( BLOCK );
+static vector<KFLOAT32> Float( BLOCK );
+
+void DecodeMuLaw()      { AudioCodec::DecodeMuLaw( &Encoded[0], &PCM[0], BLOCK ); }
+void EncodeMuLaw()      { AudioCodec::EncodeMuLaw( &PCM[0], &Encoded[0], BLOCK ); }
+void DecodeMuLawFloat() { AudioCodec::Decode( 1, &Encoded[0], BLOCK, &Float[0] ); }
+void DecodePCM8()       { AudioCodec::DecodePCM8( &Encoded[0], &PCM[0], BLOCK ); }
+void EncodePCM8()       { AudioCodec::EncodePCM8( &PCM[0], &Encoded[0], BLOCK ); }
+void DecodePCM16BE()    { AudioCodec::DecodePCM16( &Encoded[0], &PCM[0], BLOCK, true ); }
+void EncodePCM16BE()    { AudioCodec::EncodePCM16( &PCM[0], &Encoded[0], BLOCK, true ); }
+void DecodePCM16LE()    { AudioCodec::DecodePCM16( &Encoded[0], &PCM[0], BLOCK, false ); }
+void EncodePCM16LE()    { AudioCodec::EncodePCM16( &PCM[0], &Encoded[0], BLOCK, false ); }
+void PCM16ToFloat()     { AudioCodec::PCM16ToFloat( &PCM[0], &Float[0], BLOCK ); }
+void FloatToPCM16()     { AudioCodec::FloatToPCM16( &Float[0], &PCM[0], BLOCK ); }
+
+void Run( const char * Name, void ( *Codec )(), KUINT64 Samples )
+{
+    const KUINT64 ui64Blocks = Samples / BLOCK ? Samples / BLOCK : 1;
+
+    const KUINT64 ui64Start = PDU_Statistics::GetTime();
+    for( KUINT64 i = 0; i < ui64Blocks; ++i )
+    {
+        Codec();
+    }
+    const KUINT64 ui64Elapsed = PDU_Statistics::GetTime() - ui64Start;
+
+    cout << Name << ": " << ui64Blocks * BLOCK << " samples in " << ui64Elapsed / 1000000.0 << " ms, "
+         << ( ui64Elapsed ? ui64Blocks * BLOCK * 1000.0 / ui64Elapsed : 0 ) << " M samples/s" << endl;
+}
+
+int main( int argc, char * argv[] )
+{
+    const KUINT64 ui64Samples = argc > 1 ? strtoul( argv[1], 0, 10 ) : 100000000;
+
+    // Noise, so the mu-law encoder sees every segment.
+    for( KUINT32 i = 0; i < BLOCK * 2; ++i )
+    {
+        Encoded[i] = ( KOCTET )rand();
+    }
+    DecodePCM16BE();
+    PCM16ToFloat();
+
+    Run( "8 bit mu-law decode         ", DecodeMuLaw, ui64Samples );
+    Run( "8 bit mu-law encode         ", EncodeMuLaw, ui64Samples );
+    Run( "8 bit mu-law decode to float", DecodeMuLawFloat, ui64Samples );
+    Run( "8 bit linear PCM decode     ", DecodePCM8, ui64Samples );
+    Run( "8 bit linear PCM encode     ", EncodePCM8, ui64Samples );
+    Run( "16 bit PCM big endian decode", DecodePCM16BE, ui64Samples );
+    Run( "16 bit PCM big endian encode", EncodePCM16BE, ui64Samples );
+    Run( "16 bit PCM little end decode", DecodePCM16LE, ui64Samples );
+    Run( "16 bit PCM little end encode", EncodePCM16LE, ui64Samples );
+    Run( "16 bit PCM to float         ", PCM16ToFloat, ui64Samples );
+    Run( "Float to 16 bit PCM         ", FloatToPCM16, ui64Samples );
+
+    return 0;
+}
@@ -32,6 +32,8 @@ http://p.sf.net/kdis/UserGuide
 using namespace KDIS;
 using namespace DATA_TYPE;
 
+KDIS_CHECK_SCHEMA_SIZE( AggregateIdentifier, AggregateIdentifier::AGGREGATE_IDENTIFER_SIZE );
+
 //////////////////////////////////////////////////////////////////////////
 // Public:
 //////////////////////////////////////////////////////////////////////////
@@ -100,10 +102,14 @@ KString AggregateIdentifier::GetAsString() const
 
 void AggregateIdentifier::Decode( KDataStream & stream ) throw( KException )
 {
-    if( stream.GetBufferSize() < AGGREGATE_IDENTIFER_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    FieldSchema::Decode( stream, *this );
+}
 
-    SimulationIdentifier::Decode( stream );
-    stream >> m_ui16AggregateID;
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes AggregateIdentifier::TryDecode( KDataStream & stream )
+{
+    return FieldSchema::TryDecode( stream, *this );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -121,17 +127,14 @@ KDataStream AggregateIdentifier::Encode() const
 
 void AggregateIdentifier::Encode( KDataStream & stream ) const
 {
-    SimulationIdentifier::Encode( stream );
-    stream << m_ui16AggregateID;
+    FieldSchema::Encode( *this, stream );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 KBOOL AggregateIdentifier::operator == ( const AggregateIdentifier & Value ) const
 {
-    if( SimulationIdentifier::operator !=( Value ) )   return false;
-    if( m_ui16AggregateID != Value.m_ui16AggregateID ) return false;
-    return true;
+    return FieldSchema::Equal( *this, Value );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -55,6 +55,10 @@ public:
 
     static const KUINT16 AGGREGATE_IDENTIFER_SIZE = 6;
 
+    // Layout of the record, used to encode, decode, compare and hash it.
+    typedef KFieldList< SimulationIdentifier::FieldSchema,
+                        KField<AggregateIdentifier, KUINT16, &AggregateIdentifier::m_ui16AggregateID> > FieldSchema;
+
     AggregateIdentifier();
 
     AggregateIdentifier( KUINT16 SiteID, KUINT16 ApplicatonID, KUINT16 AggregateID );
@@ -82,10 +86,13 @@ public:
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::AggregateIdentifier::Decode
+    //              KDIS::DATA_TYPE::AggregateIdentifier::TryDecode
     // Description: Convert From Network Data.
+    //              TryDecode returns an error code instead of throwing.
     // Parameter:   KDataStream & stream
     //************************************
     virtual void Decode( KDataStream & stream ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream );
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::AggregateIdentifier::Encode
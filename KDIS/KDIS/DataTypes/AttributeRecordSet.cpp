@@ -111,6 +111,16 @@ void AttributeRecordSet::SetAttributeRecords( const vector<StdVarPtr> & AR )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void AttributeRecordSet::SetAttributeRecords( vector<StdVarPtr> && AR )
+{
+    m_vAttrRec = std::move( AR );
+    m_ui16NumAttrRecs = m_vAttrRec.size();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<StdVarPtr> & AttributeRecordSet::GetAttributeRecords() const
 {
     return m_vAttrRec;
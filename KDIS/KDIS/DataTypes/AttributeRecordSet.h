@@ -67,6 +67,8 @@ public:
     
     virtual ~AttributeRecordSet();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( AttributeRecordSet )
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::AttributeRecordSet::SetEntityIdentifier
     //              KDIS::DATA_TYPE::AttributeRecordSet::GetEntityIdentifier
@@ -94,6 +96,9 @@ public:
     //************************************
     void AddAttributeRecord( StdVarPtr AR );
     void SetAttributeRecords( const std::vector<StdVarPtr> & AR );
+    #ifdef KDIS_USE_CPP11
+    void SetAttributeRecords( std::vector<StdVarPtr> && AR );
+    #endif
     const std::vector<StdVarPtr> & GetAttributeRecords() const;
     void ClearAttributeRecords();
 
@@ -32,6 +32,8 @@ http://p.sf.net/kdis/UserGuide
 using namespace KDIS;
 using namespace DATA_TYPE;
 
+KDIS_CHECK_SCHEMA_SIZE( ClockTime, ClockTime::CLOCK_TIME_SIZE );
+
 //////////////////////////////////////////////////////////////////////////
 // Public:
 //////////////////////////////////////////////////////////////////////////
@@ -59,12 +61,30 @@ ClockTime::ClockTime( KDataStream & stream ) throw( KException )
 
 //////////////////////////////////////////////////////////////////////////
 
+ClockTime::ClockTime( const ClockTimePOD & P ) :
+    m_i32Hour( P.m_i32Hour ),
+    m_ui32TimePastHour( P.m_ui32TimePastHour )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 ClockTime::~ClockTime()
 {
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+ClockTimePOD ClockTime::ToPOD() const
+{
+    ClockTimePOD P;
+    P.m_i32Hour = m_i32Hour;
+    P.m_ui32TimePastHour = m_ui32TimePastHour;
+    return P;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 void ClockTime::SetHour( KINT32 H )
 {
     m_i32Hour = H;
@@ -107,10 +127,14 @@ KString ClockTime::GetAsString() const
 
 void ClockTime::Decode( KDataStream & stream ) throw( KException )
 {
-    if( stream.GetBufferSize() < CLOCK_TIME_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    FieldSchema::Decode( stream, *this );
+}
 
-    stream >> m_i32Hour
-           >> m_ui32TimePastHour;
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes ClockTime::TryDecode( KDataStream & stream )
+{
+    return FieldSchema::TryDecode( stream, *this );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -128,17 +152,14 @@ KDataStream ClockTime::Encode() const
 
 void ClockTime::Encode( KDataStream & stream ) const
 {
-    stream << m_i32Hour
-           << m_ui32TimePastHour;
+    FieldSchema::Encode( *this, stream );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 KBOOL ClockTime::operator == ( const ClockTime & Value ) const
 {
-    if( m_i32Hour          != Value.m_i32Hour )          return false;
-    if( m_ui32TimePastHour != Value.m_ui32TimePastHour ) return false;
-    return true;
+    return FieldSchema::Equal( *this, Value );
 }
 
 //////////////////////////////////////////////////////////////////////////
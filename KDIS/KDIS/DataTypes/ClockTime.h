@@ -42,6 +42,8 @@ http://p.sf.net/kdis/UserGuide
 #pragma once
 
 #include "./DataTypeBase.h"
+#include "./FieldSchema.h"
+#include "./PODTypes.h"
 
 namespace KDIS {
 namespace DATA_TYPE {
@@ -58,14 +60,27 @@ public:
 
     static const KUINT16 CLOCK_TIME_SIZE = 8;
 
+    // Layout of the record, used to encode, decode, compare and hash it.
+    typedef KFieldList< KField<ClockTime, KINT32, &ClockTime::m_i32Hour>,
+                        KField<ClockTime, KUINT32, &ClockTime::m_ui32TimePastHour> > FieldSchema;
+
     ClockTime();
 
     ClockTime( KINT32 Hour, KUINT32 TimePastHour );
 
     ClockTime( KDataStream & stream ) throw( KException );
 
+    ClockTime( const ClockTimePOD & P );
+
     virtual ~ClockTime();
 
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::ClockTime::ToPOD
+    // Description: Returns a plain copy of the fields, see PODTypes.h.
+    //              Use the ClockTime( const ClockTimePOD & ) constructor to convert back.
+    //************************************
+    ClockTimePOD ToPOD() const;
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::ClockTime::SetHour
     //              KDIS::DATA_TYPE::ClockTime::GetHour
@@ -92,10 +107,13 @@ public:
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::ClockTime::Decode
+    //              KDIS::DATA_TYPE::ClockTime::TryDecode
     // Description: Convert From Network Data.
+    //              TryDecode returns an error code instead of throwing.
     // Parameter:   KDataStream & stream
     //************************************
     virtual void Decode( KDataStream & stream ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream );
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::ClockTime::Encode
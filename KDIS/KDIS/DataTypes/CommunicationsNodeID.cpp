@@ -35,6 +35,8 @@ using namespace KDIS;
 using namespace DATA_TYPE;
 using namespace ENUMS;
 
+KDIS_CHECK_SCHEMA_SIZE( CommunicationsNodeID, CommunicationsNodeID::COMMUNICATIONS_NODE_ID_SIZE );
+
 //////////////////////////////////////////////////////////////////////////
 // Public:
 //////////////////////////////////////////////////////////////////////////
@@ -111,10 +113,14 @@ KString CommunicationsNodeID::GetAsString() const
 
 void CommunicationsNodeID::Decode( KDataStream & stream ) throw( KException )
 {
-    if( stream.GetBufferSize() < COMMUNICATIONS_NODE_ID_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    FieldSchema::Decode( stream, *this );
+}
 
-    EntityIdentifier::Decode( stream );
-    stream >> m_ui16ElementID;
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes CommunicationsNodeID::TryDecode( KDataStream & stream )
+{
+    return FieldSchema::TryDecode( stream, *this );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -132,17 +138,14 @@ KDataStream CommunicationsNodeID::Encode() const
 
 void CommunicationsNodeID::Encode( KDataStream & stream ) const
 {
-    EntityIdentifier::Encode( stream );
-    stream << m_ui16ElementID;
+    FieldSchema::Encode( *this, stream );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 KBOOL CommunicationsNodeID::operator == ( const CommunicationsNodeID & Value ) const
 {
-    if( EntityIdentifier::operator !=( Value ) )   return false;
-    if( m_ui16ElementID != Value.m_ui16ElementID ) return false;
-    return true;
+    return FieldSchema::Equal( *this, Value );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -57,6 +57,10 @@ public:
 
     static const KUINT16 COMMUNICATIONS_NODE_ID_SIZE = 8;
 
+    // Layout of the record, used to encode, decode, compare and hash it.
+    typedef KFieldList< EntityIdentifier::FieldSchema,
+                        KField<CommunicationsNodeID, KUINT16, &CommunicationsNodeID::m_ui16ElementID> > FieldSchema;
+
     CommunicationsNodeID();
 
     CommunicationsNodeID( KDataStream & stream ) throw( KException );
@@ -90,10 +94,13 @@ public:
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::CommunicationsNodeID::Decode
+    //              KDIS::DATA_TYPE::CommunicationsNodeID::TryDecode
     // Description: Convert From Network Data.
+    //              TryDecode returns an error code instead of throwing.
     // Parameter:   KDataStream & stream
     //************************************
     virtual void Decode( KDataStream & stream ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream );
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::CommunicationsNodeID::Encode
@@ -47,3 +47,18 @@ DataTypeBase::~DataTypeBase()
 }
 
 //////////////////////////////////////////////////////////////////////////
+
+ErrorCodes DataTypeBase::TryDecode( KDataStream & stream )
+{
+    try
+    {
+        Decode( stream );
+    }
+    catch( const KException & e )
+    {
+        return static_cast<ErrorCodes>( e.m_ui16ErrorCode );
+    }
+    return NO_ERRORS;
+}
+
+//////////////////////////////////////////////////////////////////////////
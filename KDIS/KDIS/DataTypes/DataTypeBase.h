@@ -67,6 +67,15 @@ public:
     //************************************
     virtual void Decode( KDataStream & stream ) throw( KException ) = 0;
 
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::DataTypeBase::TryDecode
+    // Description: Convert From Network Data without throwing, returns NO_ERRORS on success.
+    //              The default reports the error raised by Decode, fixed size records
+    //              override it with a decode that never throws.
+    // Parameter:   KDataStream & stream
+    //************************************
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream );
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::DataTypeBase::Encode
     // Description: Convert To Network Data.
@@ -33,6 +33,8 @@ using namespace KDIS;
 using namespace DATA_TYPE;
 using namespace ENUMS;
 
+KDIS_CHECK_SCHEMA_SIZE( DeadReckoningParameter, DeadReckoningParameter::DEAD_RECKONING_PARAMETER_SIZE );
+
 //////////////////////////////////////////////////////////////////////////
 // Public:
 //////////////////////////////////////////////////////////////////////////
@@ -63,12 +65,34 @@ DeadReckoningParameter::DeadReckoningParameter( DeadReckoningAlgorithm DRA, cons
 
 //////////////////////////////////////////////////////////////////////////
 
+DeadReckoningParameter::DeadReckoningParameter( const DeadReckoningParameterPOD & P ) :
+    m_ui8DeadRecknoningAlgorithm( P.m_ui8DeadRecknoningAlgorithm ),
+    m_LinearAcceleration( P.m_LinearAcceleration ),
+    m_AngularVelocity( P.m_AngularVelocity )
+{
+    memcpy( m_OtherParams, P.m_OtherParams, 15 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 DeadReckoningParameter::~DeadReckoningParameter()
 {
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+DeadReckoningParameterPOD DeadReckoningParameter::ToPOD() const
+{
+    DeadReckoningParameterPOD P;
+    P.m_ui8DeadRecknoningAlgorithm = m_ui8DeadRecknoningAlgorithm;
+    memcpy( P.m_OtherParams, m_OtherParams, 15 );
+    P.m_LinearAcceleration = m_LinearAcceleration.ToPOD();
+    P.m_AngularVelocity = m_AngularVelocity.ToPOD();
+    return P;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 void DeadReckoningParameter::SetDeadReckoningAlgorithm( DeadReckoningAlgorithm DRA )
 {
     m_ui8DeadRecknoningAlgorithm = DRA;
@@ -142,17 +166,14 @@ KString DeadReckoningParameter::GetAsString() const
 
 void DeadReckoningParameter::Decode( KDataStream & stream ) throw( KException )
 {
-    if( stream.GetBufferSize() < DEAD_RECKONING_PARAMETER_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
-
-    stream >> m_ui8DeadRecknoningAlgorithm;
+    FieldSchema::Decode( stream, *this );
+}
 
-    for( KUINT16 i = 0; i < 15; ++i )
-    {
-        stream >> m_OtherParams[i];
-    }
+//////////////////////////////////////////////////////////////////////////
 
-    stream >> KDIS_STREAM m_LinearAcceleration
-           >> KDIS_STREAM m_AngularVelocity;
+ErrorCodes DeadReckoningParameter::TryDecode( KDataStream & stream )
+{
+    return FieldSchema::TryDecode( stream, *this );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -170,26 +191,14 @@ KDataStream DeadReckoningParameter::Encode() const
 
 void DeadReckoningParameter::Encode( KDataStream & stream ) const
 {
-    stream << m_ui8DeadRecknoningAlgorithm;
-
-    for( KUINT16 i = 0; i < 15; ++i )
-    {
-        stream << m_OtherParams[i];
-    }
-
-    stream << KDIS_STREAM m_LinearAcceleration
-           << KDIS_STREAM m_AngularVelocity;
+    FieldSchema::Encode( *this, stream );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 KBOOL DeadReckoningParameter::operator == ( const DeadReckoningParameter & Value ) const
 {
-    if( m_ui8DeadRecknoningAlgorithm    != Value.m_ui8DeadRecknoningAlgorithm ) return false;
-    if( m_LinearAcceleration            != Value.m_LinearAcceleration )         return false;
-    if( m_AngularVelocity               != Value.m_AngularVelocity )            return false;
-    if( memcmp( m_OtherParams, Value.m_OtherParams, 15 ) != 0 )                 return false;
-    return true;
+    return FieldSchema::Equal( *this, Value );
 }
 
 //////////////////////////////////////////////////////////////////////////
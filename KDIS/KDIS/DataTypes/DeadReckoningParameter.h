@@ -40,6 +40,8 @@ http://p.sf.net/kdis/UserGuide
 #pragma once
 
 #include "./DataTypeBase.h"
+#include "./FieldSchema.h"
+#include "./PODTypes.h"
 #include "./Vector.h"
 
 namespace KDIS {
@@ -61,6 +63,12 @@ public:
 
     static const KUINT16 DEAD_RECKONING_PARAMETER_SIZE = 40;
 
+    // Layout of the record, used to encode, decode, compare and hash it.
+    typedef KFieldList< KField<DeadReckoningParameter, KUINT8, &DeadReckoningParameter::m_ui8DeadRecknoningAlgorithm>,
+                        KArrayField<DeadReckoningParameter, KOCTET, 15, &DeadReckoningParameter::m_OtherParams>,
+                        KRecordField<DeadReckoningParameter, Vector, &DeadReckoningParameter::m_LinearAcceleration>,
+                        KRecordField<DeadReckoningParameter, Vector, &DeadReckoningParameter::m_AngularVelocity> > FieldSchema;
+
     DeadReckoningParameter();
 
     DeadReckoningParameter( KDataStream & stream ) throw( KException );
@@ -68,8 +76,17 @@ public:
     DeadReckoningParameter( KDIS::DATA_TYPE::ENUMS::DeadReckoningAlgorithm DRA, const Vector & LinearAcceleration,
                             const Vector & AngularVelocity );
 
+    DeadReckoningParameter( const DeadReckoningParameterPOD & P );
+
     virtual ~DeadReckoningParameter();
 
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::DeadReckoningParameter::ToPOD
+    // Description: Returns a plain copy of the fields, see PODTypes.h.
+    //              Use the DeadReckoningParameter( const DeadReckoningParameterPOD & ) constructor to convert back.
+    //************************************
+    DeadReckoningParameterPOD ToPOD() const;
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::DeadReckoningParameter::SetDeadReckoningAlgorithm
     //              KDIS::DATA_TYPE::DeadReckoningParameter::GetDeadReckoningAlgorithm
@@ -117,10 +134,13 @@ public:
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::DeadReckoningParameter::Decode
+    //              KDIS::DATA_TYPE::DeadReckoningParameter::TryDecode
     // Description: Convert From Network Data.
+    //              TryDecode returns an error code instead of throwing.
     // Parameter:   KDataStream & stream
     //************************************
     virtual void Decode( KDataStream & stream ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream );
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::DeadReckoningParameter::Encode
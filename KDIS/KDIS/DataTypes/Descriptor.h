@@ -67,7 +67,7 @@ typedef KDIS::UTILS::KRef_Ptr<Descriptor> DescPtr; // Ref counter
 typedef Descriptor ExpendableDescriptor;
 #endif
 
-class KDIS_EXPORT Descriptor : public DataTypeBase
+class KDIS_EXPORT Descriptor : public DataTypeBase, public KDIS::UTILS::KRef_Counted
 {
 protected:
 
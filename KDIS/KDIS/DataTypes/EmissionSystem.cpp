@@ -145,6 +145,27 @@ void EmissionSystem::SetEmitterBeams( const vector<EmitterBeam> & Beams )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void EmissionSystem::SetEmitterBeams( vector<EmitterBeam> && Beams )
+{
+    m_vEmitterBeams = std::move( Beams );
+    m_ui8NumberOfBeams = m_vEmitterBeams.size();
+
+    // Re-Calculate the System Data Length
+    m_ui8SystemDataLength = EMISSION_SYSTEM_SIZE / 4;
+
+    vector<EmitterBeam>::const_iterator citr = m_vEmitterBeams.begin();
+    vector<EmitterBeam>::const_iterator citrEnd = m_vEmitterBeams.end();
+
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui8SystemDataLength += citr->GetBeamDataLength();
+    }
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<EmitterBeam> & EmissionSystem::GetEmitterBeams() const
 {
     return m_vEmitterBeams;
@@ -76,6 +76,8 @@ public:
 
     virtual ~EmissionSystem();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( EmissionSystem )
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::EmissionSystem::GetSystemDataLength
     // Description: Length of the emission system in 32 bit words.
@@ -112,6 +114,9 @@ public:
     //************************************
     void AddEmitterBeam( const EmitterBeam & EB );
     void SetEmitterBeams( const std::vector<EmitterBeam> & Beams );
+    #ifdef KDIS_USE_CPP11
+    void SetEmitterBeams( std::vector<EmitterBeam> && Beams );
+    #endif
     const std::vector<EmitterBeam> & GetEmitterBeams() const;
     void ClearEmitterBeams();
 
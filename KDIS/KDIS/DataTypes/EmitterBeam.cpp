@@ -205,6 +205,17 @@ void EmitterBeam::SetTrackedJammedTargets( const std::vector<TrackJamTargetIdent
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void EmitterBeam::SetTrackedJammedTargets( std::vector<TrackJamTargetIdentifier> && ID )
+{
+    m_vTrackJamTargets = std::move( ID );
+    m_ui8NumTargetInTrackJamField = m_vTrackJamTargets.size();
+    m_ui8BeamDataLength = ( EMITTER_BEAM_SIZE + ( TrackJamTargetIdentifier::TRACK_JAM_TARGET_SIZE * m_ui8NumTargetInTrackJamField ) ) / 4;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<TrackJamTargetIdentifier> & EmitterBeam::GetTrackedJammedTargets() const
 {
     return m_vTrackJamTargets;
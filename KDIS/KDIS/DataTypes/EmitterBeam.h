@@ -88,6 +88,8 @@ public:
 
     virtual ~EmitterBeam();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( EmitterBeam )
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::EmitterBeam::GetSystemDataLength
     // Description: Length of the emission system in 32 bit words.
@@ -173,6 +175,9 @@ public:
     //************************************
     void AddTrackedJammedTarget( const TrackJamTargetIdentifier & ID );
     void SetTrackedJammedTargets( const vector<TrackJamTargetIdentifier> & ID );
+    #ifdef KDIS_USE_CPP11
+    void SetTrackedJammedTargets( vector<TrackJamTargetIdentifier> && ID );
+    #endif
     const vector<TrackJamTargetIdentifier> & GetTrackedJammedTargets() const;
     void ClearTrackedJammedTargets();
 
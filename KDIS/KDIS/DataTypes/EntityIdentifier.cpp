@@ -32,6 +32,8 @@ http://p.sf.net/kdis/UserGuide
 using namespace KDIS;
 using namespace DATA_TYPE;
 
+KDIS_CHECK_SCHEMA_SIZE( EntityIdentifier, EntityIdentifier::ENTITY_IDENTIFER_SIZE );
+
 //////////////////////////////////////////////////////////////////////////
 // Public:
 //////////////////////////////////////////////////////////////////////////
@@ -66,12 +68,31 @@ EntityIdentifier::EntityIdentifier( const SimulationIdentifier & SimID, KUINT16
 
 //////////////////////////////////////////////////////////////////////////
 
+EntityIdentifier::EntityIdentifier( const EntityIdentifierPOD & P ) :
+    SimulationIdentifier( P.m_ui16SiteID, P.m_ui16ApplicationID ),
+    m_ui16EntityID( P.m_ui16EntityID )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 EntityIdentifier::~EntityIdentifier()
 {
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+EntityIdentifierPOD EntityIdentifier::ToPOD() const
+{
+    EntityIdentifierPOD P;
+    P.m_ui16SiteID = m_ui16SiteID;
+    P.m_ui16ApplicationID = m_ui16ApplicationID;
+    P.m_ui16EntityID = m_ui16EntityID;
+    return P;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 void EntityIdentifier::SetEntityID( KUINT16 ID )
 {
     m_ui16EntityID = ID;
@@ -100,10 +121,14 @@ KString EntityIdentifier::GetAsString() const
 
 void EntityIdentifier::Decode( KDataStream & stream ) throw( KException )
 {
-    if( stream.GetBufferSize() < EntityIdentifier::ENTITY_IDENTIFER_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    FieldSchema::Decode( stream, *this );
+}
 
-    SimulationIdentifier::Decode( stream );
-    stream >> m_ui16EntityID;
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes EntityIdentifier::TryDecode( KDataStream & stream )
+{
+    return FieldSchema::TryDecode( stream, *this );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -121,17 +146,14 @@ KDataStream EntityIdentifier::Encode() const
 
 void EntityIdentifier::Encode( KDataStream & stream ) const
 {
-    SimulationIdentifier::Encode( stream );
-    stream << m_ui16EntityID;
+    FieldSchema::Encode( *this, stream );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 KBOOL EntityIdentifier::operator == ( const EntityIdentifier & Value ) const
 {
-    if( SimulationIdentifier::operator !=( Value ) )             return false;
-    if( m_ui16EntityID                 != Value.m_ui16EntityID ) return false;
-    return true;
+    return FieldSchema::Equal( *this, Value );
 }
 
 //////////////////////////////////////////////////////////////////////////
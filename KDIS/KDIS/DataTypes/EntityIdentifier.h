@@ -56,6 +56,10 @@ public:
 
     static const KUINT16 ENTITY_IDENTIFER_SIZE = 6;
 
+    // Layout of the record, used to encode, decode, compare and hash it.
+    typedef KFieldList< SimulationIdentifier::FieldSchema,
+                        KField<EntityIdentifier, KUINT16, &EntityIdentifier::m_ui16EntityID> > FieldSchema;
+
     EntityIdentifier();
 
     EntityIdentifier( KUINT16 SiteID, KUINT16 ApplicatonID, KUINT16 EntityID );
@@ -64,8 +68,17 @@ public:
 
     EntityIdentifier( KDataStream & stream ) throw( KException );
 
+    EntityIdentifier( const EntityIdentifierPOD & P );
+
     virtual ~EntityIdentifier();
 
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::EntityIdentifier::ToPOD
+    // Description: Returns a plain copy of the fields, see PODTypes.h.
+    //              Use the EntityIdentifier( const EntityIdentifierPOD & ) constructor to convert back.
+    //************************************
+    EntityIdentifierPOD ToPOD() const;
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::EntityIdentifier::SetEntityID
     //              KDIS::DATA_TYPE::EntityIdentifier::GetEntityID
@@ -83,10 +96,13 @@ public:
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::EntityIdentifier::Decode
+    //              KDIS::DATA_TYPE::EntityIdentifier::TryDecode
     // Description: Convert From Network Data.
+    //              TryDecode returns an error code instead of throwing.
     // Parameter:   KDataStream & stream
     //************************************
     virtual void Decode( KDataStream & stream ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream );
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::EntityIdentifier::Encode
@@ -36,6 +36,8 @@ using namespace DATA_TYPE;
 using namespace ENUMS;
 using namespace std;
 
+KDIS_CHECK_SCHEMA_SIZE( EntityType, EntityType::ENTITY_TYPE_SIZE );
+
 //////////////////////////////////////////////////////////////////////////
 // Public:
 //////////////////////////////////////////////////////////////////////////
@@ -88,12 +90,40 @@ EntityType::EntityType( KDataStream & stream ) throw( KException )
 
 //////////////////////////////////////////////////////////////////////////
 
+EntityType::EntityType( const EntityTypePOD & P ) :
+    m_ui8EntityKind( P.m_ui8EntityKind ),
+    m_ui8Domain( P.m_ui8Domain ),
+    m_ui16Country( P.m_ui16Country ),
+    m_ui8Category( P.m_ui8Category ),
+    m_ui8SubCategory( P.m_ui8SubCategory ),
+    m_ui8Specific( P.m_ui8Specific ),
+    m_ui8Extra( P.m_ui8Extra )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 EntityType::~EntityType()
 {
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+EntityTypePOD EntityType::ToPOD() const
+{
+    EntityTypePOD P;
+    P.m_ui8EntityKind = m_ui8EntityKind;
+    P.m_ui8Domain = m_ui8Domain;
+    P.m_ui16Country = m_ui16Country;
+    P.m_ui8Category = m_ui8Category;
+    P.m_ui8SubCategory = m_ui8SubCategory;
+    P.m_ui8Specific = m_ui8Specific;
+    P.m_ui8Extra = m_ui8Extra;
+    return P;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 void EntityType::SetEntityKind( EntityKind UI )
 {
     m_ui8EntityKind = UI;
@@ -260,15 +290,14 @@ KString EntityType::GetAsString() const
 
 void EntityType::Decode( KDataStream & stream ) throw( KException )
 {
-    if( stream.GetBufferSize() < ENTITY_TYPE_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
-
-    stream >> m_ui8EntityKind
-           >> m_ui8Domain
-           >> m_ui16Country
-           >> m_ui8Category
-           >> m_ui8SubCategory
-           >> m_ui8Specific
-           >> m_ui8Extra;
+    FieldSchema::Decode( stream, *this );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes EntityType::TryDecode( KDataStream & stream )
+{
+    return FieldSchema::TryDecode( stream, *this );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -286,27 +315,14 @@ KDataStream EntityType::Encode() const
 
 void EntityType::Encode( KDataStream & stream ) const
 {
-    stream << m_ui8EntityKind
-           << m_ui8Domain
-           << m_ui16Country
-           << m_ui8Category
-           << m_ui8SubCategory
-           << m_ui8Specific
-           << m_ui8Extra;
+    FieldSchema::Encode( *this, stream );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 KBOOL EntityType::operator == ( const EntityType & Value ) const
 {
-    if( m_ui8EntityKind  != Value.m_ui8EntityKind )  return false;
-    if( m_ui8Domain      != Value.m_ui8Domain )      return false;
-    if( m_ui16Country    != Value.m_ui16Country )    return false;
-    if( m_ui8Category    != Value.m_ui8Category )    return false;
-    if( m_ui8SubCategory != Value.m_ui8SubCategory ) return false;
-    if( m_ui8Specific    != Value.m_ui8Specific )    return false;
-    if( m_ui8Extra       != Value.m_ui8Extra )       return false;
-    return true;
+    return FieldSchema::Equal( *this, Value );
 }
 
 //////////////////////////////////////////////////////////////////////////
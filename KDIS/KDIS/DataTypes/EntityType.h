@@ -39,6 +39,8 @@ http://p.sf.net/kdis/UserGuide
 #pragma once
 
 #include "./DataTypeBase.h"
+#include "./FieldSchema.h"
+#include "./PODTypes.h"
 
 namespace KDIS {
 namespace DATA_TYPE {
@@ -65,6 +67,15 @@ public:
 
     static const KUINT16 ENTITY_TYPE_SIZE = 8;
 
+    // Layout of the record, used to encode, decode, compare and hash it.
+    typedef KFieldList< KField<EntityType, KUINT8, &EntityType::m_ui8EntityKind>,
+                        KField<EntityType, KUINT8, &EntityType::m_ui8Domain>,
+                        KField<EntityType, KUINT16, &EntityType::m_ui16Country>,
+                        KField<EntityType, KUINT8, &EntityType::m_ui8Category>,
+                        KField<EntityType, KUINT8, &EntityType::m_ui8SubCategory>,
+                        KField<EntityType, KUINT8, &EntityType::m_ui8Specific>,
+                        KField<EntityType, KUINT8, &EntityType::m_ui8Extra> > FieldSchema;
+
     EntityType();
 
     EntityType( KDIS::DATA_TYPE::ENUMS::EntityKind Kind, KUINT8 Domain, KDIS::DATA_TYPE::ENUMS::Country Country, KUINT8 Categoy,
@@ -75,8 +86,17 @@ public:
 
     EntityType( KDataStream & stream ) throw( KException );
 
+    EntityType( const EntityTypePOD & P );
+
     virtual ~EntityType();
 
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::EntityType::ToPOD
+    // Description: Returns a plain copy of the fields, see PODTypes.h.
+    //              Use the EntityType( const EntityTypePOD & ) constructor to convert back.
+    //************************************
+    EntityTypePOD ToPOD() const;
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::EntityType::SetEntityKind
     //              KDIS::DATA_TYPE::EntityType::GetEntityKind
@@ -160,10 +180,13 @@ public:
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::EntityType::Decode
+    //              KDIS::DATA_TYPE::EntityType::TryDecode
     // Description: Convert From Network Data.
+    //              TryDecode returns an error code instead of throwing.
     // Parameter:   KDataStream & stream
     //************************************
     virtual void Decode( KDataStream & stream ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream );
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::EntityType::Encode
@@ -56,7 +56,7 @@ class EnvironmentRecord;
 typedef KDIS::UTILS::KRef_Ptr<EnvironmentRecord> EnvironmentRecordPtr; // Ref counter
 //typedef EnvironmentRecord* EnvironmentRecordPtr; // Weak ref
 
-class KDIS_EXPORT EnvironmentRecord : public DataTypeBase, public FactoryDecoderUser<EnvironmentRecord>
+class KDIS_EXPORT EnvironmentRecord : public DataTypeBase, public FactoryDecoderUser<EnvironmentRecord>, public KDIS::UTILS::KRef_Counted
 {
 protected:
 
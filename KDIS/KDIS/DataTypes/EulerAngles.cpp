@@ -34,6 +34,8 @@ using namespace KDIS;
 using namespace DATA_TYPE;
 using namespace UTILS;
 
+KDIS_CHECK_SCHEMA_SIZE( EulerAngles, EulerAngles::EULER_ANGLES_SIZE );
+
 //////////////////////////////////////////////////////////////////////////
 // Public:
 //////////////////////////////////////////////////////////////////////////
@@ -63,12 +65,32 @@ EulerAngles::EulerAngles( KDataStream & stream ) throw( KException )
 
 //////////////////////////////////////////////////////////////////////////
 
+EulerAngles::EulerAngles( const EulerAnglesPOD & P ) :
+    m_f32Psi( P.m_f32Psi ),
+    m_f32Theta( P.m_f32Theta ),
+    m_f32Phi( P.m_f32Phi )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 EulerAngles::~EulerAngles()
 {
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+EulerAnglesPOD EulerAngles::ToPOD() const
+{
+    EulerAnglesPOD P;
+    P.m_f32Psi = m_f32Psi;
+    P.m_f32Theta = m_f32Theta;
+    P.m_f32Phi = m_f32Phi;
+    return P;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 void EulerAngles::SetPsiInRadians( KFLOAT32 Psi )
 {
     m_f32Psi = Psi;
@@ -168,11 +190,14 @@ KString EulerAngles::GetAsString() const
 
 void EulerAngles::Decode( KDataStream & stream ) throw( KException )
 {
-    if( stream.GetBufferSize() < EULER_ANGLES_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    FieldSchema::Decode( stream, *this );
+}
 
-    stream >> m_f32Psi
-           >> m_f32Theta
-           >> m_f32Phi;
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes EulerAngles::TryDecode( KDataStream & stream )
+{
+    return FieldSchema::TryDecode( stream, *this );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -190,19 +215,14 @@ KDataStream EulerAngles::Encode() const
 
 void EulerAngles::Encode( KDataStream & stream ) const
 {
-    stream << m_f32Psi
-           << m_f32Theta
-           << m_f32Phi;
+    FieldSchema::Encode( *this, stream );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 KBOOL EulerAngles::operator == ( const EulerAngles & Value ) const
 {
-    if( m_f32Psi    != Value.m_f32Psi )     return false;
-    if( m_f32Theta  != Value.m_f32Theta )   return false;
-    if( m_f32Phi    != Value.m_f32Phi )     return false;
-    return true;
+    return FieldSchema::Equal( *this, Value );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -39,6 +39,8 @@ http://p.sf.net/kdis/UserGuide
 #pragma once
 
 #include "./DataTypeBase.h"
+#include "./FieldSchema.h"
+#include "./PODTypes.h"
 
 namespace KDIS {
 namespace DATA_TYPE {
@@ -57,6 +59,11 @@ public:
 
     static const KUINT16 EULER_ANGLES_SIZE = 12;
 
+    // Layout of the record, used to encode, decode, compare and hash it.
+    typedef KFieldList< KField<EulerAngles, KFLOAT32, &EulerAngles::m_f32Psi>,
+                        KField<EulerAngles, KFLOAT32, &EulerAngles::m_f32Theta>,
+                        KField<EulerAngles, KFLOAT32, &EulerAngles::m_f32Phi> > FieldSchema;
+
     EulerAngles();
 
     // In Radians
@@ -64,8 +71,17 @@ public:
 
     EulerAngles( KDataStream & stream ) throw( KException );
 
+    EulerAngles( const EulerAnglesPOD & P );
+
     virtual ~EulerAngles();
 
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::EulerAngles::ToPOD
+    // Description: Returns a plain copy of the fields, see PODTypes.h.
+    //              Use the EulerAngles( const EulerAnglesPOD & ) constructor to convert back.
+    //************************************
+    EulerAnglesPOD ToPOD() const;
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::EulerAngles::SetPsi
     //              KDIS::DATA_TYPE::EulerAngles::GetPsi
@@ -107,10 +123,13 @@ public:
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::EulerAngles::Decode
+    //              KDIS::DATA_TYPE::EulerAngles::TryDecode
     // Description: Convert From Network Data.
+    //              TryDecode returns an error code instead of throwing.
     // Parameter:   KDataStream & stream
     //************************************
     virtual void Decode( KDataStream & stream ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream );
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::EulerAngles::Encode
@@ -163,6 +163,15 @@ public:
 	{
 		m_mDecoders.clear();
 	}
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::FactoryDecoderUser::HasFactoryDecoders
+    // Description: Returns true if any factory decoder is registered.
+    //************************************
+	static KBOOL HasFactoryDecoders()
+	{
+		return !m_mDecoders.empty();
+	}
 };
 
 // Init static map variable.
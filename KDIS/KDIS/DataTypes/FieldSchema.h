@@ -0,0 +1,379 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      KFieldList
+    created:    18/10/2026
+
+    purpose:    Compile time description of the fields of a fixed size record.
+                A record declares its layout once as a public FieldSchema typedef
+                and the schema provides the encoding, decoding, equality, hashing
+                and size of the record, e.g:
+
+                typedef KFieldList< KField<Vector, KFLOAT32, &Vector::m_f32X>,
+                                    KField<Vector, KFLOAT32, &Vector::m_f32Y>,
+                                    KField<Vector, KFLOAT32, &Vector::m_f32Z> > FieldSchema;
+
+                Fields are copied into a local buffer in machine byte order which is then
+                byte swapped in place and copied to/from the stream in a single operation,
+                the stream size is checked once. When every field of a list has the same
+                width (Vector, WorldCoordinates, EulerAngles, EntityIdentifier...) the whole
+                record is swapped as one run in a single loop, otherwise each field or
+                array is swapped as its own run.
+
+                KField           - A single primitive member.
+                KArrayField      - A fixed size array of primitives.
+                KRecordField     - A member that is itself a record with a FieldSchema.
+                KFieldList       - Up to 8 fields, a KFieldList can also be used as a field
+                                   which is how a derived record includes its base class.
+*********************************************************************/
+
+#pragma once
+
+#include "./../KDataStream.h"
+
+namespace KDIS {
+namespace DATA_TYPE {
+
+// Compile time check that a schema matches the documented size of a record.
+#define KDIS_CHECK_SCHEMA_SIZE( Class, Size ) \
+    typedef KUINT8 Class##_FieldSchemaSizeCheck[( Class::FieldSchema::SIZE == ( Size ) ) ? 1 : -1]
+
+// Element width of a field. Mixed when a list holds fields of different widths,
+// any for an unused slot which takes the width of its neighbours.
+enum KFieldWidth
+{
+    KFIELD_MIXED_WIDTH = 0,
+    KFIELD_ANY_WIDTH   = 0xFFFF
+};
+
+template<int A, int B>
+struct KCommonWidth
+{
+    enum
+    {
+        VALUE = ( A == KFIELD_ANY_WIDTH ) ? B :
+                ( B == KFIELD_ANY_WIDTH ) ? A :
+                ( A == B ) ? A : KFIELD_MIXED_WIDTH
+    };
+};
+
+//************************************
+// FullName:    KDIS::DATA_TYPE::KSwapRun
+// Description: Reverses the byte order of Count consecutive elements of Width octets in place.
+// Parameter:   KUOCTET * Buffer
+// Parameter:   KUINT16 Count
+//************************************
+template<int Width>
+inline void KSwapRun( KUOCTET * Buffer, KUINT16 Count )
+{
+    for( KUINT16 i = 0; i < Count; ++i, Buffer += Width )
+    {
+        for( int j = 0; j < Width / 2; ++j )
+        {
+            const KUOCTET o = Buffer[j];
+            Buffer[j] = Buffer[Width - 1 - j];
+            Buffer[Width - 1 - j] = o;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+template<class Owner, class Type, Type Owner::*Member>
+struct KField
+{
+    enum { SIZE = sizeof( Type ), WIDTH = sizeof( Type ) };
+
+    template<class Obj>
+    static void Write( const Obj & O, KUOCTET * Buffer )
+    {
+        memcpy( Buffer, &( static_cast<const Owner &>( O ).*Member ), SIZE );
+    }
+
+    template<class Obj>
+    static void Read( const KUOCTET * Buffer, Obj & O )
+    {
+        memcpy( &( static_cast<Owner &>( O ).*Member ), Buffer, SIZE );
+    }
+
+    static void Swap( KUOCTET * Buffer )
+    {
+        KSwapRun<WIDTH>( Buffer, 1 );
+    }
+
+    template<class Obj>
+    static KBOOL Equal( const Obj & A, const Obj & B )
+    {
+        return static_cast<const Owner &>( A ).*Member == static_cast<const Owner &>( B ).*Member;
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+template<class Owner, class Type, KUINT16 Count, Type ( Owner::*Member )[Count]>
+struct KArrayField
+{
+    enum { SIZE = sizeof( Type ) * Count, WIDTH = sizeof( Type ) };
+
+    template<class Obj>
+    static void Write( const Obj & O, KUOCTET * Buffer )
+    {
+        memcpy( Buffer, static_cast<const Owner &>( O ).*Member, SIZE );
+    }
+
+    template<class Obj>
+    static void Read( const KUOCTET * Buffer, Obj & O )
+    {
+        memcpy( static_cast<Owner &>( O ).*Member, Buffer, SIZE );
+    }
+
+    static void Swap( KUOCTET * Buffer )
+    {
+        KSwapRun<WIDTH>( Buffer, Count );
+    }
+
+    template<class Obj>
+    static KBOOL Equal( const Obj & A, const Obj & B )
+    {
+        const Type * pA = static_cast<const Owner &>( A ).*Member;
+        const Type * pB = static_cast<const Owner &>( B ).*Member;
+        for( KUINT16 i = 0; i < Count; ++i )
+        {
+            if( pA[i] != pB[i] )return false;
+        }
+        return true;
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+template<class Owner, class Type, Type Owner::*Member>
+struct KRecordField
+{
+    enum { SIZE = Type::FieldSchema::SIZE, WIDTH = Type::FieldSchema::WIDTH };
+
+    template<class Obj>
+    static void Write( const Obj & O, KUOCTET * Buffer )
+    {
+        Type::FieldSchema::Write( static_cast<const Owner &>( O ).*Member, Buffer );
+    }
+
+    template<class Obj>
+    static void Read( const KUOCTET * Buffer, Obj & O )
+    {
+        Type::FieldSchema::Read( Buffer, static_cast<Owner &>( O ).*Member );
+    }
+
+    static void Swap( KUOCTET * Buffer )
+    {
+        Type::FieldSchema::Swap( Buffer );
+    }
+
+    template<class Obj>
+    static KBOOL Equal( const Obj & A, const Obj & B )
+    {
+        return Type::FieldSchema::Equal( static_cast<const Owner &>( A ).*Member, static_cast<const Owner &>( B ).*Member );
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+// Placeholder for unused KFieldList slots.
+struct KNoField
+{
+    enum { SIZE = 0, WIDTH = KFIELD_ANY_WIDTH };
+
+    template<class Obj>
+    static void Write( const Obj &, KUOCTET * ){}
+
+    template<class Obj>
+    static void Read( const KUOCTET *, Obj & ){}
+
+    static void Swap( KUOCTET * ){}
+
+    template<class Obj>
+    static KBOOL Equal( const Obj &, const Obj & ){ return true; }
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+template<class F1,              class F2 = KNoField, class F3 = KNoField, class F4 = KNoField,
+         class F5 = KNoField,   class F6 = KNoField, class F7 = KNoField, class F8 = KNoField>
+struct KFieldList
+{
+    enum
+    {
+        OFFSET2 = F1::SIZE,
+        OFFSET3 = OFFSET2 + F2::SIZE,
+        OFFSET4 = OFFSET3 + F3::SIZE,
+        OFFSET5 = OFFSET4 + F4::SIZE,
+        OFFSET6 = OFFSET5 + F5::SIZE,
+        OFFSET7 = OFFSET6 + F6::SIZE,
+        OFFSET8 = OFFSET7 + F7::SIZE,
+        SIZE    = OFFSET8 + F8::SIZE
+    };
+
+    enum
+    {
+        WIDTH = KCommonWidth<KCommonWidth<KCommonWidth<F1::WIDTH, F2::WIDTH>::VALUE, KCommonWidth<F3::WIDTH, F4::WIDTH>::VALUE>::VALUE,
+                             KCommonWidth<KCommonWidth<F5::WIDTH, F6::WIDTH>::VALUE, KCommonWidth<F7::WIDTH, F8::WIDTH>::VALUE>::VALUE>::VALUE,
+
+        // Number of elements when the list is swapped as a single run.
+        RUN_COUNT = ( WIDTH == KFIELD_MIXED_WIDTH || WIDTH == KFIELD_ANY_WIDTH ) ? 0 : SIZE / ( WIDTH ? WIDTH : 1 )
+    };
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::KFieldList::Write
+    //              KDIS::DATA_TYPE::KFieldList::Read
+    // Description: Copy all fields to/from a buffer of at least SIZE octets in machine byte order.
+    // Parameter:   KUOCTET * Buffer
+    //************************************
+    template<class Obj>
+    static void Write( const Obj & O, KUOCTET * Buffer )
+    {
+        F1::Write( O, Buffer );
+        F2::Write( O, Buffer + OFFSET2 );
+        F3::Write( O, Buffer + OFFSET3 );
+        F4::Write( O, Buffer + OFFSET4 );
+        F5::Write( O, Buffer + OFFSET5 );
+        F6::Write( O, Buffer + OFFSET6 );
+        F7::Write( O, Buffer + OFFSET7 );
+        F8::Write( O, Buffer + OFFSET8 );
+    }
+
+    template<class Obj>
+    static void Read( const KUOCTET * Buffer, Obj & O )
+    {
+        F1::Read( Buffer, O );
+        F2::Read( Buffer + OFFSET2, O );
+        F3::Read( Buffer + OFFSET3, O );
+        F4::Read( Buffer + OFFSET4, O );
+        F5::Read( Buffer + OFFSET5, O );
+        F6::Read( Buffer + OFFSET6, O );
+        F7::Read( Buffer + OFFSET7, O );
+        F8::Read( Buffer + OFFSET8, O );
+    }
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::KFieldList::Swap
+    // Description: Reverse the byte order of every field of a buffer of SIZE octets in place.
+    //              A list whose fields share one width is swapped as a single run.
+    // Parameter:   KUOCTET * Buffer
+    //************************************
+    static void Swap( KUOCTET * Buffer )
+    {
+        if( RUN_COUNT )
+        {
+            KSwapRun<WIDTH>( Buffer, RUN_COUNT );
+            return;
+        }
+
+        F1::Swap( Buffer );
+        F2::Swap( Buffer + OFFSET2 );
+        F3::Swap( Buffer + OFFSET3 );
+        F4::Swap( Buffer + OFFSET4 );
+        F5::Swap( Buffer + OFFSET5 );
+        F6::Swap( Buffer + OFFSET6 );
+        F7::Swap( Buffer + OFFSET7 );
+        F8::Swap( Buffer + OFFSET8 );
+    }
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::KFieldList::Equal
+    // Description: Field by field comparison.
+    //************************************
+    template<class Obj>
+    static KBOOL Equal( const Obj & A, const Obj & B )
+    {
+        return F1::Equal( A, B ) && F2::Equal( A, B ) && F3::Equal( A, B ) && F4::Equal( A, B ) &&
+               F5::Equal( A, B ) && F6::Equal( A, B ) && F7::Equal( A, B ) && F8::Equal( A, B );
+    }
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::KFieldList::Encode
+    //              KDIS::DATA_TYPE::KFieldList::TryDecode
+    //              KDIS::DATA_TYPE::KFieldList::Decode
+    // Description: Convert To/From Network Data.
+    //              TryDecode returns NOT_ENOUGH_DATA_IN_BUFFER if the stream holds less than SIZE octets
+    //              and leaves the record and stream untouched, Decode throws the same error.
+    // Parameter:   KDataStream & stream
+    //************************************
+    template<class Obj>
+    static void Encode( const Obj & O, KDataStream & stream )
+    {
+        KUOCTET Buffer[SIZE];
+        Write( O, Buffer );
+        if( stream.GetMachineEndian() != stream.GetNetWorkEndian() )Swap( Buffer );
+        stream.Write( ( const KOCTET * )Buffer, SIZE );
+    }
+
+    template<class Obj>
+    static ErrorCodes TryDecode( KDataStream & stream, Obj & O )
+    {
+        if( stream.GetBufferSize() < SIZE )return NOT_ENOUGH_DATA_IN_BUFFER;
+
+        KUOCTET Buffer[SIZE];
+        stream.Read( ( KOCTET * )Buffer, SIZE );
+        if( stream.GetMachineEndian() != stream.GetNetWorkEndian() )Swap( Buffer );
+        Read( Buffer, O );
+        return NO_ERRORS;
+    }
+
+    template<class Obj>
+    static void Decode( KDataStream & stream, Obj & O ) throw( KException )
+    {
+        const ErrorCodes e = TryDecode( stream, O );
+        if( e != NO_ERRORS )throw KException( __FUNCTION__, e );
+    }
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::KFieldList::Hash
+    // Description: FNV-1a hash of the record in network byte order.
+    //************************************
+    template<class Obj>
+    static KUINT32 Hash( const Obj & O )
+    {
+        KUOCTET Buffer[SIZE];
+        Write( O, Buffer );
+        if( !KDIS::UTILS::IsMachineBigEndian() )Swap( Buffer );
+
+        KUINT32 ui32Hash = 2166136261u;
+        for( KUINT16 i = 0; i < SIZE; ++i )
+        {
+            ui32Hash = ( ui32Hash ^ Buffer[i] ) * 16777619u;
+        }
+        return ui32Hash;
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+} // END namespace DATA_TYPE
+} // END namespace KDIS
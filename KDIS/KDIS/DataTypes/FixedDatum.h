@@ -62,7 +62,7 @@ class FixedDatum;
 typedef KDIS::UTILS::KRef_Ptr<FixedDatum> FixDtmPtr; // Ref counter
 //typedef FixedDatum* FixDtmPtr; // Weak ref
 
-class KDIS_EXPORT FixedDatum : public DataTypeBase, public FactoryDecoderUser<FixedDatum>
+class KDIS_EXPORT FixedDatum : public DataTypeBase, public FactoryDecoderUser<FixedDatum>, public KDIS::UTILS::KRef_Counted
 {
 protected:
 
@@ -52,11 +52,12 @@ http://p.sf.net/kdis/UserGuide
 #pragma once
 
 #include "./DataTypeBase.h"
+#include "./../Extras/KRef_Ptr.h"
 
 namespace KDIS {
 namespace DATA_TYPE {
 
-class KDIS_EXPORT GED : public DataTypeBase
+class KDIS_EXPORT GED : public DataTypeBase, public KDIS::UTILS::KRef_Counted
 {
 public:
 
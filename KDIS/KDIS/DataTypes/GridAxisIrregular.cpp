@@ -160,6 +160,17 @@ void GridAxisIrregular::SetXiValues( const std::vector<KUINT16> & Xi )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void GridAxisIrregular::SetXiValues( std::vector<KUINT16> && Xi )
+{
+    m_vXiValues = std::move( Xi );
+    m_ui16NumPoints = m_vXiValues.size();
+    calculatePadding();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const std::vector<KUINT16> & GridAxisIrregular::GetXiValues() const
 {
     return m_vXiValues;
@@ -81,6 +81,8 @@ public:
 
     virtual ~GridAxisIrregular();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( GridAxisIrregular )
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::GridAxisIrregular::SetCoordinateScaleXi
     //              KDIS::DATA_TYPE::GridAxisIrregular::GetCoordinateScaleXi
@@ -115,6 +117,9 @@ public:
     //************************************
     void AddXiValue( KUINT16 Xi );
     void SetXiValues( const std::vector<KUINT16> & Xi );
+    #ifdef KDIS_USE_CPP11
+    void SetXiValues( std::vector<KUINT16> && Xi );
+    #endif
     const std::vector<KUINT16> & GetXiValues() const;
     void ClearXiValues();
 
@@ -54,11 +54,12 @@ http://p.sf.net/kdis/UserGuide
 #pragma once
 
 #include "./DataTypeBase.h"
+#include "./../Extras/KRef_Ptr.h"
 
 namespace KDIS {
 namespace DATA_TYPE {
 
-class KDIS_EXPORT GridAxisRegular : public DataTypeBase
+class KDIS_EXPORT GridAxisRegular : public DataTypeBase, public KDIS::UTILS::KRef_Counted
 {
 protected:
 
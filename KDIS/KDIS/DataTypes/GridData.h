@@ -41,11 +41,12 @@ http://p.sf.net/kdis/UserGuide
 #pragma once
 
 #include "./DataTypeBase.h"
+#include "./../Extras/KRef_Ptr.h"
 
 namespace KDIS {
 namespace DATA_TYPE {
 
-class KDIS_EXPORT GridData : public DataTypeBase
+class KDIS_EXPORT GridData : public DataTypeBase, public KDIS::UTILS::KRef_Counted
 {
 protected:
 
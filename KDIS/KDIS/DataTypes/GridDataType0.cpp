@@ -133,6 +133,16 @@ void GridDataType0::SetDataValues( const std::vector<KUINT8> & DV )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void GridDataType0::SetDataValues( std::vector<KUINT8> && DV )
+{
+    m_vui8DataVals = std::move( DV );
+    m_ui16NumBytes = m_vui8DataVals.size();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const std::vector<KUINT8> & GridDataType0::GetDataValues() const
 {
     return m_vui8DataVals;
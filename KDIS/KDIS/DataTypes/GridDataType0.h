@@ -78,6 +78,8 @@ public:
 
     virtual ~GridDataType0();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( GridDataType0 )
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::GridDataType0::Encode
     // Description: The number of bytes of environmental state variable data
@@ -100,6 +102,9 @@ public:
     void AddDataValue( KUINT8 D );
     void SetDataValues( KUINT8 * Data, KUINT16 NumBytes );
     void SetDataValues( const std::vector<KUINT8> & DV );
+    #ifdef KDIS_USE_CPP11
+    void SetDataValues( std::vector<KUINT8> && DV );
+    #endif
     const std::vector<KUINT8> & GetDataValues() const;
     void ClearValues();
 
@@ -164,6 +164,16 @@ void GridDataType1::SetValues( const std::vector<KUINT16> & V )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void GridDataType1::SetValues( std::vector<KUINT16> && V )
+{
+    m_vui16Values = std::move( V );
+    m_ui16NumValues = m_vui16Values.size();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const std::vector<KUINT16> & GridDataType1::GetValues() const
 {
     return m_vui16Values;
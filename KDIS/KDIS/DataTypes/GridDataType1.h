@@ -79,6 +79,8 @@ public:
 
     virtual ~GridDataType1();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( GridDataType1 )
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::GridDataType1::SetFieldScale
     //              KDIS::DATA_TYPE::GridDataType1::GetFieldScale
@@ -116,6 +118,9 @@ public:
     //************************************
     void AddValue( KUINT16 V );
     void SetValues( const std::vector<KUINT16> & V );
+    #ifdef KDIS_USE_CPP11
+    void SetValues( std::vector<KUINT16> && V );
+    #endif
     const std::vector<KUINT16> & GetValues() const;
     void ClearValues();
 
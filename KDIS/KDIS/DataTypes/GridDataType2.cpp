@@ -118,6 +118,16 @@ void GridDataType2::SetValues( const std::vector<KFLOAT32> & V )
     m_ui16NumValues = m_vf32Values.size();
 }
 
+//////////////////////////////////////////////////////////////////////////
+
+#ifdef KDIS_USE_CPP11
+void GridDataType2::SetValues( std::vector<KFLOAT32> && V )
+{
+    m_vf32Values = std::move( V );
+    m_ui16NumValues = m_vf32Values.size();
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 
 const std::vector<KFLOAT32> & GridDataType2::GetValues() const
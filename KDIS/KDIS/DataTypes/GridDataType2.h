@@ -73,6 +73,8 @@ public:
 
     virtual ~GridDataType2();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( GridDataType2 )
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::GridDataType2::SetFieldOffset
     //              KDIS::DATA_TYPE::GridDataType2::GetFieldOffset
@@ -90,6 +92,9 @@ public:
     //************************************
     void AddValue( KFLOAT32 V );
     void SetValues( const std::vector<KFLOAT32> & V );
+    #ifdef KDIS_USE_CPP11
+    void SetValues( std::vector<KFLOAT32> && V );
+    #endif
     const std::vector<KFLOAT32> & GetValues() const;
     void ClearValues();
 
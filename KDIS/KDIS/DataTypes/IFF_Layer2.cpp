@@ -140,6 +140,17 @@ void IFF_Layer2::SetFundamentalParameterData( const vector<IFF_ATC_NAVAIDS_Funda
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void IFF_Layer2::SetFundamentalParameterData( vector<IFF_ATC_NAVAIDS_FundamentalParameterData> && FPD )
+{
+    m_vFPD = std::move( FPD );
+    m_ui16LayerLength = IFF_LAYER2_SIZE + ( m_vFPD.size() * IFF_ATC_NAVAIDS_FundamentalParameterData::IFF_ATC_NAVAIDS_FUNDAMENTAL_PARAMETER_SIZE );
+    m_SOD.SetNumberOfFundamentalParamSets( m_vFPD.size() );
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<IFF_ATC_NAVAIDS_FundamentalParameterData> & IFF_Layer2::GetFundamentalParameterData() const
 {
     return m_vFPD;
@@ -73,6 +73,8 @@ public:
 
     virtual ~IFF_Layer2();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( IFF_Layer2 )
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::IFF_Layer2::SetBeamData
     //              KDIS::DATA_TYPE::IFF_Layer2::GetBeamData
@@ -109,6 +111,9 @@ public:
     //************************************
     void AddFundamentalParameterData( const KDIS::DATA_TYPE::IFF_ATC_NAVAIDS_FundamentalParameterData & FPD );
 	void SetFundamentalParameterData( const std::vector<KDIS::DATA_TYPE::IFF_ATC_NAVAIDS_FundamentalParameterData> & FPD );
+	#ifdef KDIS_USE_CPP11
+	void SetFundamentalParameterData( std::vector<KDIS::DATA_TYPE::IFF_ATC_NAVAIDS_FundamentalParameterData> && FPD );
+	#endif
 	const std::vector<KDIS::DATA_TYPE::IFF_ATC_NAVAIDS_FundamentalParameterData> & GetFundamentalParameterData() const;
 
     //************************************
@@ -113,6 +113,28 @@ void IFF_Layer3::SetDataRecords( const std::vector<StdVarPtr> & DRS )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void IFF_Layer3::SetDataRecords( std::vector<StdVarPtr> && DRS )
+{
+	m_vStdVarRecs = std::move( DRS );
+
+    // Reset the PDU length.
+	m_ui16LayerLength = IFF_LAYER3_SIZE;
+
+    // Calculate the new length.
+    vector<StdVarPtr>::const_iterator citr = m_vStdVarRecs.begin();
+    vector<StdVarPtr>::const_iterator citrEnd = m_vStdVarRecs.end();
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui16LayerLength += ( *citr )->GetRecordLength();
+    }
+
+    m_ui16NumIffRecs = m_vStdVarRecs.size();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const std::vector<StdVarPtr> & IFF_Layer3::GetDataRecords() const
 {
 	return m_vStdVarRecs;
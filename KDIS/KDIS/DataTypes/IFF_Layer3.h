@@ -73,6 +73,8 @@ public:
 
     virtual ~IFF_Layer3();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( IFF_Layer3 )
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::IFF_Layer3::SetReportingSimulation
     //              KDIS::DATA_TYPE::IFF_Layer3::GetReportingSimulation
@@ -103,6 +105,9 @@ public:
     //************************************
     void AddDataRecord( StdVarPtr DR );
 	void SetDataRecords( const std::vector<StdVarPtr> & DRS );
+	#ifdef KDIS_USE_CPP11
+	void SetDataRecords( std::vector<StdVarPtr> && DRS );
+	#endif
 	const std::vector<StdVarPtr> & GetDataRecords() const;
     void ClearDataRecords();
 
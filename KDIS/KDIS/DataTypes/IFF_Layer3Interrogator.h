@@ -65,6 +65,8 @@ public:
     IFF_Layer3Interrogator( const LayerHeader & H, KDataStream & stream ) throw( KException );
 
     virtual ~IFF_Layer3Interrogator();
+
+    KDIS_DEFAULT_COPY_AND_MOVE( IFF_Layer3Interrogator )
 	
     //************************************
     // FullName:    KDIS::DATA_TYPE::IFF_Layer3Interrogator::SetBasicData
@@ -66,6 +66,8 @@ public:
 
     virtual ~IFF_Layer3Transponder();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( IFF_Layer3Transponder )
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::IFF_Layer3Transponder::SetBasicData
     //              KDIS::DATA_TYPE::IFF_Layer3Transponder::GetBasicData
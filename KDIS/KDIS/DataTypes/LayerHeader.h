@@ -56,7 +56,7 @@ class LayerHeader;
 typedef KDIS::UTILS::KRef_Ptr<LayerHeader> LyrHdrPtr; // Ref counter
 //typedef VaLayerHeaderLyrHdrPtr; // Weak ref	
 
-class KDIS_EXPORT LayerHeader : public DataTypeBase
+class KDIS_EXPORT LayerHeader : public DataTypeBase, public KDIS::UTILS::KRef_Counted
 {
 protected:
 
@@ -248,6 +248,16 @@ void Mine::SetScalarDetectionCoefficientValues( const vector<KUINT8> & SDC )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Mine::SetScalarDetectionCoefficientValues( vector<KUINT8> && SDC )
+{
+    SetScalarDetectionCoefficient( true );
+    m_vui8SDC = std::move( SDC );
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<KUINT8> & Mine::GetScalarDetectionCoefficientValues() const
 {
     return m_vui8SDC;
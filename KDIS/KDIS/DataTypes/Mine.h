@@ -108,6 +108,8 @@ public:
 
     virtual ~Mine();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Mine )
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::Mine::SetLocation
     //              KDIS::DATA_TYPE::Mine::GetLocation
@@ -298,6 +300,9 @@ public:
     //************************************
     void AddScalarDetectionCoefficientValue( KUINT8 SDC );
     void SetScalarDetectionCoefficientValues( const std::vector<KUINT8> & SDC );
+    #ifdef KDIS_USE_CPP11
+    void SetScalarDetectionCoefficientValues( std::vector<KUINT8> && SDC );
+    #endif
     const std::vector<KUINT8> & GetScalarDetectionCoefficientValues() const;
     std::vector<KUINT8> & GetScalarDetectionCoefficientValues();
     void ClearScalarDetectionCoefficientValues();
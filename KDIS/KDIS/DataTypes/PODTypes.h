@@ -0,0 +1,163 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    file:       PODTypes.h
+    created:    18/10/2026
+
+    purpose:    Plain mirror structs of the core fixed size DataTypes.
+                The DataType classes derive from DataTypeBase and carry a vtable,
+                these structs hold the same fields with no virtuals so they are
+                trivially copyable and standard layout. They can be stored in dense
+                arrays, copied with memcpy, loaded with SIMD or placed in shared memory.
+                Each DataType converts to and from its mirror with plain field copies,
+                e.g Vector( const VectorPOD & ) and Vector::ToPOD().
+
+                Fields are stored in machine byte order, the FieldSchema of each
+                struct encodes/decodes it exactly as its DataType counterpart.
+*********************************************************************/
+
+#pragma once
+
+#include "./FieldSchema.h"
+
+namespace KDIS {
+namespace DATA_TYPE {
+
+struct SimulationIdentifierPOD
+{
+    KUINT16 m_ui16SiteID;
+    KUINT16 m_ui16ApplicationID;
+
+    typedef KFieldList< KField<SimulationIdentifierPOD, KUINT16, &SimulationIdentifierPOD::m_ui16SiteID>,
+                        KField<SimulationIdentifierPOD, KUINT16, &SimulationIdentifierPOD::m_ui16ApplicationID> > FieldSchema;
+};
+
+struct EntityIdentifierPOD
+{
+    KUINT16 m_ui16SiteID;
+    KUINT16 m_ui16ApplicationID;
+    KUINT16 m_ui16EntityID;
+
+    typedef KFieldList< KField<EntityIdentifierPOD, KUINT16, &EntityIdentifierPOD::m_ui16SiteID>,
+                        KField<EntityIdentifierPOD, KUINT16, &EntityIdentifierPOD::m_ui16ApplicationID>,
+                        KField<EntityIdentifierPOD, KUINT16, &EntityIdentifierPOD::m_ui16EntityID> > FieldSchema;
+};
+
+struct EntityTypePOD
+{
+    KUINT8 m_ui8EntityKind;
+    KUINT8 m_ui8Domain;
+    KUINT16 m_ui16Country;
+    KUINT8 m_ui8Category;
+    KUINT8 m_ui8SubCategory;
+    KUINT8 m_ui8Specific;
+    KUINT8 m_ui8Extra;
+
+    typedef KFieldList< KField<EntityTypePOD, KUINT8, &EntityTypePOD::m_ui8EntityKind>,
+                        KField<EntityTypePOD, KUINT8, &EntityTypePOD::m_ui8Domain>,
+                        KField<EntityTypePOD, KUINT16, &EntityTypePOD::m_ui16Country>,
+                        KField<EntityTypePOD, KUINT8, &EntityTypePOD::m_ui8Category>,
+                        KField<EntityTypePOD, KUINT8, &EntityTypePOD::m_ui8SubCategory>,
+                        KField<EntityTypePOD, KUINT8, &EntityTypePOD::m_ui8Specific>,
+                        KField<EntityTypePOD, KUINT8, &EntityTypePOD::m_ui8Extra> > FieldSchema;
+};
+
+struct VectorPOD
+{
+    KFLOAT32 m_f32X;
+    KFLOAT32 m_f32Y;
+    KFLOAT32 m_f32Z;
+
+    typedef KFieldList< KField<VectorPOD, KFLOAT32, &VectorPOD::m_f32X>,
+                        KField<VectorPOD, KFLOAT32, &VectorPOD::m_f32Y>,
+                        KField<VectorPOD, KFLOAT32, &VectorPOD::m_f32Z> > FieldSchema;
+};
+
+struct WorldCoordinatesPOD
+{
+    KFLOAT64 m_f64X;
+    KFLOAT64 m_f64Y;
+    KFLOAT64 m_f64Z;
+
+    typedef KFieldList< KField<WorldCoordinatesPOD, KFLOAT64, &WorldCoordinatesPOD::m_f64X>,
+                        KField<WorldCoordinatesPOD, KFLOAT64, &WorldCoordinatesPOD::m_f64Y>,
+                        KField<WorldCoordinatesPOD, KFLOAT64, &WorldCoordinatesPOD::m_f64Z> > FieldSchema;
+};
+
+struct EulerAnglesPOD
+{
+    KFLOAT32 m_f32Psi;
+    KFLOAT32 m_f32Theta;
+    KFLOAT32 m_f32Phi;
+
+    typedef KFieldList< KField<EulerAnglesPOD, KFLOAT32, &EulerAnglesPOD::m_f32Psi>,
+                        KField<EulerAnglesPOD, KFLOAT32, &EulerAnglesPOD::m_f32Theta>,
+                        KField<EulerAnglesPOD, KFLOAT32, &EulerAnglesPOD::m_f32Phi> > FieldSchema;
+};
+
+struct ClockTimePOD
+{
+    KINT32 m_i32Hour;
+    KUINT32 m_ui32TimePastHour;
+
+    typedef KFieldList< KField<ClockTimePOD, KINT32, &ClockTimePOD::m_i32Hour>,
+                        KField<ClockTimePOD, KUINT32, &ClockTimePOD::m_ui32TimePastHour> > FieldSchema;
+};
+
+struct DeadReckoningParameterPOD
+{
+    KUINT8 m_ui8DeadRecknoningAlgorithm;
+    KOCTET m_OtherParams[15];
+    VectorPOD m_LinearAcceleration;
+    VectorPOD m_AngularVelocity;
+
+    typedef KFieldList< KField<DeadReckoningParameterPOD, KUINT8, &DeadReckoningParameterPOD::m_ui8DeadRecknoningAlgorithm>,
+                        KArrayField<DeadReckoningParameterPOD, KOCTET, 15, &DeadReckoningParameterPOD::m_OtherParams>,
+                        KRecordField<DeadReckoningParameterPOD, VectorPOD, &DeadReckoningParameterPOD::m_LinearAcceleration>,
+                        KRecordField<DeadReckoningParameterPOD, VectorPOD, &DeadReckoningParameterPOD::m_AngularVelocity> > FieldSchema;
+};
+
+// The mirrors have no padding, in memory they are the same size as on the wire.
+#define KDIS_CHECK_POD_SIZE( Type, Size ) \
+    typedef KUINT8 Type##_PODSizeCheck[( sizeof( Type ) == ( Size ) && Type::FieldSchema::SIZE == ( Size ) ) ? 1 : -1]
+
+KDIS_CHECK_POD_SIZE( SimulationIdentifierPOD, 4 );
+KDIS_CHECK_POD_SIZE( EntityIdentifierPOD, 6 );
+KDIS_CHECK_POD_SIZE( EntityTypePOD, 8 );
+KDIS_CHECK_POD_SIZE( VectorPOD, 12 );
+KDIS_CHECK_POD_SIZE( WorldCoordinatesPOD, 24 );
+KDIS_CHECK_POD_SIZE( EulerAnglesPOD, 12 );
+KDIS_CHECK_POD_SIZE( ClockTimePOD, 8 );
+KDIS_CHECK_POD_SIZE( DeadReckoningParameterPOD, 40 );
+
+#undef KDIS_CHECK_POD_SIZE
+
+} // END namespace DATA_TYPE
+} // END namespace KDIS
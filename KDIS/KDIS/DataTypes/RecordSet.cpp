@@ -144,6 +144,29 @@ void RecordSet::SetRecordValues( const vector<KUINT8> & RV, KUINT16 RecCnt )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void RecordSet::SetRecordValues( vector<KUINT8> && RV, KUINT16 RecCnt )
+{
+    m_ui16RecCnt = RecCnt;
+    m_vui8RecVals = std::move( RV );
+
+    // Calculate padding to a 32 bit boundary.
+    KUINT8 ui8NumPadding = m_ui16RecLen % 4;
+
+    // Add the padding
+    KUINT8 ui8Pad = 0;
+
+    for( KUINT8 i = 0; i < ui8NumPadding; ++i )
+    {
+        m_vui8RecVals.push_back( ui8Pad );
+    }
+
+    m_ui16RecLen += RECORD_SET_SIZE + m_vui8RecVals.size();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<KUINT8> & RecordSet::GetRecordValues() const
 {
     return m_vui8RecVals;
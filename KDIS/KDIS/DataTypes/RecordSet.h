@@ -71,6 +71,8 @@ public:
 
     virtual ~RecordSet();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( RecordSet )
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::RecordSet::SetRecordID
     //              KDIS::DATA_TYPE::RecordSet::GetRecordID
@@ -116,6 +118,9 @@ public:
     // Parameter:   KUINT16 RecNt - Number of bits used by the record.
     //************************************
 	void SetRecordValues( const std::vector<KUINT8> & RV, KUINT16 RecCnt );
+	#ifdef KDIS_USE_CPP11
+	void SetRecordValues( std::vector<KUINT8> && RV, KUINT16 RecCnt );
+	#endif
 	const std::vector<KUINT8> & GetRecordValues() const;
     void ClearRecordValues();
 
@@ -124,6 +124,18 @@ void SilentEntitySystem::SetEntityAppearanceList( const vector<EntityAppearance>
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void SilentEntitySystem::SetEntityAppearanceList( vector<EntityAppearance> && EA ) throw( KException )
+{
+    if( EA.size() >= m_ui16NumEnts )throw KException( __FUNCTION__, OUT_OF_BOUNDS );
+
+    m_vEA = std::move( EA );
+    m_ui16NumOfAppearanceRecords = m_vEA.size();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<EntityAppearance> & SilentEntitySystem::GetEntityAppearanceList() const
 {
     return m_vEA;
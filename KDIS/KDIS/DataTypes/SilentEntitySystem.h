@@ -69,6 +69,8 @@ public:
 
     virtual ~SilentEntitySystem();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( SilentEntitySystem )
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::SilentEntitySystem::SetNumberOfEntities
     //              KDIS::DATA_TYPE::SilentEntitySystem::GetNumberOfEntities
@@ -103,6 +105,9 @@ public:
     //************************************
     void AddEntityAppearance( const EntityAppearance & EA ) throw( KException );
     void SetEntityAppearanceList( const std::vector<EntityAppearance> & EA ) throw( KException );
+    #ifdef KDIS_USE_CPP11
+    void SetEntityAppearanceList( std::vector<EntityAppearance> && EA ) throw( KException );
+    #endif
     const std::vector<EntityAppearance> & GetEntityAppearanceList() const;
     void ClearEntityAppearanceList();
 
@@ -32,6 +32,8 @@ http://p.sf.net/kdis/UserGuide
 using namespace KDIS;
 using namespace DATA_TYPE;
 
+KDIS_CHECK_SCHEMA_SIZE( SimulationIdentifier, SimulationIdentifier::SIMULATION_IDENTIFIER_SIZE );
+
 //////////////////////////////////////////////////////////////////////////
 // Public:
 //////////////////////////////////////////////////////////////////////////
@@ -59,12 +61,30 @@ SimulationIdentifier::SimulationIdentifier( KUINT16 SiteID, KUINT16 ApplicatonID
 
 //////////////////////////////////////////////////////////////////////////
 
+SimulationIdentifier::SimulationIdentifier( const SimulationIdentifierPOD & P ) :
+    m_ui16SiteID( P.m_ui16SiteID ),
+    m_ui16ApplicationID( P.m_ui16ApplicationID )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 SimulationIdentifier::~SimulationIdentifier()
 {
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+SimulationIdentifierPOD SimulationIdentifier::ToPOD() const
+{
+    SimulationIdentifierPOD P;
+    P.m_ui16SiteID = m_ui16SiteID;
+    P.m_ui16ApplicationID = m_ui16ApplicationID;
+    return P;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 void SimulationIdentifier::SetSiteID( KUINT16 ID )
 {
     m_ui16SiteID = ID;
@@ -107,10 +127,14 @@ KString SimulationIdentifier::GetAsString() const
 
 void SimulationIdentifier::Decode( KDataStream & stream ) throw( KException )
 {
-    if( stream.GetBufferSize() < SIMULATION_IDENTIFIER_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    FieldSchema::Decode( stream, *this );
+}
 
-    stream >> m_ui16SiteID
-           >> m_ui16ApplicationID;
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes SimulationIdentifier::TryDecode( KDataStream & stream )
+{
+    return FieldSchema::TryDecode( stream, *this );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -128,17 +152,14 @@ KDataStream SimulationIdentifier::Encode() const
 
 void SimulationIdentifier::Encode( KDataStream & stream ) const
 {
-    stream << m_ui16SiteID
-           << m_ui16ApplicationID;
+    FieldSchema::Encode( *this, stream );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 KBOOL SimulationIdentifier::operator == ( const SimulationIdentifier & Value ) const
 {
-    if( m_ui16SiteID        != Value.m_ui16SiteID )         return false;
-    if( m_ui16ApplicationID != Value.m_ui16ApplicationID )  return false;
-    return true;
+    return FieldSchema::Equal( *this, Value );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -44,6 +44,8 @@ http://p.sf.net/kdis/UserGuide
 #pragma once
 
 #include "./DataTypeBase.h"
+#include "./FieldSchema.h"
+#include "./PODTypes.h"
 
 namespace KDIS {
 namespace DATA_TYPE {
@@ -60,14 +62,27 @@ public:
 
     static const KUINT16 SIMULATION_IDENTIFIER_SIZE = 4;
 
+    // Layout of the record, used to encode, decode, compare and hash it.
+    typedef KFieldList< KField<SimulationIdentifier, KUINT16, &SimulationIdentifier::m_ui16SiteID>,
+                        KField<SimulationIdentifier, KUINT16, &SimulationIdentifier::m_ui16ApplicationID> > FieldSchema;
+
     SimulationIdentifier();
 
     SimulationIdentifier( KUINT16 SiteID, KUINT16 ApplicatonID );
 
     SimulationIdentifier( KDataStream & stream ) throw( KException );
 
+    SimulationIdentifier( const SimulationIdentifierPOD & P );
+
     virtual ~SimulationIdentifier();
 
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::SimulationIdentifier::ToPOD
+    // Description: Returns a plain copy of the fields, see PODTypes.h.
+    //              Use the SimulationIdentifier( const SimulationIdentifierPOD & ) constructor to convert back.
+    //************************************
+    SimulationIdentifierPOD ToPOD() const;
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::SimulationIdentifier::SetSiteID
     //              KDIS::DATA_TYPE::SimulationIdentifier::GetSiteID
@@ -109,10 +124,13 @@ public:
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::SimulationIdentifier::Decode
+    //              KDIS::DATA_TYPE::SimulationIdentifier::TryDecode
     // Description: Convert From Network Data.
+    //              TryDecode returns an error code instead of throwing.
     // Parameter:   KDataStream & stream
     //************************************
     virtual void Decode( KDataStream & stream ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream );
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::SimulationIdentifier::Encode
@@ -59,7 +59,7 @@ class StandardVariable;
 typedef KDIS::UTILS::KRef_Ptr<StandardVariable> StdVarPtr; // Ref counter
 //typedef StandardVariable* StdVarPtr; // Weak ref
 
-class KDIS_EXPORT StandardVariable : public DataTypeBase, public FactoryDecoderUser<StandardVariable>
+class KDIS_EXPORT StandardVariable : public DataTypeBase, public FactoryDecoderUser<StandardVariable>, public KDIS::UTILS::KRef_Counted
 {
 protected:
 
@@ -33,6 +33,8 @@ using namespace KDIS;
 using namespace DATA_TYPE;
 using namespace ENUMS;
 
+KDIS_CHECK_SCHEMA_SIZE( Supplies, Supplies::SUPPLIES_SIZE );
+
 //////////////////////////////////////////////////////////////////////////
 // Public:
 //////////////////////////////////////////////////////////////////////////
@@ -103,10 +105,14 @@ KString Supplies::GetAsString() const
 
 void Supplies::Decode( KDataStream & stream ) throw( KException )
 {
-    if( stream.GetBufferSize() < SUPPLIES_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    FieldSchema::Decode( stream, *this );
+}
 
-    EntityType::Decode( stream );
-    stream >> m_f32Quantity;
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes Supplies::TryDecode( KDataStream & stream )
+{
+    return FieldSchema::TryDecode( stream, *this );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -124,17 +130,14 @@ KDataStream Supplies::Encode() const
 
 void Supplies::Encode( KDataStream & stream ) const
 {
-    EntityType::Encode( stream );
-    stream << m_f32Quantity;
+    FieldSchema::Encode( *this, stream );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 KBOOL Supplies::operator == ( const Supplies & Value ) const
 {
-    if( EntityType::operator !=( Value ) )            return false;
-    if( m_f32Quantity        != Value.m_f32Quantity ) return false;
-    return true;
+    return FieldSchema::Equal( *this, Value );
 }
 
 //////////////////////////////////////////////////////////////////////////
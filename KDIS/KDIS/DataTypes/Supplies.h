@@ -53,6 +53,10 @@ public:
 
     static const KUINT16 SUPPLIES_SIZE = 12;
 
+    // Layout of the record, used to encode, decode, compare and hash it.
+    typedef KFieldList< EntityType::FieldSchema,
+                        KField<Supplies, KFLOAT32, &Supplies::m_f32Quantity> > FieldSchema;
+
     Supplies();
 
     Supplies( KDIS::DATA_TYPE::ENUMS::EntityKind Kind, KUINT8 Domain, KDIS::DATA_TYPE::ENUMS::Country Country, 
@@ -80,11 +84,14 @@ public:
     virtual KString GetAsString() const;
 
     //************************************
-    // FullName:    KDIS::DATA_TYPE::DataTypeBase::Decode
+    // FullName:    KDIS::DATA_TYPE::Supplies::Decode
+    //              KDIS::DATA_TYPE::Supplies::TryDecode
     // Description: Convert From Network Data.
+    //              TryDecode returns an error code instead of throwing.
     // Parameter:   KDataStream & stream
     //************************************
     virtual void Decode( KDataStream & stream ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream );
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::Supplies::Encode
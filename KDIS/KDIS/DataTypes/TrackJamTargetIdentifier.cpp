@@ -32,6 +32,8 @@ http://p.sf.net/kdis/UserGuide
 using namespace KDIS;
 using namespace DATA_TYPE;
 
+KDIS_CHECK_SCHEMA_SIZE( TrackJamTargetIdentifier, TrackJamTargetIdentifier::TRACK_JAM_TARGET_SIZE );
+
 //////////////////////////////////////////////////////////////////////////
 // Public:
 //////////////////////////////////////////////////////////////////////////
@@ -121,13 +123,14 @@ KString TrackJamTargetIdentifier::GetAsString() const
 
 void TrackJamTargetIdentifier::Decode( KDataStream & stream ) throw( KException )
 {
-    if( stream.GetBufferSize() < TRACK_JAM_TARGET_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    FieldSchema::Decode( stream, *this );
+}
 
-    stream >> m_ui16SiteID
-           >> m_ui16ApplicationID
-           >> m_ui16EntityID
-           >> m_ui8EmitterID
-           >> m_ui8BeamID;
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes TrackJamTargetIdentifier::TryDecode( KDataStream & stream )
+{
+    return FieldSchema::TryDecode( stream, *this );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -145,23 +148,14 @@ KDataStream TrackJamTargetIdentifier::Encode() const
 
 void TrackJamTargetIdentifier::Encode( KDataStream & stream ) const
 {
-    stream << m_ui16SiteID
-           << m_ui16ApplicationID
-           << m_ui16EntityID
-           << m_ui8EmitterID
-           << m_ui8BeamID;
+    FieldSchema::Encode( *this, stream );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 KBOOL TrackJamTargetIdentifier::operator == ( const TrackJamTargetIdentifier & Value ) const
 {
-    if( m_ui16SiteID        != Value.m_ui16SiteID )         return false;
-    if( m_ui16ApplicationID != Value.m_ui16ApplicationID )  return false;
-    if( m_ui16EntityID      != Value.m_ui16EntityID )       return false;
-    if( m_ui8EmitterID      != Value.m_ui8EmitterID )       return false;
-    if( m_ui8BeamID         != Value.m_ui8BeamID )          return false;
-    return true;
+    return FieldSchema::Equal( *this, Value );
 }
 
 //////////////////////////////////////////////////////////////////////////
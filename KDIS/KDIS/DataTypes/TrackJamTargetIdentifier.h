@@ -57,6 +57,11 @@ public:
 
     static const KUINT16 TRACK_JAM_TARGET_SIZE = 8; // Min Size
 
+    // Layout of the record, used to encode, decode, compare and hash it.
+    typedef KFieldList< EntityIdentifier::FieldSchema,
+                        KField<TrackJamTargetIdentifier, KUINT8, &TrackJamTargetIdentifier::m_ui8EmitterID>,
+                        KField<TrackJamTargetIdentifier, KUINT8, &TrackJamTargetIdentifier::m_ui8BeamID> > FieldSchema;
+
     TrackJamTargetIdentifier();
 
     TrackJamTargetIdentifier( KDataStream & stream )throw( KException );
@@ -98,10 +103,13 @@ public:
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::TrackJamTargetIdentifier::Decode
+    //              KDIS::DATA_TYPE::TrackJamTargetIdentifier::TryDecode
     // Description: Convert From Network Data.
+    //              TryDecode returns an error code instead of throwing.
     // Parameter:   KDataStream & stream
     //************************************
     virtual void Decode( KDataStream & stream ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream );
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::TrackJamTargetIdentifier::Encode
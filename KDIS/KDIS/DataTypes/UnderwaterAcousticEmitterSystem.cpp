@@ -137,6 +137,18 @@ void UnderwaterAcousticEmitterSystem::SetUnderwaterAcousticEmitterBeams( const v
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void UnderwaterAcousticEmitterSystem::SetUnderwaterAcousticEmitterBeams( vector<UnderwaterAcousticEmitterBeam> && UAEB )
+{
+    m_ui8EmitterSystemDataLength = UNDERWATER_ACOUSTIC_EMITTER_SYSTEM_SIZE / 4;
+    m_vUAEB = std::move( UAEB );
+    m_ui8NumBeams = m_vUAEB.size();
+    m_ui8EmitterSystemDataLength += ( m_vUAEB.size() * UnderwaterAcousticEmitterBeam::UNDERWATER_ACOUSTIC_EMITTER_BEAM_SIZE ) / 4;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<UnderwaterAcousticEmitterBeam> & UnderwaterAcousticEmitterSystem::GetUnderwaterAcousticEmitterBeam() const
 {
     return m_vUAEB;
@@ -72,6 +72,8 @@ public:
 
     virtual ~UnderwaterAcousticEmitterSystem();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( UnderwaterAcousticEmitterSystem )
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::UnderwaterAcousticEmitterSystem::GetEmitterSystemDataLength
     // Description: Length of the emitter system in 32 bits words.
@@ -117,6 +119,9 @@ public:
     //************************************
     void AddUnderwaterAcousticEmitterBeam( const UnderwaterAcousticEmitterBeam & UAEB );
     void SetUnderwaterAcousticEmitterBeams( const std::vector<UnderwaterAcousticEmitterBeam> & UAEB );
+    #ifdef KDIS_USE_CPP11
+    void SetUnderwaterAcousticEmitterBeams( std::vector<UnderwaterAcousticEmitterBeam> && UAEB );
+    #endif
     const std::vector<UnderwaterAcousticEmitterBeam> & GetUnderwaterAcousticEmitterBeam() const;
     void ClearUnderwaterAcousticEmitterBeams();
 
@@ -104,7 +104,7 @@ KUINT32 VariableDatum::GetDatumLength() const
 
 KUINT32 VariableDatum::GetPDULength() const
 {
-    return VARIABLE_DATUM_SIZE + ( m_v8DatumValue.size() * 8 );
+    return VARIABLE_DATUM_SIZE + m_vDatumValue.size();
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -118,19 +118,11 @@ void VariableDatum::SetDatumValue( const KString & s )
 
 void VariableDatum::SetDatumValue( const KOCTET * data, KUINT32 sizeInBits )
 {
-    m_v8DatumValue.clear();
-
     KUINT32 sizeInOctets = ceil( sizeInBits / 8.0 );
-    for( KUINT16 i = 0; i < sizeInOctets; )
-    {
-        DatumEntry de;
 
-        for( KUINT16 j = 0; j < 8 && i < sizeInOctets; ++j, ++i )
-        {
-            de.Buffer[j] = data[i];
-        }
-        m_v8DatumValue.push_back( de );
-    }
+    // Copy the value and pad to the next 64 bit boundary.
+    m_vDatumValue.assign( data, data + sizeInOctets );
+    m_vDatumValue.resize( ceil( sizeInOctets / 8.0 ) * 8, 0x00 );
 
     m_ui32DatumLength = sizeInBits;
 }
@@ -143,67 +135,29 @@ void VariableDatum::GetDatumValueCopyIntoBuffer( KOCTET * Buffer, KUINT16 Buffer
 
     if( BufferSize < sizeInOctets )throw KException( __FUNCTION__, BUFFER_TOO_SMALL );
 
-    // Copy the data into the buffer, octet by octet
-    vector<DatumEntry>::const_iterator citr = m_v8DatumValue.begin();
-
-    KUINT16 i = 0;
-
-    while( i < sizeInOctets )
-    {
-        for( KUINT16 j = 0; i < sizeInOctets && j < 8; ++j, ++i )
-        {
-            Buffer[i] = citr->Buffer[j];
-        }
-        ++citr;
-    }
+    if( sizeInOctets )memcpy( Buffer, &m_vDatumValue[0], sizeInOctets );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 KString VariableDatum::GetDatumValueAsKString() const
 {
-    KStringStream ss;
-
-    vector<DatumEntry>::const_iterator citr =  m_v8DatumValue.begin();
-    vector<DatumEntry>::const_iterator citrEnd = m_v8DatumValue.end();
-
-    KUINT32 i = 0;
-
-    KUINT32 ui32LengthInOctets = ceil(m_ui32DatumLength / 8.0);
+    KUINT32 ui32LengthInOctets = ceil( m_ui32DatumLength / 8.0 );
 
-    while( citr != citrEnd )
-    {
-        for( KUINT16 j = 0; i < ui32LengthInOctets && j < 8; ++j, ++i )
-        {
-            ss << citr->Buffer[j];
-        }
-        ++citr;
-    }
+    if( ui32LengthInOctets > m_vDatumValue.size() )ui32LengthInOctets = m_vDatumValue.size();
 
-    return ss.str();
+    return KString( m_vDatumValue.begin(), m_vDatumValue.begin() + ui32LengthInOctets );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 vector<KUINT64> VariableDatum::GetDatumValueAsKUINT64() const
 {
-    KBOOL bSwapBytes = !IsMachineBigEndian();
-
-    vector<DatumEntry>::const_iterator citr = m_v8DatumValue.begin();
-    vector<DatumEntry>::const_iterator citrEnd = m_v8DatumValue.end();
-
-    vector<KUINT64> m_Return;
-
-    KUINT32 ui32CurrentPos = 0;
-    KUINT32 ui32LengthInOctets = ceil(m_ui32DatumLength / 8.0);
+    vector<KUINT64> m_Return( GetDatumValueCount<KUINT64>() );
 
-    while( citr != citrEnd )
+    for( KUINT32 i = 0; i < m_Return.size(); ++i )
     {
-        if( ( ui32LengthInOctets - ui32CurrentPos ) < 8 )break;
-
-        m_Return.push_back( NetToKUINT64( citr->Buffer, bSwapBytes ).m_Value );
-
-        ui32CurrentPos += 8;
+        m_Return[i] = GetDatumValueAt<KUINT64>( i );
     }
 
     return m_Return;
@@ -213,33 +167,35 @@ vector<KUINT64> VariableDatum::GetDatumValueAsKUINT64() const
 
 vector<KFLOAT64> VariableDatum::GetDatumValueAsKFLOAT64() const
 {
-    KBOOL bSwapBytes = !IsMachineBigEndian();
-
-    vector<DatumEntry>::const_iterator citr = m_v8DatumValue.begin();
-    vector<DatumEntry>::const_iterator citrEnd = m_v8DatumValue.end();
+    vector<KFLOAT64> m_Return( GetDatumValueCount<KFLOAT64>() );
 
-    vector<KFLOAT64> m_Return;
+    for( KUINT32 i = 0; i < m_Return.size(); ++i )
+    {
+        m_Return[i] = GetDatumValueAt<KFLOAT64>( i );
+    }
 
-    KUINT32 ui32CurrentPos = 0;
-    KUINT32 ui32LengthInOctets = ceil(m_ui32DatumLength / 8.0);
+    return m_Return;
+}
 
-    while( citr != citrEnd )
-    {
-        if( ( ui32LengthInOctets - ui32CurrentPos ) < 8 )break;
+//////////////////////////////////////////////////////////////////////////
 
-        m_Return.push_back( NetToKFLOAT64( citr->Buffer, bSwapBytes ).m_Value );
+const KOCTET * VariableDatum::GetDatumValuePtr() const
+{
+    return m_vDatumValue.empty() ? NULL : &m_vDatumValue[0];
+}
 
-        ui32CurrentPos += 8;
-    }
+//////////////////////////////////////////////////////////////////////////
 
-    return m_Return;
+KUINT32 VariableDatum::GetDatumValueSize() const
+{
+    return m_vDatumValue.size();
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 void VariableDatum::ClearDatumValue()
 {
-    m_v8DatumValue.clear();
+    m_vDatumValue.clear();
     m_ui32DatumLength = 0;
 }
 
@@ -265,26 +221,16 @@ void VariableDatum::Decode( KDataStream & stream ) throw( KException )
 {
     if( stream.GetBufferSize() < VARIABLE_DATUM_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
 
-    m_v8DatumValue.clear();
-
     stream >> m_ui32DatumID
            >> m_ui32DatumLength;
 
-    KUINT32 ui32LengthInOctets = ceil(ceil(m_ui32DatumLength / 8.0) / 8.0) * 8;
+    // Datum length is in bits, the value is padded to a 64 bit boundary.
+    KUINT32 ui32LengthInOctets = ceil( ceil( m_ui32DatumLength / 8.0 ) / 8.0 ) * 8;
 
-    // Datum length is returned in bits, so we need to convert to octets
-    for( KUINT16 i = 0; i < ui32LengthInOctets; )
-    {
-        DatumEntry de;
-
-        for( KUINT16 j = 0; i < ui32LengthInOctets && j < 8; ++j, ++i )
-        {
-            KOCTET o;
-            stream >> o;
-            de.Buffer[j] = o;
-        }
-        m_v8DatumValue.push_back( de );
-    }
+    if( stream.GetBufferSize() < ui32LengthInOctets )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+
+    m_vDatumValue.resize( ui32LengthInOctets );
+    if( ui32LengthInOctets )stream.Read( &m_vDatumValue[0], ui32LengthInOctets );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -305,18 +251,7 @@ void VariableDatum::Encode( KDataStream & stream ) const
     stream << m_ui32DatumID
            << m_ui32DatumLength;
 
-    vector<DatumEntry>::const_iterator citr = m_v8DatumValue.begin();
-    vector<DatumEntry>::const_iterator citrEnd = m_v8DatumValue.end();
-
-    while( citr != citrEnd )
-    {
-        for( KUINT16 i = 0; i < 8; ++i )
-        {
-            stream << citr->Buffer[i];
-        }
-
-        ++citr;
-    }
+    if( !m_vDatumValue.empty() )stream.Write( &m_vDatumValue[0], m_vDatumValue.size() );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -326,15 +261,7 @@ KBOOL VariableDatum::operator == ( const VariableDatum & Value ) const
     if( m_ui32DatumID     != Value.m_ui32DatumID )     return false;
     if( m_ui32DatumLength != Value.m_ui32DatumLength ) return false;
 
-    vector<DatumEntry>::const_iterator citrThis =  m_v8DatumValue.begin(),
-                                       citrOther = Value.m_v8DatumValue.begin();
-
-    while( citrThis != m_v8DatumValue.end() && citrOther != Value.m_v8DatumValue.end() )
-    {
-        if( memcmp( citrThis->Buffer, citrOther->Buffer, 8 ) != 0 )return false;
-        ++citrThis;
-        ++citrOther;
-    }
+    if( m_vDatumValue     != Value.m_vDatumValue )     return false;
     return true;
 }
 
@@ -46,6 +46,7 @@ http://p.sf.net/kdis/UserGuide
 #include "./DataTypeBase.h"
 #include "./FactoryDecoder.h"
 #include "./../Extras/KRef_Ptr.h"
+#include <vector>
 
 namespace KDIS {
 namespace DATA_TYPE {
@@ -60,7 +61,7 @@ class VariableDatum;
 typedef KDIS::UTILS::KRef_Ptr<VariableDatum> VarDtmPtr; // Ref counter
 //typedef VariableDatum* VarDtmPtr; // Weak ref
 
-class KDIS_EXPORT VariableDatum : public DataTypeBase, public FactoryDecoderUser<VariableDatum>
+class KDIS_EXPORT VariableDatum : public DataTypeBase, public FactoryDecoderUser<VariableDatum>, public KDIS::UTILS::KRef_Counted
 {
 protected:
 
@@ -68,18 +69,8 @@ protected:
 
     KUINT32 m_ui32DatumLength;
 
-    struct DatumEntry
-    {
-        KOCTET Buffer[8];
-
-        DatumEntry()
-        {
-            memset( Buffer, 0x00, 8 );
-        };
-    };
-
-    // Holds 64 bits, not all bits may belong to the value as padding is also added.
-    std::vector<DatumEntry> m_v8DatumValue;
+    // The value as one block, in network order. Padded to a multiple of 64 bits.
+    std::vector<KOCTET> m_vDatumValue;
 
 public:
 
@@ -95,6 +86,8 @@ public:
 
     virtual ~VariableDatum();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( VariableDatum )
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::VariableDatum::SetDatumID
     //              KDIS::DATA_TYPE::VariableDatum::GetDatumID
@@ -130,6 +123,7 @@ public:
     //              primitives are returned as vectors,
     //              If the datum length is not a multiple of
     //              8 then the last octets are ignored.
+    //              See GetDatumValueAt for access that does not allocate.
     // Parameter:   KOCTET * Buffer
     // Parameter:   KUINT16 BufferSize
     //************************************
@@ -146,6 +140,29 @@ public:
     //************************************
     virtual void SetDatumValue( const KOCTET * data, KUINT32 sizeInBits );
 
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableDatum::GetDatumValuePtr
+    //              KDIS::DATA_TYPE::VariableDatum::GetDatumValueSize
+    // Description: Direct access to the value octets, in network order, without copying.
+    //              The size is in octets and includes any padding.
+    //************************************
+    const KOCTET * GetDatumValuePtr() const;
+    KUINT32 GetDatumValueSize() const;
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableDatum<Type>::GetDatumValueCount
+    //              KDIS::DATA_TYPE::VariableDatum<Type>::GetDatumValueAt
+    // Description: Non allocating access to the value as an array of Type.
+    //              The count is the number of whole values held in the datum length,
+    //              GetDatumValueAt converts the value at Index to machine endian.
+    //              Throws OUT_OF_BOUNDS if Index is not less than the count.
+    // Parameter:   KUINT32 Index
+    //************************************
+    template<class Type>
+    KUINT32 GetDatumValueCount() const;
+    template<class Type>
+    Type GetDatumValueAt( KUINT32 Index ) const throw( KException );
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::VariableDatum::GetAsString
     // Description: Returns a string representation.
@@ -171,5 +188,25 @@ public:
     KBOOL operator != ( const VariableDatum & Value ) const;
 };
 
+/////////////////////////////////////////////////////////////////////////
+// templates
+//////////////////////////////////////////////////////////////////////////
+
+template<class Type>
+KUINT32 VariableDatum::GetDatumValueCount() const
+{
+    return ( m_ui32DatumLength / 8 ) / sizeof( Type );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+template<class Type>
+Type VariableDatum::GetDatumValueAt( KUINT32 Index ) const throw( KException )
+{
+    if( Index >= GetDatumValueCount<Type>() )throw KException( __FUNCTION__, OUT_OF_BOUNDS );
+
+    return NetToDataType<Type>( &m_vDatumValue[Index * sizeof( Type )], !KDIS::UTILS::IsMachineBigEndian() ).m_Value;
+}
+
 } // END namespace DATA_TYPES
 } // END namespace KDIS
@@ -64,7 +64,7 @@ typedef KDIS::UTILS::KRef_Ptr<VariableParameter> VarPrmPtr; // Ref counter
 
 using KDIS::DATA_TYPE::ENUMS::VariableParameterType;
 
-class KDIS_EXPORT VariableParameter : public DataTypeBase, public FactoryDecoderUser<VariableParameter>
+class KDIS_EXPORT VariableParameter : public DataTypeBase, public FactoryDecoderUser<VariableParameter>, public KDIS::UTILS::KRef_Counted
 {
 protected:		
 
@@ -0,0 +1,536 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./VariableParameterList.h"
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace KDIS;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+using namespace UTILS;
+
+//////////////////////////////////////////////////////////////////////////
+
+// Read/Write a value at a fixed offset of a record. Records are always big endian.
+template<class Type>
+static inline Type readField( const KUOCTET * Octs )
+{
+    return NetToDataType<Type>( ( const KOCTET * )Octs, !IsMachineBigEndian() ).m_Value;
+}
+
+template<class Type>
+static inline void writeField( KUOCTET * Octs, Type T )
+{
+    NetToDataType<Type> Net( T, !IsMachineBigEndian() );
+    memcpy( Octs, Net.m_Octs, sizeof( Type ) );
+}
+
+// Fill a network order record from a part.
+static void writeArticulatedPart( KUOCTET * Octs, const ArticulatedPart & AP )
+{
+    Octs[0] = ArticulatedPartType;
+    Octs[1] = AP.GetParameterChangeIndicator();
+    writeField<KUINT16>( Octs + 2, AP.GetAttachementID() );
+    writeField<KUINT32>( Octs + 4, AP.GetTypeVariant() );
+    writeField<KFLOAT32>( Octs + 8, AP.GetValue() );
+    memset( Octs + 12, 0, 4 );
+}
+
+static void writeAttachedPart( KUOCTET * Octs, const AttachedPart & AP )
+{
+    const EntityType & ET = AP.GetAttachedPartType();
+    Octs[0] = AttachedPartType;
+    Octs[1] = AP.GetDetachedIndicator();
+    writeField<KUINT16>( Octs + 2, AP.GetPartAttachedToID() );
+    writeField<KUINT32>( Octs + 4, AP.GetAttachedPartParameterTypeInt() );
+    Octs[8] = ET.GetEntityKind();
+    Octs[9] = ET.GetDomain();
+    writeField<KUINT16>( Octs + 10, ET.GetCountry() );
+    Octs[12] = ET.GetCategory();
+    Octs[13] = ET.GetSubCategory();
+    Octs[14] = ET.GetSpecific();
+    Octs[15] = ET.GetExtra();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+const VariableParameter * VariableParameterList::getObject( KUINT16 Index ) const
+{
+    if( m_vpObjects.empty() )return 0;
+    return m_vpObjects[Index].GetPtr();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void VariableParameterList::getRecord( KUINT16 Index, Record & R ) const
+{
+    const VariableParameter * pObj = getObject( Index );
+    if( !pObj )
+    {
+        R = m_Records[Index];
+        return;
+    }
+
+    KDataStream stream;
+    pObj->Encode( stream );
+    memset( R.m_Octs, 0, VariableParameter::VARIABLE_PARAMETER_SIZE );
+    stream.CopyIntoBuffer( ( KOCTET * )R.m_Octs, VariableParameter::VARIABLE_PARAMETER_SIZE );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void VariableParameterList::checkIndex( KUINT16 Index ) const throw( KException )
+{
+    if( Index >= m_Records.Size() )throw KException( __FUNCTION__, OUT_OF_BOUNDS );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+VariableParameterList::VariableParameterList()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+VariableParameterList::~VariableParameterList()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT16 VariableParameterList::GetCount() const
+{
+    return m_Records.Size();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL VariableParameterList::IsInline( KUINT16 Index ) const throw( KException )
+{
+    checkIndex( Index );
+    return getObject( Index ) == 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void VariableParameterList::Add( VarPrmPtr VP )
+{
+    // The slot is not used while an object is present.
+    m_Records.PushBack();
+
+    if( m_vpObjects.empty() )m_vpObjects.resize( m_Records.Size() - 1 );
+    m_vpObjects.push_back( VP );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void VariableParameterList::AddArticulatedPart( const ArticulatedPart & AP )
+{
+    writeArticulatedPart( m_Records.PushBack().m_Octs, AP );
+
+    if( !m_vpObjects.empty() )m_vpObjects.push_back( VarPrmPtr() );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void VariableParameterList::AddAttachedPart( const AttachedPart & AP )
+{
+    writeAttachedPart( m_Records.PushBack().m_Octs, AP );
+
+    if( !m_vpObjects.empty() )m_vpObjects.push_back( VarPrmPtr() );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void VariableParameterList::Set( const vector<VarPrmPtr> & VP )
+{
+    m_Records.Clear();
+    m_Records.Reserve( VP.size() );
+    for( KUINT16 i = 0; i < VP.size(); ++i )m_Records.PushBack();
+    m_vpObjects = VP;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+#ifdef KDIS_USE_CPP11
+void VariableParameterList::Set( vector<VarPrmPtr> && VP )
+{
+    m_Records.Clear();
+    m_Records.Reserve( VP.size() );
+    for( KUINT16 i = 0; i < VP.size(); ++i )m_Records.PushBack();
+    m_vpObjects = std::move( VP );
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
+const vector<VarPrmPtr> & VariableParameterList::GetVariableParameters() const
+{
+    // The inline records become objects held by the list so changes made through them are kept.
+    m_vpObjects.resize( m_Records.Size() );
+    for( KUINT16 i = 0; i < m_Records.Size(); ++i )
+    {
+        if( m_vpObjects[i].GetPtr() )continue;
+
+        KDataStream stream( ( KOCTET * )m_Records[i].m_Octs, VariableParameter::VARIABLE_PARAMETER_SIZE );
+        switch( m_Records[i].m_Octs[0] )
+        {
+            case ArticulatedPartType:
+                m_vpObjects[i] = new ArticulatedPart( stream );
+                break;
+
+            case AttachedPartType:
+                m_vpObjects[i] = new AttachedPart( stream );
+                break;
+
+            default:
+                m_vpObjects[i] = new VariableParameter( stream );
+                break;
+        }
+    }
+
+    return m_vpObjects;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void VariableParameterList::Clear()
+{
+    m_Records.Clear();
+    m_vpObjects.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+VariableParameterType VariableParameterList::GetType( KUINT16 Index ) const throw( KException )
+{
+    checkIndex( Index );
+
+    const VariableParameter * pObj = getObject( Index );
+    if( pObj )return pObj->GetVariableParameterType();
+    return ( VariableParameterType )m_Records[Index].m_Octs[0];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL VariableParameterList::GetArticulatedPart( KUINT16 Index, ArticulatedPart & AP ) const throw( KException )
+{
+    checkIndex( Index );
+
+    const VariableParameter * pObj = getObject( Index );
+    if( pObj )
+    {
+        const ArticulatedPart * pAP = dynamic_cast<const ArticulatedPart *>( pObj );
+        if( !pAP )return false;
+        AP = *pAP;
+        return true;
+    }
+
+    return DecodeArticulatedPart( m_Records[Index].m_Octs, AP );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL VariableParameterList::GetAttachedPart( KUINT16 Index, AttachedPart & AP ) const throw( KException )
+{
+    checkIndex( Index );
+
+    const VariableParameter * pObj = getObject( Index );
+    if( pObj )
+    {
+        const AttachedPart * pAP = dynamic_cast<const AttachedPart *>( pObj );
+        if( !pAP )return false;
+        AP = *pAP;
+        return true;
+    }
+
+    return DecodeAttachedPart( m_Records[Index].m_Octs, AP );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void VariableParameterList::SetArticulatedPart( KUINT16 Index, const ArticulatedPart & AP ) throw( KException )
+{
+    checkIndex( Index );
+
+    VariableParameter * pObj = m_vpObjects.empty() ? 0 : m_vpObjects[Index].GetPtr();
+    if( pObj )
+    {
+        ArticulatedPart * pAP = dynamic_cast<ArticulatedPart *>( pObj );
+        if( pAP )*pAP = AP;
+        else m_vpObjects[Index] = new ArticulatedPart( AP );
+        return;
+    }
+
+    writeArticulatedPart( m_Records[Index].m_Octs, AP );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void VariableParameterList::SetAttachedPart( KUINT16 Index, const AttachedPart & AP ) throw( KException )
+{
+    checkIndex( Index );
+
+    VariableParameter * pObj = m_vpObjects.empty() ? 0 : m_vpObjects[Index].GetPtr();
+    if( pObj )
+    {
+        AttachedPart * pAP = dynamic_cast<AttachedPart *>( pObj );
+        if( pAP )*pAP = AP;
+        else m_vpObjects[Index] = new AttachedPart( AP );
+        return;
+    }
+
+    writeAttachedPart( m_Records[Index].m_Octs, AP );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL VariableParameterList::DecodeArticulatedPart( const KUOCTET * Record, ArticulatedPart & AP )
+{
+    if( Record[0] != ArticulatedPartType )return false;
+
+    AP.SetParameterChangeIndicator( Record[1] );
+    AP.SetAttachementID( readField<KUINT16>( Record + 2 ) );
+    AP.SetTypeVariant( readField<KUINT32>( Record + 4 ) );
+    AP.SetValue( readField<KFLOAT32>( Record + 8 ) );
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL VariableParameterList::DecodeAttachedPart( const KUOCTET * Record, AttachedPart & AP )
+{
+    if( Record[0] != AttachedPartType )return false;
+
+    AP.SetDetachedIndicator( Record[1] );
+    AP.SetPartAttachedToID( readField<KUINT16>( Record + 2 ) );
+    AP.SetAttachedPartParameterType( readField<KUINT32>( Record + 4 ) );
+    AP.SetAttachedPartType( EntityType( Record[8], Record[9], readField<KUINT16>( Record + 10 ),
+                                        Record[12], Record[13], Record[14], Record[15] ) );
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KString VariableParameterList::GetAsString() const
+{
+    KStringStream ss;
+
+    for( KUINT16 i = 0; i < m_Records.Size(); ++i )
+    {
+        const VariableParameter * pObj = getObject( i );
+        if( pObj )
+        {
+            ss << pObj->GetAsString();
+            continue;
+        }
+
+        switch( m_Records[i].m_Octs[0] )
+        {
+            case ArticulatedPartType:
+            {
+                ArticulatedPart AP;
+                GetArticulatedPart( i, AP );
+                ss << AP.GetAsString();
+                break;
+            }
+
+            case AttachedPartType:
+            {
+                AttachedPart AP;
+                GetAttachedPart( i, AP );
+                ss << AP.GetAsString();
+                break;
+            }
+
+            default:
+                ss << "Variable Parameter:"
+                   << "\n\tType:          " << GetEnumAsStringVariableParameterType( m_Records[i].m_Octs[0] )
+                   << "\n";
+                break;
+        }
+    }
+
+    return ss.str();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void VariableParameterList::Decode( KDataStream & stream, KUINT16 Count ) throw( KException )
+{
+    const ErrorCodes e = TryDecode( stream, Count );
+    if( e != NO_ERRORS )throw KException( __FUNCTION__, e );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes VariableParameterList::TryDecode( KDataStream & stream, KUINT16 Count )
+{
+    Clear();
+
+    if( stream.GetBufferSize() < Count * VariableParameter::VARIABLE_PARAMETER_SIZE )return NOT_ENOUGH_DATA_IN_BUFFER;
+
+    m_Records.Reserve( Count );
+
+    // Records can only be held raw when they are in DIS network order.
+    KBOOL bRaw = stream.GetNetWorkEndian() == Big_Endian;
+
+    // Nothing to look up per record, take them all at once.
+    if( bRaw && !VariableParameter::HasFactoryDecoders() )
+    {
+        for( KUINT16 i = 0; i < Count; ++i )m_Records.PushBack();
+        if( Count )stream.Read( ( KOCTET * )m_Records[0].m_Octs, Count * VariableParameter::VARIABLE_PARAMETER_SIZE );
+        return NO_ERRORS;
+    }
+
+    for( KUINT16 i = 0; i < Count; ++i )
+    {
+        // A custom decoder may have read more than a record.
+        if( stream.GetBufferSize() < ( Count - i ) * VariableParameter::VARIABLE_PARAMETER_SIZE )return NOT_ENOUGH_DATA_IN_BUFFER;
+
+        // Save the current write position so we can peek.
+        KUINT16 pos = stream.GetCurrentWritePosition();
+        KUINT8 paramTyp;
+
+        // Extract the  type then reset the stream.
+        stream >> paramTyp;
+        stream.SetCurrentWritePosition( pos );
+
+        // Use the factory decoder, the only part that may throw.
+        VariableParameter * p = 0;
+        try
+        {
+            p = VariableParameter::FactoryDecode( paramTyp, stream );
+        }
+        catch( const KException & Ex )
+        {
+            return static_cast<ErrorCodes>( Ex.m_ui16ErrorCode );
+        }
+
+        // Did we find a custom decoder? if not then use the default.
+        if( p )
+        {
+            Add( VarPrmPtr( p ) );
+        }
+        else if( bRaw )
+        {
+            stream.Read( ( KOCTET * )m_Records.PushBack().m_Octs, VariableParameter::VARIABLE_PARAMETER_SIZE );
+
+            if( !m_vpObjects.empty() )m_vpObjects.push_back( VarPrmPtr() );
+        }
+        else
+        {
+            // Default internals
+            switch( paramTyp )
+            {
+                case ArticulatedPartType:
+                    Add( VarPrmPtr( new ArticulatedPart( stream ) ) );
+                    break;
+
+                case AttachedPartType:
+                    Add( VarPrmPtr( new AttachedPart( stream ) ) );
+                    break;
+
+                default:
+                    Add( VarPrmPtr( new VariableParameter( stream ) ) );
+                    break;
+            }
+        }
+    }
+
+    return NO_ERRORS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void VariableParameterList::Encode( KDataStream & stream ) const
+{
+    KBOOL bRaw = stream.GetNetWorkEndian() == Big_Endian;
+
+    for( KUINT16 i = 0; i < m_Records.Size(); ++i )
+    {
+        const VariableParameter * pObj = getObject( i );
+        if( pObj )
+        {
+            pObj->Encode( stream );
+            continue;
+        }
+
+        const KUOCTET * pOcts = m_Records[i].m_Octs;
+        if( bRaw || ( pOcts[0] != ArticulatedPartType && pOcts[0] != AttachedPartType ) )
+        {
+            stream.Write( ( const KOCTET * )pOcts, VariableParameter::VARIABLE_PARAMETER_SIZE );
+        }
+        else if( pOcts[0] == ArticulatedPartType )
+        {
+            ArticulatedPart AP;
+            GetArticulatedPart( i, AP );
+            AP.Encode( stream );
+        }
+        else
+        {
+            AttachedPart AP;
+            GetAttachedPart( i, AP );
+            AP.Encode( stream );
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL VariableParameterList::operator == ( const VariableParameterList & Value ) const
+{
+    if( m_Records.Size() != Value.m_Records.Size() )return false;
+
+    Record A, B;
+    for( KUINT16 i = 0; i < m_Records.Size(); ++i )
+    {
+        getRecord( i, A );
+        Value.getRecord( i, B );
+        if( memcmp( A.m_Octs, B.m_Octs, VariableParameter::VARIABLE_PARAMETER_SIZE ) != 0 )return false;
+    }
+
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL VariableParameterList::operator != ( const VariableParameterList & Value ) const
+{
+    return !( *this == Value );
+}
+
+//////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,228 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      VariableParameterList
+    created:    18/10/2026
+
+    purpose:    Storage for the variable parameter records of a PDU.
+                Records are fixed 16 octet structures so the common types
+                (ArticulatedPart, AttachedPart and generic records) are held
+                inline, in network byte order, in a small vector and are only
+                turned into objects when requested. Records decoded by a custom
+                FactoryDecoder, or added as a VarPrmPtr, are held on the heap as
+                before so they keep their reference semantics.
+
+                GetVariableParameters returns the records as a vector of VarPrmPtr.
+                The first call turns any inline records into heap objects held by the
+                list, so changes made through them are encoded. Use the typed Get/Set
+                accessors to work with the records without allocating.
+*********************************************************************/
+
+#pragma once
+
+#include "./ArticulatedPart.h"
+#include "./AttachedPart.h"
+#include "./../Extras/KSmallVector.h"
+#include <vector>
+
+namespace KDIS {
+namespace DATA_TYPE {
+
+class KDIS_EXPORT VariableParameterList
+{
+public:
+
+    // Number of records that can be held without allocating.
+    static const KUINT16 INLINE_CAPACITY = 20;
+
+    // A single record, stored in network byte order.
+    struct Record
+    {
+        KUOCTET m_Octs[VariableParameter::VARIABLE_PARAMETER_SIZE];
+    };
+
+protected:
+
+    KDIS::UTILS::KSmallVector<Record, INLINE_CAPACITY> m_Records;
+
+    // Empty while every record is inline, otherwise one entry per record
+    // where NULL means the record is inline. Filled in by GetVariableParameters.
+    mutable std::vector<VarPrmPtr> m_vpObjects;
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableParameterList::getObject
+    // Description: Returns the heap object for the record or NULL if it is inline.
+    // Parameter:   KUINT16 Index
+    //************************************
+    const VariableParameter * getObject( KUINT16 Index ) const;
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableParameterList::getRecord
+    // Description: Returns the record as it would be encoded.
+    // Parameter:   KUINT16 Index
+    // Parameter:   Record & R
+    //************************************
+    void getRecord( KUINT16 Index, Record & R ) const;
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableParameterList::checkIndex
+    // Description: Throws OUT_OF_BOUNDS if the index is not valid.
+    // Parameter:   KUINT16 Index
+    //************************************
+    void checkIndex( KUINT16 Index ) const throw( KException );
+
+public:
+
+    VariableParameterList();
+
+    virtual ~VariableParameterList();
+
+    KDIS_DEFAULT_COPY_AND_MOVE( VariableParameterList )
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableParameterList::GetCount
+    // Description: Number of records.
+    //************************************
+    KUINT16 GetCount() const;
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableParameterList::IsInline
+    // Description: Returns true if the record is held inline rather than as a heap object.
+    // Parameter:   KUINT16 Index
+    //************************************
+    KBOOL IsInline( KUINT16 Index ) const throw( KException );
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableParameterList::Add
+    //              KDIS::DATA_TYPE::VariableParameterList::AddArticulatedPart
+    //              KDIS::DATA_TYPE::VariableParameterList::AddAttachedPart
+    // Description: Adds a record. A VarPrmPtr is referenced, changes made to the object
+    //              later will be encoded. The typed versions copy the value inline.
+    // Parameter:   VarPrmPtr VP, const ArticulatedPart & AP, const AttachedPart & AP
+    //************************************
+    void Add( VarPrmPtr VP );
+    void AddArticulatedPart( const ArticulatedPart & AP );
+    void AddAttachedPart( const AttachedPart & AP );
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableParameterList::Set
+    //              KDIS::DATA_TYPE::VariableParameterList::GetVariableParameters
+    // Description: Access to the records as referenced objects, changes made to the objects are encoded.
+    //              Note: GetVariableParameters allocates an object for each inline record the first
+    //              time it is called and holds it from then on. Records added afterwards are inline
+    //              until the next call, which is also when the reference reflects them.
+    // Parameter:   const std::vector<VarPrmPtr> & VP
+    //************************************
+    void Set( const std::vector<VarPrmPtr> & VP );
+    #ifdef KDIS_USE_CPP11
+    void Set( std::vector<VarPrmPtr> && VP );
+    #endif
+    const std::vector<VarPrmPtr> & GetVariableParameters() const;
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableParameterList::Clear
+    // Description: Removes all records.
+    //************************************
+    void Clear();
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableParameterList::GetType
+    // Description: The record type. Throws OUT_OF_BOUNDS if Index is invalid.
+    // Parameter:   KUINT16 Index
+    //************************************
+    KDIS::DATA_TYPE::ENUMS::VariableParameterType GetType( KUINT16 Index ) const throw( KException );
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableParameterList::GetArticulatedPart
+    //              KDIS::DATA_TYPE::VariableParameterList::GetAttachedPart
+    // Description: Copies the record into AP without allocating. Returns false if the
+    //              record is of a different type. Throws OUT_OF_BOUNDS if Index is invalid.
+    // Parameter:   KUINT16 Index
+    // Parameter:   ArticulatedPart & AP, AttachedPart & AP
+    //************************************
+    KBOOL GetArticulatedPart( KUINT16 Index, ArticulatedPart & AP ) const throw( KException );
+    KBOOL GetAttachedPart( KUINT16 Index, AttachedPart & AP ) const throw( KException );
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableParameterList::SetArticulatedPart
+    //              KDIS::DATA_TYPE::VariableParameterList::SetAttachedPart
+    // Description: Replaces the record with AP. An inline record is overwritten in place, an object
+    //              of the same type is assigned to so a VarPrmPtr to it sees the change.
+    //              Throws OUT_OF_BOUNDS if Index is invalid.
+    // Parameter:   KUINT16 Index
+    // Parameter:   const ArticulatedPart & AP, const AttachedPart & AP
+    //************************************
+    void SetArticulatedPart( KUINT16 Index, const ArticulatedPart & AP ) throw( KException );
+    void SetAttachedPart( KUINT16 Index, const AttachedPart & AP ) throw( KException );
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableParameterList::DecodeArticulatedPart
+    //              KDIS::DATA_TYPE::VariableParameterList::DecodeAttachedPart
+    // Description: Decodes a single 16 octet network order record into AP without allocating.
+    //              Returns false if the record is of a different type.
+    // Parameter:   const KUOCTET * Record
+    // Parameter:   ArticulatedPart & AP, AttachedPart & AP
+    //************************************
+    static KBOOL DecodeArticulatedPart( const KUOCTET * Record, ArticulatedPart & AP );
+    static KBOOL DecodeAttachedPart( const KUOCTET * Record, AttachedPart & AP );
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableParameterList::GetAsString
+    // Description: Returns a string representation of all the records.
+    //************************************
+    KString GetAsString() const;
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableParameterList::Decode
+    //              KDIS::DATA_TYPE::VariableParameterList::TryDecode
+    // Description: Convert From Network Data. Records with a registered FactoryDecoder
+    //              are decoded with it, all others are stored inline. Without any registered
+    //              decoders the records are read in one block.
+    //              TryDecode returns an error code instead of throwing, including for an
+    //              exception raised by a FactoryDecoder.
+    // Parameter:   KDataStream & stream
+    // Parameter:   KUINT16 Count - Number of records to decode.
+    //************************************
+    void Decode( KDataStream & stream, KUINT16 Count ) throw( KException );
+    KDIS::ErrorCodes TryDecode( KDataStream & stream, KUINT16 Count );
+
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::VariableParameterList::Encode
+    // Description: Convert To Network Data.
+    // Parameter:   KDataStream & stream
+    //************************************
+    void Encode( KDataStream & stream ) const;
+
+    KBOOL operator == ( const VariableParameterList & Value ) const;
+    KBOOL operator != ( const VariableParameterList & Value ) const;
+};
+
+} // END namespace DATA_TYPES
+} // END namespace KDIS
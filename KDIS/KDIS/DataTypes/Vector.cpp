@@ -33,6 +33,8 @@ http://p.sf.net/kdis/UserGuide
 using namespace KDIS;
 using namespace DATA_TYPE;
 
+KDIS_CHECK_SCHEMA_SIZE( Vector, Vector::VECTOR_SIZE );
+
 //////////////////////////////////////////////////////////////////////////
 // Public:
 //////////////////////////////////////////////////////////////////////////
@@ -62,12 +64,32 @@ Vector::Vector( KDataStream & stream ) throw( KException )
 
 //////////////////////////////////////////////////////////////////////////
 
+Vector::Vector( const VectorPOD & P ) :
+    m_f32X( P.m_f32X ),
+    m_f32Y( P.m_f32Y ),
+    m_f32Z( P.m_f32Z )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 Vector::~Vector()
 {
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+VectorPOD Vector::ToPOD() const
+{
+    VectorPOD P;
+    P.m_f32X = m_f32X;
+    P.m_f32Y = m_f32Y;
+    P.m_f32Z = m_f32Z;
+    return P;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 void Vector::SetX( KFLOAT32 X )
 {
     m_f32X = X;
@@ -163,11 +185,14 @@ KString Vector::GetAsString() const
 
 void Vector::Decode( KDataStream & stream ) throw( KException )
 {
-    if( stream.GetBufferSize() < VECTOR_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    FieldSchema::Decode( stream, *this );
+}
 
-    stream >> m_f32X
-           >> m_f32Y
-           >> m_f32Z;
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes Vector::TryDecode( KDataStream & stream )
+{
+    return FieldSchema::TryDecode( stream, *this );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -185,19 +210,14 @@ KDataStream Vector::Encode() const
 
 void Vector::Encode( KDataStream & stream ) const
 {
-    stream << m_f32X
-           << m_f32Y
-           << m_f32Z;
+    FieldSchema::Encode( *this, stream );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 KBOOL Vector::operator == ( const Vector & Value ) const
 {
-    if( m_f32X != Value.m_f32X ) return false;
-    if( m_f32Y != Value.m_f32Y ) return false;
-    if( m_f32Z != Value.m_f32Z ) return false;
-    return true;
+    return FieldSchema::Equal( *this, Value );
 }
 
 //////////////////////////////////////////////////////////////////////////
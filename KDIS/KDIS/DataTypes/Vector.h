@@ -64,6 +64,8 @@ http://p.sf.net/kdis/UserGuide
 #pragma once
 
 #include "./DataTypeBase.h"
+#include "./FieldSchema.h"
+#include "./PODTypes.h"
 
 namespace KDIS {
 namespace DATA_TYPE {
@@ -82,14 +84,28 @@ public:
 
     static const KUINT16 VECTOR_SIZE = 12;
 
+    // Layout of the record, used to encode, decode, compare and hash it.
+    typedef KFieldList< KField<Vector, KFLOAT32, &Vector::m_f32X>,
+                        KField<Vector, KFLOAT32, &Vector::m_f32Y>,
+                        KField<Vector, KFLOAT32, &Vector::m_f32Z> > FieldSchema;
+
     Vector();
 
     Vector( KFLOAT32 X, KFLOAT32 Y, KFLOAT32 Z );
 
     Vector( KDataStream & stream ) throw( KException );
 
+    Vector( const VectorPOD & P );
+
     virtual ~Vector();
 
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::Vector::ToPOD
+    // Description: Returns a plain copy of the fields, see PODTypes.h.
+    //              Use the Vector( const VectorPOD & ) constructor to convert back.
+    //************************************
+    VectorPOD ToPOD() const;
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::Vector::SetX
     //              KDIS::DATA_TYPE::Vector::GetX
@@ -162,10 +178,13 @@ public:
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::Vector::Decode
+    //              KDIS::DATA_TYPE::Vector::TryDecode
     // Description: Convert From Network Data.
+    //              TryDecode returns an error code instead of throwing.
     // Parameter:   KDataStream & stream
     //************************************
     virtual void Decode( KDataStream & stream ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream );
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::Vector::Encode
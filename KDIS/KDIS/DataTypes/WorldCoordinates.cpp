@@ -32,6 +32,8 @@ http://p.sf.net/kdis/UserGuide
 using namespace KDIS;
 using namespace DATA_TYPE;
 
+KDIS_CHECK_SCHEMA_SIZE( WorldCoordinates, WorldCoordinates::WORLD_COORDINATES_SIZE );
+
 //////////////////////////////////////////////////////////////////////////
 // Public:
 //////////////////////////////////////////////////////////////////////////
@@ -61,12 +63,32 @@ WorldCoordinates::WorldCoordinates( KDataStream & stream ) throw( KException )
 
 //////////////////////////////////////////////////////////////////////////
 
+WorldCoordinates::WorldCoordinates( const WorldCoordinatesPOD & P ) :
+    m_f64X( P.m_f64X ),
+    m_f64Y( P.m_f64Y ),
+    m_f64Z( P.m_f64Z )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 WorldCoordinates::~WorldCoordinates()
 {
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+WorldCoordinatesPOD WorldCoordinates::ToPOD() const
+{
+    WorldCoordinatesPOD P;
+    P.m_f64X = m_f64X;
+    P.m_f64Y = m_f64Y;
+    P.m_f64Z = m_f64Z;
+    return P;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 void WorldCoordinates::SetX( KFLOAT64  X )
 {
     m_f64X = X;
@@ -156,11 +178,14 @@ KString WorldCoordinates::GetAsString() const
 
 void WorldCoordinates::Decode( KDataStream & stream ) throw( KException )
 {
-    if( stream.GetBufferSize() < WORLD_COORDINATES_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    FieldSchema::Decode( stream, *this );
+}
 
-    stream >> m_f64X
-           >> m_f64Y
-           >> m_f64Z;
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes WorldCoordinates::TryDecode( KDataStream & stream )
+{
+    return FieldSchema::TryDecode( stream, *this );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -178,19 +203,14 @@ KDataStream WorldCoordinates::Encode() const
 
 void WorldCoordinates::Encode( KDataStream & stream ) const
 {
-    stream << m_f64X
-           << m_f64Y
-           << m_f64Z;
+    FieldSchema::Encode( *this, stream );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 KBOOL WorldCoordinates::operator == ( const WorldCoordinates & Value ) const
 {
-    if( m_f64X != Value.m_f64X ) return false;
-    if( m_f64Y != Value.m_f64Y ) return false;
-    if( m_f64Z != Value.m_f64Z ) return false;
-    return true;
+    return FieldSchema::Equal( *this, Value );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -44,6 +44,8 @@ http://p.sf.net/kdis/UserGuide
 #pragma once
 
 #include "./DataTypeBase.h"
+#include "./FieldSchema.h"
+#include "./PODTypes.h"
 #include "./Vector.h"
 
 namespace KDIS {
@@ -63,14 +65,28 @@ public:
 
     static const KUINT16 WORLD_COORDINATES_SIZE = 24;
 
+    // Layout of the record, used to encode, decode, compare and hash it.
+    typedef KFieldList< KField<WorldCoordinates, KFLOAT64, &WorldCoordinates::m_f64X>,
+                        KField<WorldCoordinates, KFLOAT64, &WorldCoordinates::m_f64Y>,
+                        KField<WorldCoordinates, KFLOAT64, &WorldCoordinates::m_f64Z> > FieldSchema;
+
     WorldCoordinates();
 
     WorldCoordinates( KDataStream & stream ) throw( KException );
 
     WorldCoordinates( KFLOAT64 X, KFLOAT64 Y, KFLOAT64 Z );
 
+    WorldCoordinates( const WorldCoordinatesPOD & P );
+
     virtual ~WorldCoordinates();
 
+    //************************************
+    // FullName:    KDIS::DATA_TYPE::WorldCoordinates::ToPOD
+    // Description: Returns a plain copy of the fields, see PODTypes.h.
+    //              Use the WorldCoordinates( const WorldCoordinatesPOD & ) constructor to convert back.
+    //************************************
+    WorldCoordinatesPOD ToPOD() const;
+
     //************************************
     // FullName:    KDIS::DATA_TYPE::WorldCoordinates::SetX
     //              KDIS::DATA_TYPE::WorldCoordinates::GetX
@@ -135,10 +151,13 @@ public:
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::WorldCoordinates::Decode
+    //              KDIS::DATA_TYPE::WorldCoordinates::TryDecode
     // Description: Convert From Network Data.
+    //              TryDecode returns an error code instead of throwing.
     // Parameter:   KDataStream & stream
     //************************************
     virtual void Decode( KDataStream & stream ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream );
 
     //************************************
     // FullName:    KDIS::DATA_TYPE::WorldCoordinates::Encode
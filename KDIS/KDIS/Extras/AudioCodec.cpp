@@ -0,0 +1,367 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./AudioCodec.h"
+#include "./KUtils.h"
+#include "./../DataTypes/Enums/EnumRadio.h"
+#include <cstring>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define KDIS_AUDIO_CODEC_SSE2
+#include <emmintrin.h>
+#endif
+
+using namespace KDIS;
+using namespace UTILS;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+
+//////////////////////////////////////////////////////////////////////////
+
+// Mu-law(G.711) lookup tables, built when the library is loaded.
+static const KINT32 MU_LAW_BIAS = 0x84;
+static const KINT32 MU_LAW_CLIP = 32635;
+
+// Samples are converted to float in blocks of this size on the stack.
+static const KUINT32 FLOAT_BLOCK = 256;
+
+struct MuLawTables
+{
+    KINT16 m_i16Decode[256];
+    KFLOAT32 m_f32Decode[256];
+    KUINT8 m_ui8Exponent[256];
+
+    MuLawTables()
+    {
+        for( KINT32 i = 0; i < 256; ++i )
+        {
+            const KINT32 u = ~i & 0xFF;
+            const KINT32 t = ( ( ( u & 0x0F ) << 3 ) + MU_LAW_BIAS ) << ( ( u & 0x70 ) >> 4 );
+            m_i16Decode[i] = ( KINT16 )( ( u & 0x80 ) ? ( MU_LAW_BIAS - t ) : ( t - MU_LAW_BIAS ) );
+            m_f32Decode[i] = m_i16Decode[i] / 32768.0f;
+
+            // The position of the highest set bit of i, the segment of a biased sample >> 7.
+            KUINT8 e = 0;
+            for( KINT32 v = i >> 1; v; v >>= 1 )++e;
+            m_ui8Exponent[i] = e;
+        }
+    }
+};
+
+static const MuLawTables MU_LAW;
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+KUINT8 AudioCodec::GetSampleSize( KUINT16 EncodingType )
+{
+    switch( EncodingType )
+    {
+        case _8_bit_mu_law:
+        case _8_bit_linear_PCM:
+            return 1;
+
+        case _16_bit_linear_PCM2sComplementBigEndian:
+        case _16_bit_linear_PCM2sComplementLittleEndian:
+            return 2;
+    }
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL AudioCodec::Decode( KUINT16 EncodingType, const KOCTET * In, KUINT32 Samples, KINT16 * Out )
+{
+    switch( EncodingType )
+    {
+        case _8_bit_mu_law:
+            DecodeMuLaw( In, Out, Samples );
+            return true;
+
+        case _8_bit_linear_PCM:
+            DecodePCM8( In, Out, Samples );
+            return true;
+
+        case _16_bit_linear_PCM2sComplementBigEndian:
+            DecodePCM16( In, Out, Samples, true );
+            return true;
+
+        case _16_bit_linear_PCM2sComplementLittleEndian:
+            DecodePCM16( In, Out, Samples, false );
+            return true;
+    }
+    return false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL AudioCodec::Decode( KUINT16 EncodingType, const KOCTET * In, KUINT32 Samples, KFLOAT32 * Out )
+{
+    const KUINT8 ui8Size = GetSampleSize( EncodingType );
+    if( ui8Size == 0 )return false;
+
+    if( EncodingType == _8_bit_mu_law )
+    {
+        const KUINT8 * pIn = ( const KUINT8 * )In;
+        for( KUINT32 i = 0; i < Samples; ++i )
+        {
+            Out[i] = MU_LAW.m_f32Decode[pIn[i]];
+        }
+        return true;
+    }
+
+    KINT16 i16Block[FLOAT_BLOCK];
+    while( Samples )
+    {
+        const KUINT32 ui32Count = Samples < FLOAT_BLOCK ? Samples : FLOAT_BLOCK;
+        Decode( EncodingType, In, ui32Count, i16Block );
+        PCM16ToFloat( i16Block, Out, ui32Count );
+        In += ui32Count * ui8Size;
+        Out += ui32Count;
+        Samples -= ui32Count;
+    }
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL AudioCodec::Encode( KUINT16 EncodingType, const KINT16 * In, KUINT32 Samples, KOCTET * Out )
+{
+    switch( EncodingType )
+    {
+        case _8_bit_mu_law:
+            EncodeMuLaw( In, Out, Samples );
+            return true;
+
+        case _8_bit_linear_PCM:
+            EncodePCM8( In, Out, Samples );
+            return true;
+
+        case _16_bit_linear_PCM2sComplementBigEndian:
+            EncodePCM16( In, Out, Samples, true );
+            return true;
+
+        case _16_bit_linear_PCM2sComplementLittleEndian:
+            EncodePCM16( In, Out, Samples, false );
+            return true;
+    }
+    return false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void AudioCodec::DecodeMuLaw( const KOCTET * In, KINT16 * Out, KUINT32 Samples )
+{
+    const KUINT8 * pIn = ( const KUINT8 * )In;
+    for( KUINT32 i = 0; i < Samples; ++i )
+    {
+        Out[i] = MU_LAW.m_i16Decode[pIn[i]];
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void AudioCodec::EncodeMuLaw( const KINT16 * In, KOCTET * Out, KUINT32 Samples )
+{
+    for( KUINT32 i = 0; i < Samples; ++i )
+    {
+        KINT32 s = In[i];
+        const KINT32 sign = ( s >> 8 ) & 0x80;
+        if( sign )s = -s;
+        if( s > MU_LAW_CLIP )s = MU_LAW_CLIP;
+        s += MU_LAW_BIAS;
+
+        const KINT32 e = MU_LAW.m_ui8Exponent[( s >> 7 ) & 0xFF];
+        const KINT32 m = ( s >> ( e + 3 ) ) & 0x0F;
+        Out[i] = ( KOCTET )~( sign | ( e << 4 ) | m );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void AudioCodec::DecodePCM8( const KOCTET * In, KINT16 * Out, KUINT32 Samples )
+{
+    KUINT32 i = 0;
+
+#ifdef KDIS_AUDIO_CODEC_SSE2
+    // Flipping the top bit makes the samples signed, they become the high octet.
+    const __m128i sign = _mm_set1_epi8( ( char )0x80 );
+    const __m128i zero = _mm_setzero_si128();
+    for( ; i + 16 <= Samples; i += 16 )
+    {
+        const __m128i v = _mm_xor_si128( _mm_loadu_si128( ( const __m128i * )( In + i ) ), sign );
+        _mm_storeu_si128( ( __m128i * )( Out + i ), _mm_unpacklo_epi8( zero, v ) );
+        _mm_storeu_si128( ( __m128i * )( Out + i + 8 ), _mm_unpackhi_epi8( zero, v ) );
+    }
+#endif
+
+    const KUINT8 * pIn = ( const KUINT8 * )In;
+    for( ; i < Samples; ++i )
+    {
+        Out[i] = ( KINT16 )( ( pIn[i] - 128 ) << 8 );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void AudioCodec::EncodePCM8( const KINT16 * In, KOCTET * Out, KUINT32 Samples )
+{
+    KUINT32 i = 0;
+
+#ifdef KDIS_AUDIO_CODEC_SSE2
+    const __m128i sign = _mm_set1_epi8( ( char )0x80 );
+    for( ; i + 16 <= Samples; i += 16 )
+    {
+        const __m128i a = _mm_srai_epi16( _mm_loadu_si128( ( const __m128i * )( In + i ) ), 8 );
+        const __m128i b = _mm_srai_epi16( _mm_loadu_si128( ( const __m128i * )( In + i + 8 ) ), 8 );
+        _mm_storeu_si128( ( __m128i * )( Out + i ), _mm_xor_si128( _mm_packs_epi16( a, b ), sign ) );
+    }
+#endif
+
+    for( ; i < Samples; ++i )
+    {
+        Out[i] = ( KOCTET )( ( In[i] >> 8 ) + 128 );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void AudioCodec::DecodePCM16( const KOCTET * In, KINT16 * Out, KUINT32 Samples, KBOOL BigEndian )
+{
+    if( BigEndian == IsMachineBigEndian() )
+    {
+        memcpy( Out, In, Samples * 2 );
+    }
+    else
+    {
+        SwapPCM16( In, ( KOCTET * )Out, Samples );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void AudioCodec::EncodePCM16( const KINT16 * In, KOCTET * Out, KUINT32 Samples, KBOOL BigEndian )
+{
+    if( BigEndian == IsMachineBigEndian() )
+    {
+        memcpy( Out, In, Samples * 2 );
+    }
+    else
+    {
+        SwapPCM16( ( const KOCTET * )In, Out, Samples );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void AudioCodec::SwapPCM16( const KOCTET * In, KOCTET * Out, KUINT32 Samples )
+{
+    KUINT32 i = 0;
+
+#ifdef KDIS_AUDIO_CODEC_SSE2
+    for( ; i + 16 <= Samples; i += 16 )
+    {
+        const __m128i a = _mm_loadu_si128( ( const __m128i * )( In + i * 2 ) );
+        const __m128i b = _mm_loadu_si128( ( const __m128i * )( In + i * 2 + 16 ) );
+        _mm_storeu_si128( ( __m128i * )( Out + i * 2 ), _mm_or_si128( _mm_slli_epi16( a, 8 ), _mm_srli_epi16( a, 8 ) ) );
+        _mm_storeu_si128( ( __m128i * )( Out + i * 2 + 16 ), _mm_or_si128( _mm_slli_epi16( b, 8 ), _mm_srli_epi16( b, 8 ) ) );
+    }
+#endif
+
+    for( ; i < Samples; ++i )
+    {
+        Out[i * 2] = In[i * 2 + 1];
+        Out[i * 2 + 1] = In[i * 2];
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void AudioCodec::PCM16ToFloat( const KINT16 * In, KFLOAT32 * Out, KUINT32 Samples )
+{
+    KUINT32 i = 0;
+
+#ifdef KDIS_AUDIO_CODEC_SSE2
+    const __m128 scale = _mm_set1_ps( 1.0f / 32768.0f );
+    for( ; i + 8 <= Samples; i += 8 )
+    {
+        // Sign extend by placing each sample in the high half of a 32 bit lane.
+        const __m128i v = _mm_loadu_si128( ( const __m128i * )( In + i ) );
+        const __m128i lo = _mm_srai_epi32( _mm_unpacklo_epi16( v, v ), 16 );
+        const __m128i hi = _mm_srai_epi32( _mm_unpackhi_epi16( v, v ), 16 );
+        _mm_storeu_ps( Out + i, _mm_mul_ps( _mm_cvtepi32_ps( lo ), scale ) );
+        _mm_storeu_ps( Out + i + 4, _mm_mul_ps( _mm_cvtepi32_ps( hi ), scale ) );
+    }
+#endif
+
+    for( ; i < Samples; ++i )
+    {
+        Out[i] = In[i] / 32768.0f;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void AudioCodec::FloatToPCM16( const KFLOAT32 * In, KINT16 * Out, KUINT32 Samples )
+{
+    KUINT32 i = 0;
+
+#ifdef KDIS_AUDIO_CODEC_SSE2
+    const __m128 scale = _mm_set1_ps( 32768.0f );
+    const __m128 lower = _mm_set1_ps( -32768.0f );
+    const __m128 upper = _mm_set1_ps( 32767.0f );
+    const __m128 sign = _mm_set1_ps( -0.0f );
+    const __m128 half = _mm_set1_ps( 0.5f );
+    for( ; i + 8 <= Samples; i += 8 )
+    {
+        // NaN is silence, masked to 0 as the clip would turn it into the smallest integer.
+        // Clip before converting, out of range floats convert to the smallest integer.
+        // Rounds half away from zero like the scalar code, the SSE2 rounding mode would not.
+        __m128 a = _mm_mul_ps( _mm_loadu_ps( In + i ), scale );
+        __m128 b = _mm_mul_ps( _mm_loadu_ps( In + i + 4 ), scale );
+        a = _mm_min_ps( _mm_max_ps( _mm_and_ps( a, _mm_cmpord_ps( a, a ) ), lower ), upper );
+        b = _mm_min_ps( _mm_max_ps( _mm_and_ps( b, _mm_cmpord_ps( b, b ) ), lower ), upper );
+        a = _mm_add_ps( a, _mm_or_ps( _mm_and_ps( a, sign ), half ) );
+        b = _mm_add_ps( b, _mm_or_ps( _mm_and_ps( b, sign ), half ) );
+        _mm_storeu_si128( ( __m128i * )( Out + i ), _mm_packs_epi32( _mm_cvttps_epi32( a ), _mm_cvttps_epi32( b ) ) );
+    }
+#endif
+
+    for( ; i < Samples; ++i )
+    {
+        KFLOAT32 f = In[i] * 32768.0f;
+        if( f != f )f = 0.0f; // NaN
+        if( f < -32768.0f )f = -32768.0f;
+        if( f > 32767.0f )f = 32767.0f;
+        Out[i] = ( KINT16 )( f < 0 ? f - 0.5f : f + 0.5f );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
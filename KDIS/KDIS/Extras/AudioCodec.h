@@ -0,0 +1,143 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      AudioCodec
+    created:    19/10/2026
+
+    purpose:    Bulk conversion of the Signal PDU audio encodings to and from 16 bit
+                machine endian PCM and floating point PCM(-1 to 1). The 16 bit linear
+                PCM byte swapping, the 8 bit linear PCM and the float conversions use
+                SSE2 when it is available and the scalar code elsewhere. Mu-law is
+                converted with lookup tables, SSE2 has no per lane shifts or gathers.
+
+                The buffers do not need to be aligned and may not overlap.
+*********************************************************************/
+
+#pragma once
+
+#include "./../KDefines.h"
+
+namespace KDIS {
+namespace UTILS {
+
+class KDIS_EXPORT AudioCodec
+{
+public:
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioCodec::GetSampleSize
+    // Description: Octets per sample for an audio encoding type(see EncodingType),
+    //              0 when the encoding is not supported.
+    // Parameter:   KUINT16 EncodingType
+    //************************************
+    static KUINT8 GetSampleSize( KUINT16 EncodingType );
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioCodec::Decode
+    // Description: Converts samples in an audio encoding to PCM.
+    //              Returns false if the encoding is not supported.
+    // Parameter:   KUINT16 EncodingType
+    // Parameter:   const KOCTET * In - Samples * GetSampleSize octets.
+    // Parameter:   KUINT32 Samples
+    // Parameter:   KINT16 * Out / KFLOAT32 * Out
+    //************************************
+    static KBOOL Decode( KUINT16 EncodingType, const KOCTET * In, KUINT32 Samples, KINT16 * Out );
+    static KBOOL Decode( KUINT16 EncodingType, const KOCTET * In, KUINT32 Samples, KFLOAT32 * Out );
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioCodec::Encode
+    // Description: Converts PCM samples to an audio encoding.
+    //              Returns false if the encoding is not supported.
+    // Parameter:   KUINT16 EncodingType
+    // Parameter:   const KINT16 * In
+    // Parameter:   KUINT32 Samples
+    // Parameter:   KOCTET * Out - Samples * GetSampleSize octets.
+    //************************************
+    static KBOOL Encode( KUINT16 EncodingType, const KINT16 * In, KUINT32 Samples, KOCTET * Out );
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioCodec::DecodeMuLaw
+    //              KDIS::UTILS::AudioCodec::EncodeMuLaw
+    // Description: 8 bit mu-law(G.711) to and from 16 bit PCM.
+    // Parameter:   const KOCTET * In / const KINT16 * In
+    // Parameter:   KINT16 * Out / KOCTET * Out
+    // Parameter:   KUINT32 Samples
+    //************************************
+    static void DecodeMuLaw( const KOCTET * In, KINT16 * Out, KUINT32 Samples );
+    static void EncodeMuLaw( const KINT16 * In, KOCTET * Out, KUINT32 Samples );
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioCodec::DecodePCM8
+    //              KDIS::UTILS::AudioCodec::EncodePCM8
+    // Description: 8 bit unsigned linear PCM to and from 16 bit PCM.
+    // Parameter:   const KOCTET * In / const KINT16 * In
+    // Parameter:   KINT16 * Out / KOCTET * Out
+    // Parameter:   KUINT32 Samples
+    //************************************
+    static void DecodePCM8( const KOCTET * In, KINT16 * Out, KUINT32 Samples );
+    static void EncodePCM8( const KINT16 * In, KOCTET * Out, KUINT32 Samples );
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioCodec::DecodePCM16
+    //              KDIS::UTILS::AudioCodec::EncodePCM16
+    // Description: 16 bit linear PCM in the given byte order to and from machine endian,
+    //              the bytes are swapped when the orders differ.
+    // Parameter:   const KOCTET * In / const KINT16 * In
+    // Parameter:   KINT16 * Out / KOCTET * Out
+    // Parameter:   KUINT32 Samples
+    // Parameter:   KBOOL BigEndian - The byte order of the encoded samples.
+    //************************************
+    static void DecodePCM16( const KOCTET * In, KINT16 * Out, KUINT32 Samples, KBOOL BigEndian );
+    static void EncodePCM16( const KINT16 * In, KOCTET * Out, KUINT32 Samples, KBOOL BigEndian );
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioCodec::SwapPCM16
+    // Description: Reverses the byte order of 16 bit samples.
+    // Parameter:   const KOCTET * In
+    // Parameter:   KOCTET * Out
+    // Parameter:   KUINT32 Samples
+    //************************************
+    static void SwapPCM16( const KOCTET * In, KOCTET * Out, KUINT32 Samples );
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioCodec::PCM16ToFloat
+    //              KDIS::UTILS::AudioCodec::FloatToPCM16
+    // Description: 16 bit PCM to and from float PCM, a float outside -1 to 1 is clipped
+    //              and NaN is converted to silence.
+    // Parameter:   const KINT16 * In / const KFLOAT32 * In
+    // Parameter:   KFLOAT32 * Out / KINT16 * Out
+    // Parameter:   KUINT32 Samples
+    //************************************
+    static void PCM16ToFloat( const KINT16 * In, KFLOAT32 * Out, KUINT32 Samples );
+    static void FloatToPCM16( const KFLOAT32 * In, KINT16 * Out, KUINT32 Samples );
+};
+
+} // END namespace UTILS
+} // END namespace KDIS
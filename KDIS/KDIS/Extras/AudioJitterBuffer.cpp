@@ -0,0 +1,345 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./AudioJitterBuffer.h"
+#include "./AudioCodec.h"
+#include "./../DataTypes/Enums/EnumRadio.h"
+#include <cstring>
+#include <cmath>
+
+using namespace KDIS;
+using namespace UTILS;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+void AudioJitterBuffer::resync( KUINT32 TimeStamp )
+{
+    memset( &m_vRing[0], m_Silence, m_vRing.size() );
+
+    if( m_bSynced )++m_ui64Resyncs;
+    m_bSynced = true;
+    m_bPlaying = false;
+    m_ui32AnchorTimeStamp = TimeStamp;
+    m_i64AnchorPos = 0;
+    m_ui32AnchorSamples = 0;
+    m_i64Read = 0;
+    m_i64End = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void AudioJitterBuffer::copyRing( KINT64 Pos, const KOCTET * In, KOCTET * Out, KUINT32 Samples )
+{
+    const KUINT32 ui32Index = ( KUINT32 )( Pos % m_ui32Capacity );
+    const KUINT32 ui32First = ( Samples < m_ui32Capacity - ui32Index ) ? Samples : m_ui32Capacity - ui32Index;
+    const KUINT32 ui32FirstSz = ui32First * m_ui8SampleSize;
+    const KUINT32 ui32SecondSz = ( Samples - ui32First ) * m_ui8SampleSize;
+    KOCTET * pRing = &m_vRing[0];
+    KOCTET * pSlot = pRing + ui32Index * m_ui8SampleSize;
+
+    if( Out )
+    {
+        // Leave silence behind for the next time round the ring.
+        memcpy( Out, pSlot, ui32FirstSz );
+        memcpy( Out + ui32FirstSz, pRing, ui32SecondSz );
+        memset( pSlot, m_Silence, ui32FirstSz );
+        memset( pRing, m_Silence, ui32SecondSz );
+    }
+    else
+    {
+        memcpy( pSlot, In, ui32FirstSz );
+        memcpy( pRing, In + ui32FirstSz, ui32SecondSz );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+AudioJitterBuffer::AudioJitterBuffer( KUINT32 RingSamples /*= 16384*/, KUINT32 FrameSamples /*= 160*/,
+                                      KUINT32 DelaySamples /*= 480*/ ) throw( KException ) :
+    m_ui32Capacity( RingSamples ),
+    m_ui32FrameSamples( FrameSamples ),
+    m_ui32DelaySamples( DelaySamples ),
+    m_ui16EncodingType( 0 ),
+    m_ui32SampleRate( 0 ),
+    m_ui8SampleSize( 0 ),
+    m_Silence( 0 ),
+    m_bSynced( false ),
+    m_bPlaying( false ),
+    m_ui32AnchorTimeStamp( 0 ),
+    m_i64AnchorPos( 0 ),
+    m_ui32AnchorSamples( 0 ),
+    m_i64Read( 0 ),
+    m_i64End( 0 ),
+    m_ui64Blocks( 0 ),
+    m_ui64Late( 0 ),
+    m_ui64Resyncs( 0 ),
+    m_ui64Underruns( 0 ),
+    m_ui64Unsupported( 0 )
+{
+    if( FrameSamples == 0 || ( KUINT64 )DelaySamples + FrameSamples >= RingSamples )
+    {
+        throw KException( __FUNCTION__, INVALID_DATA, "The ring must hold more than the play delay and a frame" );
+    }
+
+    // Room for the largest sample size.
+    m_vRing.resize( RingSamples * 2 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+AudioJitterBuffer::~AudioJitterBuffer()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KOCTET AudioJitterBuffer::GetSilence( KUINT16 EncodingType )
+{
+    switch( EncodingType )
+    {
+        case _8_bit_mu_law:
+            return ( KOCTET )0xFF;
+
+        case _8_bit_linear_PCM:
+            return ( KOCTET )0x80; // Unsigned, centred on 128.
+    }
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT64 AudioJitterBuffer::TimeStampToSamples( KUINT32 From, KUINT32 To, KUINT32 SampleRate )
+{
+    // The time is the upper 31 bits, in units of 3600 / 2^31 seconds.
+    KINT64 i64Units = ( ( To >> 1 ) - ( From >> 1 ) ) & 0x7FFFFFFF;
+    if( i64Units >= 0x40000000 )i64Units -= 0x80000000LL;
+
+    return ( KINT64 )floor( ( KFLOAT64 )i64Units * 3600.0 * SampleRate / 2147483648.0 + 0.5 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL AudioJitterBuffer::Write( KUINT32 TimeStamp, KUINT16 EncodingType, KUINT32 SampleRate, const KOCTET * Data, KUINT32 Samples )
+{
+    const KUINT8 ui8Size = AudioCodec::GetSampleSize( EncodingType );
+    // A block larger than the ring could never be stored, it is not supported.
+    if( ui8Size == 0 || Samples > m_ui32Capacity )
+    {
+        ++m_ui64Unsupported;
+        return false;
+    }
+
+    if( Samples == 0 )return false;
+
+    if( !m_bSynced || EncodingType != m_ui16EncodingType || SampleRate != m_ui32SampleRate )
+    {
+        m_ui16EncodingType = EncodingType;
+        m_ui32SampleRate = SampleRate;
+        m_ui8SampleSize = ui8Size;
+        m_Silence = GetSilence( EncodingType );
+        resync( TimeStamp );
+    }
+
+    // Time stamps jitter with the sender's clock. Blocks the same size as the anchor are
+    // placed on its grid, any other block close to the end of the anchor is joined to it,
+    // so the stream stays seamless.
+    KINT64 i64Pos = m_i64AnchorPos + TimeStampToSamples( m_ui32AnchorTimeStamp, TimeStamp, SampleRate );
+    const KINT64 i64Half = Samples / 2;
+    if( Samples == m_ui32AnchorSamples )
+    {
+        const KINT64 i64Offset = i64Pos - m_i64AnchorPos;
+        i64Pos = m_i64AnchorPos + ( ( i64Offset >= 0 ? i64Offset + i64Half : i64Offset - i64Half ) / Samples ) * Samples;
+    }
+    else if( i64Pos >= m_i64AnchorPos + m_ui32AnchorSamples - i64Half && i64Pos <= m_i64AnchorPos + m_ui32AnchorSamples + i64Half )
+    {
+        i64Pos = m_i64AnchorPos + m_ui32AnchorSamples;
+    }
+
+    // Too far ahead to fit, a new talk spurt after the buffer ran dry or
+    // so far behind that the sender's clock must have been reset.
+    if( i64Pos + Samples > m_i64Read + m_ui32Capacity ||
+        ( !m_bPlaying && i64Pos - m_i64End > m_ui32DelaySamples ) ||
+        i64Pos + m_ui32Capacity < m_i64Read )
+    {
+        resync( TimeStamp );
+        i64Pos = 0;
+    }
+
+    if( i64Pos + Samples <= m_i64Read )
+    {
+        ++m_ui64Late;
+        return false;
+    }
+
+    if( i64Pos >= m_i64AnchorPos )
+    {
+        m_ui32AnchorTimeStamp = TimeStamp;
+        m_i64AnchorPos = i64Pos;
+        m_ui32AnchorSamples = Samples;
+    }
+
+    // Drop the part that has already been played.
+    if( i64Pos < m_i64Read )
+    {
+        const KUINT32 ui32Skip = ( KUINT32 )( m_i64Read - i64Pos );
+        Data += ui32Skip * ui8Size;
+        Samples -= ui32Skip;
+        i64Pos = m_i64Read;
+    }
+
+    copyRing( i64Pos, Data, NULL, Samples );
+    if( i64Pos + Samples > m_i64End )m_i64End = i64Pos + Samples;
+
+    ++m_ui64Blocks;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL AudioJitterBuffer::IsFrameReady() const
+{
+    if( !m_bSynced )return false;
+    return m_i64End - m_i64Read >= ( m_bPlaying ? 0 : m_ui32DelaySamples ) + m_ui32FrameSamples;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL AudioJitterBuffer::ReadFrame( KOCTET * Out )
+{
+    if( !IsFrameReady() )
+    {
+        if( m_bPlaying )
+        {
+            ++m_ui64Underruns;
+            m_bPlaying = false;
+        }
+        return false;
+    }
+
+    m_bPlaying = true;
+    copyRing( m_i64Read, NULL, Out, m_ui32FrameSamples );
+    m_i64Read += m_ui32FrameSamples;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void AudioJitterBuffer::Reset()
+{
+    // The ring is silenced when the next stream starts.
+    m_bSynced = false;
+    m_bPlaying = false;
+    m_i64Read = 0;
+    m_i64End = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT16 AudioJitterBuffer::GetEncodingType() const
+{
+    return m_ui16EncodingType;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 AudioJitterBuffer::GetSampleRate() const
+{
+    return m_ui32SampleRate;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 AudioJitterBuffer::GetFrameSamples() const
+{
+    return m_ui32FrameSamples;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 AudioJitterBuffer::GetFrameSize() const
+{
+    return m_ui32FrameSamples * m_ui8SampleSize;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 AudioJitterBuffer::GetBuffered() const
+{
+    return m_bSynced ? ( KUINT32 )( m_i64End - m_i64Read ) : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL AudioJitterBuffer::IsPlaying() const
+{
+    return m_bPlaying;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 AudioJitterBuffer::GetBlockCount() const
+{
+    return m_ui64Blocks;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 AudioJitterBuffer::GetLateCount() const
+{
+    return m_ui64Late;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 AudioJitterBuffer::GetResyncCount() const
+{
+    return m_ui64Resyncs;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 AudioJitterBuffer::GetUnderrunCount() const
+{
+    return m_ui64Underruns;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 AudioJitterBuffer::GetUnsupportedCount() const
+{
+    return m_ui64Unsupported;
+}
+
+//////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,208 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      AudioJitterBuffer
+    created:    19/10/2026
+
+    purpose:    Reorders and de-jitters the audio of one radio transmitter. Each block of
+                samples is placed in a ring by its position in the stream, worked out
+                from the PDU time stamp and the sample rate, so late and out of order
+                Signal PDU land where they belong and missing samples play as silence.
+                Playout starts once the play delay has been buffered and the samples are
+                read in fixed size frames.
+
+                The samples are kept as they arrive, still encoded, only the encodings with
+                a fixed sample size are supported: 8 bit mu-law, 8 bit linear PCM and
+                16 bit linear PCM. The ring is allocated up front, writing and reading
+                never allocate.
+*********************************************************************/
+
+#pragma once
+
+#include "./../KDefines.h"
+#include <vector>
+
+namespace KDIS {
+namespace UTILS {
+
+class KDIS_EXPORT AudioJitterBuffer
+{
+protected:
+
+    std::vector<KOCTET> m_vRing;
+
+    KUINT32 m_ui32Capacity;
+    KUINT32 m_ui32FrameSamples;
+    KUINT32 m_ui32DelaySamples;
+
+    // The format of the stream, a change of format restarts it.
+    KUINT16 m_ui16EncodingType;
+    KUINT32 m_ui32SampleRate;
+    KUINT8 m_ui8SampleSize;
+    KOCTET m_Silence;
+
+    // Positions are in samples from the start of the stream. The newest in order
+    // block anchors the positions of the blocks that follow it.
+    KBOOL m_bSynced;
+    KBOOL m_bPlaying;
+    KUINT32 m_ui32AnchorTimeStamp;
+    KINT64 m_i64AnchorPos;
+    KUINT32 m_ui32AnchorSamples;
+    KINT64 m_i64Read;
+    KINT64 m_i64End;
+
+    KUINT64 m_ui64Blocks;
+    KUINT64 m_ui64Late;
+    KUINT64 m_ui64Resyncs;
+    KUINT64 m_ui64Underruns;
+    KUINT64 m_ui64Unsupported;
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioJitterBuffer::resync
+    // Description: Restarts the stream at the block being written, the ring is silenced
+    //              and playout waits for the play delay again.
+    // Parameter:   KUINT32 TimeStamp
+    //************************************
+    void resync( KUINT32 TimeStamp );
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioJitterBuffer::copyRing
+    // Description: Copies samples into or out of the ring at a stream position,
+    //              wrapping at the end. Pass a NULL Out to write In, else In is ignored.
+    // Parameter:   KINT64 Pos
+    // Parameter:   const KOCTET * In
+    // Parameter:   KOCTET * Out
+    // Parameter:   KUINT32 Samples
+    //************************************
+    void copyRing( KINT64 Pos, const KOCTET * In, KOCTET * Out, KUINT32 Samples );
+
+public:
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioJitterBuffer::AudioJitterBuffer
+    // Description: The sizes are in samples. The ring must hold more than the play delay
+    //              and a frame, a block that does not fit restarts the stream.
+    // Parameter:   KUINT32 RingSamples
+    // Parameter:   KUINT32 FrameSamples - Samples returned by each ReadFrame.
+    // Parameter:   KUINT32 DelaySamples - Samples buffered before playout starts.
+    //************************************
+    AudioJitterBuffer( KUINT32 RingSamples = 16384, KUINT32 FrameSamples = 160, KUINT32 DelaySamples = 480 ) throw( KException );
+
+    virtual ~AudioJitterBuffer();
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioJitterBuffer::GetSilence
+    // Description: The value of a silent sample for an audio encoding type(see EncodingType),
+    //              the sample sizes are given by AudioCodec::GetSampleSize.
+    // Parameter:   KUINT16 EncodingType
+    //************************************
+    static KOCTET GetSilence( KUINT16 EncodingType );
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioJitterBuffer::TimeStampToSamples
+    // Description: Returns the number of samples between two DIS time stamps, negative when
+    //              To is before From. The time stamps wrap every hour so they must be less
+    //              than half an hour apart.
+    // Parameter:   KUINT32 From
+    // Parameter:   KUINT32 To
+    // Parameter:   KUINT32 SampleRate
+    //************************************
+    static KINT64 TimeStampToSamples( KUINT32 From, KUINT32 To, KUINT32 SampleRate );
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioJitterBuffer::Write
+    // Description: Adds a block of encoded samples. Returns false if the block was
+    //              not stored because it arrived too late, the encoding is not supported
+    //              or it holds more samples than the ring.
+    // Parameter:   KUINT32 TimeStamp - The raw DIS time stamp of the PDU.
+    // Parameter:   KUINT16 EncodingType
+    // Parameter:   KUINT32 SampleRate
+    // Parameter:   const KOCTET * Data
+    // Parameter:   KUINT32 Samples
+    //************************************
+    KBOOL Write( KUINT32 TimeStamp, KUINT16 EncodingType, KUINT32 SampleRate, const KOCTET * Data, KUINT32 Samples );
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioJitterBuffer::IsFrameReady
+    // Description: True when ReadFrame will return a frame.
+    //************************************
+    KBOOL IsFrameReady() const;
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioJitterBuffer::ReadFrame
+    // Description: Copies the next frame, GetFrameSize octets, to Out and returns true.
+    //              Returns false while buffering, running out of samples counts as an
+    //              underrun and buffering starts again.
+    // Parameter:   KOCTET * Out
+    //************************************
+    KBOOL ReadFrame( KOCTET * Out );
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioJitterBuffer::Reset
+    // Description: Empties the buffer and forgets the stream, the counters are kept.
+    //************************************
+    void Reset();
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioJitterBuffer::GetEncodingType
+    //              KDIS::UTILS::AudioJitterBuffer::GetSampleRate
+    //              KDIS::UTILS::AudioJitterBuffer::GetFrameSamples
+    //              KDIS::UTILS::AudioJitterBuffer::GetFrameSize
+    //              KDIS::UTILS::AudioJitterBuffer::GetBuffered
+    //              KDIS::UTILS::AudioJitterBuffer::IsPlaying
+    // Description: The stream format, the frame size in samples and octets and the
+    //              number of samples buffered ahead of the read position.
+    //************************************
+    KUINT16 GetEncodingType() const;
+    KUINT32 GetSampleRate() const;
+    KUINT32 GetFrameSamples() const;
+    KUINT32 GetFrameSize() const;
+    KUINT32 GetBuffered() const;
+    KBOOL IsPlaying() const;
+
+    //************************************
+    // FullName:    KDIS::UTILS::AudioJitterBuffer::GetBlockCount
+    //              KDIS::UTILS::AudioJitterBuffer::GetLateCount
+    //              KDIS::UTILS::AudioJitterBuffer::GetResyncCount
+    //              KDIS::UTILS::AudioJitterBuffer::GetUnderrunCount
+    //              KDIS::UTILS::AudioJitterBuffer::GetUnsupportedCount
+    // Description: Blocks stored, blocks dropped for arriving after they were due to play,
+    //              stream restarts, underruns and blocks in an unsupported encoding or
+    //              larger than the ring.
+    //************************************
+    KUINT64 GetBlockCount() const;
+    KUINT64 GetLateCount() const;
+    KUINT64 GetResyncCount() const;
+    KUINT64 GetUnderrunCount() const;
+    KUINT64 GetUnsupportedCount() const;
+};
+
+} // END namespace UTILS
+} // END namespace KDIS
@@ -430,6 +430,105 @@ inline Type Dot( Type const a[3] ,Type const b[3] )
     return  a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
 };
 
+/************************************************************************/
+/* Local tangent frames                                                 */
+/************************************************************************/
+
+//************************************
+// FullName:    KDIS::UTILS::LocalFrame<Type>
+// Description: The local North, East and Down unit vectors of a geodetic
+//              position expressed in the geocentric(ECEF) frame.
+//              The frame only depends on lat/lon so it can be calculated once and
+//              shared between all entities in the same area, see LocalFrameCache.
+//************************************
+
+template<class Type>
+struct LocalFrame
+{
+    Type N[3];
+    Type E[3];
+    Type D[3];
+};
+
+//************************************
+// FullName:    KDIS::UTILS<Type>::CalculateLocalFrame
+// Description: Calculates the local NED frame for a geodetic position.
+// Parameter:   Type Lat - Geodetic Latitude in radians
+// Parameter:   Type Lon - Geodetic Longitude in radians
+// Parameter:   LocalFrame<Type> & F - Frame out
+//************************************
+
+template<class Type>
+inline void CalculateLocalFrame( Type Lat, Type Lon, LocalFrame<Type> & F )
+{
+    const Type SinLat = static_cast<Type>( sin( Lat ) );
+    const Type CosLat = static_cast<Type>( cos( Lat ) );
+    const Type SinLon = static_cast<Type>( sin( Lon ) );
+    const Type CosLon = static_cast<Type>( cos( Lon ) );
+
+    // 'N'
+    F.N[0] = -SinLat * CosLon;
+    F.N[1] = -SinLat * SinLon;
+    F.N[2] =  CosLat;
+
+    // 'E'
+    F.E[0] = -SinLon;
+    F.E[1] =  CosLon;
+    F.E[2] =  0;
+
+    // 'D'
+    F.D[0] = -CosLat * CosLon;
+    F.D[1] = -CosLat * SinLon;
+    F.D[2] = -SinLat;
+};
+
+//************************************
+// FullName:    KDIS::UTILS<Type>::HeadingPitchRollToEuler
+// Description: Converts Heading, Pitch and Roll to Euler for DIS using a precalculated local frame.
+// Parameter:   Type H - Heading in radians
+// Parameter:   Type P - Pitch in radians
+// Parameter:   Type R - Roll in radians
+// Parameter:   const LocalFrame<Type> & F - Local NED frame of the entity
+// Parameter:   Type & Psi - Euler angle out
+// Parameter:   Type & Theta - Euler angle out
+// Parameter:   Type & Phi - Euler angle out
+//************************************
+
+template<class Type>
+inline void HeadingPitchRollToEuler( Type H, Type P, Type R, const LocalFrame<Type> & F, Type & Psi, Type & Theta,
+                                     Type & Phi )
+{
+    const Type SinH = static_cast<Type>( sin( H ) ), CosH = static_cast<Type>( cos( H ) );
+    const Type SinP = static_cast<Type>( sin( P ) ), CosP = static_cast<Type>( cos( P ) );
+    const Type SinR = static_cast<Type>( sin( R ) ), CosR = static_cast<Type>( cos( R ) );
+
+    // Body x and y axis in the local frame.
+    const Type Xn = CosH * CosP, Xe = SinH * CosP, Xd = -SinP;
+    const Type Yn = -CosR * SinH + SinR * SinP * CosH;
+    const Type Ye =  CosR * CosH + SinR * SinP * SinH;
+    const Type Yd =  SinR * CosP;
+
+    // Now into the geocentric frame.
+    Type X[3], Y[3];
+    for( KUINT8 i = 0; i < 3; ++i )
+    {
+        X[i] = Xn * F.N[i] + Xe * F.E[i] + Xd * F.D[i];
+        Y[i] = Yn * F.N[i] + Ye * F.E[i] + Yd * F.D[i];
+    }
+
+    // calculate angles from vectors
+    Psi = static_cast<Type>( atan2( X[1], X[0] ) );
+    Theta = static_cast<Type>( atan2( -X[2], sqrt( X[0] * X[0] + X[1] * X[1] ) ) );
+
+    const Type SinPsi = static_cast<Type>( sin( Psi ) ), CosPsi = static_cast<Type>( cos( Psi ) );
+    const Type SinTheta = static_cast<Type>( sin( Theta ) ), CosTheta = static_cast<Type>( cos( Theta ) );
+
+    // Y . y2 and Y . z2
+    const Type Yy2 = -SinPsi * Y[0] + CosPsi * Y[1];
+    const Type Yz2 = SinTheta * ( CosPsi * Y[0] + SinPsi * Y[1] ) + CosTheta * Y[2];
+    Phi = static_cast<Type>( atan2( Yz2, Yy2 ) );
+};
+
 //************************************
 // FullName:    KDIS::UTILS<Type>::HeadingPitchRollToEuler
 // Description: Converts Heading, Pitch and Roll to Euler for DIS.
@@ -447,57 +546,55 @@ template<class Type>
 inline void HeadingPitchRollToEuler( Type H, Type P, Type R, Type Lat, Type Lon, Type & Psi, Type & Theta,
                                      Type & Phi )
 {
-    // local NED
-    //Type const  D0[3] = { 1.0 , 0.0 , 0.0 };
-    Type const  E0[3] = { 0.0 , 1.0 , 0.0 };
-    Type const  N0[3] = { 0.0 , 0.0 , 1.0 };
-    Type        me[3];
-    Type        N[3];
-    Type        E[3];
-    Type        D[3];
-    // 'E'
-    RotateAboutAxis( E , E0 , N0 , Lon );
-    me[0] = -E[0] ;
-    me[1] = -E[1] ;
-    me[2] = -E[2] ;
-    // 'N'
-    RotateAboutAxis( N , N0 , me , Lat );
-    // 'D'
-    Cross( D , N , E );
-    /*
-    *  Orientation
-    */
-    // rotate about D by heading
-    Type  N1[3] , E1[3] , D1[3] ;
-    RotateAboutAxis( N1 , N  , D , H );
-    RotateAboutAxis( E1 , E  , D , H );
-    memcpy( D1 , D  , sizeof( Type[3] ) );
-    // rotate about E1 vector by pitch
-    Type  N2[3] , E2[3] , D2[3] ;
-    RotateAboutAxis( N2 , N1 , E1 , P );
-    memcpy( E2 , E1 , sizeof( Type[3] ) );
-    RotateAboutAxis( D2 , D1 , E1 , P );
-    // rotate about N2 by roll
-    Type  N3[3] , E3[3] , D3[3] ;
-    memcpy( N3 , N2 , sizeof( Type[3] ) );
-    RotateAboutAxis( E3 , E2 , N2 , R );
-    RotateAboutAxis( D3 , D2 , N2 , R );
-
-    // calculate angles from vectors
-    Type  x0[3] = { 1.0 , 0.0 , 0.0 };   // == D0
-    Type  y0[3] = { 0.0 , 1.0 , 0.0 };   // == E0
-    Type  z0[3] = { 0.0 , 0.0 , 1.0 };   // == Z0
-    Type  y2[3] ;
-    Type  z2[3] ;
-    Psi = static_cast<Type>(atan2(  Dot( N3 , y0 ) , Dot( N3 , x0 ) ));
-    Theta = static_cast<Type>(atan2( -Dot( N3 , z0 ) , sqrt( pow(Dot( N3 , x0 ), 2) + pow(Dot( N3 , y0 ), 2) ) ));
-    RotateAboutAxis( y2 , y0 , z0 , Psi );
-    RotateAboutAxis( z2 , z0 , y2 , Theta );
-    Phi = static_cast<Type>(atan2(  Dot( E3 , z2 ) , Dot( E3 , y2 ) ));
+    LocalFrame<Type> F;
+    CalculateLocalFrame( Lat, Lon, F );
+    HeadingPitchRollToEuler( H, P, R, F, Psi, Theta, Phi );
 };
 
 //////////////////////////////////////////////////////////////////////////
 
+//************************************
+// FullName:    KDIS::UTILS<Type>::EulerToHeadingPitchRoll
+// Description: Converts Euler to Heading, Pitch and Roll using a precalculated local frame.
+// Parameter:   const LocalFrame<Type> & F - Local NED frame of the entity
+// Parameter:   Type Psi - Euler angle
+// Parameter:   Type Theta - Euler angle
+// Parameter:   Type Phi - Euler angle
+// Parameter:   Type & H - Heading in radians out
+// Parameter:   Type & P - Pitch in radians out
+// Parameter:   Type & R - Roll in radians out
+//************************************
+
+template<class Type>
+inline void EulerToHeadingPitchRoll( const LocalFrame<Type> & F, Type Psi, Type Theta, Type Phi, Type & H, Type & P, Type & R )
+{
+    const Type SinPsi = static_cast<Type>( sin( Psi ) ), CosPsi = static_cast<Type>( cos( Psi ) );
+    const Type SinTheta = static_cast<Type>( sin( Theta ) ), CosTheta = static_cast<Type>( cos( Theta ) );
+    const Type SinPhi = static_cast<Type>( sin( Phi ) ), CosPhi = static_cast<Type>( cos( Phi ) );
+
+    // Body x and y axis in the geocentric frame.
+    const Type X[3] = { CosPsi * CosTheta, SinPsi * CosTheta, -SinTheta };
+    const Type Y[3] = { -CosPhi * SinPsi + SinPhi * SinTheta * CosPsi,
+                         CosPhi * CosPsi + SinPhi * SinTheta * SinPsi,
+                         SinPhi * CosTheta };
+
+    // Now into the local frame.
+    const Type Xn = Dot( X, F.N ), Xe = Dot( X, F.E ), Xd = Dot( X, F.D );
+    const Type Yn = Dot( Y, F.N ), Ye = Dot( Y, F.E ), Yd = Dot( Y, F.D );
+
+    // calculate angles from vectors
+    H = static_cast<Type>( atan2( Xe, Xn ) );
+    P = static_cast<Type>( atan2( -Xd, sqrt( Xn * Xn + Xe * Xe ) ) );
+
+    const Type SinH = static_cast<Type>( sin( H ) ), CosH = static_cast<Type>( cos( H ) );
+    const Type SinP = static_cast<Type>( sin( P ) ), CosP = static_cast<Type>( cos( P ) );
+
+    // Y . y2 and Y . z2
+    const Type Yy2 = -SinH * Yn + CosH * Ye;
+    const Type Yz2 = SinP * ( CosH * Yn + SinH * Ye ) + CosP * Yd;
+    R = static_cast<Type>( atan2( Yz2, Yy2 ) );
+};
+
 //************************************
 // FullName:    KDIS::UTILS<Type>::EulerToHeadingPitchRoll
 // Description: Converts Euler to Heading, Pitch and Roll.
@@ -514,64 +611,245 @@ inline void HeadingPitchRollToEuler( Type H, Type P, Type R, Type Lat, Type Lon,
 template<class Type>
 void EulerToHeadingPitchRoll( Type Lat, Type Lon, Type Psi, Type Theta, Type Phi, Type & H, Type & P, Type & R )
 {
-    // local NED vectors in ECEF coordinate frame
-    Type  N[3] ;
-    Type  E[3] ;
-    Type  D[3] ;
-
-    // Calculate NED from lat and lon
-    // local NED
-    //Type const  D0[3] = { 1. , 0. , 0. };
-    Type const  E0[3] = { 0. , 1. , 0. };
-    Type const  N0[3] = { 0. , 0. , 1. };
-    Type        me[3] ;
-    // 'E'
-    RotateAboutAxis( E , E0 , N0 , Lon );
-    me[0] = -E[0] ;
-    me[1] = -E[1] ;
-    me[2] = -E[2] ;
-    // 'N'
-    RotateAboutAxis( N , N0 , me , Lat );
-    // 'D'
-    Cross( D , N , E );
-    /*
-     *  Orientation:
-     *    input : (x0,y0,z0)=(N,E,D) and (Psi,Theta,Phi Euler angles)
-     *    output: (x3,y3,z3)=body vectors in local frame
-     */
-    // rotate about Z by Psi
-    Type  X[]= {1.,0.,0.};
-    Type  Y[]= {0.,1.,0.};
-    Type  Z[]= {0.,0.,1.};
-    Type  X1[3] , Y1[3] , Z1[3] ;
-    RotateAboutAxis( X1 , X  , Z , Psi );
-    RotateAboutAxis( Y1 , Y  , Z , Psi );
-    memcpy(          Z1 , Z  , sizeof( Type[3] ) );
-    // rotate about Y1 vector by Theta
-    Type  X2[3] , Y2[3] , Z2[3] ;
-    RotateAboutAxis( X2 , X1 , Y1 , Theta );
-    memcpy(          Y2 , Y1 , sizeof( Type[3] ) );
-    RotateAboutAxis( Z2 , Z1 , Y1 , Theta );
-    // rotate about X2 by Phi
-    Type  X3[3] , Y3[3] , Z3[3] ;
-    memcpy(          X3 , X2 , sizeof( Type[3] ) );
-    RotateAboutAxis( Y3 , Y2 , X2 , Phi );
-    RotateAboutAxis( Z3 , Z2 , X2 , Phi );
-    // calculate angles from vectors
-    Type x0[3];
-    memcpy( x0 , N , sizeof( Type[3] ) );
-    Type y0[3];
-    memcpy( y0 , E , sizeof( Type[3] ) );
-    Type z0[3];
-    memcpy( z0 , D , sizeof( Type[3] ) );
-    Type  y2[3] ;
-    Type  z2[3] ;
-    H = static_cast<Type>(atan2(  Dot( X3 , y0 ) , Dot( X3 , x0 ) ));
-    P = static_cast<Type>(atan2( -Dot( X3 , z0 ) , sqrt( pow(Dot( X3 , x0 ), 2) + pow(Dot( X3 , y0 ), 2) ) ));
-    RotateAboutAxis( y2 , y0 , z0 , H );
-    RotateAboutAxis( z2 , z0 , y2 , P );
-    R = static_cast<Type>(atan2(  Dot( Y3 , z2 ) , Dot( Y3 , y2 ) ));
+    LocalFrame<Type> F;
+    CalculateLocalFrame( Lat, Lon, F );
+    EulerToHeadingPitchRoll( F, Psi, Theta, Phi, H, P, R );
 }
 
+/************************************************************************/
+/* Local frame cache                                                    */
+/************************************************************************/
+
+//************************************
+// FullName:    KDIS::UTILS::LocalFrameCache<Type>
+// Description: Caches local NED frames in lat/lon tiles. Every position that falls
+//              inside a tile shares the frame calculated at the centre of the tile so
+//              entities that are clustered together in the same theatre only pay for
+//              the trigonometry once.
+//              The cache is direct mapped, a tile that maps to an occupied slot replaces it.
+//              Note: The frame is only exact at the centre of the tile, the orientation error
+//              is bounded by half of the tile size. The default tile size of 0.0001 radians (around 600m)
+//              gives an error below 0.003 degrees.
+//              Note: The cache is not thread safe, use one cache per thread.
+//************************************
+
+template<class Type>
+class LocalFrameCache
+{
+public:
+
+    static const KUINT32 CACHE_SIZE = 256; // Must be a power of 2.
+
+private:
+
+    struct Entry
+    {
+        KINT32 m_i32LatTile;
+        KINT32 m_i32LonTile;
+        KBOOL m_bValid;
+        LocalFrame<Type> m_Frame;
+    };
+
+    Entry m_Entries[CACHE_SIZE];
+
+    LocalFrame<Type> m_Uncached;
+
+    Type m_TileSize;
+
+    KUINT32 m_ui32Hits;
+
+    KUINT32 m_ui32Misses;
+
+public:
+
+    // The smallest tile size accepted(around 0.6m). Smaller tiles would overflow the tile index.
+    static Type MinTileSize()
+    {
+        return static_cast<Type>( 0.0000001 );
+    };
+
+    LocalFrameCache( Type TileSize = static_cast<Type>( 0.0001 ) ) throw( KException ) :
+        m_TileSize( 0 ),
+        m_ui32Hits( 0 ),
+        m_ui32Misses( 0 )
+    {
+        SetTileSize( TileSize );
+    };
+
+    //************************************
+    // FullName:    KDIS::UTILS::LocalFrameCache<Type>::SetTileSize
+    //              KDIS::UTILS::LocalFrameCache<Type>::GetTileSize
+    // Description: The size of each tile in radians. Changing the size clears the cache.
+    //              Throws INVALID_DATA if the size is NaN or smaller than MinTileSize.
+    // Parameter:   Type TS
+    //************************************
+    void SetTileSize( Type TS ) throw( KException )
+    {
+        // Written so that NaN fails the test as well.
+        if( !( TS >= MinTileSize() ) )throw KException( __FUNCTION__, INVALID_DATA, "Tile size must be at least MinTileSize" );
+
+        m_TileSize = TS;
+        Clear();
+    };
+
+    Type GetTileSize() const
+    {
+        return m_TileSize;
+    };
+
+    //************************************
+    // FullName:    KDIS::UTILS::LocalFrameCache<Type>::Clear
+    // Description: Removes all cached frames and resets the hit/miss counters.
+    //************************************
+    void Clear()
+    {
+        for( KUINT32 i = 0; i < CACHE_SIZE; ++i )
+        {
+            m_Entries[i].m_bValid = false;
+        }
+        m_ui32Hits = 0;
+        m_ui32Misses = 0;
+    };
+
+    //************************************
+    // FullName:    KDIS::UTILS::LocalFrameCache<Type>::GetHits
+    //              KDIS::UTILS::LocalFrameCache<Type>::GetMisses
+    // Description: Number of lookups that were served from the cache and the
+    //              number that required a new frame to be calculated.
+    //************************************
+    KUINT32 GetHits() const
+    {
+        return m_ui32Hits;
+    };
+
+    KUINT32 GetMisses() const
+    {
+        return m_ui32Misses;
+    };
+
+    //************************************
+    // FullName:    KDIS::UTILS::LocalFrameCache<Type>::GetFrame
+    // Description: Returns the local frame for the tile that contains the position.
+    //              The reference is valid until the next call to GetFrame or Clear.
+    // Parameter:   Type Lat - Geodetic Latitude in radians
+    // Parameter:   Type Lon - Geodetic Longitude in radians
+    //************************************
+    const LocalFrame<Type> & GetFrame( Type Lat, Type Lon )
+    {
+        const Type LatT = static_cast<Type>( floor( Lat / m_TileSize ) );
+        const Type LonT = static_cast<Type>( floor( Lon / m_TileSize ) );
+
+        // Positions whose tile does not fit in the index(unnormalised or NaN) are not cached.
+        const Type Limit = static_cast<Type>( 2147483646.0 );
+        if( !( LatT >= -Limit && LatT <= Limit && LonT >= -Limit && LonT <= Limit ) )
+        {
+            ++m_ui32Misses;
+            CalculateLocalFrame( Lat, Lon, m_Uncached );
+            return m_Uncached;
+        }
+
+        const KINT32 LatTile = static_cast<KINT32>( LatT );
+        const KINT32 LonTile = static_cast<KINT32>( LonT );
+
+        const KUINT32 Slot = ( ( static_cast<KUINT32>( LatTile ) * 73856093u ) ^
+                               ( static_cast<KUINT32>( LonTile ) * 19349663u ) ) & ( CACHE_SIZE - 1 );
+
+        Entry & E = m_Entries[Slot];
+        if( E.m_bValid && E.m_i32LatTile == LatTile && E.m_i32LonTile == LonTile )
+        {
+            ++m_ui32Hits;
+            return E.m_Frame;
+        }
+
+        ++m_ui32Misses;
+        E.m_i32LatTile = LatTile;
+        E.m_i32LonTile = LonTile;
+        E.m_bValid = true;
+        CalculateLocalFrame( static_cast<Type>( ( LatTile + 0.5 ) * m_TileSize ),
+                             static_cast<Type>( ( LonTile + 0.5 ) * m_TileSize ), E.m_Frame );
+        return E.m_Frame;
+    };
+};
+
+/************************************************************************/
+/* Batch orientation conversions                                        */
+/************************************************************************/
+
+// Number of entities converted per block by the batch conversions.
+static const KUINT32 BATCH_BLOCK_SIZE = 64;
+
+//************************************
+// FullName:    KDIS::UTILS<Type>::HeadingPitchRollToEuler
+// Description: Converts an array of Heading, Pitch and Roll values to Euler for DIS.
+//              Frames are taken from the cache so entities in the same tile share the frame.
+//              All arrays must hold at least Count values, all angles are in radians.
+//              The work is done in blocks of BATCH_BLOCK_SIZE, the frames for a block are
+//              looked up first so the conversion loop itself has no branches and can be
+//              vectorised by compilers that provide vector trigonometry(e.g. GCC with -O3
+//              -ffast-math and glibc's libmvec), otherwise it runs as a scalar loop.
+// Parameter:   const Type * H, const Type * P, const Type * R - Heading, Pitch and Roll in
+// Parameter:   const Type * Lat, const Type * Lon - Geodetic position in
+// Parameter:   Type * Psi, Type * Theta, Type * Phi - Euler angles out
+// Parameter:   KUINT32 Count
+// Parameter:   LocalFrameCache<Type> & Cache
+//************************************
+
+template<class Type>
+inline void HeadingPitchRollToEuler( const Type * H, const Type * P, const Type * R, const Type * Lat, const Type * Lon,
+                                     Type * Psi, Type * Theta, Type * Phi, KUINT32 Count, LocalFrameCache<Type> & Cache )
+{
+    LocalFrame<Type> F[BATCH_BLOCK_SIZE];
+
+    for( KUINT32 b = 0; b < Count; b += BATCH_BLOCK_SIZE )
+    {
+        const KUINT32 n = ( Count - b < BATCH_BLOCK_SIZE ) ? Count - b : BATCH_BLOCK_SIZE;
+
+        for( KUINT32 i = 0; i < n; ++i )
+        {
+            F[i] = Cache.GetFrame( Lat[b + i], Lon[b + i] );
+        }
+
+        for( KUINT32 i = 0; i < n; ++i )
+        {
+            HeadingPitchRollToEuler( H[b + i], P[b + i], R[b + i], F[i], Psi[b + i], Theta[b + i], Phi[b + i] );
+        }
+    }
+};
+
+//************************************
+// FullName:    KDIS::UTILS<Type>::EulerToHeadingPitchRoll
+// Description: Converts an array of Euler angles to Heading, Pitch and Roll.
+//              Frames are taken from the cache so entities in the same tile share the frame.
+//              All arrays must hold at least Count values, all angles are in radians.
+//              Blocked the same way as the batch HeadingPitchRollToEuler.
+// Parameter:   const Type * Lat, const Type * Lon - Geodetic position in
+// Parameter:   const Type * Psi, const Type * Theta, const Type * Phi - Euler angles in
+// Parameter:   Type * H, Type * P, Type * R - Heading, Pitch and Roll out
+// Parameter:   KUINT32 Count
+// Parameter:   LocalFrameCache<Type> & Cache
+//************************************
+
+template<class Type>
+inline void EulerToHeadingPitchRoll( const Type * Lat, const Type * Lon, const Type * Psi, const Type * Theta, const Type * Phi,
+                                     Type * H, Type * P, Type * R, KUINT32 Count, LocalFrameCache<Type> & Cache )
+{
+    LocalFrame<Type> F[BATCH_BLOCK_SIZE];
+
+    for( KUINT32 b = 0; b < Count; b += BATCH_BLOCK_SIZE )
+    {
+        const KUINT32 n = ( Count - b < BATCH_BLOCK_SIZE ) ? Count - b : BATCH_BLOCK_SIZE;
+
+        for( KUINT32 i = 0; i < n; ++i )
+        {
+            F[i] = Cache.GetFrame( Lat[b + i], Lon[b + i] );
+        }
+
+        for( KUINT32 i = 0; i < n; ++i )
+        {
+            EulerToHeadingPitchRoll( F[i], Psi[b + i], Theta[b + i], Phi[b + i], H[b + i], P[b + i], R[b + i] );
+        }
+    }
+};
+
 } // END namespace UTILS
 } // END namespace KDIS
@@ -53,32 +53,198 @@ purpose:    Implementation of a referenced smart pointer.
 
             - MyClass * p = pObj.GetPtr(); // p is not safe. It could be deleted when the KRef_Ptr goes out of scope leaving you with a NULL pointer.
 
-            - KRef_Ptr<MyClass> pRef = pObj.GetPtr(); // This will create a second reference to the pointer which will cause problems.
+            - KRef_Ptr<MyClass> pRef = pObj.GetPtr(); // This will create a second reference to the pointer which will cause problems(unless MyClass derives from KRef_Counted).
 
               instead use
 
               KRef_Ptr<MyClass> pRef = pObj;
+
+            -*Intrusive Counting:*-
+
+            Classes that derive from KRef_Counted carry their own reference count, KRef_Ptr will use the
+            embedded count instead of allocating a separate one. This halves the allocations for each object
+            and also makes it safe to create a new KRef_Ptr from a raw pointer that is already referenced.
+            Note: KRef_Counted should only appear once in a class hierarchy and should be placed in the
+            class that is used as the KRef_Ptr type, e.g VariableParameter for VarPrmPtr.
+            The PDU are not counted as most are never shared, use PduPtr::Make or KRef_Ptr<PDU>::Make
+            to create a shared PDU with a single allocation.
+
+            For types that are not intrusive, KRef_Ptr<MyClass>::Make( ... ) allocates the counter and the
+            object together in a single allocation.
+
+            -*Thread Safety:*-
+
+            The CounterPolicy decides how the reference count is updated. KRef_SingleThreaded is the fastest
+            but a referenced object must not be shared between threads. KRef_Atomic uses atomic operations
+            so copies of a KRef_Ptr may be created and destroyed in different threads, e.g when passing
+            decoded PDU to worker threads. Note: A single KRef_Ptr instance is still not safe to modify from
+            multiple threads at the same time.
+            The default policy is KRef_SingleThreaded unless KDIS_USE_ATOMIC_REF_COUNTING is defined.
 *********************************************************************/
 
 #pragma once
 
 #include "./../KDefines.h"
+#include <new>
+
+#if defined( KDIS_USE_ATOMIC_REF_COUNTING ) && ( defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 ) )
+#include <intrin.h>
+#endif
 
 namespace KDIS {
 namespace UTILS {
 
-typedef KDIS::KUINT16 RefCounter; // Change the counter to KUINT32 if you expect to have over 65,535 references.
+typedef KDIS::KUINT32 RefCounter;
+
+//************************************
+// FullName:    KDIS::UTILS::KRef_Count
+// Description: The reference count and a record of where it is stored,
+//              this tells the last KRef_Ptr how the memory should be released.
+//************************************
+struct KRef_Count
+{
+    enum Storage
+    {
+        Separate  = 0, // Counter allocated on its own.
+        Intrusive = 1, // Counter embedded in the object(KRef_Counted).
+        Combined  = 2  // Counter and object share a single allocation(KRef_Ptr::Make).
+    };
+
+    volatile RefCounter m_Count;
+
+    KUINT8 m_ui8Storage;
+};
+
+/************************************************************************/
+/* Counter Policies                                                     */
+/************************************************************************/
+
+class KRef_SingleThreaded
+{
+public:
+
+    static RefCounter Increment( volatile RefCounter & C )
+    {
+        return ++C;
+    };
+
+    static RefCounter Decrement( volatile RefCounter & C )
+    {
+        return --C;
+    };
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+class KRef_Atomic
+{
+public:
+
+    static RefCounter Increment( volatile RefCounter & C )
+    {
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+        return static_cast<RefCounter>( _InterlockedIncrement( reinterpret_cast<volatile long *>( &C ) ) );
+#else
+        return __sync_add_and_fetch( &C, 1 );
+#endif
+    };
+
+    static RefCounter Decrement( volatile RefCounter & C )
+    {
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+        return static_cast<RefCounter>( _InterlockedDecrement( reinterpret_cast<volatile long *>( &C ) ) );
+#else
+        return __sync_sub_and_fetch( &C, 1 );
+#endif
+    };
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+#ifdef KDIS_USE_ATOMIC_REF_COUNTING
+    typedef KRef_Atomic KRef_DefaultCounterPolicy;
+#else
+    typedef KRef_SingleThreaded KRef_DefaultCounterPolicy;
+#endif
+
+/************************************************************************/
+/* Intrusive Counting                                                   */
+/************************************************************************/
+
+class KRef_Counted;
+inline KRef_Count * KRef_IntrusiveCount( const KRef_Counted * p );
+
+class KRef_Counted
+{
+private:
+
+    friend KRef_Count * KRef_IntrusiveCount( const KRef_Counted * p );
+
+    mutable KRef_Count m_RefCount;
+
+protected:
 
+    KRef_Counted()
+    {
+        m_RefCount.m_Count = 0;
+        m_RefCount.m_ui8Storage = KRef_Count::Intrusive;
+    };
+
+    // A copy is a new object so it must not inherit the count.
+    KRef_Counted( const KRef_Counted & )
+    {
+        m_RefCount.m_Count = 0;
+        m_RefCount.m_ui8Storage = KRef_Count::Intrusive;
+    };
+
+    KRef_Counted & operator=( const KRef_Counted & )
+    {
+        return *this;
+    };
+
+    ~KRef_Counted()
+    {
+    };
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+inline KRef_Count * KRef_IntrusiveCount( const KRef_Counted * p )
+{
+    return &p->m_RefCount;
+}
+
+inline KRef_Count * KRef_IntrusiveCount( const void * )
+{
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+// Memory layout used by KRef_Ptr::Make.
 template<class Type>
+struct KRef_Block
+{
+    KRef_Count m_Count;
+    Type m_Obj;
+};
+
+/************************************************************************/
+/* KRef_Ptr                                                             */
+/************************************************************************/
+
+template<class Type, class CounterPolicy = KRef_DefaultCounterPolicy>
 class KRef_Ptr
 {
 private:
 
-    typedef KRef_Ptr<Type> ThisType;
+    template<class OtherType, class OtherPolicy> friend class KRef_Ptr;
+
+    typedef KRef_Ptr<Type, CounterPolicy> ThisType;
 
     Type * m_pRef;
 
-    RefCounter * m_piCount;
+    KRef_Count * m_piCount;
 
     //************************************
     // FullName:    KRef_Ptr<Type>::ref
@@ -86,7 +252,7 @@ private:
     //************************************
     void ref()
     {
-        if( m_pRef )++( *m_piCount );
+        if( m_pRef )CounterPolicy::Increment( m_piCount->m_Count );
     };
 
     //************************************
@@ -98,17 +264,90 @@ private:
     {
         if( m_pRef )
         {
-            --( *m_piCount );
-            if( *m_piCount == 0 )
+            if( CounterPolicy::Decrement( m_piCount->m_Count ) == 0 )
+            {
+                switch( m_piCount->m_ui8Storage )
+                {
+                    case KRef_Count::Separate:
+                        delete m_pRef;
+                        delete m_piCount;
+                        break;
+
+                    case KRef_Count::Intrusive:
+                        delete m_pRef; // The counter goes with the object.
+                        break;
+
+                    case KRef_Count::Combined:
+                        m_pRef->~Type();
+                        ::operator delete( m_piCount ); // The counter is at the start of the block.
+                        break;
+                }
+            }
+            m_piCount = NULL;
+            m_pRef = NULL;
+        }
+    };
+
+    //************************************
+    // FullName:    KRef_Ptr<Type>::attach
+    // Description: Takes ownership of a new pointer. Uses the embedded
+    //              counter for KRef_Counted types else allocates one.
+    // Parameter:   Type * p
+    //************************************
+    void attach( Type * p )
+    {
+        m_pRef = p;
+        m_piCount = NULL;
+
+        if( m_pRef )
+        {
+            m_piCount = KRef_IntrusiveCount( p );
+            if( !m_piCount )
             {
-                delete m_piCount;
-                delete m_pRef;
-                m_piCount = NULL;
-                m_pRef = NULL;
+                m_piCount = new KRef_Count;
+                m_piCount->m_Count = 0;
+                m_piCount->m_ui8Storage = KRef_Count::Separate;
             }
+            ref();
         }
     };
 
+    //************************************
+    // FullName:    KRef_Ptr<Type>::isIntrusive
+    // Description: True if Type carries its own counter.
+    //************************************
+    static KBOOL isIntrusive( const KRef_Counted * )
+    {
+        return true;
+    };
+
+    static KBOOL isIntrusive( const void * )
+    {
+        return false;
+    };
+
+    //************************************
+    // FullName:    KRef_Ptr<Type>::allocBlock
+    //              KRef_Ptr<Type>::adoptBlock
+    // Description: Used by Make to place the counter and object in a single allocation.
+    //************************************
+    static KRef_Block<Type> * allocBlock()
+    {
+        return static_cast<KRef_Block<Type>*>( ::operator new( sizeof( KRef_Block<Type> ) ) );
+    };
+
+    static ThisType adoptBlock( KRef_Block<Type> * B )
+    {
+        B->m_Count.m_Count = 0;
+        B->m_Count.m_ui8Storage = KRef_Count::Combined;
+
+        ThisType p;
+        p.m_pRef = &B->m_Obj;
+        p.m_piCount = &B->m_Count;
+        p.ref();
+        return p;
+    };
+
 public:
 
     KRef_Ptr() :
@@ -119,13 +358,29 @@ public:
 
     KRef_Ptr( Type * p )
     {
-        m_pRef = p;
-        m_piCount = new RefCounter;
-        *m_piCount = 0;
+        attach( p );
+    };
+
+    KRef_Ptr( const ThisType & p ) :
+        m_pRef( p.m_pRef ),
+        m_piCount( p.m_piCount )
+    {
         ref();
     };
 
-    KRef_Ptr( const KRef_Ptr<Type> & p ) :
+#ifdef KDIS_USE_CPP11
+    // Takes over the reference without touching the counter.
+    KRef_Ptr( ThisType && p ) :
+        m_pRef( p.m_pRef ),
+        m_piCount( p.m_piCount )
+    {
+        p.m_pRef = NULL;
+        p.m_piCount = NULL;
+    };
+#endif
+
+    template<class Other>
+    KRef_Ptr( const KRef_Ptr<Other, CounterPolicy> & p ) :
         m_pRef( p.m_pRef ),
         m_piCount( p.m_piCount )
     {
@@ -137,6 +392,121 @@ public:
         unRef();
     };
 
+    //************************************
+    // FullName:    KRef_Ptr<Type>::Make
+    // Description: Creates a new object and its reference counter in a single allocation.
+    //              Arguments are forwarded to the Type constructor.
+    //              E.G KRef_Ptr<MyClass> pObj = KRef_Ptr<MyClass>::Make( a, b );
+    //              Note: KRef_Counted types are created with new as they already
+    //              hold their own counter.
+    //************************************
+    static ThisType Make()
+    {
+        if( isIntrusive( static_cast<Type*>( 0 ) ) )return ThisType( new Type );
+
+        KRef_Block<Type> * pBlock = allocBlock();
+        try
+        {
+            new( &pBlock->m_Obj ) Type;
+        }
+        catch( ... )
+        {
+            ::operator delete( pBlock );
+            throw;
+        }
+        return adoptBlock( pBlock );
+    };
+
+    template<class A1>
+    static ThisType Make( A1 & a1 )
+    {
+        if( isIntrusive( static_cast<Type*>( 0 ) ) )return ThisType( new Type( a1 ) );
+
+        KRef_Block<Type> * pBlock = allocBlock();
+        try
+        {
+            new( &pBlock->m_Obj ) Type( a1 );
+        }
+        catch( ... )
+        {
+            ::operator delete( pBlock );
+            throw;
+        }
+        return adoptBlock( pBlock );
+    };
+
+    template<class A1>
+    static ThisType Make( const A1 & a1 )
+    {
+        if( isIntrusive( static_cast<Type*>( 0 ) ) )return ThisType( new Type( a1 ) );
+
+        KRef_Block<Type> * pBlock = allocBlock();
+        try
+        {
+            new( &pBlock->m_Obj ) Type( a1 );
+        }
+        catch( ... )
+        {
+            ::operator delete( pBlock );
+            throw;
+        }
+        return adoptBlock( pBlock );
+    };
+
+    template<class A1, class A2>
+    static ThisType Make( const A1 & a1, const A2 & a2 )
+    {
+        if( isIntrusive( static_cast<Type*>( 0 ) ) )return ThisType( new Type( a1, a2 ) );
+
+        KRef_Block<Type> * pBlock = allocBlock();
+        try
+        {
+            new( &pBlock->m_Obj ) Type( a1, a2 );
+        }
+        catch( ... )
+        {
+            ::operator delete( pBlock );
+            throw;
+        }
+        return adoptBlock( pBlock );
+    };
+
+    template<class A1, class A2, class A3>
+    static ThisType Make( const A1 & a1, const A2 & a2, const A3 & a3 )
+    {
+        if( isIntrusive( static_cast<Type*>( 0 ) ) )return ThisType( new Type( a1, a2, a3 ) );
+
+        KRef_Block<Type> * pBlock = allocBlock();
+        try
+        {
+            new( &pBlock->m_Obj ) Type( a1, a2, a3 );
+        }
+        catch( ... )
+        {
+            ::operator delete( pBlock );
+            throw;
+        }
+        return adoptBlock( pBlock );
+    };
+
+    template<class A1, class A2, class A3, class A4>
+    static ThisType Make( const A1 & a1, const A2 & a2, const A3 & a3, const A4 & a4 )
+    {
+        if( isIntrusive( static_cast<Type*>( 0 ) ) )return ThisType( new Type( a1, a2, a3, a4 ) );
+
+        KRef_Block<Type> * pBlock = allocBlock();
+        try
+        {
+            new( &pBlock->m_Obj ) Type( a1, a2, a3, a4 );
+        }
+        catch( ... )
+        {
+            ::operator delete( pBlock );
+            throw;
+        }
+        return adoptBlock( pBlock );
+    };
+
     //************************************
     // FullName:    KRef_Ptr<Type>::Clear
     // Description: Removes the current reference held.
@@ -166,7 +536,8 @@ public:
     //************************************
     RefCounter GetCount() const
     {
-        if( m_piCount )return *m_piCount;
+        if( m_piCount )return m_piCount->m_Count;
+        return 0;
     };
 
     //************************************
@@ -174,7 +545,7 @@ public:
     // Description: Assignment of an other KRef_Ptr.
     // Parameter:   const KRef_Ptr<Type> & p
     //************************************
-    KRef_Ptr<Type> & operator=( const KRef_Ptr<Type> & p )
+    KRef_Ptr<Type, CounterPolicy> & operator=( const ThisType & p )
     {
         if( m_pRef == p.m_pRef )return *this;
         unRef();
@@ -184,14 +555,34 @@ public:
         return *this;
     };
 
+#ifdef KDIS_USE_CPP11
+    //************************************
+    // FullName:    KRef_Ptr<Type>::operator=
+    // Description: Move assignment of an other KRef_Ptr, the reference
+    //              is taken over without touching the counter.
+    // Parameter:   KRef_Ptr<Type> && p
+    //************************************
+    KRef_Ptr<Type, CounterPolicy> & operator=( ThisType && p )
+    {
+        if( this == &p )return *this;
+        unRef();
+        m_pRef = p.m_pRef;
+        m_piCount = p.m_piCount;
+        p.m_pRef = NULL;
+        p.m_piCount = NULL;
+        return *this;
+    };
+#endif
+
     //************************************
     // FullName:    KRef_Ptr<Other>::operator=
     // Description: Assignment of an other KRef_Ptr of a different type.
     // Parameter:   const KRef_Ptr<Other> & p
     //************************************
     template<class Other>
-    KRef_Ptr<Type> & operator=( const KRef_Ptr<Other> & p )
+    KRef_Ptr<Type, CounterPolicy> & operator=( const KRef_Ptr<Other, CounterPolicy> & p )
     {
+        if( m_pRef == p.m_pRef )return *this;
         unRef();
         m_pRef = p.m_pRef;
         m_piCount = p.m_piCount;
@@ -204,14 +595,11 @@ public:
     // Description: Assignment of a new reference.
     // Parameter:   Type * p
     //************************************
-    KRef_Ptr<Type> & operator=( Type * p )
+    KRef_Ptr<Type, CounterPolicy> & operator=( Type * p )
     {
         if( m_pRef == p )return *this;
         unRef();
-        m_pRef = p;
-        m_piCount = new RefCounter;
-        *m_piCount = 0;
-        ref();
+        attach( p );
         return *this;
     };
 
@@ -221,13 +609,11 @@ public:
     // Parameter:   Other * p
     //************************************
     template<class Other>
-    KRef_Ptr<Type> & operator=( Other * p )
+    KRef_Ptr<Type, CounterPolicy> & operator=( Other * p )
     {
+        if( m_pRef == p )return *this;
         unRef();
-        m_pRef = p;
-        m_piCount = new RefCounter;
-        *m_piCount = 0;
-        ref();
+        attach( p );
         return *this;
     };
 
@@ -236,7 +622,7 @@ public:
     // Description: Comparison equals. Checks if both references are the same.
     // Parameter:   const KRef_Ptr<Type> & p
     //************************************
-    KBOOL operator==( const KRef_Ptr<Type> & p )const
+    KBOOL operator==( const ThisType & p )const
     {
         return m_pRef == p.m_pRef;
     };
@@ -249,7 +635,7 @@ public:
     // Parameter:   const KRef_Ptr<Other> & p
     //************************************
     template<class Other>
-    KBOOL operator==( const KRef_Ptr<Other> & p )const
+    KBOOL operator==( const KRef_Ptr<Other, CounterPolicy> & p )const
     {
         return m_pRef == p.m_pRef;
     };
@@ -308,7 +694,7 @@ public:
     // Description: Comparison does not equals. Compares the referenced pointer to an other KRef_Ptr.
     // Parameter:   const KRef_Ptr<Type> & p
     //************************************
-    KBOOL operator!= ( const KRef_Ptr<Type> & p ) const
+    KBOOL operator!= ( const ThisType & p ) const
     {
         return m_pRef != p.m_pRef;
     };
@@ -319,7 +705,7 @@ public:
     // Parameter:   const KRef_Ptr<Other> & p
     //************************************
     template<class Other>
-    KBOOL operator!= ( const KRef_Ptr<Other> & p ) const
+    KBOOL operator!= ( const KRef_Ptr<Other, CounterPolicy> & p ) const
     {
         return m_pRef != p.m_pRef;
     };
@@ -0,0 +1,231 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      KSmallVector
+    created:    18/10/2026
+
+    purpose:    A vector that stores the first InlineCapacity elements inside
+                the object itself and only allocates when it grows beyond that.
+                Intended for small fixed size records, such as the 16 octet
+                variable parameter records, where most containers hold only a
+                handful of elements and a heap allocation per container would
+                dominate the cost of decoding.
+
+                Elements are copied by assignment and must be default constructible.
+                Clear does not release memory that has been allocated.
+*********************************************************************/
+
+#pragma once
+
+#include "./../KDefines.h"
+
+namespace KDIS {
+namespace UTILS {
+
+template<class Type, KUINT16 InlineCapacity>
+class KSmallVector
+{
+protected:
+
+    Type m_Inline[InlineCapacity];
+
+    Type * m_pData;
+
+    KUINT32 m_ui32Size;
+
+    KUINT32 m_ui32Capacity;
+
+    //************************************
+    // FullName:    KDIS::UTILS::KSmallVector::grow
+    // Description: Moves the elements into a heap buffer of at least MinCapacity.
+    // Parameter:   KUINT32 MinCapacity
+    //************************************
+    void grow( KUINT32 MinCapacity )
+    {
+        KUINT32 ui32NewCap = m_ui32Capacity * 2;
+        if( ui32NewCap < MinCapacity )ui32NewCap = MinCapacity;
+
+        Type * pNew = new Type[ui32NewCap];
+        for( KUINT32 i = 0; i < m_ui32Size; ++i )
+        {
+            pNew[i] = m_pData[i];
+        }
+
+        if( m_pData != m_Inline )delete[] m_pData;
+
+        m_pData = pNew;
+        m_ui32Capacity = ui32NewCap;
+    };
+
+    //************************************
+    // FullName:    KDIS::UTILS::KSmallVector::assign
+    // Description: Copies the elements of another vector.
+    // Parameter:   const KSmallVector & Other
+    //************************************
+    void assign( const KSmallVector & Other )
+    {
+        m_ui32Size = 0;
+        Reserve( Other.m_ui32Size );
+        for( KUINT32 i = 0; i < Other.m_ui32Size; ++i )
+        {
+            m_pData[i] = Other.m_pData[i];
+        }
+        m_ui32Size = Other.m_ui32Size;
+    };
+
+public:
+
+    KSmallVector() :
+        m_pData( m_Inline ),
+        m_ui32Size( 0 ),
+        m_ui32Capacity( InlineCapacity )
+    {
+    };
+
+    KSmallVector( const KSmallVector & Other ) :
+        m_pData( m_Inline ),
+        m_ui32Size( 0 ),
+        m_ui32Capacity( InlineCapacity )
+    {
+        assign( Other );
+    };
+
+    ~KSmallVector()
+    {
+        if( m_pData != m_Inline )delete[] m_pData;
+    };
+
+    KSmallVector & operator=( const KSmallVector & Other )
+    {
+        if( this != &Other )assign( Other );
+        return *this;
+    };
+
+    //************************************
+    // FullName:    KDIS::UTILS::KSmallVector::Reserve
+    // Description: Makes sure there is room for Capacity elements.
+    // Parameter:   KUINT32 Capacity
+    //************************************
+    void Reserve( KUINT32 Capacity )
+    {
+        if( Capacity > m_ui32Capacity )grow( Capacity );
+    };
+
+    //************************************
+    // FullName:    KDIS::UTILS::KSmallVector::PushBack
+    // Description: Adds an element to the end. The version without a parameter
+    //              returns the new element so it can be filled in place.
+    // Parameter:   const Type & T
+    //************************************
+    void PushBack( const Type & T )
+    {
+        PushBack() = T;
+    };
+
+    Type & PushBack()
+    {
+        if( m_ui32Size == m_ui32Capacity )grow( m_ui32Size + 1 );
+        return m_pData[m_ui32Size++];
+    };
+
+    //************************************
+    // FullName:    KDIS::UTILS::KSmallVector::Clear
+    // Description: Removes all elements, any allocated memory is kept for reuse.
+    //************************************
+    void Clear()
+    {
+        m_ui32Size = 0;
+    };
+
+    //************************************
+    // FullName:    KDIS::UTILS::KSmallVector::Size
+    //              KDIS::UTILS::KSmallVector::Capacity
+    //              KDIS::UTILS::KSmallVector::IsInline
+    // Description: Number of elements, number of elements that fit without
+    //              allocating and whether the elements are stored inside the object.
+    //************************************
+    KUINT32 Size() const
+    {
+        return m_ui32Size;
+    };
+
+    KUINT32 Capacity() const
+    {
+        return m_ui32Capacity;
+    };
+
+    KBOOL IsInline() const
+    {
+        return m_pData == m_Inline;
+    };
+
+    //************************************
+    // FullName:    KDIS::UTILS::KSmallVector::Begin
+    //              KDIS::UTILS::KSmallVector::End
+    // Description: Pointers to the first and one past the last element.
+    //************************************
+    const Type * Begin() const
+    {
+        return m_pData;
+    };
+
+    Type * Begin()
+    {
+        return m_pData;
+    };
+
+    const Type * End() const
+    {
+        return m_pData + m_ui32Size;
+    };
+
+    Type * End()
+    {
+        return m_pData + m_ui32Size;
+    };
+
+    //************************************
+    // FullName:    KDIS::UTILS::KSmallVector::operator[]
+    // Description: Element access, no bounds checking is performed.
+    // Parameter:   KUINT32 Index
+    //************************************
+    const Type & operator[]( KUINT32 Index ) const
+    {
+        return m_pData[Index];
+    };
+
+    Type & operator[]( KUINT32 Index )
+    {
+        return m_pData[Index];
+    };
+};
+
+} // END namespace UTILS
+} // END namespace KDIS
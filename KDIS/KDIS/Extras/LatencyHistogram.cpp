@@ -0,0 +1,178 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./LatencyHistogram.h"
+
+using namespace KDIS;
+using namespace UTILS;
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+LatencyHistogram::LatencyHistogram()
+{
+    Reset();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+LatencyHistogram::~LatencyHistogram()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT8 LatencyHistogram::GetBucket( KUINT64 Ns )
+{
+    if( !Ns )return 0;
+
+    // The bucket is the number of significant bits.
+#if defined( __GNUC__ )
+    KUINT8 ui8Bucket = 64 - __builtin_clzll( Ns );
+#else
+    KUINT8 ui8Bucket = 0;
+    while( Ns )
+    {
+        ++ui8Bucket;
+        Ns >>= 1;
+    }
+#endif
+
+    return ui8Bucket < BUCKETS ? ui8Bucket : BUCKETS - 1;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void LatencyHistogram::Record( KUINT64 Ns )
+{
+    ++m_ui64Buckets[GetBucket( Ns )];
+    ++m_ui64Count;
+    m_ui64Total += Ns;
+    if( Ns < m_ui64Min )m_ui64Min = Ns;
+    if( Ns > m_ui64Max )m_ui64Max = Ns;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void LatencyHistogram::Reset()
+{
+    memset( m_ui64Buckets, 0, sizeof( m_ui64Buckets ) );
+    m_ui64Count = 0;
+    m_ui64Total = 0;
+    m_ui64Min = ~( KUINT64 )0;
+    m_ui64Max = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 LatencyHistogram::GetCount() const
+{
+    return m_ui64Count;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 LatencyHistogram::GetTotal() const
+{
+    return m_ui64Total;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 LatencyHistogram::GetMin() const
+{
+    return m_ui64Count ? m_ui64Min : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 LatencyHistogram::GetMax() const
+{
+    return m_ui64Max;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 LatencyHistogram::GetMean() const
+{
+    return m_ui64Count ? m_ui64Total / m_ui64Count : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 LatencyHistogram::GetBucketCount( KUINT8 Bucket ) const
+{
+    return Bucket < BUCKETS ? m_ui64Buckets[Bucket] : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 LatencyHistogram::GetPercentile( KFLOAT64 P ) const
+{
+    if( !m_ui64Count )return 0;
+
+    // The rank of the percentile, rounded up so P100 is the last duration.
+    const KFLOAT64 f64Rank = ( P / 100.0 ) * m_ui64Count;
+    KUINT64 ui64Rank = ( KUINT64 )f64Rank;
+    if( ui64Rank < f64Rank )++ui64Rank;
+    if( ui64Rank < 1 )ui64Rank = 1;
+
+    KUINT64 ui64Seen = 0;
+    for( KUINT8 i = 0; i < BUCKETS; ++i )
+    {
+        ui64Seen += m_ui64Buckets[i];
+        if( ui64Seen >= ui64Rank )
+        {
+            const KUINT64 ui64Top = i ? ( ( ( KUINT64 )1 << i ) - 1 ) : 0;
+            return ui64Top < m_ui64Max ? ui64Top : m_ui64Max;
+        }
+    }
+
+    return m_ui64Max;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KString LatencyHistogram::GetAsString() const
+{
+    KStringStream ss;
+
+    ss << "Latency Histogram:\n"
+       << "\tCount: " << m_ui64Count
+       << "\n\tMin:   " << GetMin() << "ns"
+       << "\n\tMean:  " << GetMean() << "ns"
+       << "\n\tP50:   " << GetPercentile( 50 ) << "ns"
+       << "\n\tP99:   " << GetPercentile( 99 ) << "ns"
+       << "\n\tMax:   " << m_ui64Max << "ns\n";
+
+    return ss.str();
+}
+
+//////////////////////////////////////////////////////////////////////////
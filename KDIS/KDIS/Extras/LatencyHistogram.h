@@ -0,0 +1,123 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      LatencyHistogram
+    created:    19/10/2026
+
+    purpose:    A fixed size histogram of durations in nanoseconds with power of two
+                buckets, recording is a few integer operations and never allocates.
+                Bucket 0 holds 0ns and bucket i holds [2^(i-1), 2^i) ns.
+*********************************************************************/
+
+#pragma once
+
+#include "./../KDefines.h"
+
+namespace KDIS {
+namespace UTILS {
+
+class KDIS_EXPORT LatencyHistogram
+{
+public:
+
+    static const KUINT8 BUCKETS = 64;
+
+protected:
+
+    KUINT64 m_ui64Buckets[BUCKETS];
+    KUINT64 m_ui64Count;
+    KUINT64 m_ui64Total;
+    KUINT64 m_ui64Min;
+    KUINT64 m_ui64Max;
+
+public:
+
+    LatencyHistogram();
+
+    virtual ~LatencyHistogram();
+
+    //************************************
+    // FullName:    KDIS::UTILS::LatencyHistogram::GetBucket
+    // Description: Returns the bucket a duration falls into.
+    // Parameter:   KUINT64 Ns
+    //************************************
+    static KUINT8 GetBucket( KUINT64 Ns );
+
+    //************************************
+    // FullName:    KDIS::UTILS::LatencyHistogram::Record
+    // Description: Adds a duration in nanoseconds.
+    // Parameter:   KUINT64 Ns
+    //************************************
+    void Record( KUINT64 Ns );
+
+    //************************************
+    // FullName:    KDIS::UTILS::LatencyHistogram::Reset
+    // Description: Clears all recorded durations.
+    //************************************
+    void Reset();
+
+    //************************************
+    // FullName:    KDIS::UTILS::LatencyHistogram::GetCount
+    //              KDIS::UTILS::LatencyHistogram::GetTotal
+    //              KDIS::UTILS::LatencyHistogram::GetMin
+    //              KDIS::UTILS::LatencyHistogram::GetMax
+    //              KDIS::UTILS::LatencyHistogram::GetMean
+    // Description: Summary of the recorded durations in nanoseconds, all 0 when nothing is recorded.
+    //************************************
+    KUINT64 GetCount() const;
+    KUINT64 GetTotal() const;
+    KUINT64 GetMin() const;
+    KUINT64 GetMax() const;
+    KUINT64 GetMean() const;
+
+    //************************************
+    // FullName:    KDIS::UTILS::LatencyHistogram::GetBucketCount
+    // Description: Number of durations recorded in a bucket.
+    // Parameter:   KUINT8 Bucket
+    //************************************
+    KUINT64 GetBucketCount( KUINT8 Bucket ) const;
+
+    //************************************
+    // FullName:    KDIS::UTILS::LatencyHistogram::GetPercentile
+    // Description: Returns an upper bound in nanoseconds for the given percentile(0-100), this is the
+    //              top of the bucket the percentile falls in, capped to the largest recorded duration.
+    // Parameter:   KFLOAT64 P
+    //************************************
+    KUINT64 GetPercentile( KFLOAT64 P ) const;
+
+    //************************************
+    // FullName:    KDIS::UTILS::LatencyHistogram::GetAsString
+    // Description: Returns a string representation
+    //************************************
+    KString GetAsString() const;
+};
+
+} // END namespace UTILS
+} // END namespace KDIS
@@ -125,7 +125,7 @@ using namespace ENUMS;
 // protected:
 //////////////////////////////////////////////////////////////////////////
 
-auto_ptr<Header> PDU_Factory::applyFilters( Header * H )
+PduUniquePtr PDU_Factory::applyFilters( Header * H )
 {
     // Test all the filters
     vector<PDU_Factory_Filter*>::const_iterator citr = m_vFilters.begin();
@@ -136,20 +136,23 @@ auto_ptr<Header> PDU_Factory::applyFilters( Header * H )
         if( !( *citr )->ApplyFilter( H ) )
         {
             // The PDU failed a test so free the memory and return NULL.
+            if( m_pStats )m_pStats->OnFiltered( *H );
             delete H;
-            return auto_ptr<Header>( NULL );
+            return PduUniquePtr();
         }
     }
 
-    return auto_ptr<Header>( H );
+    return PduUniquePtr( H );
 }
 
 //////////////////////////////////////////////////////////////////////////
 // public:
 //////////////////////////////////////////////////////////////////////////
 
-PDU_Factory::PDU_Factory()
+PDU_Factory::PDU_Factory() :
+    m_pStats( 0 )
 {
+    SetDecodeEnabled( true );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -190,7 +193,58 @@ void PDU_Factory::RemoveFilter( PDU_Factory_Filter * F )
 
 //////////////////////////////////////////////////////////////////////////
 
-auto_ptr<Header> PDU_Factory::Decode( KOCTET * Buffer, KUINT16 BufferSize )throw( KException )
+void PDU_Factory::SetDecodeEnabled( KBOOL E )
+{
+    memset( m_bDecodeType, E, sizeof( m_bDecodeType ) );
+    memset( m_bDecodeFamily, 0, sizeof( m_bDecodeFamily ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Factory::SetDecodeEnabled( PDUType T, KBOOL E )
+{
+    m_bDecodeType[( KUINT8 )T] = E;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Factory::SetDecodeEnabled( ProtocolFamily PF, KBOOL E )
+{
+    m_bDecodeFamily[( KUINT8 )PF] = E;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL PDU_Factory::IsDecodeEnabled( const Header & H ) const
+{
+    return m_bDecodeType[( KUINT8 )H.GetPDUType()] || m_bDecodeFamily[( KUINT8 )H.GetProtocolFamily()];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Factory::CopyDecodeEnabled( const PDU_Factory & F )
+{
+    memcpy( m_bDecodeType, F.m_bDecodeType, sizeof( m_bDecodeType ) );
+    memcpy( m_bDecodeFamily, F.m_bDecodeFamily, sizeof( m_bDecodeFamily ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Factory::SetStatistics( PDU_Statistics * S )
+{
+    m_pStats = S;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+PDU_Statistics * PDU_Factory::GetStatistics() const
+{
+    return m_pStats;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+PduUniquePtr PDU_Factory::Decode( KOCTET * Buffer, KUINT16 BufferSize )throw( KException )
 {
     KDataStream kd( Buffer, BufferSize );
     return Decode( kd );
@@ -198,15 +252,21 @@ auto_ptr<Header> PDU_Factory::Decode( KOCTET * Buffer, KUINT16 BufferSize )throw
 
 //////////////////////////////////////////////////////////////////////////
 
-auto_ptr<Header> PDU_Factory::Decode( KDataStream & Stream )throw( KException )
+PduUniquePtr PDU_Factory::Decode( KDataStream & Stream )throw( KException )
 {
     return Decode( Header( Stream ), Stream );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
-auto_ptr<Header> PDU_Factory::Decode( const Header & H, KDataStream & Stream )throw( KException )
+PduUniquePtr PDU_Factory::Decode( const Header & H, KDataStream & Stream )throw( KException )
 {
+    if( !IsDecodeEnabled( H ) )
+    {
+        if( m_pStats )m_pStats->OnFiltered( H );
+        return PduUniquePtr();
+    }
+
     switch( H.GetPDUType() )
     {
     case Entity_State_PDU_Type:
@@ -437,7 +497,81 @@ auto_ptr<Header> PDU_Factory::Decode( const Header & H, KDataStream & Stream )th
     }
 
     // We could not decode the PDU
-    return auto_ptr<Header>( NULL );
+    return PduUniquePtr();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes PDU_Factory::TryDecode( KOCTET * Buffer, KUINT16 BufferSize, PduUniquePtr & PDU )
+{
+    KDataStream kd( Buffer, BufferSize );
+    return TryDecode( kd, PDU );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes PDU_Factory::TryDecode( KDataStream & Stream, PduUniquePtr & PDU )
+{
+    Header H;
+    const ErrorCodes e = H.TryDecode( Stream );
+    if( e != NO_ERRORS )return e;
+
+    return TryDecode( H, Stream, PDU );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes PDU_Factory::TryDecode( const Header & H, KDataStream & Stream, PduUniquePtr & PDU )
+{
+    if( Stream.GetBufferSize() + Header::HEADER6_PDU_SIZE < H.GetPDULength() )return NOT_ENOUGH_DATA_IN_BUFFER;
+
+    if( !IsDecodeEnabled( H ) )
+    {
+        if( m_pStats )m_pStats->OnFiltered( H );
+        PDU.reset();
+        return NO_ERRORS;
+    }
+
+    // The most common PDUs decode without exceptions.
+    Header * pPDU = 0;
+    switch( H.GetPDUType() )
+    {
+    case Entity_State_PDU_Type:
+        pPDU = new Entity_State_PDU;
+        break;
+
+    case Fire_PDU_Type:
+        pPDU = new Fire_PDU;
+        break;
+
+    case Detonation_PDU_Type:
+        pPDU = new Detonation_PDU;
+        break;
+
+    default:
+        // The stream holds the whole PDU so only malformed content can make the remaining PDUs throw.
+        try
+        {
+            PDU = Decode( H, Stream );
+        }
+        catch( const KException & Ex )
+        {
+            return static_cast<ErrorCodes>( Ex.m_ui16ErrorCode );
+        }
+        return NO_ERRORS;
+    }
+
+    *pPDU = H;
+
+    const ErrorCodes e = pPDU->TryDecode( Stream, true );
+    if( e != NO_ERRORS )
+    {
+        delete pPDU;
+        return e;
+    }
+
+    PDU = applyFilters( pPDU );
+    return NO_ERRORS;
 }
 
 //////////////////////////////////////////////////////////////////////////
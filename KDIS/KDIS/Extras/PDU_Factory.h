@@ -42,6 +42,7 @@ http://p.sf.net/kdis/UserGuide
 #include <vector>
 #include "./../PDU/Header.h"
 #include "./PDU_Factory_Filters.h"
+#include "./PDU_Statistics.h"
 
 namespace KDIS {
 namespace UTILS {
@@ -52,19 +53,25 @@ protected:
 
     std::vector<PDU_Factory_Filter*> m_vFilters;
 
+    // PDU are decoded if their type or protocol family is enabled.
+    KBOOL m_bDecodeType[256];
+    KBOOL m_bDecodeFamily[256];
+
+    PDU_Statistics * m_pStats;
+
     //************************************
     // FullName:    KDIS::UTILS::PDU_Factory::applyFilters
     // Description: Applies the filter/s to the PDU and returns a NULL
     //              pointer if the PDU does not pass all filters.
     // Parameter:   Header * H
     //************************************
-    std::auto_ptr<KDIS::PDU::Header> applyFilters( KDIS::PDU::Header * H );
+    KDIS::PDU::PduUniquePtr applyFilters( KDIS::PDU::Header * H );
 
 public:
 
     PDU_Factory();
 
-    ~PDU_Factory();
+    virtual ~PDU_Factory();
 
     //************************************
     // FullName:    KDIS::UTILS::PDU_Factory::AddFilter
@@ -81,24 +88,60 @@ public:
     //************************************
     void RemoveFilter( PDU_Factory_Filter * F );
 
+    //************************************
+    // FullName:    KDIS::UTILS::PDU_Factory::SetDecodeEnabled
+    //              KDIS::UTILS::PDU_Factory::IsDecodeEnabled
+    // Description: Controls which PDU are decoded, a PDU is decoded if either its type or its protocol
+    //              family is enabled. Decode returns a NULL pointer for any other PDU without decoding
+    //              its body, this is cheaper than a filter which only runs after the PDU is decoded.
+    //              By default all types are enabled. SetDecodeEnabled( E ) enables all types or disables
+    //              all types and families.
+    //              Note: PDU_Dispatcher::ApplyDecodeMask can set this from the registered handlers.
+    // Parameter:   KBOOL E
+    // Parameter:   PDUType T
+    // Parameter:   ProtocolFamily PF
+    // Parameter:   const Header & H
+    //************************************
+    void SetDecodeEnabled( KBOOL E );
+    void SetDecodeEnabled( KDIS::DATA_TYPE::ENUMS::PDUType T, KBOOL E );
+    void SetDecodeEnabled( KDIS::DATA_TYPE::ENUMS::ProtocolFamily PF, KBOOL E );
+    KBOOL IsDecodeEnabled( const KDIS::PDU::Header & H ) const;
+
+    //************************************
+    // FullName:    KDIS::UTILS::PDU_Factory::CopyDecodeEnabled
+    // Description: Enables the same PDU types and families as F, see SetDecodeEnabled.
+    // Parameter:   const PDU_Factory & F
+    //************************************
+    void CopyDecodeEnabled( const PDU_Factory & F );
+
+    //************************************
+    // FullName:    KDIS::UTILS::PDU_Factory::SetStatistics
+    //              KDIS::UTILS::PDU_Factory::GetStatistics
+    // Description: When set the PDU that are not decoded or are rejected by a filter are counted
+    //              as filtered. The statistics are not owned by the factory. NULL by default.
+    // Parameter:   PDU_Statistics * S
+    //************************************
+    void SetStatistics( PDU_Statistics * S );
+    PDU_Statistics * GetStatistics() const;
+
     //************************************
     // FullName:    KDIS::UTILS::PDU_Factory::Decode
     // Description: Converts a stream of OCTETS into the correct PDU type.
     //              If the PDU type is unknown or not currently
-    //              implemented in KDIS a NULL auto_ptr is returned.
+    //              implemented in KDIS a NULL pointer is returned.
     // Parameter:   KOCTET * Buffer
     // Parameter:   KUINT16 BufferSize
     //************************************
-    virtual std::auto_ptr<KDIS::PDU::Header> Decode( KOCTET * Buffer, KUINT16 BufferSize )throw( KException );
+    virtual KDIS::PDU::PduUniquePtr Decode( KOCTET * Buffer, KUINT16 BufferSize )throw( KException );
 
     //************************************
     // FullName:    KDIS::UTILS::PDU_Factory::Decode
     // Description: Converts data stream into the correct PDU type.
     //              If the PDU type is unknown or not currently
-    //              implemented a NULL auto_ptr is returned.
+    //              implemented a NULL pointer is returned.
     // Parameter:   KDataStream & Stream
     //************************************
-    virtual std::auto_ptr<KDIS::PDU::Header> Decode( KDataStream & Stream )throw( KException );
+    virtual KDIS::PDU::PduUniquePtr Decode( KDataStream & Stream )throw( KException );
 
     //************************************
     // FullName:    KDIS::UTILS::PDU_Factory::Decode
@@ -110,7 +153,25 @@ public:
     // Parameter:   const Header & H
     // Parameter:   KDataStream & Stream
     //************************************
-    virtual std::auto_ptr<KDIS::PDU::Header> Decode( const KDIS::PDU::Header & H, KDataStream & Stream )throw( KException );
+    virtual KDIS::PDU::PduUniquePtr Decode( const KDIS::PDU::Header & H, KDataStream & Stream )throw( KException );
+
+    //************************************
+    // FullName:    KDIS::UTILS::PDU_Factory::TryDecode
+    // Description: As Decode but reports errors through the returned code instead of throwing,
+    //              PDU is only set when NO_ERRORS is returned and is NULL if the PDU type is unknown
+    //              or the PDU failed a filter. The stream is checked once for the whole PDU declared
+    //              by the header before any decoding, so truncated data is rejected up front.
+    //              Malformed content is only rejected without a throw for Entity State, Fire and
+    //              Detonation PDUs, see Header6::TryDecode.
+    // Parameter:   KOCTET * Buffer
+    // Parameter:   KUINT16 BufferSize
+    // Parameter:   KDataStream & Stream
+    // Parameter:   const Header & H
+    // Parameter:   PduUniquePtr & PDU
+    //************************************
+    KDIS::ErrorCodes TryDecode( KOCTET * Buffer, KUINT16 BufferSize, KDIS::PDU::PduUniquePtr & PDU );
+    KDIS::ErrorCodes TryDecode( KDataStream & Stream, KDIS::PDU::PduUniquePtr & PDU );
+    virtual KDIS::ErrorCodes TryDecode( const KDIS::PDU::Header & H, KDataStream & Stream, KDIS::PDU::PduUniquePtr & PDU );
 };
 
 } // END namespace UTILS
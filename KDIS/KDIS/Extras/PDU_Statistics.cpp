@@ -0,0 +1,253 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./PDU_Statistics.h"
+#include <cstring>
+
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+#include <Windows.h>
+#include <intrin.h>
+#else
+#include <time.h>
+#endif
+
+using namespace KDIS;
+using namespace PDU;
+using namespace UTILS;
+using namespace DATA_TYPE::ENUMS;
+
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Statistics::add( KUINT64 & C, KUINT64 V )
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    _InterlockedExchangeAdd64( reinterpret_cast<volatile __int64 *>( &C ), ( __int64 )V );
+#elif defined( __ATOMIC_RELAXED )
+    __atomic_fetch_add( &C, V, __ATOMIC_RELAXED );
+#else
+    __sync_fetch_and_add( &C, V );
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 PDU_Statistics::load( const KUINT64 & C )
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    return ( KUINT64 )_InterlockedCompareExchange64( reinterpret_cast<volatile __int64 *>( const_cast<KUINT64 *>( &C ) ), 0, 0 );
+#elif defined( __ATOMIC_RELAXED )
+    return __atomic_load_n( &C, __ATOMIC_RELAXED );
+#else
+    return __sync_fetch_and_add( const_cast<KUINT64 *>( &C ), 0 );
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+PDU_Statistics::PDU_Statistics()
+{
+    memset( &m_Counters, 0, sizeof( m_Counters ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+PDU_Statistics::~PDU_Statistics()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 PDU_Statistics::GetTime()
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency( &freq );
+    QueryPerformanceCounter( &now );
+    return ( KUINT64 )( now.QuadPart / freq.QuadPart ) * 1000000000 +
+           ( KUINT64 )( now.QuadPart % freq.QuadPart ) * 1000000000 / freq.QuadPart;
+#else
+    timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ( KUINT64 )ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Statistics::OnDatagramReceived( KUINT32 Bytes )
+{
+    add( m_Counters.m_ui64DatagramsReceived, 1 );
+    add( m_Counters.m_ui64BytesReceived, Bytes );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Statistics::OnDatagramFiltered()
+{
+    add( m_Counters.m_ui64DatagramsFiltered, 1 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Statistics::OnDatagramSent( KUINT32 Bytes )
+{
+    add( m_Counters.m_ui64DatagramsSent, 1 );
+    add( m_Counters.m_ui64BytesSent, Bytes );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Statistics::OnDatagramsDropped( KUINT32 Count )
+{
+    add( m_Counters.m_ui64DatagramsDropped, Count );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Statistics::OnBundleReceived()
+{
+    add( m_Counters.m_ui64Bundles, 1 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Statistics::OnDecoded( const Header & H, KUINT64 DecodeTime, KBOOL BundleMember )
+{
+    TypeCounters & T = m_Counters.m_Types[( KUINT8 )H.GetPDUType()];
+    add( T.m_ui64Received, 1 );
+    add( T.m_ui64BytesReceived, H.GetPDULength() );
+    add( T.m_ui64DecodeTime, DecodeTime );
+    add( m_Counters.m_ui64Decoded, 1 );
+    add( m_Counters.m_ui64DecodeTime, DecodeTime );
+
+    if( BundleMember )add( m_Counters.m_ui64BundleMembers, 1 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Statistics::OnFiltered( const Header & H )
+{
+    add( m_Counters.m_Types[( KUINT8 )H.GetPDUType()].m_ui64Filtered, 1 );
+    add( m_Counters.m_ui64Filtered, 1 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Statistics::OnFailed( ErrorCodes E )
+{
+    add( m_Counters.m_ui64Failed, 1 );
+    if( E < ERROR_CODES )add( m_Counters.m_ui64Errors[E], 1 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Statistics::OnFailed( const Header & H, ErrorCodes E )
+{
+    add( m_Counters.m_Types[( KUINT8 )H.GetPDUType()].m_ui64Failed, 1 );
+    OnFailed( E );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Statistics::OnSent( const Header & H )
+{
+    TypeCounters & T = m_Counters.m_Types[( KUINT8 )H.GetPDUType()];
+    add( T.m_ui64Sent, 1 );
+    add( T.m_ui64BytesSent, H.GetPDULength() );
+    add( m_Counters.m_ui64Sent, 1 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Statistics::GetSnapshot( Snapshot & S ) const
+{
+    // The snapshot is nothing but counters so it can be copied one counter at a time.
+    const KUINT64 * pSrc = reinterpret_cast<const KUINT64 *>( &m_Counters );
+    KUINT64 * pDst = reinterpret_cast<KUINT64 *>( &S );
+    for( KUINT32 i = 0; i < sizeof( Snapshot ) / sizeof( KUINT64 ); ++i )
+    {
+        pDst[i] = load( pSrc[i] );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Statistics::Reset()
+{
+    // Subtract what was read instead of storing 0 so increments made in between are kept.
+    KUINT64 * pCounters = reinterpret_cast<KUINT64 *>( &m_Counters );
+    for( KUINT32 i = 0; i < sizeof( Snapshot ) / sizeof( KUINT64 ); ++i )
+    {
+        add( pCounters[i], ( KUINT64 )0 - load( pCounters[i] ) );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KString PDU_Statistics::Snapshot::GetAsString() const
+{
+    KStringStream ss;
+
+    ss << "PDU Statistics:\n"
+       << "\tDatagrams Received: " << m_ui64DatagramsReceived << " (" << m_ui64BytesReceived << " bytes)"
+       << "\n\tDatagrams Filtered: " << m_ui64DatagramsFiltered
+       << "\n\tDatagrams Dropped:  " << m_ui64DatagramsDropped
+       << "\n\tDatagrams Sent:     " << m_ui64DatagramsSent << " (" << m_ui64BytesSent << " bytes)"
+       << "\n\tPDU Decoded:        " << m_ui64Decoded << " (" << m_ui64DecodeTime << "ns decoding)"
+       << "\n\tPDU Filtered:       " << m_ui64Filtered
+       << "\n\tPDU Failed:         " << m_ui64Failed
+       << "\n\tPDU Sent:           " << m_ui64Sent
+       << "\n\tBundles:            " << m_ui64Bundles << " (" << m_ui64BundleMembers << " PDU)\n";
+
+    for( KUINT8 i = 0; i < ERROR_CODES; ++i )
+    {
+        if( !m_ui64Errors[i] )continue;
+        ss << "\tError " << ( KUINT16 )i << ": " << m_ui64Errors[i] << " - " << GetErrorText( i ) << "\n";
+    }
+
+    for( KUINT16 i = 0; i < 256; ++i )
+    {
+        const TypeCounters & T = m_Types[i];
+        if( !T.m_ui64Received && !T.m_ui64Filtered && !T.m_ui64Failed && !T.m_ui64Sent )continue;
+
+        ss << "\t" << GetEnumAsStringPDUType( i ) << ":"
+           << " Received " << T.m_ui64Received << " (" << T.m_ui64BytesReceived << " bytes, " << T.m_ui64DecodeTime << "ns decoding)"
+           << ", Filtered " << T.m_ui64Filtered
+           << ", Failed " << T.m_ui64Failed
+           << ", Sent " << T.m_ui64Sent << " (" << T.m_ui64BytesSent << " bytes)\n";
+    }
+
+    return ss.str();
+}
+
+//////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,194 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      PDU_Statistics
+    created:    19/10/2026
+
+    purpose:    Runtime counters for a connection and its PDU_Factory: datagrams and bytes
+                received and sent, PDU decoded, filtered and failed(by error code), bundle
+                members and decode time, in total and per PDU type.
+                The counters are updated with relaxed atomic adds so several receive threads
+                can share one instance, reading a snapshot never blocks the writers.
+*********************************************************************/
+
+#pragma once
+
+#include "./../PDU/Header.h"
+
+namespace KDIS {
+namespace UTILS {
+
+class KDIS_EXPORT PDU_Statistics
+{
+public:
+
+    static const KUINT8 ERROR_CODES = KDIS::CONNECTION_SOCKET_ERROR + 1;
+
+    struct TypeCounters
+    {
+        KUINT64 m_ui64Received;
+        KUINT64 m_ui64BytesReceived;
+        KUINT64 m_ui64Filtered;
+        KUINT64 m_ui64Failed;
+        KUINT64 m_ui64DecodeTime;
+        KUINT64 m_ui64Sent;
+        KUINT64 m_ui64BytesSent;
+    };
+
+    struct KDIS_EXPORT Snapshot
+    {
+        KUINT64 m_ui64DatagramsReceived;
+        KUINT64 m_ui64BytesReceived;
+        KUINT64 m_ui64DatagramsFiltered;
+        KUINT64 m_ui64DatagramsDropped; // By the kernel, only known when drop detection is enabled on the connection.
+        KUINT64 m_ui64DatagramsSent;
+        KUINT64 m_ui64BytesSent;
+
+        KUINT64 m_ui64Decoded;
+        KUINT64 m_ui64Filtered;
+        KUINT64 m_ui64Failed;
+        KUINT64 m_ui64DecodeTime; // Nanoseconds spent in the PDU_Factory for the decoded PDU.
+        KUINT64 m_ui64Sent;
+
+        // Datagrams holding more than one PDU and the number of PDU decoded from them.
+        KUINT64 m_ui64Bundles;
+        KUINT64 m_ui64BundleMembers;
+
+        // Failures indexed by KDIS::ErrorCodes.
+        KUINT64 m_ui64Errors[ERROR_CODES];
+
+        TypeCounters m_Types[256];
+
+        //************************************
+        // FullName:    KDIS::UTILS::PDU_Statistics::Snapshot::GetAsString
+        // Description: Returns a string representation, PDU types and errors that were never counted are left out.
+        //************************************
+        KString GetAsString() const;
+    };
+
+protected:
+
+    Snapshot m_Counters;
+
+    //************************************
+    // FullName:    KDIS::UTILS::PDU_Statistics::add
+    //              KDIS::UTILS::PDU_Statistics::load
+    // Description: Relaxed atomic add and read of a counter.
+    // Parameter:   KUINT64 & C
+    // Parameter:   KUINT64 V
+    //************************************
+    static void add( KUINT64 & C, KUINT64 V );
+    static KUINT64 load( const KUINT64 & C );
+
+public:
+
+    PDU_Statistics();
+
+    virtual ~PDU_Statistics();
+
+    //************************************
+    // FullName:    KDIS::UTILS::PDU_Statistics::GetTime
+    // Description: Monotonic time in nanoseconds, used to time the decoding.
+    //************************************
+    static KUINT64 GetTime();
+
+    //************************************
+    // FullName:    KDIS::UTILS::PDU_Statistics::OnDatagramReceived
+    //              KDIS::UTILS::PDU_Statistics::OnDatagramFiltered
+    //              KDIS::UTILS::PDU_Statistics::OnDatagramSent
+    // Description: Counts a datagram received, one discarded by a ConnectionSubscriber and one sent.
+    // Parameter:   KUINT32 Bytes
+    //************************************
+    void OnDatagramReceived( KUINT32 Bytes );
+    void OnDatagramFiltered();
+    void OnDatagramSent( KUINT32 Bytes );
+
+    //************************************
+    // FullName:    KDIS::UTILS::PDU_Statistics::OnDatagramsDropped
+    // Description: Counts datagrams the kernel dropped before they could be received.
+    // Parameter:   KUINT32 Count
+    //************************************
+    void OnDatagramsDropped( KUINT32 Count );
+
+    //************************************
+    // FullName:    KDIS::UTILS::PDU_Statistics::OnBundleReceived
+    // Description: Counts a datagram holding more than one PDU, call it once the first header is known.
+    //************************************
+    void OnBundleReceived();
+
+    //************************************
+    // FullName:    KDIS::UTILS::PDU_Statistics::OnDecoded
+    // Description: Counts a decoded PDU.
+    // Parameter:   const KDIS::PDU::Header & H
+    // Parameter:   KUINT64 DecodeTime - nanoseconds.
+    // Parameter:   KBOOL BundleMember - the PDU shares its datagram with other PDU.
+    //************************************
+    void OnDecoded( const KDIS::PDU::Header & H, KUINT64 DecodeTime, KBOOL BundleMember );
+
+    //************************************
+    // FullName:    KDIS::UTILS::PDU_Statistics::OnFiltered
+    // Description: Counts a PDU that was not decoded or was rejected by a PDU_Factory_Filter.
+    // Parameter:   const KDIS::PDU::Header & H
+    //************************************
+    void OnFiltered( const KDIS::PDU::Header & H );
+
+    //************************************
+    // FullName:    KDIS::UTILS::PDU_Statistics::OnFailed
+    // Description: Counts a PDU that failed to decode, the header is not known when it failed itself.
+    // Parameter:   KDIS::ErrorCodes E
+    // Parameter:   const KDIS::PDU::Header & H
+    //************************************
+    void OnFailed( KDIS::ErrorCodes E );
+    void OnFailed( const KDIS::PDU::Header & H, KDIS::ErrorCodes E );
+
+    //************************************
+    // FullName:    KDIS::UTILS::PDU_Statistics::OnSent
+    // Description: Counts a PDU passed to the connection for sending, see OnDatagramSent for the network side.
+    // Parameter:   const KDIS::PDU::Header & H
+    //************************************
+    void OnSent( const KDIS::PDU::Header & H );
+
+    //************************************
+    // FullName:    KDIS::UTILS::PDU_Statistics::GetSnapshot
+    // Description: Copies the counters. Each counter is read atomically but updates made while copying
+    //              may be seen for some counters and not others.
+    // Parameter:   Snapshot & S
+    //************************************
+    void GetSnapshot( Snapshot & S ) const;
+
+    //************************************
+    // FullName:    KDIS::UTILS::PDU_Statistics::Reset
+    // Description: Sets all counters to 0, safe to call while other threads update them.
+    //************************************
+    void Reset();
+};
+
+} // END namespace UTILS
+} // END namespace KDIS
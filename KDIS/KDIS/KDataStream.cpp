@@ -178,6 +178,13 @@ void KDataStream::Clear()
 
 //////////////////////////////////////////////////////////////////////////
 
+void KDataStream::Reserve( KUINT16 Size )
+{
+    m_vBuffer.reserve( m_vBuffer.size() + Size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 KString KDataStream::GetAsString() const
 {
     KStringStream ss;
@@ -226,6 +233,13 @@ void KDataStream::Write( KOCTET V )
 
 //////////////////////////////////////////////////////////////////////////
 
+void KDataStream::Write( const KOCTET * Data, KUINT16 Size )
+{
+    m_vBuffer.insert( m_vBuffer.end(), Data, Data + Size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 void KDataStream::Read( KUOCTET & V )
 {
     V = m_vBuffer[m_ui16CurrentWritePos++];
@@ -240,6 +254,16 @@ void KDataStream::Read( KOCTET & V )
 
 //////////////////////////////////////////////////////////////////////////
 
+void KDataStream::Read( KOCTET * Data, KUINT16 Size ) throw( KException )
+{
+    if( GetBufferSize() < Size )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+
+    if( Size )memcpy( Data, &m_vBuffer[m_ui16CurrentWritePos], Size );
+    m_ui16CurrentWritePos += Size;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 KDataStream & KDataStream::operator << ( KDataStream val )
 {
     vector<KUOCTET>::const_iterator citr = val.m_vBuffer.begin();
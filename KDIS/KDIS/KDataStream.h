@@ -65,6 +65,8 @@ public:
 
     ~KDataStream();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( KDataStream )
+
     //************************************
     // FullName:    KDIS::KDataStream::GetMachineEndian
     // Description: Returns the machine endian. Calculated automatically.
@@ -143,6 +145,14 @@ public:
     //************************************
     void Clear();
 
+    //************************************
+    // FullName:    KDIS::KDataStream::Reserve
+    // Description: Reserves room for Size more octets so that writing them does not reallocate.
+    //              Clear keeps the reserved memory, a stream can be reused as an encode arena.
+    // Parameter:   KUINT16 Size
+    //************************************
+    void Reserve( KUINT16 Size );
+
     //************************************
     // FullName:    KDIS::KDataStream::GetAsString
     // Description: Returns string representation of the stream, values are in hex.
@@ -162,22 +172,29 @@ public:
     //************************************
     // FullName:    KDIS::KDataStream<Type>::Write
     // Description: Write data into stream.
+    //              The array version copies the octets as they are, no byte swapping is done.
     // Parameter:   Type T, KUOCTET V, KOCTET V
+    // Parameter:   const KOCTET * Data, KUINT16 Size
     //************************************
     template<class Type>
     void Write( Type T );
     void Write( KUOCTET V );
     void Write( KOCTET V );
+    void Write( const KOCTET * Data, KUINT16 Size );
 
     //************************************
     // FullName:    KDIS::KDataStream<Type>::Write
     // Description: Read data from stream.
+    //              The array version copies the octets as they are, no byte swapping is done.
+    //              Throws NOT_ENOUGH_DATA_IN_BUFFER if the stream holds less than Size octets.
     // Parameter:   Type & T, KUOCTET & V, KOCTET & V
+    // Parameter:   KOCTET * Data, KUINT16 Size
     //************************************
     template<class Type>
     void Read( Type & T );
     void Read( KUOCTET & V );
     void Read( KOCTET & V );
+    void Read( KOCTET * Data, KUINT16 Size ) throw( KException );
 
     // Write into stream
     template<class Type>
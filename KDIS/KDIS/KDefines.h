@@ -49,6 +49,12 @@ http://p.sf.net/kdis/UserGuide
 // in your project pre-processor definitions (-D KDIS_USE_ENUM_DESCRIPTORS).
 //#define KDIS_USE_ENUM_DESCRIPTORS
 
+// Comment out the following line to enable C++11 support or declare KDIS_USE_CPP11 in your project
+// pre-processor definitions (-D KDIS_USE_CPP11). This adds move constructors, rvalue setters and
+// std::unique_ptr factory returns so large PDU can be built and forwarded without deep copies.
+// Requires a C++11 compiler.
+//#define KDIS_USE_CPP11
+
 #if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
 // Disable this warning, it simply warns us about any functions that have a throw qualifier.
 #pragma warning( disable : 4290 )
@@ -90,6 +96,29 @@ http://p.sf.net/kdis/UserGuide
     #define DIS_VERSION 6
 #endif
 
+/************************************************************************/
+/* C++11 Support                                                        */
+/************************************************************************/
+
+#ifdef KDIS_USE_CPP11
+    #if __cplusplus < 201103L && !( defined( _MSC_VER ) && _MSC_VER >= 1800 )
+        #error "KDIS_USE_CPP11 requires a C++11 compiler."
+    #endif
+
+    #include <utility> // std::move
+
+    // Adds defaulted copy and move operations to a class. A user declared destructor
+    // suppresses the implicit move operations so any class that owns containers and
+    // has a virtual destructor should use this in its public section.
+    #define KDIS_DEFAULT_COPY_AND_MOVE( Class )         \
+        Class( const Class & ) = default;               \
+        Class( Class && ) = default;                    \
+        Class & operator=( const Class & ) = default;   \
+        Class & operator=( Class && ) = default;
+#else
+    #define KDIS_DEFAULT_COPY_AND_MOVE( Class )
+#endif
+
 /************************************************************************/
 /* Type Definitions                                                     */
 /************************************************************************/
@@ -29,7 +29,10 @@ http://p.sf.net/kdis/UserGuide
 
 #include <ostream>
 #include <iostream>
+#include <algorithm>
 #include "./Connection.h"
+#include "./SocketUtils.h"
+#include "./SharedMemoryTransport.h"
 
 #if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 ) // Windows Headers //
 
@@ -41,6 +44,7 @@ http://p.sf.net/kdis/UserGuide
 
 #include <sys/time.h>
 #include <unistd.h>
+#include <time.h>
 
 #define INVALID_SOCKET -1
 #define SOCKET_ERROR -1
@@ -49,105 +53,18 @@ http://p.sf.net/kdis/UserGuide
 #endif
 
 #define THROW_ERROR throw KException( getErrorText( ERROR_CODE ), CONNECTION_SOCKET_ERROR )
-#define SEND_SOCK 0
-#define RECEIVE_SOCK 1
 
 using namespace KDIS;
 using namespace PDU;
 using namespace UTILS;
 using namespace NETWORK;
+using namespace DATA_TYPE::ENUMS;
 using namespace std;
 
 //////////////////////////////////////////////////////////////////////////
 // protected:
 //////////////////////////////////////////////////////////////////////////
 
-void Connection::startup() throw( KException )
-{
-    // Create the sockets if they do not already exist.
-    if( !m_iSocket[SEND_SOCK] && !m_iSocket[RECEIVE_SOCK] )
-    {
-        // Windows only //
-#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
-        WSADATA w;
-        static KINT32 iWinSockInit = WSAStartup( 0x0202, &w ); // Init with winsock version 2.2
-        if( iWinSockInit != NO_ERROR )
-        {
-            THROW_ERROR;
-        }
-#endif
-
-        // Create both sockets
-        for( KINT8 i = 0; i < 2; ++i )
-        {
-            m_iSocket[i] = socket( AF_INET, SOCK_DGRAM, IPPROTO_UDP ); // Create a IPv4 UDP socket.
-
-            if( m_iSocket[i] == INVALID_SOCKET )
-            {
-                THROW_ERROR;
-            }
-        }
-
-        // Bind socket for incoming data.
-        if( !m_bSendOnly )
-            bindSocket();
-    }
-}
-
-//////////////////////////////////////////////////////////////////////////
-
-void Connection::bindSocket()
-{
-    // Set the receive socket to be reusable. Useful if your server has
-    // been shut down, and then restarted right away.
-    KINT32 yes = 1;
-    KINT32 iRet = setsockopt( m_iSocket[RECEIVE_SOCK], SOL_SOCKET, SO_REUSEADDR, ( const char * )&yes, sizeof( yes ) );
-    if( iRet == SOCKET_ERROR )
-    {
-        THROW_ERROR;
-    }
-
-    // Construct bind structure
-    sockaddr_in Address;
-    memset( &Address, 0, sizeof( Address ) );
-    Address.sin_family = AF_INET;                   // Internet address family
-    Address.sin_addr.s_addr = htonl( INADDR_ANY );  // Any incoming interface
-    Address.sin_port = htons( m_uiPort );           // Listen Port
-
-    // Now bind
-    iRet = bind( m_iSocket[RECEIVE_SOCK], ( sockaddr* )&Address, sizeof( Address ) );
-    if( iRet == SOCKET_ERROR )
-    {
-        THROW_ERROR;
-    }
-}
-
-//////////////////////////////////////////////////////////////////////////
-
-void Connection::shutdown() throw( KException )
-{
-    for( KINT8 i = 0; i < 2; ++i )
-    {
-        if( m_iSocket[i] )
-        {
-            #if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
-                KINT32 iError = closesocket( m_iSocket[i] );
-            #else
-                KINT32 iError = close( m_iSocket[i] );
-            #endif
-
-            if( iError == SOCKET_ERROR )
-            {
-                THROW_ERROR;
-            }
-
-            m_iSocket[i] = 0;
-        }
-    }
-}
-
-//////////////////////////////////////////////////////////////////////////
-
 const KCHAR8 * Connection::getErrorText( KINT32 ErrorCode ) const
 {
     switch ( ErrorCode )
@@ -329,25 +246,273 @@ const KCHAR8 * Connection::getErrorText( KINT32 ErrorCode ) const
     }
 }
 
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 Connection::getMonotonicTime()
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency( &freq );
+    QueryPerformanceCounter( &now );
+    return ( KUINT64 )( now.QuadPart / freq.QuadPart ) * 1000000 +
+           ( KUINT64 )( now.QuadPart % freq.QuadPart ) * 1000000 / freq.QuadPart;
+#else
+    timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ( KUINT64 )ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::applyDecodeMask()
+{
+    m_Dispatcher.ApplyDecodeMask( *m_pPduFact );
+    if( m_pShards )m_pShards->CopyDecodeEnabled( *m_pPduFact );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+PDU_Handler * Connection::handlerAdded( PDU_Handler * H )
+{
+    if( m_bDecodeHandledOnly )applyDecodeMask();
+    return H;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Transport * Connection::transport() const
+{
+    return m_pTransport ? m_pTransport : m_pUDP;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+UDP_Transport * Connection::udp() const
+{
+    return m_pTransport ? dynamic_cast<UDP_Transport *>( m_pTransport ) : m_pUDP;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::configureUDP( UDP_Transport & T ) throw ( KException )
+{
+    T.SetBlockingModeEnabled( m_bBlockingSocket );
+
+    // Not all platforms support kernel timestamps, then only the later stages are recorded.
+    T.SetReceiveTimestampsEnabled( m_bTrackLatency );
+    T.SetDropDetectionEnabled( m_bDetectDrops );
+
+    if( m_ui32ReceiveBufferSize && !SetSocketBufferSize( T.GetSocket( true ), true, m_ui32ReceiveBufferSize ) )
+    {
+        THROW_ERROR;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::resetReceiveSocket( UDP_Transport & T, KBOOL Bind ) throw ( KException )
+{
+    T.ResetReceiveSocket( Bind );
+    configureUDP( T );
+
+    if( Bind )
+    {
+        vector<KString>::const_iterator citr = m_vMulticastAddresses.begin();
+        vector<KString>::const_iterator citrEnd = m_vMulticastAddresses.end();
+        for( ; citr != citrEnd; ++citr )
+        {
+            T.AddMulticastAddress( *citr );
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::stopReceiveShards()
+{
+    if( m_pShards )
+    {
+        m_pShards->Recycle( m_pShardDatagram );
+        m_pShardDatagram = 0;
+        delete m_pShards;
+        m_pShards = 0;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes Connection::tryGetNextShardPDU( PduUniquePtr & PDU, KString * SenderIp ) throw ( KException )
+{
+    KBOOL bPopped = false;
+
+    while( true )
+    {
+        if( !m_pShardDatagram )
+        {
+            // Only wait once per call, as Receive does.
+            if( bPopped )return NO_ERRORS;
+
+            timeval tval = m_blockingTimeout;
+            if( !m_bBlockingSocket )
+            {
+                tval.tv_sec  = 0;
+                tval.tv_usec = 1;
+            }
+
+            m_pShardDatagram = m_pShards->Pop( tval );
+            if( !m_pShardDatagram )return NO_ERRORS;
+
+            bPopped = true;
+            m_ui32ShardPDU = 0;
+            m_LastSender = m_pShardDatagram->m_Sender;
+            m_ui64LastArrival = m_pShardDatagram->m_ui64ArrivalTime;
+            m_ui64LastReceive = m_pShardDatagram->m_ui64ReceiveTime;
+
+            // The shard has already counted them in the statistics.
+            if( m_pShardDatagram->m_ui32Dropped )datagramsDropped( m_pShardDatagram->m_ui32Dropped );
+
+            // Fire the first event, this event can also be used to inform us if we should stop
+            vector<ConnectionSubscriber*>::iterator itr = m_vpSubscribers.begin();
+            vector<ConnectionSubscriber*>::iterator itrEnd = m_vpSubscribers.end();
+            for( ; itr != itrEnd; ++itr )
+            {
+                if( !( *itr )->OnDataReceived( &m_pShardDatagram->m_vData[0], m_pShardDatagram->m_vData.size(), m_LastSender, m_ui64LastArrival ) )
+                {
+                    // We should quit
+                    m_pShards->Recycle( m_pShardDatagram );
+                    m_pShardDatagram = 0;
+                    return NO_ERRORS;
+                }
+            }
+        }
+
+        ReceiveShards::Datagram & D = *m_pShardDatagram;
+        if( m_ui32ShardPDU < D.m_vpPDU.size() )
+        {
+            const KUINT64 ui64Decoded = D.m_vui64DecodedTime[m_ui32ShardPDU];
+            PDU.reset( D.m_vpPDU[m_ui32ShardPDU] );
+            D.m_vpPDU[m_ui32ShardPDU++] = 0;
+
+            // The decode mask may have changed since the shards were started.
+            if( !m_pPduFact->IsDecodeEnabled( *PDU ) )
+            {
+                PDU.reset();
+                continue;
+            }
+
+            if( SenderIp )
+            {
+                *SenderIp = inet_ntoa( m_LastSender.sin_addr );
+            }
+
+            try
+            {
+                vector<ConnectionSubscriber*>::iterator itr = m_vpSubscribers.begin();
+                vector<ConnectionSubscriber*>::iterator itrEnd = m_vpSubscribers.end();
+                for( ; itr != itrEnd; ++itr )
+                {
+                    ( *itr )->OnPDUReceived( PDU.get() );
+                }
+
+                m_Dispatcher.Dispatch( *PDU );
+            }
+            catch( const exception & )
+            {
+                // A subscriber failed, drop the rest of the datagram as before.
+                m_pShards->Recycle( m_pShardDatagram );
+                m_pShardDatagram = 0;
+                throw;
+            }
+
+            // The shard only times the datagrams when tracking was on when they were received.
+            if( m_bTrackLatency && m_ui64LastReceive )recordLatency( *PDU, ui64Decoded );
+
+            return NO_ERRORS;
+        }
+
+        // The datagram is finished, report any decoding error the shard hit.
+        const ErrorCodes e = D.m_Error;
+        m_pShards->Recycle( m_pShardDatagram );
+        m_pShardDatagram = 0;
+        if( e != NO_ERRORS )return e;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::recordLatency( const Header & H, KUINT64 DecodedTime )
+{
+    const KUINT64 ui64Now = GetWallTime();
+    LatencyHistogram ** pHist = m_pLatency[( KUINT8 )H.GetPDUType()];
+
+    // Without a kernel timestamp the first stage is unknown. The clock may step so never record less than 0.
+    if( m_ui64LastArrival )
+    {
+        if( !pHist[KernelToReceive] )pHist[KernelToReceive] = new LatencyHistogram;
+        pHist[KernelToReceive]->Record( m_ui64LastReceive > m_ui64LastArrival ? m_ui64LastReceive - m_ui64LastArrival : 0 );
+    }
+
+    if( !pHist[ReceiveToDecoded] )pHist[ReceiveToDecoded] = new LatencyHistogram;
+    pHist[ReceiveToDecoded]->Record( DecodedTime > m_ui64LastReceive ? DecodedTime - m_ui64LastReceive : 0 );
+
+    if( !pHist[DecodedToHandled] )pHist[DecodedToHandled] = new LatencyHistogram;
+    pHist[DecodedToHandled]->Record( ui64Now > DecodedTime ? ui64Now - DecodedTime : 0 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::datagramsDropped( KUINT32 Count )
+{
+    m_ui64Dropped += Count;
+
+    vector<ConnectionSubscriber*>::iterator itr = m_vpSubscribers.begin();
+    vector<ConnectionSubscriber*>::iterator itrEnd = m_vpSubscribers.end();
+    for( ; itr != itrEnd; ++itr )
+    {
+        ( *itr )->OnDatagramsDropped( Count );
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 // public:
 //////////////////////////////////////////////////////////////////////////
 
 Connection::Connection( const KString & SendAddress, KUINT32 Port /* = 3000 */, KBOOL SendAddressIsMulticast /* = false */,
                         KBOOL Blocking /* = true */, PDU_Factory * Custom /* = 0 */, KBOOL SendOnly /* = false*/) :
-    m_uiPort( Port ),
+    m_pUDP( 0 ),
     m_bBlockingSocket( Blocking ),
-    m_bSendOnly( SendOnly )
+    m_bDecodeHandledOnly( false ),
+    m_bCoalesce( false ),
+    m_ui16CoalesceMaxSize( 0 ),
+    m_ui32CoalesceDeadline( 0 ),
+    m_ui64CoalesceStart( 0 ),
+    m_pShards( 0 ),
+    m_pShardDatagram( 0 ),
+    m_ui32ShardPDU( 0 ),
+    m_bTrackLatency( false ),
+    m_ui64LastArrival( 0 ),
+    m_ui64LastReceive( 0 ),
+    m_pStats( 0 ),
+    m_ui32ReceiveBufferSize( 0 ),
+    m_bDetectDrops( false ),
+    m_ui64Dropped( 0 ),
+    m_pTransport( 0 )
 {
-    m_iSocket[SEND_SOCK] = 0;
-    m_iSocket[RECEIVE_SOCK] = 0;
+    memset( m_bCoalesceExempt, 0, sizeof( m_bCoalesceExempt ) );
+    m_bCoalesceExempt[Fire_PDU_Type] = true;
+    m_bCoalesceExempt[Detonation_PDU_Type] = true;
 
     m_blockingTimeout.tv_sec = 0;
     m_blockingTimeout.tv_usec = 0;
 
-    startup();
+    memset( &m_LastSender, 0, sizeof( m_LastSender ) );
+    memset( m_pLatency, 0, sizeof( m_pLatency ) );
+
+    m_pUDP = new UDP_Transport( SendAddress, Port, SendAddressIsMulticast, SendOnly );
 
-    SetSendAddress( SendAddress, SendAddressIsMulticast );
+    // Remember the group so it can be joined again when the receive socket changes.
+    if( SendAddressIsMulticast )m_vMulticastAddresses.push_back( SendAddress );
 
     SetBlockingModeEnabled( Blocking );
 
@@ -366,37 +531,40 @@ Connection::Connection( const KString & SendAddress, KUINT32 Port /* = 3000 */,
 
 Connection::~Connection()
 {
-    shutdown();
+    // Do not lose any queued PDU, there is nobody to report a failure to at this point.
+    try
+    {
+        FlushCoalescedPDUs();
+    }
+    catch( ... )
+    {
+    }
+
+    stopReceiveShards();
     delete m_pPduFact;
+    delete m_pTransport;
+    delete m_pUDP;
+
+    for( KUINT16 i = 0; i < 256; ++i )
+    {
+        for( KUINT8 j = 0; j < LATENCY_STAGES; ++j )
+        {
+            delete m_pLatency[i][j];
+        }
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 void Connection::SetSendAddress( const KString & A, KBOOL Multicast /*= false */ ) throw( KException )
 {
-    m_sSendAddress = A;
-
-    // Create the send to address structure
-    memset( &m_SendToAddr, 0, sizeof( m_SendToAddr ) );
-    m_SendToAddr.sin_family = AF_INET;
-    m_SendToAddr.sin_addr.s_addr = inet_addr( m_sSendAddress.c_str() );
-    m_SendToAddr.sin_port = htons( m_uiPort );
+    UDP_Transport * pUDP = udp();
+    ( pUDP ? pUDP : m_pUDP )->SetSendAddress( A );
 
+    // Join through AddMulticastAddress so the group is remembered and joined by any shards.
     if( Multicast )
     {
         AddMulticastAddress( A );
-
-        // TODO: Do we need to disable broadcasting on the socket if we switch to multicast?
-    }
-    else
-    {
-        // Enable broadcasting on the send socket
-        KINT32 yes = 1;
-        KINT32 iRet = setsockopt( m_iSocket[SEND_SOCK], SOL_SOCKET, SO_BROADCAST, ( const char * )&yes, sizeof( yes ) );
-        if( iRet == SOCKET_ERROR )
-        {
-            THROW_ERROR;
-        }
     }
 }
 
@@ -404,68 +572,106 @@ void Connection::SetSendAddress( const KString & A, KBOOL Multicast /*= false */
 
 const KString & Connection::GetSendAddress() const
 {
-    return m_sSendAddress;
+    const UDP_Transport * pUDP = udp();
+    return ( pUDP ? pUDP : m_pUDP )->GetSendAddress();
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 void Connection::AddMulticastAddress( const KString & A ) throw( KException )
 {
-    // Attempt to join the group
-    ip_mreq mc;
-    mc.imr_multiaddr.s_addr = inet_addr( m_sSendAddress.c_str() );
-    mc.imr_interface.s_addr = htonl( INADDR_ANY );
-    KINT32 iRet = setsockopt( m_iSocket[RECEIVE_SOCK], IPPROTO_IP, IP_ADD_MEMBERSHIP, ( KOCTET* )&mc, sizeof( mc ) );
-    if( iRet == SOCKET_ERROR )
+    // The shards own the port while they run.
+    if( m_pShards )
     {
-        THROW_ERROR;
+        m_pShards->AddMulticastAddress( A );
     }
+    else
+    {
+        transport()->AddMulticastAddress( A );
+    }
+
+    // Remember the group so it can be joined again when the receive socket changes.
+    m_vMulticastAddresses.push_back( A );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 void Connection::RemoveMulticastAddress( const KString & A ) throw( KException )
 {
-    // Attempt to drop the address.
-    ip_mreq mc;
-    mc.imr_multiaddr.s_addr = inet_addr( m_sSendAddress.c_str() );
-    mc.imr_interface.s_addr = htonl( INADDR_ANY );
-    KINT32 iRet = setsockopt( m_iSocket[RECEIVE_SOCK], IPPROTO_IP, IP_DROP_MEMBERSHIP, ( KOCTET* )&mc, sizeof( mc ) );
-    if( iRet == SOCKET_ERROR )
+    if( m_pShards )
     {
-        THROW_ERROR;
+        m_pShards->RemoveMulticastAddress( A );
+    }
+    else
+    {
+        transport()->RemoveMulticastAddress( A );
     }
+
+    vector<KString>::iterator itr = find( m_vMulticastAddresses.begin(), m_vMulticastAddresses.end(), A );
+    if( itr != m_vMulticastAddresses.end() )m_vMulticastAddresses.erase( itr );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
-void Connection::SetBlockingModeEnabled( KBOOL E )
+void Connection::SetReceiveShards( KUINT16 Count, const vector<KINT32> & CPUs /* = vector<KINT32>() */,
+                                   ReceiveShards::FactoryCreator FC /* = 0 */ ) throw( KException )
 {
-    m_bBlockingSocket = E;
+    UDP_Transport * pUDP = udp();
+    if( !pUDP && Count )throw KException( __FUNCTION__, INVALID_OPERATION, "Receive shards need a UDP_Transport" );
+
+    stopReceiveShards();
 
-    for( KINT8 i = 0; i < 2; ++i )
+    if( !Count )
     {
-        KINT32 iResult;
+        if( pUDP )resetReceiveSocket( *pUDP, true );
+        return;
+    }
 
-#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    // The transport's socket must leave the port or it would take a share of the datagrams.
+    resetReceiveSocket( *pUDP, false );
+
+    try
+    {
+        m_pShards = new ReceiveShards( pUDP->GetPort(), Count, CPUs, FC );
+        m_pShards->SetTimingEnabled( m_bTrackLatency );
+        m_pShards->SetStatistics( m_pStats );
+        m_pShards->SetDropDetectionEnabled( m_bDetectDrops );
+        if( m_ui32ReceiveBufferSize )m_pShards->SetReceiveBufferSize( m_ui32ReceiveBufferSize );
+
+        vector<KString>::const_iterator citr = m_vMulticastAddresses.begin();
+        vector<KString>::const_iterator citrEnd = m_vMulticastAddresses.end();
+        for( ; citr != citrEnd; ++citr )
+        {
+            m_pShards->AddMulticastAddress( *citr );
+        }
 
-        // Windows non blocking //
-        unsigned long int uliIoctBlock = !m_bBlockingSocket;           // 1 enable, 0 disable.
-        iResult = ioctlsocket( m_iSocket[i], FIONBIO, &uliIoctBlock ); // FIONBIO =  blocking mode
+        if( m_bDecodeHandledOnly )m_pShards->CopyDecodeEnabled( *m_pPduFact );
 
-#else
+        m_pShards->Start();
+    }
+    catch( const KException & )
+    {
+        stopReceiveShards();
+        resetReceiveSocket( *pUDP, true );
+        throw;
+    }
+}
 
-        // Linux non blocking //
-        KINT32 uliIoctBlock = !m_bBlockingSocket; // 1 enable, 0 disable.
-        iResult = fcntl( m_iSocket[i], F_SETFL, O_NONBLOCK | FASYNC, &uliIoctBlock );
+//////////////////////////////////////////////////////////////////////////
 
-#endif
+KUINT16 Connection::GetReceiveShardCount() const
+{
+    return m_pShards ? m_pShards->GetShardCount() : 0;
+}
 
-        if( iResult == SOCKET_ERROR )
-        {
-            THROW_ERROR;
-        }
-    }
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::SetBlockingModeEnabled( KBOOL E )
+{
+    m_bBlockingSocket = E;
+
+    UDP_Transport * pUDP = udp();
+    if( pUDP )pUDP->SetBlockingModeEnabled( E );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -528,6 +734,8 @@ void Connection::SetPDU_Factory( PDU_Factory * P )
     {
         if( m_pPduFact )delete m_pPduFact;
         m_pPduFact = P;
+        m_pPduFact->SetStatistics( m_pStats );
+        if( m_bDecodeHandledOnly )applyDecodeMask();
     }
 }
 
@@ -540,14 +748,50 @@ PDU_Factory * Connection::GetPDU_Factory()
 
 //////////////////////////////////////////////////////////////////////////
 
-KINT32 Connection::Send( const KOCTET * Data, KUINT32 DataSz ) throw ( KException )
+PDU_Handler * Connection::AddPDUHandler( ProtocolFamily PF, void ( *F )( const Header & ) )
+{
+    return handlerAdded( m_Dispatcher.AddHandler( PF, F ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::RemovePDUHandler( PDU_Handler * H )
+{
+    m_Dispatcher.RemoveHandler( H );
+    if( m_bDecodeHandledOnly )applyDecodeMask();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::SetDecodeHandledOnly( KBOOL E )
 {
-    KINT32 iBytesSent =  sendto( m_iSocket[SEND_SOCK], Data, DataSz, 0, ( sockaddr * )&m_SendToAddr, sizeof( m_SendToAddr ) );
+    m_bDecodeHandledOnly = E;
 
-    if( iBytesSent == SOCKET_ERROR )
+    if( m_bDecodeHandledOnly )
     {
-        THROW_ERROR;
+        applyDecodeMask();
     }
+    else
+    {
+        m_pPduFact->SetDecodeEnabled( true );
+        if( m_pShards )m_pShards->CopyDecodeEnabled( *m_pPduFact );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL Connection::IsDecodeHandledOnly() const
+{
+    return m_bDecodeHandledOnly;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 Connection::Send( const KOCTET * Data, KUINT32 DataSz ) throw ( KException )
+{
+    KINT32 iBytesSent = transport()->Send( Data, DataSz );
+
+    if( m_pStats )m_pStats->OnDatagramSent( iBytesSent );
 
     return iBytesSent;
 }
@@ -571,96 +815,252 @@ KINT32 Connection::SendPDU( Header * H ) throw ( KException )
         ( *itr )->OnPDUTransmit( H );
     }
 
-    // Now send the PDU
-    KDataStream stream;
-    H->Encode( stream );
-    return Send( stream.GetBufferPtr(), stream.GetBufferSize() );
-}
+    if( m_pStats )m_pStats->OnSent( *H );
 
-//////////////////////////////////////////////////////////////////////////
+    if( !m_bCoalesce || m_bCoalesceExempt[H->GetPDUType()] || H->GetPDULength() > m_ui16CoalesceMaxSize )
+    {
+        // Send anything queued first so the PDU does not overtake it.
+        KINT32 iBytesSent = FlushCoalescedPDUs();
 
-KINT32 Connection::Receive( KOCTET * Buffer, KUINT32 BufferSz, KString * SenderIp /*= NULL*/ ) throw ( KException )
-{
-    // We use fd_set to test the receive socket for readability. This is used in both blocking
-    // and none blocking mode however it is primarily here for none blocking mode as it is more
-    // efficient to use this method than to continuously poll the socket.
-    fd_set fd;
-    FD_ZERO( &fd );
-    FD_SET( m_iSocket[RECEIVE_SOCK], &fd );
-    timeval pTimeout;
+        // Now send the PDU
+        KDataStream stream;
+        H->Encode( stream );
+        return iBytesSent + Send( stream.GetBufferPtr(), stream.GetBufferSize() );
+    }
 
-    if( !m_bBlockingSocket )
+    // Send the current bundle first if it is due or the PDU will not fit in it.
+    KINT32 iBytesSent = FlushExpiredCoalescedPDUs();
+    if( m_CoalesceStream.GetBufferSize() + H->GetPDULength() > m_ui16CoalesceMaxSize )
     {
-        // If we are using none blocking mode we need to set
-        // a time limit to wait for the select function.
-        timeval tval;
-        tval.tv_sec  = 0;
-        tval.tv_usec = 1;
-        pTimeout = tval;
+        iBytesSent += FlushCoalescedPDUs();
     }
-    else
+
+    if( m_CoalesceStream.GetBufferSize() == 0 )
     {
-        // Even in blocking mode, it can be useful to return
-        // occasionally after a long period without data.
-        // where (long period == a second or so).
-        // This can make clean exits a joy and allow status messages
-        // from the same thread
-        pTimeout = m_blockingTimeout;
+        m_ui64CoalesceStart = getMonotonicTime();
     }
 
-    // Check the socket, do we have data waiting?
-    KINT32 uiErr = select( m_iSocket[RECEIVE_SOCK] + 1, &fd, 0, 0, &pTimeout );
+    H->Encode( m_CoalesceStream );
 
-    if( uiErr == SOCKET_ERROR )
+    // Don't hold on to a full bundle.
+    if( m_CoalesceStream.GetBufferSize() == m_ui16CoalesceMaxSize )
     {
-        THROW_ERROR;
+        iBytesSent += FlushCoalescedPDUs();
     }
 
-    if( uiErr ) // If none zero we have data waiting
+    return iBytesSent;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::SetCoalescingEnabled( KBOOL E, KUINT32 DeadlineUS /* = 1000 */, KUINT16 MaxSize /* = 1472 */ ) throw ( KException )
+{
+    if( !E )
     {
-        // Get data from socket
-        sockaddr_in ClientAddr;
-        socklen_t iSz = sizeof( ClientAddr );
-        uiErr = recvfrom( m_iSocket[RECEIVE_SOCK], Buffer, BufferSz, 0, ( sockaddr * )&ClientAddr, &iSz );
+        FlushCoalescedPDUs();
+    }
 
-        if( uiErr == SOCKET_ERROR )
-        {
-            THROW_ERROR;
-        }
+    m_bCoalesce = E;
+    m_ui32CoalesceDeadline = DeadlineUS;
+    m_ui16CoalesceMaxSize = MaxSize > MAX_PDU_SIZE ? MAX_PDU_SIZE : MaxSize;
+
+    if( m_bCoalesce )
+    {
+        m_CoalesceStream.Reserve( m_ui16CoalesceMaxSize );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL Connection::IsCoalescingEnabled() const
+{
+    return m_bCoalesce;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::SetCoalescingExempt( PDUType T, KBOOL E )
+{
+    m_bCoalesceExempt[( KUINT8 )T] = E;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL Connection::IsCoalescingExempt( PDUType T ) const
+{
+    return m_bCoalesceExempt[( KUINT8 )T];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 Connection::FlushCoalescedPDUs() throw ( KException )
+{
+    if( m_CoalesceStream.GetBufferSize() == 0 )return 0;
+
+    KINT32 iBytesSent = 0;
+    try
+    {
+        iBytesSent = Send( m_CoalesceStream );
+    }
+    catch( const KException & )
+    {
+        // Don't leave the bundle queued forever.
+        m_CoalesceStream.Clear();
+        throw;
+    }
+
+    m_CoalesceStream.Clear();
+    return iBytesSent;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 Connection::FlushExpiredCoalescedPDUs() throw ( KException )
+{
+    if( m_CoalesceStream.GetBufferSize() == 0 )return 0;
+
+    if( getMonotonicTime() - m_ui64CoalesceStart < m_ui32CoalesceDeadline )return 0;
+
+    return FlushCoalescedPDUs();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 Connection::SendBundle( const Bundle & B ) throw ( KException )
+{
+    const vector<KDataStream> & vStreams = B.GetPDUStreams();
+    const vector<PduPtr> & vRefs = B.GetRefPDUs();
 
-        // Do we need the sending IP address?
-        if( SenderIp )
+    // First lets fire the events.
+    vector<PduPtr>::const_iterator citrRef = vRefs.begin();
+    vector<PduPtr>::const_iterator citrRefEnd = vRefs.end();
+    for( ; citrRef != citrRefEnd; ++citrRef )
+    {
+        vector<ConnectionSubscriber*>::iterator itr = m_vpSubscribers.begin();
+        vector<ConnectionSubscriber*>::iterator itrEnd = m_vpSubscribers.end();
+        for( ; itr != itrEnd; ++itr )
         {
-            *SenderIp = inet_ntoa( ClientAddr.sin_addr );
+            ( *itr )->OnPDUTransmit( citrRef->GetPtr() );
         }
+
+        if( m_pStats )m_pStats->OnSent( **citrRef );
+    }
+
+    // Encode the referenced PDUs into the arena, they follow the streams as in Bundle::Encode.
+    m_SendArena.Clear();
+    m_SendArena.Reserve( MAX_PDU_SIZE );
+    B.EncodeRefPDUs( m_SendArena );
+
+    // Build the scatter-gather list over the member buffers.
+    m_vSendIOV.clear();
+    vector<KDataStream>::const_iterator citrObj = vStreams.begin();
+    vector<KDataStream>::const_iterator citrObjEnd = vStreams.end();
+    for( ; citrObj != citrObjEnd; ++citrObj )
+    {
+        if( !citrObj->GetBufferSize() )continue;
+
+        KIOVEC v;
+        SetIOVec( v, citrObj->GetBufferPtr(), citrObj->GetBufferSize() );
+        m_vSendIOV.push_back( v );
+    }
+
+    if( m_SendArena.GetBufferSize() )
+    {
+        KIOVEC v;
+        SetIOVec( v, m_SendArena.GetBufferPtr(), m_SendArena.GetBufferSize() );
+        m_vSendIOV.push_back( v );
     }
 
-    return uiErr;
+    if( m_vSendIOV.empty() )return 0;
+
+    const KINT32 iBytesSent = transport()->SendGather( &m_vSendIOV[0], m_vSendIOV.size() );
+
+    if( m_pStats )m_pStats->OnDatagramSent( iBytesSent );
+
+    return iBytesSent;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 Connection::ReceiveFrom( KOCTET * Buffer, KUINT32 BufferSz, sockaddr_in & Sender, KUINT64 * ArrivalTime /* = 0 */ ) throw ( KException )
+{
+    // In none blocking mode the transport is only polled. Even in blocking mode, it can be useful
+    // to return occasionally after a long period without data(where long period == a second or so).
+    // This can make clean exits a joy and allow status messages from the same thread.
+    const KINT32 iTimeout = m_bBlockingSocket ? m_blockingTimeout.tv_sec * 1000000 + m_blockingTimeout.tv_usec : 0;
+
+    KUINT32 ui32Dropped = 0;
+    const KINT32 iSz = transport()->Receive( Buffer, BufferSz, Sender, iTimeout, ArrivalTime, &ui32Dropped );
+
+    if( ui32Dropped )
+    {
+        if( m_pStats )m_pStats->OnDatagramsDropped( ui32Dropped );
+        datagramsDropped( ui32Dropped );
+    }
+
+    return iSz;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 Connection::Receive( KOCTET * Buffer, KUINT32 BufferSz, KString * SenderIp /*= NULL*/ ) throw ( KException )
+{
+    sockaddr_in Sender;
+    KINT32 iSz = ReceiveFrom( Buffer, BufferSz, Sender );
+
+    // Do we need the sending IP address?
+    if( iSz && SenderIp )
+    {
+        *SenderIp = inet_ntoa( Sender.sin_addr );
+    }
+
+    return iSz;
 }
 
 //////////////////////////////////////////////////////////////////////////
 
-auto_ptr<Header> Connection::GetNextPDU( KString * SenderIp /* = 0 */ ) throw ( KException )
+PduUniquePtr Connection::GetNextPDU( KString * SenderIp /* = 0 */ ) throw ( KException )
 {
+    PduUniquePtr pdu;
+    const ErrorCodes e = TryGetNextPDU( pdu, SenderIp );
+    if( e != NO_ERRORS )throw KException( __FUNCTION__, e );
+    return pdu;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes Connection::TryGetNextPDU( PduUniquePtr & PDU, KString * SenderIp /* = 0 */ ) throw ( KException )
+{
+    PDU.reset();
+
+    // Keep the coalescing deadline when the application only polls for data.
+    FlushExpiredCoalescedPDUs();
+
+    if( m_pShards )return tryGetNextShardPDU( PDU, SenderIp );
+
     // Are we currently dealing with a PDU Bundle, if so then dont read any new data.
     if( m_stream.GetBufferSize() == 0 )
     {
         // Get some new data from the network
         // Create a buffer to store network data
         KOCTET Buffer[MAX_PDU_SIZE];
-        KINT32 iSz = Receive( Buffer, MAX_PDU_SIZE, &m_sLastIP );
+        KINT32 iSz = ReceiveFrom( Buffer, MAX_PDU_SIZE, m_LastSender, &m_ui64LastArrival );
 
         if( iSz )
         {
+            if( m_bTrackLatency )m_ui64LastReceive = GetWallTime();
+            if( m_pStats )m_pStats->OnDatagramReceived( iSz );
+
             // Fire the first event, this event can also be used to inform us if we should stop
             vector<ConnectionSubscriber*>::iterator itr = m_vpSubscribers.begin();
             vector<ConnectionSubscriber*>::iterator itrEnd = m_vpSubscribers.end();
             for( ; itr != itrEnd; ++itr )
             {
-                if( !( *itr )->OnDataReceived( Buffer, iSz, m_sLastIP ) )
+                if( !( *itr )->OnDataReceived( Buffer, iSz, m_LastSender, m_ui64LastArrival ) )
                 {
                     // We should quit
-                    return auto_ptr<Header>( 0 );
+                    if( m_pStats )m_pStats->OnDatagramFiltered();
+                    return NO_ERRORS;
                 }
             }
 
@@ -670,58 +1070,326 @@ auto_ptr<Header> Connection::GetNextPDU( KString * SenderIp /* = 0 */ ) throw (
         }
     }
 
-    // Now process the stream
-    if( m_stream.GetBufferSize() > 0 )
+    // Now process the stream, PDU the factory does not decode are skipped until one is found.
+    // Do they want the IP address returned?
+    if( SenderIp && m_stream.GetBufferSize() > 0 )
     {
-        // Do they want the IP address returned?
-        if( SenderIp )
-        {
-            *SenderIp = m_sLastIP;
-        }
+        *SenderIp = inet_ntoa( m_LastSender.sin_addr );
+    }
 
+    while( m_stream.GetBufferSize() > 0 )
+    {
         // Get the current write position
         KUINT16 currentPos = m_stream.GetCurrentWritePosition();
+        const KUINT32 ui32DatagramSize = currentPos + m_stream.GetBufferSize();
+
+        // Get the next/only PDU from the stream
+        Header H;
+        ErrorCodes e = H.TryDecode( m_stream );
+        KUINT64 ui64DecodeStart = 0;
+
+        // We step through the stream by the PDU length, one smaller than a header would never move on.
+        if( e == NO_ERRORS && H.GetPDULength() < Header::HEADER6_PDU_SIZE )e = INVALID_DATA;
+
+        if( e == NO_ERRORS )
+        {
+            if( m_pStats && !currentPos && H.GetPDULength() < ui32DatagramSize )m_pStats->OnBundleReceived();
+
+            if( !m_pPduFact->IsDecodeEnabled( H ) )
+            {
+                // The header has been checked against the stream so we can step over the body.
+                if( m_pStats )m_pStats->OnFiltered( H );
+                m_stream.SetCurrentWritePosition( currentPos + H.GetPDULength() );
+                continue;
+            }
+
+            if( m_pStats )ui64DecodeStart = PDU_Statistics::GetTime();
+            e = m_pPduFact->TryDecode( H, m_stream, PDU );
+            if( m_pStats && e != NO_ERRORS )m_pStats->OnFailed( H, e );
+        }
+        else if( m_pStats )
+        {
+            m_pStats->OnFailed( e );
+        }
+
+        if( e != NO_ERRORS )
+        {
+            // Something went wrong, the stream is likely corrupted now so wipe it or we will have issues in the next GetNextPDU call.
+            m_stream.Clear();
+            return e;
+        }
 
-        try
+        // If the PDU was decoded successfully then fire the next event
+        if( PDU.get() )
         {
-            // Get the next/only PDU from the stream
-            auto_ptr<Header> pdu = m_pPduFact->Decode( m_stream );
+            const KUINT64 ui64Decoded = m_bTrackLatency ? GetWallTime() : 0;
+
+            if( m_pStats )
+            {
+                m_pStats->OnDecoded( *PDU, PDU_Statistics::GetTime() - ui64DecodeStart, currentPos || PDU->GetPDULength() < ui32DatagramSize );
+            }
 
-            // If the PDU was decoded successfully then fire the next event
-            if( pdu.get() )
+            try
             {
                 vector<ConnectionSubscriber*>::iterator itr = m_vpSubscribers.begin();
                 vector<ConnectionSubscriber*>::iterator itrEnd = m_vpSubscribers.end();
                 for( ; itr != itrEnd; ++itr )
                 {
-                    ( *itr )->OnPDUReceived( pdu.get() );
+                    ( *itr )->OnPDUReceived( PDU.get() );
                 }
 
-                // Set the write pos for the next pdu. We do this here as its possible that when the PDU was decoded that some data may
-				// have been left un-decoded so to be extra safe we use the reported pdu size and not the current stream.
-                m_stream.SetCurrentWritePosition( currentPos + pdu->GetPDULength() );
-
-                // Now return the decoded pdu
-                return pdu;
+                m_Dispatcher.Dispatch( *PDU );
             }
-            else
+            catch( const exception & )
             {
-                // If a PDU could not be decoded in the PDU bundle, then we need to throw
-                // out the whole stream. There is no way to know where the next PDU might start
-                // in the data stream.
+                // A subscriber failed, drop the rest of the stream as before.
                 m_stream.Clear();
+                throw;
             }
+
+            if( m_bTrackLatency )recordLatency( *PDU, ui64Decoded );
+
+            // Set the write pos for the next pdu. We do this here as its possible that when the PDU was decoded that some data may
+            // have been left un-decoded so to be extra safe we use the reported pdu size and not the current stream.
+            m_stream.SetCurrentWritePosition( currentPos + PDU->GetPDULength() );
         }
-        catch( const exception & e )
+        else
         {
-            // Something went wrong, the stream is likely corrupted now so wipe it or we will have issues in the next GetNextPDU call.
+            // If a PDU could not be decoded in the PDU bundle, then we need to throw
+            // out the whole stream. There is no way to know where the next PDU might start
+            // in the data stream.
             m_stream.Clear();
-            throw;
         }
+
+        break;
     }
 
-    return auto_ptr<Header>( 0 ); // No data so Null ptr
+    return NO_ERRORS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const sockaddr_in & Connection::GetLastSender() const
+{
+    return m_LastSender;
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+KString Connection::GetLastSenderIp() const
+{
+    return inet_ntoa( m_LastSender.sin_addr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 Connection::GetLastArrivalTime() const
+{
+    return m_ui64LastArrival;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::SetLatencyTrackingEnabled( KBOOL E )
+{
+    m_bTrackLatency = E;
+
+    // Not all platforms support kernel timestamps, then only the later stages are recorded.
+    UDP_Transport * pUDP = udp();
+    if( pUDP )pUDP->SetReceiveTimestampsEnabled( E );
+    if( m_pShards )m_pShards->SetTimingEnabled( E );
+
+    if( !E )
+    {
+        m_ui64LastArrival = 0;
+        m_ui64LastReceive = 0;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL Connection::IsLatencyTrackingEnabled() const
+{
+    return m_bTrackLatency;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const LatencyHistogram * Connection::GetLatencyHistogram( PDUType T, LatencyStage S ) const
+{
+    if( S >= LATENCY_STAGES )return 0;
+    return m_pLatency[( KUINT8 )T][S];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::ResetLatencyHistograms()
+{
+    for( KUINT16 i = 0; i < 256; ++i )
+    {
+        for( KUINT8 j = 0; j < LATENCY_STAGES; ++j )
+        {
+            if( m_pLatency[i][j] )m_pLatency[i][j]->Reset();
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::SetStatisticsEnabled( KBOOL E )
+{
+    m_pStats = E ? &m_Stats : 0;
+    m_pPduFact->SetStatistics( m_pStats );
+    if( m_pShards )m_pShards->SetStatistics( m_pStats );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL Connection::IsStatisticsEnabled() const
+{
+    return m_pStats != 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+PDU_Statistics & Connection::GetStatistics()
+{
+    return m_Stats;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const PDU_Statistics & Connection::GetStatistics() const
+{
+    return m_Stats;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::SetReceiveBufferSize( KUINT32 Size ) throw ( KException )
+{
+    UDP_Transport * pUDP = udp();
+    if( pUDP && !SetSocketBufferSize( pUDP->GetSocket( true ), true, Size ) )
+    {
+        THROW_ERROR;
+    }
+
+    if( m_pShards )m_pShards->SetReceiveBufferSize( Size );
+    m_ui32ReceiveBufferSize = Size;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 Connection::GetReceiveBufferSize() const
+{
+    const UDP_Transport * pUDP = udp();
+    return pUDP ? GetSocketBufferSize( pUDP->GetSocket( true ), true ) : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::SetSendBufferSize( KUINT32 Size ) throw ( KException )
+{
+    UDP_Transport * pUDP = udp();
+    if( pUDP && !SetSocketBufferSize( pUDP->GetSocket( false ), false, Size ) )
+    {
+        THROW_ERROR;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 Connection::GetSendBufferSize() const
+{
+    const UDP_Transport * pUDP = udp();
+    return pUDP ? GetSocketBufferSize( pUDP->GetSocket( false ), false ) : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::SetDropDetectionEnabled( KBOOL E )
+{
+    m_bDetectDrops = E;
+
+    UDP_Transport * pUDP = udp();
+    if( pUDP )pUDP->SetDropDetectionEnabled( E );
+    if( m_pShards )m_pShards->SetDropDetectionEnabled( E );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL Connection::IsDropDetectionEnabled() const
+{
+    return m_bDetectDrops;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 Connection::GetDroppedDatagramCount() const
+{
+    return m_ui64Dropped;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::SetTransport( Transport * T ) throw ( KException )
+{
+    if( T == m_pTransport )return;
+
+    stopReceiveShards();
+    delete m_pTransport;
+    m_pTransport = T;
+    m_stream.Clear();
+
+    if( m_pTransport )
+    {
+        // Stop our own socket collecting datagrams nobody reads.
+        resetReceiveSocket( *m_pUDP, false );
+
+        UDP_Transport * pUDP = udp();
+        if( pUDP )configureUDP( *pUDP );
+
+        vector<KString>::const_iterator citr = m_vMulticastAddresses.begin();
+        vector<KString>::const_iterator citrEnd = m_vMulticastAddresses.end();
+        for( ; citr != citrEnd; ++citr )
+        {
+            m_pTransport->AddMulticastAddress( *citr );
+        }
+    }
+    else
+    {
+        resetReceiveSocket( *m_pUDP, true );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Transport * Connection::GetTransport()
+{
+    return m_pTransport;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::SetSharedMemoryTransport( const KString & Name, KUINT32 Slots /* = SharedMemoryRing::DEFAULT_SLOTS */,
+                                           KUINT32 Mode /* = 0600 */ ) throw ( KException )
+{
+    SetTransport( new SharedMemoryTransport( Name, Slots, Mode ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Connection::SetNetworkTransport() throw ( KException )
+{
+    SetTransport( 0 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const SharedMemoryRing * Connection::GetSharedMemoryRing() const
+{
+    SharedMemoryTransport * pShm = dynamic_cast<SharedMemoryTransport *>( m_pTransport );
+    return pShm ? &pShm->GetRing() : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
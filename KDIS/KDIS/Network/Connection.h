@@ -55,11 +55,18 @@ http://p.sf.net/kdis/UserGuide
 #include <netdb.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/uio.h>
 
 #endif
 
 #include "./../Extras/PDU_Factory.h"
+#include "./../PDU/Bundle.h"
 #include "./ConnectionSubscriber.h"
+#include "./PDU_Dispatcher.h"
+#include "./ReceiveShards.h"
+#include "./UDP_Transport.h"
+#include "./SharedMemoryRing.h"
+#include "./../Extras/LatencyHistogram.h"
 #include <vector>
 
 namespace KDIS {
@@ -67,53 +74,154 @@ namespace NETWORK {
 
 class KDIS_EXPORT Connection
 {
-protected:
+public:
 
-    KINT32 m_iSocket[2]; // 1 for sending & 1 for receiving.
+    // The stages of receiving a PDU that latency is recorded for, see SetLatencyTrackingEnabled.
+    enum LatencyStage
+    {
+        KernelToReceive,  // Arrival at the socket until read by the connection.
+        ReceiveToDecoded, // Read until the PDU has been decoded.
+        DecodedToHandled, // Decoded until all subscribers and PDU handlers have returned.
+        LATENCY_STAGES
+    };
 
-    KUINT32 m_uiPort;
+protected:
 
-    timeval m_blockingTimeout;
+    // The connection's own UDP sockets, used unless another transport is set.
+    UDP_Transport * m_pUDP;
 
-    sockaddr_in m_SendToAddr;
-    KString m_sSendAddress;
+    timeval m_blockingTimeout;
 
     KBOOL m_bBlockingSocket;
 
-    KBOOL m_bSendOnly;
-
     std::vector<ConnectionSubscriber*> m_vpSubscribers;
 
     KDIS::UTILS::PDU_Factory * m_pPduFact;
 
+    // Typed PDU handlers, see AddPDUHandler.
+    PDU_Dispatcher m_Dispatcher;
+    KBOOL m_bDecodeHandledOnly;
+
     // Allows us to handle pdu bundles
     KDataStream m_stream;
-    KString m_sLastIP;
+    sockaddr_in m_LastSender;
+
+    // Reused by SendBundle so sending does not allocate.
+    KDataStream m_SendArena;
+    std::vector<KIOVEC> m_vSendIOV;
+
+    // Outgoing PDU coalescing, see SetCoalescingEnabled.
+    KBOOL m_bCoalesce;
+    KUINT16 m_ui16CoalesceMaxSize;
+    KUINT32 m_ui32CoalesceDeadline;
+    KUINT64 m_ui64CoalesceStart;
+    KDataStream m_CoalesceStream;
+    KBOOL m_bCoalesceExempt[256];
+
+    // Sharded receiving, see SetReceiveShards.
+    ReceiveShards * m_pShards;
+    ReceiveShards::Datagram * m_pShardDatagram;
+    KUINT32 m_ui32ShardPDU;
+    std::vector<KString> m_vMulticastAddresses;
+
+    // Latency tracking, times are nanoseconds since the epoch. The histograms are created on first use.
+    KBOOL m_bTrackLatency;
+    KUINT64 m_ui64LastArrival;
+    KUINT64 m_ui64LastReceive;
+    KDIS::UTILS::LatencyHistogram * m_pLatency[256][LATENCY_STAGES];
+
+    // Points to m_Stats while statistics are enabled, else NULL.
+    KDIS::UTILS::PDU_Statistics m_Stats;
+    KDIS::UTILS::PDU_Statistics * m_pStats;
+
+    // Receive socket buffer size in bytes, 0 leaves the system default.
+    KUINT32 m_ui32ReceiveBufferSize;
+
+    // Kernel drop detection.
+    KBOOL m_bDetectDrops;
+    KUINT64 m_ui64Dropped;
+
+    // When set datagrams are sent and received by the transport instead of m_pUDP.
+    Transport * m_pTransport;
 
     //************************************
-    // FullName:    KDIS::NETWORK::Connection::startup
-    // Description: Setup the socket.
+    // FullName:    KDIS::NETWORK::Connection::transport
+    //              KDIS::NETWORK::Connection::udp
+    // Description: The transport in use and the same as a UDP_Transport, NULL when it is not one.
     //************************************
-    void startup() throw ( KException );
+    Transport * transport() const;
+    UDP_Transport * udp() const;
 
     //************************************
-    // FullName:    KDIS::NETWORK::Connection::bindSocket
-    // Description: Bind the socket to receive data from all.
+    // FullName:    KDIS::NETWORK::Connection::getErrorText
+    // Description: Convert an internal socket error code into a text description.
+    // Parameter:   KINT32 ErrorCode
     //************************************
-    void bindSocket();
+    const KCHAR8 * getErrorText( KINT32 ErrorCode ) const;
 
     //************************************
-    // FullName:    KDIS::NETWORK::Connection::shutdown
-    // Description: Shutdown all socket features.
+    // FullName:    KDIS::NETWORK::Connection::getMonotonicTime
+    // Description: Returns a monotonic time in microseconds, used for the coalescing deadline.
     //************************************
-    void shutdown() throw ( KException );
+    static KUINT64 getMonotonicTime();
 
     //************************************
-    // FullName:    KDIS::NETWORK::Connection::getErrorText
-    // Description: Convert an internal socket error code into a text description.
-    // Parameter:   KINT32 ErrorCode
+    // FullName:    KDIS::NETWORK::Connection::applyDecodeMask
+    // Description: Sets the decode mask from the handlers on our factory and any shard factories.
     //************************************
-    const KCHAR8 * getErrorText( KINT32 ErrorCode ) const;
+    void applyDecodeMask();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::handlerAdded
+    // Description: Updates the decode mask after a handler is added and returns the handler.
+    // Parameter:   PDU_Handler * H
+    //************************************
+    PDU_Handler * handlerAdded( PDU_Handler * H );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::configureUDP
+    // Description: Applies the blocking mode, latency tracking, drop detection and receive buffer size to T.
+    // Parameter:   UDP_Transport & T
+    //************************************
+    void configureUDP( UDP_Transport & T ) throw ( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::resetReceiveSocket
+    // Description: Replaces the receive socket of T with a new one, when bound it rejoins the multicast groups.
+    // Parameter:   UDP_Transport & T
+    // Parameter:   KBOOL Bind
+    //************************************
+    void resetReceiveSocket( UDP_Transport & T, KBOOL Bind ) throw ( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::stopReceiveShards
+    // Description: Stops the receive shards, any undelivered PDU are discarded.
+    //************************************
+    void stopReceiveShards();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::tryGetNextShardPDU
+    // Description: TryGetNextPDU when the receive shards are running, the PDU have already been decoded
+    //              by the shards so only the events are fired here.
+    // Parameter:   PduUniquePtr & PDU
+    // Parameter:   KString * SenderIp
+    //************************************
+    KDIS::ErrorCodes tryGetNextShardPDU( KDIS::PDU::PduUniquePtr & PDU, KString * SenderIp ) throw ( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::recordLatency
+    // Description: Records the latency of each stage for a handled PDU.
+    // Parameter:   const Header & H
+    // Parameter:   KUINT64 DecodedTime
+    //************************************
+    void recordLatency( const KDIS::PDU::Header & H, KUINT64 DecodedTime );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::datagramsDropped
+    // Description: Adds to the drop count and informs the subscribers.
+    // Parameter:   KUINT32 Count
+    //************************************
+    void datagramsDropped( KUINT32 Count );
 
 public:
 
@@ -141,11 +249,35 @@ public:
     //              Note: If you want to also send data to this address you should
     //              call SetSendAddress with the same multicast address.
     //              Note: You can add multiple groups.
+    //              Note: The groups are also joined by any receive shards.
     // Parameter:   const KString & A
     //************************************
     void AddMulticastAddress( const KString & A ) throw( KException );
     void RemoveMulticastAddress( const KString & A ) throw( KException );
 
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::SetReceiveShards
+    //              KDIS::NETWORK::Connection::GetReceiveShardCount
+    // Description: Spreads receiving across Count sockets bound to the port with SO_REUSEPORT, each read and
+    //              decoded by its own thread and PDU_Factory, see ReceiveShards. GetNextPDU then returns the
+    //              PDU from all shards and fires the subscriber events on the calling thread as before, so
+    //              subscribers do not need to be thread safe. Pass a Count of 0 to go back to receiving on
+    //              the transport's own socket. Shards need a UDP_Transport, the connection's own or one
+    //              passed to SetTransport, the shards take over its port.
+    //              Note: While sharded the transport's socket does not receive, use GetNextPDU not Receive.
+    //              Note: The shard factories are created by FC(the standard PDU_Factory by default), filters
+    //              added to GetPDU_Factory are not applied by the shards. The decode mask set by
+    //              SetDecodeHandledOnly is kept in step with the handlers on every shard.
+    //              Note: At most ReceiveShards::GetMaxReady datagrams are queued, beyond that the shards
+    //              stop reading and the kernel drops datagrams until GetNextPDU catches up.
+    // Parameter:   KUINT16 Count
+    // Parameter:   const std::vector<KINT32> & CPUs - Optional CPU to pin each shard's thread to, -1 to not pin.
+    // Parameter:   ReceiveShards::FactoryCreator FC
+    //************************************
+    void SetReceiveShards( KUINT16 Count, const std::vector<KINT32> & CPUs = std::vector<KINT32>(),
+                           ReceiveShards::FactoryCreator FC = 0 ) throw( KException );
+    KUINT16 GetReceiveShardCount() const;
+
     //************************************
     // FullName:    KDIS::NETWORK::Connection::SetBlockingModeEnabled
     // Description: Enabled/Disable blocking mode.
@@ -192,6 +324,52 @@ public:
     void SetPDU_Factory( KDIS::UTILS::PDU_Factory * P );
     KDIS::UTILS::PDU_Factory * GetPDU_Factory();
 
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::AddPDUHandler
+    //              KDIS::NETWORK::Connection::RemovePDUHandler
+    // Description: Registers a callback for a PDU type or protocol family, called by GetNextPDU after the
+    //              subscribers OnPDUReceived. Unlike a subscriber only the handlers registered for the
+    //              PDU are called and type handlers receive the concrete PDU class, e.g
+    //              AddPDUHandler( Entity_State_PDU_Type, this, &MyClass::OnEntityState ).
+    //              See PDU_Dispatcher::AddHandler. The handler is owned by the connection.
+    // Parameter:   PDUType T, ProtocolFamily PF
+    // Parameter:   Obj * O
+    // Parameter:   callback
+    // Parameter:   PDU_Handler * H
+    //************************************
+    template<class PduType>
+    PDU_Handler * AddPDUHandler( KDIS::DATA_TYPE::ENUMS::PDUType T, void ( *F )( const PduType & ) )
+    {
+        return handlerAdded( m_Dispatcher.AddHandler( T, F ) );
+    };
+
+    template<class Obj, class PduType>
+    PDU_Handler * AddPDUHandler( KDIS::DATA_TYPE::ENUMS::PDUType T, Obj * O, void ( Obj::*F )( const PduType & ) )
+    {
+        return handlerAdded( m_Dispatcher.AddHandler( T, O, F ) );
+    };
+
+    PDU_Handler * AddPDUHandler( KDIS::DATA_TYPE::ENUMS::ProtocolFamily PF, void ( *F )( const KDIS::PDU::Header & ) );
+
+    template<class Obj>
+    PDU_Handler * AddPDUHandler( KDIS::DATA_TYPE::ENUMS::ProtocolFamily PF, Obj * O, void ( Obj::*F )( const KDIS::PDU::Header & ) )
+    {
+        return handlerAdded( m_Dispatcher.AddHandler( PF, O, F ) );
+    };
+
+    void RemovePDUHandler( PDU_Handler * H );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::SetDecodeHandledOnly
+    //              KDIS::NETWORK::Connection::IsDecodeHandledOnly
+    // Description: When enabled only PDU with a registered handler are decoded, all others are skipped
+    //              by GetNextPDU without being decoded or passed to the subscribers.
+    //              The PDU_Factory decode mask is kept in step with the handlers.
+    // Parameter:   KBOOL E
+    //************************************
+    void SetDecodeHandledOnly( KBOOL E );
+    KBOOL IsDecodeHandledOnly() const;
+
     //************************************
     // FullName:    KDIS::NETWORK::Connection::Send
     // Description: Send data over the network. Returns number of bytes sent.
@@ -205,11 +383,62 @@ public:
     //************************************
     // FullName:    KDIS::NETWORK::Connection::SendPDU
     // Description: Sends a PDU over the network, fires the OnPDUTransmit event.
-    //              Returns number of bytes sent.
+    //              Returns number of bytes sent, when coalescing this is the size of any bundle
+    //              that was sent by the call.
     // Parameter:   Header * H
     //************************************
     KINT32 SendPDU( KDIS::PDU::Header * H ) throw ( KException );
 
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::SetCoalescingEnabled
+    //              KDIS::NETWORK::Connection::IsCoalescingEnabled
+    // Description: When enabled SendPDU does not send each PDU in its own datagram, instead the PDU are
+    //              encoded back to back into a bundle which is sent once the next PDU would no longer fit
+    //              in MaxSize octets or the oldest queued PDU has waited DeadlineUS microseconds.
+    //              The deadline is checked on each SendPDU and GetNextPDU call, if neither is called
+    //              regularly use FlushExpiredCoalescedPDUs. Disabling sends any queued PDU.
+    //              Note: The default MaxSize is an Ethernet MTU less the IP and UDP headers.
+    //              Note: The PDU are not padded to 64 bit boundaries, as with Bundle, so any receiver
+    //              that supports bundles(including GetNextPDU) can split them.
+    // Parameter:   KBOOL E
+    // Parameter:   KUINT32 DeadlineUS = 1000
+    // Parameter:   KUINT16 MaxSize = 1472
+    //************************************
+    void SetCoalescingEnabled( KBOOL E, KUINT32 DeadlineUS = 1000, KUINT16 MaxSize = 1472 ) throw ( KException );
+    KBOOL IsCoalescingEnabled() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::SetCoalescingExempt
+    //              KDIS::NETWORK::Connection::IsCoalescingExempt
+    // Description: Exempt PDU types are always sent immediately by SendPDU, even when coalescing,
+    //              any PDU already queued are sent ahead of them so the order is kept.
+    //              By default the Fire and Detonation PDU are exempt.
+    // Parameter:   PDUType T
+    // Parameter:   KBOOL E
+    //************************************
+    void SetCoalescingExempt( KDIS::DATA_TYPE::ENUMS::PDUType T, KBOOL E );
+    KBOOL IsCoalescingExempt( KDIS::DATA_TYPE::ENUMS::PDUType T ) const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::FlushCoalescedPDUs
+    //              KDIS::NETWORK::Connection::FlushExpiredCoalescedPDUs
+    // Description: Sends the PDU queued by coalescing, the expired version only does so when the
+    //              deadline has passed. Returns number of bytes sent, 0 if nothing was sent.
+    //************************************
+    KINT32 FlushCoalescedPDUs() throw ( KException );
+    KINT32 FlushExpiredCoalescedPDUs() throw ( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::SendBundle
+    // Description: Sends all PDU in the bundle as a single datagram, fires the OnPDUTransmit event
+    //              for each referenced PDU. Returns number of bytes sent.
+    //              The PDU streams are handed to the socket in place as a scatter-gather list and
+    //              the referenced PDUs are encoded into one reused arena, so unlike
+    //              Send( Bundle::Encode() ) no intermediate copy of the bundle is made.
+    // Parameter:   const Bundle & B
+    //************************************
+    KINT32 SendBundle( const KDIS::PDU::Bundle & B ) throw ( KException );
+
     //************************************
     // FullName:    KDIS::NETWORK::Connection::Receive
     // Description: Check for new data being sent to us. Returns size of data received in octets/bytes.
@@ -222,6 +451,17 @@ public:
     //************************************
     KINT32 Receive( KOCTET * Buffer, KUINT32 BufferSz, KString * SenderIp = 0 ) throw ( KException );
 
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::ReceiveFrom
+    // Description: As Receive but the sender is returned as the binary socket address, no string is created.
+    // Parameter:   KOCTET * Buffer
+    // Parameter:   KUINT32 BufferSz
+    // Parameter:   sockaddr_in & Sender
+    // Parameter:   KUINT64 * ArrivalTime - Optional field. Set to the kernel arrival time in nanoseconds
+    //                                      since the epoch if latency tracking is enabled, else 0.
+    //************************************
+    KINT32 ReceiveFrom( KOCTET * Buffer, KUINT32 BufferSz, sockaddr_in & Sender, KUINT64 * ArrivalTime = 0 ) throw ( KException );
+
     //************************************
     // FullName:    KDIS::NETWORK::Connection::GetNextPDU
     // Description: Checks the network for new data using Receive if not curently handling a pdu bundle,
@@ -231,7 +471,138 @@ public:
     //              Note: This function supports PDU Bundles.
     // Parameter:   KString * SenderIp - Optional field. Pass a none null pointer to get the senders IP address.
     //************************************
-    std::auto_ptr<KDIS::PDU::Header> GetNextPDU( KString * SenderIp = 0 ) throw ( KException );
+    KDIS::PDU::PduUniquePtr GetNextPDU( KString * SenderIp = 0 ) throw ( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::TryGetNextPDU
+    // Description: As GetNextPDU but decoding errors are returned instead of thrown, the stream is
+    //              discarded on error. PDU is NULL if no data is available or the PDU could not be decoded.
+    //              Note: Socket errors are still reported by exception, as with Receive.
+    // Parameter:   PduUniquePtr & PDU
+    // Parameter:   KString * SenderIp - Optional field. Pass a none null pointer to get the senders IP address.
+    //************************************
+    KDIS::ErrorCodes TryGetNextPDU( KDIS::PDU::PduUniquePtr & PDU, KString * SenderIp = 0 ) throw ( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::GetLastSender
+    //              KDIS::NETWORK::Connection::GetLastSenderIp
+    //              KDIS::NETWORK::Connection::GetLastArrivalTime
+    // Description: The sender of the datagram the last PDU returned by GetNextPDU came from.
+    //              The string version formats the address on each call.
+    //              The arrival time is the kernel timestamp of the datagram in nanoseconds since the epoch,
+    //              it is 0 unless latency tracking is enabled.
+    //************************************
+    const sockaddr_in & GetLastSender() const;
+    KString GetLastSenderIp() const;
+    KUINT64 GetLastArrivalTime() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::SetLatencyTrackingEnabled
+    //              KDIS::NETWORK::Connection::IsLatencyTrackingEnabled
+    // Description: Enables kernel arrival timestamps(SO_TIMESTAMPNS) on the receive socket/s and records a
+    //              histogram for each PDU type and LatencyStage of the PDU returned by GetNextPDU.
+    //              Where kernel timestamps are not supported the KernelToReceive stage is not recorded.
+    // Parameter:   KBOOL E
+    //************************************
+    void SetLatencyTrackingEnabled( KBOOL E );
+    KBOOL IsLatencyTrackingEnabled() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::GetLatencyHistogram
+    //              KDIS::NETWORK::Connection::ResetLatencyHistograms
+    // Description: The latency recorded for a PDU type and stage, NULL if none has been recorded.
+    // Parameter:   PDUType T
+    // Parameter:   LatencyStage S
+    //************************************
+    const KDIS::UTILS::LatencyHistogram * GetLatencyHistogram( KDIS::DATA_TYPE::ENUMS::PDUType T, LatencyStage S ) const;
+    void ResetLatencyHistograms();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::SetStatisticsEnabled
+    //              KDIS::NETWORK::Connection::IsStatisticsEnabled
+    // Description: Counts the datagrams and PDU received and sent by this connection, its PDU_Factory
+    //              and receive shards. Disabled by default, the counters are kept when disabled.
+    // Parameter:   KBOOL E
+    //************************************
+    void SetStatisticsEnabled( KBOOL E );
+    KBOOL IsStatisticsEnabled() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::GetStatistics
+    // Description: The counters, a snapshot can be taken from any thread.
+    //************************************
+    KDIS::UTILS::PDU_Statistics & GetStatistics();
+    const KDIS::UTILS::PDU_Statistics & GetStatistics() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::SetReceiveBufferSize
+    //              KDIS::NETWORK::Connection::GetReceiveBufferSize
+    //              KDIS::NETWORK::Connection::SetSendBufferSize
+    //              KDIS::NETWORK::Connection::GetSendBufferSize
+    // Description: The kernel socket buffer sizes in bytes(SO_RCVBUF/SO_SNDBUF). The system defaults are
+    //              often too small for bursts of multicast traffic. The receive size is kept and applied
+    //              again if the socket is replaced and to the receive shards. The kernel may round or double
+    //              the size, Get returns the size in use, 0 when the transport is not a UDP_Transport.
+    //              Note: On Linux the size is capped by net.core.rmem_max/wmem_max unless the process
+    //              has CAP_NET_ADMIN.
+    // Parameter:   KUINT32 Size
+    //************************************
+    void SetReceiveBufferSize( KUINT32 Size ) throw ( KException );
+    KUINT32 GetReceiveBufferSize() const;
+    void SetSendBufferSize( KUINT32 Size ) throw ( KException );
+    KUINT32 GetSendBufferSize() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::SetDropDetectionEnabled
+    //              KDIS::NETWORK::Connection::IsDropDetectionEnabled
+    //              KDIS::NETWORK::Connection::GetDroppedDatagramCount
+    // Description: Reads the number of datagrams the kernel dropped because the receive buffer was full
+    //              (SO_RXQ_OVFL) with each datagram received. New drops are added to the count, the
+    //              statistics and reported to ConnectionSubscriber::OnDatagramsDropped.
+    //              Drops are only noticed when the next datagram arrives. Not supported on Windows.
+    // Parameter:   KBOOL E
+    //************************************
+    void SetDropDetectionEnabled( KBOOL E );
+    KBOOL IsDropDetectionEnabled() const;
+    KUINT64 GetDroppedDatagramCount() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::SetTransport
+    //              KDIS::NETWORK::Connection::GetTransport
+    // Description: Sends and receives the datagrams through T instead of the connection's own
+    //              UDP_Transport, e.g a LoopbackTransport or SharedMemoryTransport. The rest of the
+    //              connection(subscribers, factory, handlers, bundles, coalescing and statistics)
+    //              is unchanged. The blocking mode and timeout are passed on as the receive timeout.
+    //              The transport is owned by the connection, pass NULL to delete it and go back to the
+    //              connection's own UDP_Transport. Receive shards are stopped.
+    //              Multicast groups are passed on to the transport and remembered for the sockets.
+    //              Note: When T is a UDP_Transport the blocking mode, latency tracking, drop detection,
+    //              socket buffer sizes and receive shards apply to it, other transports are configured
+    //              directly.
+    //              GetTransport returns NULL when using the connection's own UDP_Transport.
+    // Parameter:   Transport * T
+    //************************************
+    void SetTransport( Transport * T ) throw ( KException );
+    Transport * GetTransport();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Connection::SetSharedMemoryTransport
+    //              KDIS::NETWORK::Connection::SetNetworkTransport
+    //              KDIS::NETWORK::Connection::GetSharedMemoryRing
+    // Description: Switches the connection to exchange datagrams through a SharedMemoryRing with the
+    //              other processes on this host that use the same name, bypassing the network stack,
+    //              and back to the network. These are SetTransport with a SharedMemoryTransport and
+    //              SetTransport( NULL ). Datagrams appear to come from 127.0.0.1 and datagrams lost by
+    //              falling behind the ring are reported as dropped.
+    //              GetSharedMemoryRing returns NULL when not using a SharedMemoryTransport.
+    // Parameter:   const KString & Name
+    // Parameter:   KUINT32 Slots - used if this process creates the ring.
+    // Parameter:   KUINT32 Mode - the permissions used if this process creates the ring.
+    //************************************
+    void SetSharedMemoryTransport( const KString & Name, KUINT32 Slots = SharedMemoryRing::DEFAULT_SLOTS,
+                                   KUINT32 Mode = 0600 ) throw ( KException );
+    void SetNetworkTransport() throw ( KException );
+    const SharedMemoryRing * GetSharedMemoryRing() const;
 };
 
 } // END namespace NETWORK
@@ -28,11 +28,41 @@ http://p.sf.net/kdis/UserGuide
 *********************************************************************/
 
 #include "./ConnectionAddressFilter.h"
+#include <cstdlib>
 
 using namespace std;
 using namespace KDIS;
 using namespace NETWORK;
 
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+void ConnectionAddressFilter::parseAddress( const KString & A, KUINT32 & Addr, KUINT8 & PrefixLength ) throw( KException )
+{
+	const KString::size_type Slash = A.find( '/' );
+	const KString sAddr = A.substr( 0, Slash );
+
+	// inet_addr can not tell the broadcast address apart from an error.
+	const unsigned long ulAddr = inet_addr( sAddr.c_str() );
+	if( ulAddr == INADDR_NONE && sAddr != "255.255.255.255" )throw KException( __FUNCTION__, INVALID_DATA );
+	Addr = ntohl( ulAddr );
+
+	PrefixLength = 32;
+	if( Slash != KString::npos )
+	{
+		const KString sPrefix = A.substr( Slash + 1 );
+		if( sPrefix.empty() || sPrefix.size() > 2 || sPrefix.find_first_not_of( "0123456789" ) != KString::npos )
+		{
+			throw KException( __FUNCTION__, INVALID_DATA );
+		}
+
+		const KINT32 iPrefix = atoi( sPrefix.c_str() );
+		if( iPrefix > 32 )throw KException( __FUNCTION__, INVALID_DATA );
+		PrefixLength = iPrefix;
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////
 // public:
 //////////////////////////////////////////////////////////////////////////
@@ -40,6 +70,8 @@ using namespace NETWORK;
 ConnectionAddressFilter::ConnectionAddressFilter( FilterMode FM /* = AllowAddressesInFilterList */ ) :
 	m_FM( FM )
 {
+	PrefixNode Root = { { 0, 0 }, false };
+	m_vTrie.push_back( Root );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -64,43 +96,103 @@ ConnectionAddressFilter::FilterMode ConnectionAddressFilter::GetFilterMode() con
 
 //////////////////////////////////////////////////////////////////////////
 
-void ConnectionAddressFilter::AddAddress( const KString & A )
+void ConnectionAddressFilter::AddAddress( const KString & A ) throw( KException )
 {
-	m_Filter.insert( A );
+	KUINT32 ui32Addr;
+	KUINT8 ui8Prefix;
+	parseAddress( A, ui32Addr, ui8Prefix );
+	AddAddress( ui32Addr, ui8Prefix );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
-void ConnectionAddressFilter::RemoveAddress( const KString & A )
+void ConnectionAddressFilter::AddAddress( KUINT32 Addr, KUINT8 PrefixLength /* = 32 */ )
 {
-	set<KString>::iterator itr = m_Filter.find( A );
-	if( itr != m_Filter.end() )
+	if( PrefixLength > 32 )PrefixLength = 32;
+
+	// Walk the prefix bits from the most significant, adding any missing nodes.
+	KUINT32 ui32Node = 0;
+	for( KUINT8 i = 0; i < PrefixLength; ++i )
 	{
-		// If we found the address then remove it.
-		m_Filter.erase( itr );
+		const KUINT8 ui8Bit = ( Addr >> ( 31 - i ) ) & 1;
+		if( !m_vTrie[ui32Node].m_ui32Child[ui8Bit] )
+		{
+			PrefixNode N = { { 0, 0 }, false };
+			m_vTrie.push_back( N );
+			m_vTrie[ui32Node].m_ui32Child[ui8Bit] = m_vTrie.size() - 1;
+		}
+		ui32Node = m_vTrie[ui32Node].m_ui32Child[ui8Bit];
 	}
+
+	m_vTrie[ui32Node].m_bInFilter = true;
 }
 
 //////////////////////////////////////////////////////////////////////////
 
-KBOOL ConnectionAddressFilter::TestAddress( const KString & A )
+void ConnectionAddressFilter::RemoveAddress( const KString & A ) throw( KException )
 {
-	// Check if the sender is in our filter.
-	set<KString>::iterator itr = m_Filter.find( A );
-	if( itr != m_Filter.end() )
+	KUINT32 ui32Addr;
+	KUINT8 ui8Prefix;
+	parseAddress( A, ui32Addr, ui8Prefix );
+	RemoveAddress( ui32Addr, ui8Prefix );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ConnectionAddressFilter::RemoveAddress( KUINT32 Addr, KUINT8 PrefixLength /* = 32 */ )
+{
+	if( PrefixLength > 32 )PrefixLength = 32;
+
+	KUINT32 ui32Node = 0;
+	for( KUINT8 i = 0; i < PrefixLength; ++i )
 	{
-		return ( m_FM == AllowAddressesInFilterList ) ? true : false;
+		ui32Node = m_vTrie[ui32Node].m_ui32Child[( Addr >> ( 31 - i ) ) & 1];
+		if( !ui32Node )return; // Not in the list.
 	}
 
-	return ( m_FM == AllowAddressesInFilterList ) ? false : true;
+	// The nodes are left in place, they are reused if the address is added again.
+	m_vTrie[ui32Node].m_bInFilter = false;
 }
 
 //////////////////////////////////////////////////////////////////////////
 
-KBOOL ConnectionAddressFilter::OnDataReceived( const KOCTET * Data, KUINT32 DataLength, const KString & SenderIp )
+KBOOL ConnectionAddressFilter::TestAddress( const KString & A ) throw( KException )
+{
+	KUINT32 ui32Addr;
+	KUINT8 ui8Prefix;
+	parseAddress( A, ui32Addr, ui8Prefix );
+	return TestAddress( ui32Addr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL ConnectionAddressFilter::TestAddress( KUINT32 Addr ) const
+{
+	// Check if the sender is in any range of our filter.
+	KBOOL bInFilter = m_vTrie[0].m_bInFilter;
+	KUINT32 ui32Node = 0;
+	for( KUINT8 i = 0; i < 32 && !bInFilter; ++i )
+	{
+		ui32Node = m_vTrie[ui32Node].m_ui32Child[( Addr >> ( 31 - i ) ) & 1];
+		if( !ui32Node )break;
+		bInFilter = m_vTrie[ui32Node].m_bInFilter;
+	}
+
+	return ( m_FM == AllowAddressesInFilterList ) ? bInFilter : !bInFilter;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL ConnectionAddressFilter::OnDataReceived( const KOCTET *, KUINT32, const KString & SenderIp )
 {
 	return TestAddress( SenderIp );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+KBOOL ConnectionAddressFilter::OnDataReceived( const KOCTET *, KUINT32, const sockaddr_in & Sender )
+{
+	return TestAddress( ( KUINT32 )ntohl( Sender.sin_addr.s_addr ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
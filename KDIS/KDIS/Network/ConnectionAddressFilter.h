@@ -33,12 +33,14 @@ http://p.sf.net/kdis/UserGuide
     author:     Karl Jones
 
     purpose:    A simple filter for allowing data through based on its IP address.
+                Addresses and CIDR ranges are held as 32 bit values in a binary prefix
+                trie so each datagram is tested without any string conversion.
 *********************************************************************/
 
 #pragma once
 
 #include "./ConnectionSubscriber.h"
-#include <set>
+#include <vector>
 
 namespace KDIS {
 namespace NETWORK {
@@ -57,7 +59,24 @@ protected:
 
     FilterMode m_FM;
 
-    std::set<KString> m_Filter;
+    // One node per prefix bit, node 0 is the root. A child index of 0 means no child.
+    struct PrefixNode
+    {
+        KUINT32 m_ui32Child[2];
+        KBOOL m_bInFilter;
+    };
+
+    std::vector<PrefixNode> m_vTrie;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ConnectionAddressFilter::parseAddress
+    // Description: Converts "a.b.c.d" or "a.b.c.d/n" into a host order address and prefix length.
+    //              Throws INVALID_DATA if the string is not a valid IPv4 address or range.
+    // Parameter:   const KString & A
+    // Parameter:   KUINT32 & Addr
+    // Parameter:   KUINT8 & PrefixLength
+    //************************************
+    static void parseAddress( const KString & A, KUINT32 & Addr, KUINT8 & PrefixLength ) throw( KException );
 
 public:
 
@@ -79,35 +98,50 @@ public:
     // FullName:    KDIS::NETWORK::ConnectionAddressFilter::AddAddress
     // Description: Add an address to the filter list, this address will either
     //              be blocked or allowed depending on the FilterMode.
+    //              A range can be added in CIDR notation e.g "192.168.0.0/16", the binary
+    //              version takes the address in host byte order.
     // Parameter:   const KString & A
+    // Parameter:   KUINT32 Addr
+    // Parameter:   KUINT8 PrefixLength = 32
     //************************************
-    void AddAddress( const KString & A );
+    void AddAddress( const KString & A ) throw( KException );
+    void AddAddress( KUINT32 Addr, KUINT8 PrefixLength = 32 );
 
     //************************************
     // FullName:    KDIS::NETWORK::ConnectionAddressFilter::RemoveAddress
-    // Description: Remove an address from the filter list.
+    // Description: Remove an address or range from the filter list, it must match the added one.
     //              If the address is not in the list then nothing happens.
     // Parameter:   const KString & A
+    // Parameter:   KUINT32 Addr
+    // Parameter:   KUINT8 PrefixLength = 32
     //************************************
-    void RemoveAddress( const KString & A );
+    void RemoveAddress( const KString & A ) throw( KException );
+    void RemoveAddress( KUINT32 Addr, KUINT8 PrefixLength = 32 );
 
     //************************************
     // FullName:    KDIS::NETWORK::ConnectionAddressFilter::TestAddress
     // Description: Test an address to see if it will be allowed through the filter.
     //              Returns true if address is allowed else false.
+    //              The binary version takes the address in host byte order.
     // Parameter:   const KString & A
+    // Parameter:   KUINT32 Addr
     //************************************
-    KBOOL TestAddress( const KString & A );
+    KBOOL TestAddress( const KString & A ) throw( KException );
+    KBOOL TestAddress( KUINT32 Addr ) const;
 
     //************************************
     // FullName:    KDIS::NETWORK::ConnectionAddressFilter::OnDataReceived
     // Description: This is where the filtering is done, we check if the IP address is in
     //              the block/allow list and return true/false to allow/stop the PDU.
+    //              The version with the arrival time is inherited and calls the sockaddr_in version.
     // Parameter:   const KOCTET * Data
     // Parameter:   KUINT32 DataLength
     // Parameter:   const KString & SenderIp
+    // Parameter:   const sockaddr_in & Sender
     //************************************
+    using ConnectionSubscriber::OnDataReceived;
     virtual KBOOL OnDataReceived( const KOCTET * Data, KUINT32 DataLength, const KString & SenderIp );
+    virtual KBOOL OnDataReceived( const KOCTET * Data, KUINT32 DataLength, const sockaddr_in & Sender );
 };
 
 } // END namespace NETWORK
@@ -45,6 +45,13 @@ http://p.sf.net/kdis/UserGuide
 
 #pragma once
 
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+#include <WinSock2.h>
+#else
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#endif
+
 #include "./../PDU/Header.h"
 
 namespace KDIS {
@@ -78,12 +85,52 @@ public:
         return true;
     };
 
+    //************************************
+    // FullName:    KDIS::NETWORK::ConnectionSubscriber::OnDataReceived
+    // Description: As above but the sender is passed as the binary socket address.
+    //              By default it formats the address and calls the string version, override this
+    //              instead to avoid the conversion on every datagram.
+    // Parameter:   const KOCTET * Data
+    // Parameter:   KUINT32 DataLength
+    // Parameter:   const sockaddr_in & Sender
+    //************************************
+    virtual KBOOL OnDataReceived( const KOCTET * Data, KUINT32 DataLength, const sockaddr_in & Sender )
+    {
+        return OnDataReceived( Data, DataLength, KString( inet_ntoa( Sender.sin_addr ) ) );
+    };
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ConnectionSubscriber::OnDataReceived
+    // Description: As above with the time the datagram arrived, in nanoseconds since the epoch. The time is
+    //              taken by the kernel when Connection::SetLatencyTrackingEnabled is on, else it is 0.
+    //              This is the version the connection calls, by default it calls the version above.
+    // Parameter:   const KOCTET * Data
+    // Parameter:   KUINT32 DataLength
+    // Parameter:   const sockaddr_in & Sender
+    // Parameter:   KUINT64 ArrivalTime
+    //************************************
+    virtual KBOOL OnDataReceived( const KOCTET * Data, KUINT32 DataLength, const sockaddr_in & Sender, KUINT64 /*ArrivalTime*/ )
+    {
+        return OnDataReceived( Data, DataLength, Sender );
+    };
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ConnectionSubscriber::OnDatagramsDropped
+    // Description: Called before OnDataReceived when the kernel reports that datagrams were dropped
+    //              since the previous one, usually because the receive buffer was full.
+    //              Only called when Connection::SetDropDetectionEnabled is on.
+    // Parameter:   KUINT32 Count
+    //************************************
+    virtual void OnDatagramsDropped( KUINT32 /*Count*/ )
+    {
+    };
+
     //************************************
     // FullName:    KDIS::NETWORK::ConnectionSubscriber::OnPDUReceived
     // Description: Called after a PDU has been decoded (GetNextPDU). Use this function to handle various PDU,
     //              e.g a data logger or entity manager class.
     //              Note: This function is not for filtering, for PDU based filtering see the PDU_Factory.
-    //              Note: By default this PDU will be deleted unless it is released(auto_ptr) by the function that calls GetNextPDU.
+    //              Note: By default this PDU will be deleted unless it is released(PduUniquePtr) by the function that calls GetNextPDU.
     // Parameter:   const KOCTET * Data
     //************************************
     virtual void OnPDUReceived( const KDIS::PDU::Header * H )
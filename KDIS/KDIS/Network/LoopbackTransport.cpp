@@ -0,0 +1,212 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./LoopbackTransport.h"
+#include <string.h>
+
+#if !defined( WIN32 ) & !defined( _WIN32 ) & !defined( WIN64 ) & !defined( _WIN64 )
+#include <arpa/inet.h>
+#endif
+
+using namespace std;
+using namespace KDIS;
+using namespace NETWORK;
+
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+KOCTET * LoopbackTransport::claim( KUINT32 Size ) throw( KException )
+{
+    if( Size > m_ui32SlotSize )throw KException( __FUNCTION__, PDU_TOO_LARGE );
+
+    if( m_ui32Count == m_vui32Sizes.size() )
+    {
+        ++m_ui32Dropped;
+        return 0;
+    }
+
+    const KUINT32 ui32Slot = ( m_ui32Head + m_ui32Count ) % m_vui32Sizes.size();
+    m_vui32Sizes[ui32Slot] = Size;
+    ++m_ui32Count;
+    return &m_vBuffer[ui32Slot * m_ui32SlotSize];
+}
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+LoopbackTransport::LoopbackTransport( KUINT32 Capacity /* = DEFAULT_CAPACITY */, KUINT32 SlotSize /* = MAX_PDU_SIZE */ ) throw( KException ) :
+    m_ui32SlotSize( SlotSize ),
+    m_ui32Head( 0 ),
+    m_ui32Count( 0 ),
+    m_ui32Dropped( 0 ),
+    m_bReplay( false )
+{
+    if( !Capacity || !SlotSize )throw KException( __FUNCTION__, INVALID_DATA, "The capacity and slot size must not be 0" );
+
+    m_vBuffer.resize( ( size_t )Capacity * SlotSize );
+    m_vui32Sizes.resize( Capacity );
+
+    memset( &m_Sender, 0, sizeof( m_Sender ) );
+    m_Sender.sin_family = AF_INET;
+    m_Sender.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+LoopbackTransport::~LoopbackTransport()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void LoopbackTransport::SetSenderAddress( const KString & A )
+{
+    m_Sender.sin_addr.s_addr = inet_addr( A.c_str() );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KString LoopbackTransport::GetSenderAddress() const
+{
+    return inet_ntoa( m_Sender.sin_addr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void LoopbackTransport::SetReplayEnabled( KBOOL E )
+{
+    m_bReplay = E;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL LoopbackTransport::IsReplayEnabled() const
+{
+    return m_bReplay;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 LoopbackTransport::GetCapacity() const
+{
+    return m_vui32Sizes.size();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 LoopbackTransport::GetQueuedCount() const
+{
+    return m_ui32Count;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void LoopbackTransport::Clear()
+{
+    m_ui32Head = 0;
+    m_ui32Count = 0;
+    m_ui32Dropped = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 LoopbackTransport::Send( const KOCTET * Data, KUINT32 DataSz ) throw( KException )
+{
+    KOCTET * pSlot = claim( DataSz );
+    if( pSlot )memcpy( pSlot, Data, DataSz );
+
+    // As with UDP a datagram lost by the receiver still counts as sent.
+    return DataSz;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 LoopbackTransport::SendGather( const KIOVEC * Parts, KUINT32 Count ) throw( KException )
+{
+    KUINT32 ui32Size = 0;
+    for( KUINT32 i = 0; i < Count; ++i )
+    {
+        ui32Size += GetIOVecSize( Parts[i] );
+    }
+
+    // Gather straight into the slot.
+    KOCTET * pSlot = claim( ui32Size );
+    if( pSlot )
+    {
+        for( KUINT32 i = 0; i < Count; ++i )
+        {
+            memcpy( pSlot, GetIOVecData( Parts[i] ), GetIOVecSize( Parts[i] ) );
+            pSlot += GetIOVecSize( Parts[i] );
+        }
+    }
+
+    return ui32Size;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 LoopbackTransport::Receive( KOCTET * Buffer, KUINT32 BufferSz, sockaddr_in & Sender, KINT32 /*TimeoutUS*/,
+                                   KUINT64 * ArrivalTime /* = 0 */, KUINT32 * Dropped /* = 0 */ ) throw( KException )
+{
+    // Nothing can arrive while we wait so the timeout is ignored.
+    if( ArrivalTime )*ArrivalTime = 0;
+    if( Dropped )
+    {
+        *Dropped = m_ui32Dropped;
+        m_ui32Dropped = 0;
+    }
+
+    if( !m_ui32Count )return 0;
+
+    const KUINT32 ui32Slot = m_ui32Head;
+    const KUINT32 ui32Size = m_vui32Sizes[ui32Slot] < BufferSz ? m_vui32Sizes[ui32Slot] : BufferSz;
+    memcpy( Buffer, &m_vBuffer[ui32Slot * m_ui32SlotSize], ui32Size );
+    Sender = m_Sender;
+
+    m_ui32Head = ( m_ui32Head + 1 ) % m_vui32Sizes.size();
+    --m_ui32Count;
+
+    // The datagram is still in the slot, put it back at the end of the queue.
+    if( m_bReplay )
+    {
+        const KUINT32 ui32Tail = ( m_ui32Head + m_ui32Count ) % m_vui32Sizes.size();
+        if( ui32Tail != ui32Slot )
+        {
+            memcpy( &m_vBuffer[ui32Tail * m_ui32SlotSize], &m_vBuffer[ui32Slot * m_ui32SlotSize], m_vui32Sizes[ui32Slot] );
+            m_vui32Sizes[ui32Tail] = m_vui32Sizes[ui32Slot];
+        }
+        ++m_ui32Count;
+    }
+
+    return ui32Size;
+}
+
+//////////////////////////////////////////////////////////////////////////
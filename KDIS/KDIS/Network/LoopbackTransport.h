@@ -0,0 +1,134 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      LoopbackTransport
+    created:    19/10/2026
+
+    purpose:    An in-process transport, datagrams sent are received by the same transport
+                in the order they were sent. There are no sockets, threads or clocks involved
+                and all memory is allocated by the constructor so a Connection using it decodes
+                and dispatches exactly the same sequence of PDU on every run. This makes it
+                suitable for testing subscribers and handlers and for measuring decode and
+                dispatch throughput without a network.
+
+                When the queue is full new datagrams are dropped and reported by the next
+                Receive, as a socket would. In replay mode received datagrams are queued again
+                so a fixed set of datagrams can be received endlessly.
+                Note: Not thread safe, send and receive from the same thread.
+*********************************************************************/
+
+#pragma once
+
+#include "./Transport.h"
+#include <vector>
+
+namespace KDIS {
+namespace NETWORK {
+
+class KDIS_EXPORT LoopbackTransport : public Transport
+{
+public:
+
+    static const KUINT32 DEFAULT_CAPACITY = 1024;
+
+protected:
+
+    // Slot i is m_vBuffer[i * m_ui32SlotSize].
+    std::vector<KOCTET> m_vBuffer;
+    std::vector<KUINT32> m_vui32Sizes;
+    KUINT32 m_ui32SlotSize;
+
+    KUINT32 m_ui32Head;
+    KUINT32 m_ui32Count;
+
+    KUINT32 m_ui32Dropped;
+    KBOOL m_bReplay;
+
+    sockaddr_in m_Sender;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::LoopbackTransport::claim
+    // Description: Returns the next free slot or NULL and counts a drop if the queue is full.
+    //              Throws PDU_TOO_LARGE if Size will not fit in a slot.
+    // Parameter:   KUINT32 Size
+    //************************************
+    KOCTET * claim( KUINT32 Size ) throw( KException );
+
+public:
+
+    //************************************
+    // FullName:    KDIS::NETWORK::LoopbackTransport::LoopbackTransport
+    // Description: Allocates room for Capacity datagrams of up to SlotSize octets.
+    // Parameter:   KUINT32 Capacity
+    // Parameter:   KUINT32 SlotSize
+    //************************************
+    LoopbackTransport( KUINT32 Capacity = DEFAULT_CAPACITY, KUINT32 SlotSize = MAX_PDU_SIZE ) throw( KException );
+
+    virtual ~LoopbackTransport();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::LoopbackTransport::SetSenderAddress
+    //              KDIS::NETWORK::LoopbackTransport::GetSenderAddress
+    // Description: The address received datagrams appear to come from, 127.0.0.1 by default.
+    // Parameter:   const KString & A
+    //************************************
+    void SetSenderAddress( const KString & A );
+    KString GetSenderAddress() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::LoopbackTransport::SetReplayEnabled
+    //              KDIS::NETWORK::LoopbackTransport::IsReplayEnabled
+    // Description: When enabled each received datagram is queued again behind the others,
+    //              so the queued datagrams are received over and over in the same order.
+    // Parameter:   KBOOL E
+    //************************************
+    void SetReplayEnabled( KBOOL E );
+    KBOOL IsReplayEnabled() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::LoopbackTransport::GetCapacity
+    //              KDIS::NETWORK::LoopbackTransport::GetQueuedCount
+    //              KDIS::NETWORK::LoopbackTransport::Clear
+    // Description: The number of datagrams that can be queued and are queued, Clear empties
+    //              the queue and forgets any drops not yet reported.
+    //************************************
+    KUINT32 GetCapacity() const;
+    KUINT32 GetQueuedCount() const;
+    void Clear();
+
+    // Transport interface.
+    virtual KINT32 Send( const KOCTET * Data, KUINT32 DataSz ) throw( KException );
+    virtual KINT32 SendGather( const KIOVEC * Parts, KUINT32 Count ) throw( KException );
+    virtual KINT32 Receive( KOCTET * Buffer, KUINT32 BufferSz, sockaddr_in & Sender, KINT32 TimeoutUS,
+                            KUINT64 * ArrivalTime = 0, KUINT32 * Dropped = 0 ) throw( KException );
+};
+
+} // END namespace NETWORK
+} // END namespace KDIS
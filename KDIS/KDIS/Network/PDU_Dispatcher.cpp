@@ -0,0 +1,164 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./PDU_Dispatcher.h"
+
+using namespace std;
+using namespace KDIS;
+using namespace PDU;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+using namespace UTILS;
+using namespace NETWORK;
+
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+PDU_Handler * PDU_Dispatcher::addHandler( vector<PDU_Handler*> & V, PDU_Handler * H )
+{
+    V.push_back( H );
+    return H;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+PDU_Dispatcher::PDU_Dispatcher()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+PDU_Dispatcher::~PDU_Dispatcher()
+{
+    RemoveAllHandlers();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+PDU_Handler * PDU_Dispatcher::AddHandler( ProtocolFamily PF, void ( *F )( const Header & ) )
+{
+    return addHandler( m_vpFamilyHandlers[( KUINT8 )PF], new PDU_FunctionHandler<Header>( F ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Dispatcher::RemoveHandler( PDU_Handler * H )
+{
+    if( !H )return;
+
+    for( KUINT16 i = 0; i < 256; ++i )
+    {
+        vector<PDU_Handler*> * pTables[2] = { &m_vpTypeHandlers[i], &m_vpFamilyHandlers[i] };
+        for( KUINT8 j = 0; j < 2; ++j )
+        {
+            vector<PDU_Handler*>::iterator itr = pTables[j]->begin();
+            vector<PDU_Handler*>::iterator itrEnd = pTables[j]->end();
+            for( ; itr != itrEnd; ++itr )
+            {
+                if( *itr == H )
+                {
+                    pTables[j]->erase( itr );
+                    delete H;
+                    return;
+                }
+            }
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Dispatcher::RemoveAllHandlers()
+{
+    for( KUINT16 i = 0; i < 256; ++i )
+    {
+        vector<PDU_Handler*>::iterator itr = m_vpTypeHandlers[i].begin();
+        vector<PDU_Handler*>::iterator itrEnd = m_vpTypeHandlers[i].end();
+        for( ; itr != itrEnd; ++itr )
+        {
+            delete *itr;
+        }
+        m_vpTypeHandlers[i].clear();
+
+        itr = m_vpFamilyHandlers[i].begin();
+        itrEnd = m_vpFamilyHandlers[i].end();
+        for( ; itr != itrEnd; ++itr )
+        {
+            delete *itr;
+        }
+        m_vpFamilyHandlers[i].clear();
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL PDU_Dispatcher::HasHandlers( const Header & H ) const
+{
+    return !m_vpTypeHandlers[( KUINT8 )H.GetPDUType()].empty() ||
+           !m_vpFamilyHandlers[( KUINT8 )H.GetProtocolFamily()].empty();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Dispatcher::Dispatch( const Header & H ) const
+{
+    const vector<PDU_Handler*> & vType = m_vpTypeHandlers[( KUINT8 )H.GetPDUType()];
+    vector<PDU_Handler*>::const_iterator citr = vType.begin();
+    vector<PDU_Handler*>::const_iterator citrEnd = vType.end();
+    for( ; citr != citrEnd; ++citr )
+    {
+        ( *citr )->OnPDU( H );
+    }
+
+    const vector<PDU_Handler*> & vFamily = m_vpFamilyHandlers[( KUINT8 )H.GetProtocolFamily()];
+    citr = vFamily.begin();
+    citrEnd = vFamily.end();
+    for( ; citr != citrEnd; ++citr )
+    {
+        ( *citr )->OnPDU( H );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Dispatcher::ApplyDecodeMask( PDU_Factory & F ) const
+{
+    F.SetDecodeEnabled( false );
+
+    for( KUINT16 i = 0; i < 256; ++i )
+    {
+        if( !m_vpTypeHandlers[i].empty() )   F.SetDecodeEnabled( ( PDUType )i, true );
+        if( !m_vpFamilyHandlers[i].empty() ) F.SetDecodeEnabled( ( ProtocolFamily )i, true );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,212 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      PDU_Dispatcher
+    created:    18/10/2026
+
+    purpose:    Routes decoded PDU to handlers registered for their PDU type or
+                protocol family. Handlers are kept in a table indexed by type and
+                family so only the handlers that asked for a PDU are called, and
+                typed handlers receive the concrete PDU class.
+
+                The dispatcher can also configure a PDU_Factory so that PDU types
+                without a handler are not decoded at all.
+*********************************************************************/
+
+#pragma once
+
+#include "./../Extras/PDU_Factory.h"
+#include <vector>
+
+namespace KDIS {
+namespace NETWORK {
+
+//////////////////////////////////////////////////////////////////////////
+// The base handler class, one is created for each registered callback. //
+//////////////////////////////////////////////////////////////////////////
+class KDIS_EXPORT PDU_Handler
+{
+public:
+
+    PDU_Handler() {};
+
+    virtual ~PDU_Handler() {};
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Handler::OnPDU
+    // Description: Called for each PDU the handler was registered for.
+    // Parameter:   const Header & H
+    //************************************
+    virtual void OnPDU( const KDIS::PDU::Header & H ) = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Calls a free function with the concrete PDU class.                   //
+//////////////////////////////////////////////////////////////////////////
+template<class PduType>
+class PDU_FunctionHandler : public PDU_Handler
+{
+protected:
+
+    void ( *m_pFunc )( const PduType & );
+
+public:
+
+    PDU_FunctionHandler( void ( *F )( const PduType & ) ) : m_pFunc( F ) {};
+
+    virtual void OnPDU( const KDIS::PDU::Header & H )
+    {
+        m_pFunc( static_cast<const PduType &>( H ) );
+    };
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Calls a member function with the concrete PDU class.                 //
+//////////////////////////////////////////////////////////////////////////
+template<class Obj, class PduType>
+class PDU_MemberHandler : public PDU_Handler
+{
+protected:
+
+    Obj * m_pObj;
+
+    void ( Obj::*m_pFunc )( const PduType & );
+
+public:
+
+    PDU_MemberHandler( Obj * O, void ( Obj::*F )( const PduType & ) ) : m_pObj( O ), m_pFunc( F ) {};
+
+    virtual void OnPDU( const KDIS::PDU::Header & H )
+    {
+        ( m_pObj->*m_pFunc )( static_cast<const PduType &>( H ) );
+    };
+};
+
+class KDIS_EXPORT PDU_Dispatcher
+{
+protected:
+
+    // Handlers indexed by PDU type and protocol family.
+    std::vector<PDU_Handler*> m_vpTypeHandlers[256];
+    std::vector<PDU_Handler*> m_vpFamilyHandlers[256];
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Dispatcher::addHandler
+    // Description: Stores the handler in the table and returns it.
+    // Parameter:   std::vector<PDU_Handler*> & V
+    // Parameter:   PDU_Handler * H
+    //************************************
+    PDU_Handler * addHandler( std::vector<PDU_Handler*> & V, PDU_Handler * H );
+
+private:
+
+    // Handlers are owned by the dispatcher.
+    PDU_Dispatcher( const PDU_Dispatcher & );
+    PDU_Dispatcher & operator = ( const PDU_Dispatcher & );
+
+public:
+
+    PDU_Dispatcher();
+
+    virtual ~PDU_Dispatcher();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Dispatcher::AddHandler
+    // Description: Registers a callback for a PDU type, the callback receives the concrete PDU class.
+    //              PduType must be the class the PDU_Factory decodes the type into, e.g
+    //              AddHandler( Entity_State_PDU_Type, &OnEntityState ) where OnEntityState takes
+    //              a const Entity_State_PDU &.
+    //              Returns the handler which can be passed to RemoveHandler, it is owned by the dispatcher.
+    // Parameter:   PDUType T
+    // Parameter:   Obj * O
+    // Parameter:   void ( *F )( const PduType & ), void ( Obj::*F )( const PduType & )
+    //************************************
+    template<class PduType>
+    PDU_Handler * AddHandler( KDIS::DATA_TYPE::ENUMS::PDUType T, void ( *F )( const PduType & ) )
+    {
+        return addHandler( m_vpTypeHandlers[( KUINT8 )T], new PDU_FunctionHandler<PduType>( F ) );
+    };
+
+    template<class Obj, class PduType>
+    PDU_Handler * AddHandler( KDIS::DATA_TYPE::ENUMS::PDUType T, Obj * O, void ( Obj::*F )( const PduType & ) )
+    {
+        return addHandler( m_vpTypeHandlers[( KUINT8 )T], new PDU_MemberHandler<Obj, PduType>( O, F ) );
+    };
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Dispatcher::AddHandler
+    // Description: Registers a callback for every PDU of a protocol family.
+    //              Returns the handler which can be passed to RemoveHandler, it is owned by the dispatcher.
+    // Parameter:   ProtocolFamily PF
+    // Parameter:   Obj * O
+    // Parameter:   void ( *F )( const Header & ), void ( Obj::*F )( const Header & )
+    //************************************
+    PDU_Handler * AddHandler( KDIS::DATA_TYPE::ENUMS::ProtocolFamily PF, void ( *F )( const KDIS::PDU::Header & ) );
+
+    template<class Obj>
+    PDU_Handler * AddHandler( KDIS::DATA_TYPE::ENUMS::ProtocolFamily PF, Obj * O, void ( Obj::*F )( const KDIS::PDU::Header & ) )
+    {
+        return addHandler( m_vpFamilyHandlers[( KUINT8 )PF], new PDU_MemberHandler<Obj, KDIS::PDU::Header>( O, F ) );
+    };
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Dispatcher::RemoveHandler
+    //              KDIS::NETWORK::PDU_Dispatcher::RemoveAllHandlers
+    // Description: Unregisters and deletes a handler returned by AddHandler, or all of them.
+    // Parameter:   PDU_Handler * H
+    //************************************
+    void RemoveHandler( PDU_Handler * H );
+    void RemoveAllHandlers();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Dispatcher::HasHandlers
+    // Description: Returns true if any handler is registered for the PDU's type or family.
+    // Parameter:   const Header & H
+    //************************************
+    KBOOL HasHandlers( const KDIS::PDU::Header & H ) const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Dispatcher::Dispatch
+    // Description: Calls the handlers registered for the PDU's type followed by those for its family.
+    // Parameter:   const Header & H
+    //************************************
+    void Dispatch( const KDIS::PDU::Header & H ) const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Dispatcher::ApplyDecodeMask
+    // Description: Configures the factory to only decode the PDU types and families that have a handler,
+    //              any other PDU is skipped without being decoded.
+    // Parameter:   PDU_Factory & F
+    //************************************
+    void ApplyDecodeMask( KDIS::UTILS::PDU_Factory & F ) const;
+};
+
+} // END namespace NETWORK
+} // END namespace KDIS
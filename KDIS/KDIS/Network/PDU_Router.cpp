@@ -0,0 +1,251 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./PDU_Router.h"
+#include <algorithm>
+#include <string.h>
+
+using namespace std;
+using namespace KDIS;
+using namespace NETWORK;
+
+// The offset of the PDU length in the header, see Header6.
+static const KUINT32 PDU_LENGTH_OFFSET = 8;
+static const KUINT32 PDU_HEADER_SIZE = 12;
+
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Router::closeDatagram() throw( KException )
+{
+    if( !m_ui32Used )return;
+
+    SetIOVec( m_vIOV[m_ui32Datagrams], &m_vBuffer[m_ui32Datagrams * MAX_PDU_SIZE], m_ui32Used );
+    ++m_ui32Datagrams;
+    m_ui32Used = 0;
+
+    if( m_ui32Datagrams == m_vIOV.size() )sendBatch();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Router::sendBatch() throw( KException )
+{
+    const KUINT32 ui32Count = m_ui32Datagrams;
+
+    // The batch is emptied first so a failed send does not send it again.
+    m_ui32Datagrams = 0;
+
+    if( m_pOutput && ui32Count )m_pOutput->SendBatch( &m_vIOV[0], ui32Count );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+PDU_Router::PDU_Router( Transport * Output, KUINT32 BundleSize /* = DEFAULT_BUNDLE_SIZE */,
+                        KUINT32 BatchSize /* = DEFAULT_BATCH_SIZE */ ) throw( KException ) :
+    m_pOutput( Output ),
+    m_ui32BundleSize( BundleSize ),
+    m_ui32Datagrams( 0 ),
+    m_ui32Used( 0 ),
+    m_ui64Forwarded( 0 ),
+    m_ui64Dropped( 0 ),
+    m_ui64Malformed( 0 )
+{
+    if( BundleSize < PDU_HEADER_SIZE || BundleSize > MAX_PDU_SIZE )throw KException( __FUNCTION__, INVALID_DATA, "The bundle size must be between 12 and MAX_PDU_SIZE" );
+    if( !BatchSize )throw KException( __FUNCTION__, INVALID_DATA, "The batch size must not be 0" );
+
+    m_vBuffer.resize( ( size_t )BatchSize * MAX_PDU_SIZE );
+    m_vIOV.resize( BatchSize );
+    m_vReceive.resize( MAX_PDU_SIZE );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+PDU_Router::~PDU_Router()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Router::SetOutput( Transport * Output ) throw( KException )
+{
+    if( Output == m_pOutput )return;
+
+    Flush();
+    m_pOutput = Output;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Transport * PDU_Router::GetOutput() const
+{
+    return m_pOutput;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Router::AddRule( PDU_Router_Rule * R )
+{
+    m_vpRules.push_back( R );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Router::RemoveRule( PDU_Router_Rule * R )
+{
+    m_vpRules.erase( remove( m_vpRules.begin(), m_vpRules.end(), R ), m_vpRules.end() );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 PDU_Router::Route( const KOCTET * Data, KUINT32 DataSz ) throw( KException )
+{
+    const KUINT32 ui32Rules = m_vpRules.size();
+    for( KUINT32 i = 0; i < ui32Rules; ++i )
+    {
+        m_vpRules[i]->BeginDatagram();
+    }
+
+    KUINT32 ui32Accepted = 0;
+    KUINT32 ui32Pos = 0;
+    while( ui32Pos < DataSz )
+    {
+        const KOCTET * pPDU = Data + ui32Pos;
+        const KUINT32 ui32Remaining = DataSz - ui32Pos;
+
+        // Check the PDU is whole before touching it.
+        KUINT32 ui32Length = 0;
+        if( ui32Remaining >= PDU_HEADER_SIZE )
+        {
+            ui32Length = ( ( KUINT32 )( KUINT8 )pPDU[PDU_LENGTH_OFFSET] << 8 ) | ( KUINT8 )pPDU[PDU_LENGTH_OFFSET + 1];
+        }
+        if( ui32Length < PDU_HEADER_SIZE || ui32Length > ui32Remaining || ui32Length > MAX_PDU_SIZE )
+        {
+            ++m_ui64Malformed;
+            break;
+        }
+        ui32Pos += ui32Length;
+
+        // Start a new datagram if the PDU does not fit in the one being built.
+        if( m_ui32Used && m_ui32Used + ui32Length > m_ui32BundleSize )closeDatagram();
+
+        KOCTET * pOut = &m_vBuffer[m_ui32Datagrams * MAX_PDU_SIZE + m_ui32Used];
+        memcpy( pOut, pPDU, ui32Length );
+
+        KBOOL bAccept = true;
+        for( KUINT32 i = 0; i < ui32Rules && bAccept; ++i )
+        {
+            bAccept = m_vpRules[i]->Apply( pOut, ui32Length );
+        }
+
+        if( !bAccept )
+        {
+            // Leave the copy to be overwritten by the next PDU.
+            ++m_ui64Dropped;
+            continue;
+        }
+
+        m_ui32Used += ui32Length;
+        ++m_ui64Forwarded;
+        ++ui32Accepted;
+    }
+
+    return ui32Accepted;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 PDU_Router::Pump( Transport & Input, KINT32 TimeoutUS ) throw( KException )
+{
+    KUINT32 ui32Accepted = 0;
+    sockaddr_in Sender;
+
+    KINT32 iSz = Input.Receive( &m_vReceive[0], m_vReceive.size(), Sender, TimeoutUS );
+    for( KUINT32 i = 0; iSz > 0; ++i )
+    {
+        ui32Accepted += Route( &m_vReceive[0], iSz );
+
+        // Stop after a batch so a busy input can not hold back the flush.
+        if( i + 1 == m_vIOV.size() )break;
+        iSz = Input.Receive( &m_vReceive[0], m_vReceive.size(), Sender, 0 );
+    }
+
+    Flush();
+    return ui32Accepted;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Router::Flush() throw( KException )
+{
+    closeDatagram();
+    sendBatch();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 PDU_Router::GetPendingCount() const
+{
+    return m_ui32Datagrams + ( m_ui32Used ? 1 : 0 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 PDU_Router::GetForwardedCount() const
+{
+    return m_ui64Forwarded;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 PDU_Router::GetDroppedCount() const
+{
+    return m_ui64Dropped;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 PDU_Router::GetMalformedCount() const
+{
+    return m_ui64Malformed;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_Router::ResetCounters()
+{
+    m_ui64Forwarded = 0;
+    m_ui64Dropped = 0;
+    m_ui64Malformed = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
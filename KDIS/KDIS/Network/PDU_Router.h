@@ -0,0 +1,183 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      PDU_Router
+    created:    19/10/2026
+
+    purpose:    Forwards PDU from one network to another without decoding them.
+                Each received datagram is split into its PDU using the length field of
+                each header, every PDU is copied once into the datagram being built for the
+                output and the rules are applied to the copy in place. PDU that pass are
+                bundled into output datagrams of up to the bundle size and the datagrams are
+                sent in batches, so the cost of routing is a copy and a few field accesses per
+                PDU rather than a decode and an encode.
+
+                A datagram whose PDU lengths do not add up is forwarded up to the first bad
+                PDU and counted as malformed.
+                Note: The router is not thread safe, route from a single thread.
+*********************************************************************/
+
+#pragma once
+
+#include "./Transport.h"
+#include "./PDU_Router_Rules.h"
+#include <vector>
+
+namespace KDIS {
+namespace NETWORK {
+
+class KDIS_EXPORT PDU_Router
+{
+public:
+
+    static const KUINT32 DEFAULT_BUNDLE_SIZE = 1472;
+    static const KUINT32 DEFAULT_BATCH_SIZE = 32;
+
+protected:
+
+    Transport * m_pOutput;
+
+    std::vector<PDU_Router_Rule*> m_vpRules;
+
+    // Datagram i of the batch is m_vBuffer[i * MAX_PDU_SIZE], the last is the one being built.
+    std::vector<KOCTET> m_vBuffer;
+    std::vector<KIOVEC> m_vIOV;
+    KUINT32 m_ui32BundleSize;
+    KUINT32 m_ui32Datagrams;
+    KUINT32 m_ui32Used;
+
+    // Receive buffer used by Pump.
+    std::vector<KOCTET> m_vReceive;
+
+    KUINT64 m_ui64Forwarded;
+    KUINT64 m_ui64Dropped;
+    KUINT64 m_ui64Malformed;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Router::closeDatagram
+    // Description: Adds the datagram being built to the batch, sends the batch if it is full.
+    //************************************
+    void closeDatagram() throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Router::sendBatch
+    // Description: Sends the complete datagrams of the batch.
+    //************************************
+    void sendBatch() throw( KException );
+
+public:
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Router::PDU_Router
+    // Description: Output is not deleted by the router and may be NULL, in which case
+    //              PDU are routed and counted but not sent.
+    //              BundleSize is the largest output datagram, a PDU larger than it is sent
+    //              on its own. Up to BatchSize datagrams are sent with each SendBatch.
+    // Parameter:   Transport * Output
+    // Parameter:   KUINT32 BundleSize
+    // Parameter:   KUINT32 BatchSize
+    //************************************
+    PDU_Router( Transport * Output, KUINT32 BundleSize = DEFAULT_BUNDLE_SIZE,
+                KUINT32 BatchSize = DEFAULT_BATCH_SIZE ) throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Router::~PDU_Router
+    // Description: Unsent datagrams are discarded, call Flush first to send them.
+    //************************************
+    virtual ~PDU_Router();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Router::SetOutput
+    //              KDIS::NETWORK::PDU_Router::GetOutput
+    // Description: The transport routed datagrams are sent with. Changing the output
+    //              flushes the datagrams routed so far to the old output.
+    // Parameter:   Transport * Output
+    //************************************
+    void SetOutput( Transport * Output ) throw( KException );
+    Transport * GetOutput() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Router::AddRule
+    //              KDIS::NETWORK::PDU_Router::RemoveRule
+    // Description: Add/Remove a rule. Rules are applied in the order they were added and
+    //              are not deleted by the router.
+    // Parameter:   PDU_Router_Rule * R
+    //************************************
+    void AddRule( PDU_Router_Rule * R );
+    void RemoveRule( PDU_Router_Rule * R );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Router::Route
+    // Description: Routes the PDU in a datagram. The routed PDU are held until a batch is
+    //              full or Flush is called. Returns the number of PDU accepted by the rules.
+    // Parameter:   const KOCTET * Data
+    // Parameter:   KUINT32 DataSz
+    //************************************
+    KUINT32 Route( const KOCTET * Data, KUINT32 DataSz ) throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Router::Pump
+    // Description: Waits up to TimeoutUS for a datagram from Input, routes it and up to a batch
+    //              of the datagrams waiting behind it then flushes. Call in a loop to bridge
+    //              two networks.
+    //              Returns the number of PDU accepted by the rules.
+    // Parameter:   Transport & Input
+    // Parameter:   KINT32 TimeoutUS
+    //************************************
+    KUINT32 Pump( Transport & Input, KINT32 TimeoutUS ) throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Router::Flush
+    // Description: Sends all routed datagrams.
+    //************************************
+    void Flush() throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Router::GetPendingCount
+    // Description: The number of routed datagrams not yet sent, including a partly built one.
+    //************************************
+    KUINT32 GetPendingCount() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Router::GetForwardedCount
+    //              KDIS::NETWORK::PDU_Router::GetDroppedCount
+    //              KDIS::NETWORK::PDU_Router::GetMalformedCount
+    //              KDIS::NETWORK::PDU_Router::ResetCounters
+    // Description: The number of PDU accepted and dropped by the rules and the number of
+    //              datagrams whose PDU lengths were invalid.
+    //************************************
+    KUINT64 GetForwardedCount() const;
+    KUINT64 GetDroppedCount() const;
+    KUINT64 GetMalformedCount() const;
+    void ResetCounters();
+};
+
+} // END namespace NETWORK
+} // END namespace KDIS
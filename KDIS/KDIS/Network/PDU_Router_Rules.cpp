@@ -0,0 +1,380 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./PDU_Router_Rules.h"
+#include "./../DataTypes/TimeStamp.h"
+#include <algorithm>
+#include <string.h>
+
+using namespace std;
+using namespace KDIS;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+using namespace NETWORK;
+
+// The offsets of the fixed header fields, see Header6.
+static const KUINT16 EXERCISE_ID_OFFSET = 1;
+static const KUINT16 PDU_TYPE_OFFSET = 2;
+static const KUINT16 PROTOCOL_FAMILY_OFFSET = 3;
+static const KUINT16 TIME_STAMP_OFFSET = 4;
+static const KUINT16 ORIGIN_ID_OFFSET = 12;
+
+//////////////////////////////////////////////////////////////////////////
+
+static inline KBOOL isLiveEntity( const KOCTET * Data )
+{
+    return ( KUINT8 )Data[PROTOCOL_FAMILY_OFFSET] == LiveEntity;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+static inline KUINT16 readUINT16( const KOCTET * Data )
+{
+    return ( ( KUINT16 )( KUINT8 )Data[0] << 8 ) | ( KUINT8 )Data[1];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+static inline void writeUINT16( KOCTET * Data, KUINT16 Value )
+{
+    Data[0] = ( KOCTET )( Value >> 8 );
+    Data[1] = ( KOCTET )Value;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// RouterFilterPDUType
+//////////////////////////////////////////////////////////////////////////
+
+RouterFilterPDUType::RouterFilterPDUType( KBOOL Allow /* = true */ ) :
+    m_bAllow( Allow )
+{
+    fill( m_bTypes, m_bTypes + 256, false );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+RouterFilterPDUType::~RouterFilterPDUType()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void RouterFilterPDUType::AddType( KUINT8 T )
+{
+    m_bTypes[T] = true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void RouterFilterPDUType::RemoveType( KUINT8 T )
+{
+    m_bTypes[T] = false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL RouterFilterPDUType::Apply( KOCTET * Data, KUINT16 Length )
+{
+    if( Length < PDU_TYPE_OFFSET + 1 )return true;
+    return m_bTypes[( KUINT8 )Data[PDU_TYPE_OFFSET]] == m_bAllow;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// RouterFilterExerciseID
+//////////////////////////////////////////////////////////////////////////
+
+RouterFilterExerciseID::RouterFilterExerciseID( KUINT8 ID ) :
+    m_ui8ID( ID )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+RouterFilterExerciseID::~RouterFilterExerciseID()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL RouterFilterExerciseID::Apply( KOCTET * Data, KUINT16 Length )
+{
+    if( Length < EXERCISE_ID_OFFSET + 1 )return true;
+    return ( KUINT8 )Data[EXERCISE_ID_OFFSET] == m_ui8ID;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// RouterFilterSite
+//////////////////////////////////////////////////////////////////////////
+
+RouterFilterSite::RouterFilterSite( KBOOL Allow /* = true */ ) :
+    m_bAllow( Allow )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+RouterFilterSite::~RouterFilterSite()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void RouterFilterSite::AddSite( KUINT16 S )
+{
+    vector<KUINT16>::iterator itr = lower_bound( m_vSites.begin(), m_vSites.end(), S );
+    if( itr == m_vSites.end() || *itr != S )m_vSites.insert( itr, S );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void RouterFilterSite::RemoveSite( KUINT16 S )
+{
+    vector<KUINT16>::iterator itr = lower_bound( m_vSites.begin(), m_vSites.end(), S );
+    if( itr != m_vSites.end() && *itr == S )m_vSites.erase( itr );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL RouterFilterSite::Apply( KOCTET * Data, KUINT16 Length )
+{
+    KUINT16 ui16Site = 0;
+    if( isLiveEntity( Data ) )
+    {
+        if( Length < ORIGIN_ID_OFFSET + 1 )return true;
+        ui16Site = ( KUINT8 )Data[ORIGIN_ID_OFFSET];
+    }
+    else
+    {
+        if( Length < ORIGIN_ID_OFFSET + 2 )return true;
+        ui16Site = readUINT16( Data + ORIGIN_ID_OFFSET );
+    }
+
+    return binary_search( m_vSites.begin(), m_vSites.end(), ui16Site ) == m_bAllow;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// RouterRewriteExerciseID
+//////////////////////////////////////////////////////////////////////////
+
+RouterRewriteExerciseID::RouterRewriteExerciseID( KUINT8 ID ) :
+    m_ui8ID( ID )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+RouterRewriteExerciseID::~RouterRewriteExerciseID()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL RouterRewriteExerciseID::Apply( KOCTET * Data, KUINT16 Length )
+{
+    if( Length < EXERCISE_ID_OFFSET + 1 )return true;
+    Data[EXERCISE_ID_OFFSET] = ( KOCTET )m_ui8ID;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// RouterRewriteSiteApplication
+//////////////////////////////////////////////////////////////////////////
+
+void RouterRewriteSiteApplication::setDefaultOffsets()
+{
+    // Every standard PDU starts with the originating entity, object or minefield ID.
+    for( KUINT16 i = Entity_State_PDU_Type; i <= Attribute_PDU_Type; ++i )
+    {
+        m_vOffsets[i].assign( 1, ORIGIN_ID_OFFSET );
+    }
+
+    // Firing, target and munition entity IDs then the event ID.
+    const KUINT16 aui16Fire[] = { 12, 18, 24, 30 };
+    m_vOffsets[Fire_PDU_Type].assign( aui16Fire, aui16Fire + 4 );
+    m_vOffsets[Detonation_PDU_Type].assign( aui16Fire, aui16Fire + 4 );
+
+    // Issuing and colliding entity IDs then the event ID.
+    m_vOffsets[Collision_PDU_Type].assign( aui16Fire, aui16Fire + 3 );
+    m_vOffsets[Collision_Elastic_PDU_Type].assign( aui16Fire, aui16Fire + 3 );
+
+    // Originating and receiving entity IDs of the logistics and simulation management PDU.
+    for( KUINT16 i = Service_Request_PDU_Type; i <= Message_PDU_Type; ++i )
+    {
+        m_vOffsets[i].assign( aui16Fire, aui16Fire + 2 );
+    }
+    for( KUINT16 i = CreateEntity_R_PDU_Type; i <= RecordQuery_R_PDU_Type; ++i )
+    {
+        m_vOffsets[i].assign( aui16Fire, aui16Fire + 2 );
+    }
+
+    // Originating, receiving and transfer entity IDs, the transfer entity follows the request ID.
+    const KUINT16 aui16Transfer[] = { 12, 18, 30 };
+    m_vOffsets[TransferControl_PDU_Type].assign( aui16Transfer, aui16Transfer + 3 );
+
+    // Originating and receiving simulation IDs then the attacker and primary target entity IDs.
+    const KUINT16 aui16IOAction[] = { 12, 18, 40, 46 };
+    m_vOffsets[IO_Action_PDU_Type].assign( aui16IOAction, aui16IOAction + 4 );
+
+    // Originating simulation ID then the attacker and primary target entity IDs.
+    const KUINT16 aui16IOReport[] = { 12, 22, 28 };
+    m_vOffsets[IO_Report_PDU_Type].assign( aui16IOReport, aui16IOReport + 3 );
+
+    // Designating entity ID then the designated entity ID after the code name.
+    const KUINT16 aui16Designator[] = { 12, 20 };
+    m_vOffsets[Designator_PDU_Type].assign( aui16Designator, aui16Designator + 2 );
+
+    // Receiving radio then the transmitting radio.
+    const KUINT16 aui16Receiver[] = { 12, 28 };
+    m_vOffsets[Receiver_PDU_Type].assign( aui16Receiver, aui16Receiver + 2 );
+
+    // Source entity ID after the control type and channel type then the master entity ID.
+    const KUINT16 aui16Intercom[] = { 14, 26 };
+    m_vOffsets[IntercomControl_PDU_Type].assign( aui16Intercom, aui16Intercom + 2 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+RouterRewriteSiteApplication::RouterRewriteSiteApplication( KUINT16 FromSite, KUINT16 FromApp, KUINT16 ToSite, KUINT16 ToApp ) :
+    m_ui16FromSite( FromSite ),
+    m_ui16FromApp( FromApp ),
+    m_ui16ToSite( ToSite ),
+    m_ui16ToApp( ToApp ),
+    m_bMatchApp( true )
+{
+    setDefaultOffsets();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+RouterRewriteSiteApplication::RouterRewriteSiteApplication( KUINT16 FromSite, KUINT16 ToSite ) :
+    m_ui16FromSite( FromSite ),
+    m_ui16FromApp( 0 ),
+    m_ui16ToSite( ToSite ),
+    m_ui16ToApp( 0 ),
+    m_bMatchApp( false )
+{
+    setDefaultOffsets();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+RouterRewriteSiteApplication::~RouterRewriteSiteApplication()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void RouterRewriteSiteApplication::SetIdentifierOffsets( KUINT8 T, const vector<KUINT16> & O )
+{
+    m_vOffsets[T] = O;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const vector<KUINT16> & RouterRewriteSiteApplication::GetIdentifierOffsets( KUINT8 T ) const
+{
+    return m_vOffsets[T];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL RouterRewriteSiteApplication::Apply( KOCTET * Data, KUINT16 Length )
+{
+    if( Length < PROTOCOL_FAMILY_OFFSET + 1 )return true;
+
+    const vector<KUINT16> & vOffsets = m_vOffsets[( KUINT8 )Data[PDU_TYPE_OFFSET]];
+    const KBOOL bLE = isLiveEntity( Data );
+
+    if( bLE && ( m_ui16ToSite > 0xFF || ( m_bMatchApp && m_ui16ToApp > 0xFF ) ) )return true;
+
+    vector<KUINT16>::const_iterator citr = vOffsets.begin();
+    vector<KUINT16>::const_iterator citrEnd = vOffsets.end();
+    for( ; citr != citrEnd; ++citr )
+    {
+        KOCTET * p = Data + *citr;
+
+        if( bLE )
+        {
+            if( *citr + 2 > Length )continue;
+            if( ( KUINT8 )p[0] != m_ui16FromSite )continue;
+            if( m_bMatchApp && ( KUINT8 )p[1] != m_ui16FromApp )continue;
+            p[0] = ( KOCTET )m_ui16ToSite;
+            if( m_bMatchApp )p[1] = ( KOCTET )m_ui16ToApp;
+        }
+        else
+        {
+            if( *citr + 4 > Length )continue;
+            if( readUINT16( p ) != m_ui16FromSite )continue;
+            if( m_bMatchApp && readUINT16( p + 2 ) != m_ui16FromApp )continue;
+            writeUINT16( p, m_ui16ToSite );
+            if( m_bMatchApp )writeUINT16( p + 2, m_ui16ToApp );
+        }
+    }
+
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// RouterRewriteTimeStamp
+//////////////////////////////////////////////////////////////////////////
+
+RouterRewriteTimeStamp::RouterRewriteTimeStamp( TimeStampType T /* = RelativeTime */ ) :
+    m_Type( T )
+{
+    BeginDatagram();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+RouterRewriteTimeStamp::~RouterRewriteTimeStamp()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void RouterRewriteTimeStamp::BeginDatagram()
+{
+    TimeStamp ts( m_Type, 0 );
+    ts.CalculateTimeStamp();
+
+    KDataStream stream;
+    ts.Encode( stream );
+    stream.CopyIntoBuffer( m_cStamp, sizeof( m_cStamp ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL RouterRewriteTimeStamp::Apply( KOCTET * Data, KUINT16 Length )
+{
+    if( Length < TIME_STAMP_OFFSET + sizeof( m_cStamp ) )return true;
+    memcpy( Data + TIME_STAMP_OFFSET, m_cStamp, sizeof( m_cStamp ) );
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,277 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      PDU_Router_Rules
+    created:    19/10/2026
+
+    purpose:    Rules applied by the PDU_Router to each PDU it forwards. A rule works on
+                the encoded PDU and may drop it or change its fields in place, nothing is
+                decoded. The rules are applied in the order they were added so filters
+                should be added before rewrites.
+
+                E.G A gateway that only forwards entity state and fire PDU from site 1 and
+                moves them into exercise 7 would use a RouterFilterPDUType, a RouterFilterSite
+                and a RouterRewriteExerciseID.
+*********************************************************************/
+
+#pragma once
+
+#include "./../KDefines.h"
+#include "./../DataTypes/Enums/EnumHeader.h"
+#include <vector>
+
+namespace KDIS {
+namespace NETWORK {
+
+//////////////////////////////////////////////////////////////////////////
+// The base rule class that all rules must derive from.                 //
+//////////////////////////////////////////////////////////////////////////
+class KDIS_EXPORT PDU_Router_Rule
+{
+public:
+
+    PDU_Router_Rule() {};
+
+    virtual ~PDU_Router_Rule() {};
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Router_Rule::BeginDatagram
+    // Description: Called once before the PDU of each routed datagram, allows a rule to
+    //              calculate a value once per datagram instead of once per PDU.
+    //************************************
+    virtual void BeginDatagram() {};
+
+    //************************************
+    // FullName:    KDIS::NETWORK::PDU_Router_Rule::Apply
+    // Description: Called for each PDU. Data points to the router's copy of the PDU and
+    //              Length is the length from its header, at least 12 octets. Any field may
+    //              be changed in place but the length must not change.
+    //              Return false to drop the PDU.
+    // Parameter:   KOCTET * Data
+    // Parameter:   KUINT16 Length
+    //************************************
+    virtual KBOOL Apply( KOCTET * Data, KUINT16 Length ) = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// RouterFilterPDUType                                                  //
+// Forwards or drops the PDU types in its list.                         //
+//////////////////////////////////////////////////////////////////////////
+class KDIS_EXPORT RouterFilterPDUType : public PDU_Router_Rule
+{
+protected:
+
+    KBOOL m_bAllow;
+    KBOOL m_bTypes[256];
+
+public:
+
+    //************************************
+    // FullName:    KDIS::NETWORK::RouterFilterPDUType::RouterFilterPDUType
+    // Description: When Allow is true only the listed types are forwarded,
+    //              when false the listed types are dropped.
+    // Parameter:   KBOOL Allow
+    //************************************
+    RouterFilterPDUType( KBOOL Allow = true );
+
+    virtual ~RouterFilterPDUType();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::RouterFilterPDUType::AddType
+    //              KDIS::NETWORK::RouterFilterPDUType::RemoveType
+    // Description: Add/Remove a type from the list.
+    // Parameter:   KUINT8 T
+    //************************************
+    void AddType( KUINT8 T );
+    void RemoveType( KUINT8 T );
+
+    virtual KBOOL Apply( KOCTET * Data, KUINT16 Length );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// RouterFilterExerciseID                                               //
+// Only forwards PDU from a single exercise.                            //
+//////////////////////////////////////////////////////////////////////////
+class KDIS_EXPORT RouterFilterExerciseID : public PDU_Router_Rule
+{
+protected:
+
+    KUINT8 m_ui8ID;
+
+public:
+
+    RouterFilterExerciseID( KUINT8 ID );
+
+    virtual ~RouterFilterExerciseID();
+
+    virtual KBOOL Apply( KOCTET * Data, KUINT16 Length );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// RouterFilterSite                                                     //
+// Forwards or drops PDU based on the site of the originating entity,   //
+// the first identifier after the header.                               //
+//////////////////////////////////////////////////////////////////////////
+class KDIS_EXPORT RouterFilterSite : public PDU_Router_Rule
+{
+protected:
+
+    KBOOL m_bAllow;
+
+    // Kept sorted.
+    std::vector<KUINT16> m_vSites;
+
+public:
+
+    //************************************
+    // FullName:    KDIS::NETWORK::RouterFilterSite::RouterFilterSite
+    // Description: When Allow is true only PDU from the listed sites are forwarded,
+    //              when false PDU from the listed sites are dropped.
+    //              PDU that are too short to contain an identifier are always forwarded.
+    // Parameter:   KBOOL Allow
+    //************************************
+    RouterFilterSite( KBOOL Allow = true );
+
+    virtual ~RouterFilterSite();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::RouterFilterSite::AddSite
+    //              KDIS::NETWORK::RouterFilterSite::RemoveSite
+    // Description: Add/Remove a site from the list.
+    // Parameter:   KUINT16 S
+    //************************************
+    void AddSite( KUINT16 S );
+    void RemoveSite( KUINT16 S );
+
+    virtual KBOOL Apply( KOCTET * Data, KUINT16 Length );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// RouterRewriteExerciseID                                              //
+// Moves every PDU into a single exercise.                              //
+//////////////////////////////////////////////////////////////////////////
+class KDIS_EXPORT RouterRewriteExerciseID : public PDU_Router_Rule
+{
+protected:
+
+    KUINT8 m_ui8ID;
+
+public:
+
+    RouterRewriteExerciseID( KUINT8 ID );
+
+    virtual ~RouterRewriteExerciseID();
+
+    virtual KBOOL Apply( KOCTET * Data, KUINT16 Length );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// RouterRewriteSiteApplication                                         //
+// Replaces a site and application in every identifier of the PDU       //
+// whose offset is known, E.G the firing, target and munition IDs and   //
+// the event ID of a Fire PDU.                                          //
+//////////////////////////////////////////////////////////////////////////
+class KDIS_EXPORT RouterRewriteSiteApplication : public PDU_Router_Rule
+{
+protected:
+
+    KUINT16 m_ui16FromSite;
+    KUINT16 m_ui16FromApp;
+    KUINT16 m_ui16ToSite;
+    KUINT16 m_ui16ToApp;
+    KBOOL m_bMatchApp;
+
+    // Identifier offsets for each PDU type.
+    std::vector<KUINT16> m_vOffsets[256];
+
+    void setDefaultOffsets();
+
+public:
+
+    //************************************
+    // FullName:    KDIS::NETWORK::RouterRewriteSiteApplication::RouterRewriteSiteApplication
+    // Description: Identifiers with site FromSite and application FromApp are changed to
+    //              ToSite and ToApp. The second form changes the site of every identifier
+    //              from FromSite and keeps the application.
+    //              The Live Entity family uses 1 octet site and application numbers,
+    //              identifiers in those PDU are only changed when the new values fit.
+    // Parameter:   KUINT16 FromSite
+    // Parameter:   KUINT16 FromApp
+    // Parameter:   KUINT16 ToSite
+    // Parameter:   KUINT16 ToApp
+    //************************************
+    RouterRewriteSiteApplication( KUINT16 FromSite, KUINT16 FromApp, KUINT16 ToSite, KUINT16 ToApp );
+    RouterRewriteSiteApplication( KUINT16 FromSite, KUINT16 ToSite );
+
+    virtual ~RouterRewriteSiteApplication();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::RouterRewriteSiteApplication::SetIdentifierOffsets
+    //              KDIS::NETWORK::RouterRewriteSiteApplication::GetIdentifierOffsets
+    // Description: The offsets of the identifiers rewritten in a PDU type. By default the
+    //              offsets of the entity, event and radio identifiers of the standard PDU
+    //              are used and the first identifier after the header of any other type.
+    //              Identifiers beyond the end of a PDU are ignored.
+    // Parameter:   KUINT8 T
+    // Parameter:   const std::vector<KUINT16> & O
+    //************************************
+    void SetIdentifierOffsets( KUINT8 T, const std::vector<KUINT16> & O );
+    const std::vector<KUINT16> & GetIdentifierOffsets( KUINT8 T ) const;
+
+    virtual KBOOL Apply( KOCTET * Data, KUINT16 Length );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// RouterRewriteTimeStamp                                               //
+// Stamps every PDU with the router's clock, for networks that do not   //
+// share a time reference.                                              //
+//////////////////////////////////////////////////////////////////////////
+class KDIS_EXPORT RouterRewriteTimeStamp : public PDU_Router_Rule
+{
+protected:
+
+    KDIS::DATA_TYPE::ENUMS::TimeStampType m_Type;
+
+    // The encoded time stamp, calculated once per datagram.
+    KOCTET m_cStamp[4];
+
+public:
+
+    RouterRewriteTimeStamp( KDIS::DATA_TYPE::ENUMS::TimeStampType T = KDIS::DATA_TYPE::ENUMS::RelativeTime );
+
+    virtual ~RouterRewriteTimeStamp();
+
+    virtual void BeginDatagram();
+
+    virtual KBOOL Apply( KOCTET * Data, KUINT16 Length );
+};
+
+} // END namespace NETWORK
+} // END namespace KDIS
@@ -0,0 +1,279 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./RadioAudioReceiver.h"
+#include "./SocketUtils.h"
+#include "./../Extras/AudioCodec.h"
+
+using namespace std;
+using namespace KDIS;
+using namespace NETWORK;
+using namespace PDU;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+using namespace UTILS;
+
+// The offsets of the PDU type and length in the header, see Header6.
+static const KUINT32 PDU_TYPE_OFFSET = 2;
+static const KUINT32 PDU_LENGTH_OFFSET = 8;
+static const KUINT32 PDU_HEADER_SIZE = 12;
+
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+RadioAudioReceiver::Stream::Stream( KUINT32 RingSamples, KUINT32 FrameSamples, KUINT32 DelaySamples ) :
+    m_ui64Key( 0 ),
+    m_ui64LastActivity( 0 ),
+    m_Buffer( RingSamples, FrameSamples, DelaySamples )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 RadioAudioReceiver::makeKey( const EntityIdentifier & ID, KUINT16 RadioID )
+{
+    return ( ( KUINT64 )ID.GetSiteID() << 48 ) | ( ( KUINT64 )ID.GetApplicationID() << 32 ) |
+           ( ( KUINT64 )ID.GetEntityID() << 16 ) | RadioID;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void RadioAudioReceiver::handleSignal( const Signal_View & S, KUINT64 Now ) throw( KException )
+{
+    const KUINT16 ui16Type = S.GetEncodingType();
+    const KUINT8 ui8Size = AudioCodec::GetSampleSize( ui16Type );
+    if( S.GetEncodingClass() != EncodedAudio || ui8Size == 0 )
+    {
+        ++m_ui64Ignored;
+        return;
+    }
+
+    const KOCTET * pData = S.GetSignalData();
+    KUINT32 ui32Samples = S.GetSamples();
+    if( ui32Samples * ui8Size > S.GetSignalDataSize() )ui32Samples = S.GetSignalDataSize() / ui8Size;
+
+    const KUINT64 ui64Key = makeKey( S.GetEntityID(), S.GetRadioID() );
+    map<KUINT64, KUINT32>::iterator itr = m_mStreams.find( ui64Key );
+    if( itr == m_mStreams.end() )
+    {
+        if( m_vFree.empty() )
+        {
+            ++m_ui64NoStream;
+            return;
+        }
+
+        itr = m_mStreams.insert( make_pair( ui64Key, m_vFree.back() ) ).first;
+        m_vFree.pop_back();
+        m_vStreams[itr->second].m_ui64Key = ui64Key;
+    }
+
+    Stream & s = m_vStreams[itr->second];
+    s.m_ui64LastActivity = Now;
+    s.m_Buffer.Write( S.GetTimeStamp(), ui16Type, S.GetSampleRate(), pData, ui32Samples );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+RadioAudioReceiver::RadioAudioReceiver( KUINT32 MaxStreams /*= 512*/, KUINT32 RingSamples /*= 16384*/,
+                                        KUINT32 FrameSamples /*= 160*/, KUINT32 DelaySamples /*= 480*/ ) throw( KException ) :
+    m_bConsume( false ),
+    m_ui64Signals( 0 ),
+    m_ui64Ignored( 0 ),
+    m_ui64NoStream( 0 )
+{
+    // Throws if the sizes are not valid.
+    Stream s( RingSamples, FrameSamples, DelaySamples );
+
+    m_vStreams.resize( MaxStreams, s );
+    m_vFree.reserve( MaxStreams );
+    for( KUINT32 i = MaxStreams; i > 0; --i )
+    {
+        m_vFree.push_back( i - 1 );
+    }
+
+    // Room for the largest sample size.
+    m_vFrame.resize( FrameSamples * 2 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+RadioAudioReceiver::~RadioAudioReceiver()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void RadioAudioReceiver::SetConsumeSignals( KBOOL C )
+{
+    m_bConsume = C;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL RadioAudioReceiver::GetConsumeSignals() const
+{
+    return m_bConsume;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL RadioAudioReceiver::HandleDatagram( const KOCTET * Data, KUINT32 DataLength, KUINT64 ArrivalTime /* = 0 */ )
+{
+    const KUINT64 ui64Now = ArrivalTime ? ArrivalTime : GetWallTime();
+    KBOOL bOnlySignals = DataLength > 0;
+    KUINT32 ui32Pos = 0;
+    while( ui32Pos < DataLength )
+    {
+        const KOCTET * pPDU = Data + ui32Pos;
+        const KUINT32 ui32Remaining = DataLength - ui32Pos;
+
+        KUINT32 ui32Length = 0;
+        if( ui32Remaining >= PDU_HEADER_SIZE )
+        {
+            ui32Length = ( ( KUINT32 )( KUINT8 )pPDU[PDU_LENGTH_OFFSET] << 8 ) | ( KUINT8 )pPDU[PDU_LENGTH_OFFSET + 1];
+        }
+        if( ui32Length < PDU_HEADER_SIZE || ui32Length > ui32Remaining )
+        {
+            // Leave the connection to report the malformed PDU.
+            return false;
+        }
+        ui32Pos += ui32Length;
+
+        if( ( KUINT8 )pPDU[PDU_TYPE_OFFSET] != Signal_PDU_Type )
+        {
+            bOnlySignals = false;
+            continue;
+        }
+
+        ++m_ui64Signals;
+        try
+        {
+            handleSignal( Signal_View( pPDU, ( KUINT16 )ui32Length ), ui64Now );
+        }
+        catch( KException & )
+        {
+            ++m_ui64Ignored;
+        }
+    }
+
+    return bOnlySignals;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 RadioAudioReceiver::ReadFrames( RadioAudioHandler & H )
+{
+    KUINT32 ui32Frames = 0;
+    map<KUINT64, KUINT32>::iterator itr = m_mStreams.begin();
+    map<KUINT64, KUINT32>::iterator itrEnd = m_mStreams.end();
+    for( ; itr != itrEnd; ++itr )
+    {
+        AudioJitterBuffer & b = m_vStreams[itr->second].m_Buffer;
+        if( !b.ReadFrame( &m_vFrame[0] ) )continue;
+
+        const KUINT64 k = itr->first;
+        H.OnAudioFrame( EntityIdentifier( ( KUINT16 )( k >> 48 ), ( KUINT16 )( k >> 32 ), ( KUINT16 )( k >> 16 ) ), ( KUINT16 )k,
+                        b.GetEncodingType(), b.GetSampleRate(), &m_vFrame[0], b.GetFrameSize() );
+        ++ui32Frames;
+    }
+    return ui32Frames;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 RadioAudioReceiver::RemoveIdleStreams( KUINT64 IdleTime )
+{
+    const KUINT64 ui64Now = GetWallTime();
+    KUINT32 ui32Removed = 0;
+    map<KUINT64, KUINT32>::iterator itr = m_mStreams.begin();
+    while( itr != m_mStreams.end() )
+    {
+        Stream & s = m_vStreams[itr->second];
+        if( ui64Now - s.m_ui64LastActivity < IdleTime )
+        {
+            ++itr;
+            continue;
+        }
+
+        s.m_Buffer.Reset();
+        m_vFree.push_back( itr->second );
+        m_mStreams.erase( itr++ );
+        ++ui32Removed;
+    }
+    return ui32Removed;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const AudioJitterBuffer * RadioAudioReceiver::GetJitterBuffer( const EntityIdentifier & ID, KUINT16 RadioID ) const
+{
+    map<KUINT64, KUINT32>::const_iterator itr = m_mStreams.find( makeKey( ID, RadioID ) );
+    if( itr == m_mStreams.end() )return NULL;
+    return &m_vStreams[itr->second].m_Buffer;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 RadioAudioReceiver::GetStreamCount() const
+{
+    return m_mStreams.size();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 RadioAudioReceiver::GetSignalCount() const
+{
+    return m_ui64Signals;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 RadioAudioReceiver::GetIgnoredCount() const
+{
+    return m_ui64Ignored;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 RadioAudioReceiver::GetNoStreamCount() const
+{
+    return m_ui64NoStream;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL RadioAudioReceiver::OnDataReceived( const KOCTET * Data, KUINT32 DataLength, const sockaddr_in &, KUINT64 ArrivalTime )
+{
+    return !( HandleDatagram( Data, DataLength, ArrivalTime ) && m_bConsume );
+}
+
+//////////////////////////////////////////////////////////////////////////
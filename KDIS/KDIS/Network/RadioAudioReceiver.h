@@ -0,0 +1,210 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      RadioAudioReceiver
+    created:    19/10/2026
+
+    purpose:    Collects the audio of every radio transmitter heard in Signal PDU and
+                plays each one out through its own AudioJitterBuffer. The Signal PDU are
+                read in place with a Signal_View, the samples are copied once from the
+                receive buffer into the transmitter's ring and from there into the
+                frame handed to the RadioAudioHandler.
+
+                A stream is kept for each transmitter, identified by its entity and radio
+                ID. The streams are allocated up front, a new transmitter takes a free
+                stream and nothing is allocated per PDU, so hundreds of streams can be
+                received without heap traffic.
+
+                Add the receiver to the Connection as a subscriber, or pass it each received
+                datagram with HandleDatagram, and call ReadFrames once per frame period.
+                Note: Not thread safe, call from the thread that receives the PDU.
+*********************************************************************/
+
+#pragma once
+
+#include "./ConnectionSubscriber.h"
+#include "./../PDU/Radio_Communications/Signal_View.h"
+#include "./../Extras/AudioJitterBuffer.h"
+#include <vector>
+#include <map>
+
+namespace KDIS {
+namespace NETWORK {
+
+//////////////////////////////////////////////////////////////////////////
+// Receives the audio frames read by the RadioAudioReceiver.            //
+//////////////////////////////////////////////////////////////////////////
+class KDIS_EXPORT RadioAudioHandler
+{
+public:
+
+    RadioAudioHandler() {};
+
+    virtual ~RadioAudioHandler() {};
+
+    //************************************
+    // FullName:    KDIS::NETWORK::RadioAudioHandler::OnAudioFrame
+    // Description: Called with the next frame of a transmitter, still in its encoding.
+    //              The frame is only valid for the length of the call.
+    // Parameter:   const EntityIdentifier & ID
+    // Parameter:   KUINT16 RadioID
+    // Parameter:   KUINT16 EncodingType
+    // Parameter:   KUINT32 SampleRate
+    // Parameter:   const KOCTET * Frame
+    // Parameter:   KUINT32 Size - Octets in the frame.
+    //************************************
+    virtual void OnAudioFrame( const KDIS::DATA_TYPE::EntityIdentifier & ID, KUINT16 RadioID, KUINT16 EncodingType,
+                               KUINT32 SampleRate, const KOCTET * Frame, KUINT32 Size ) = 0;
+};
+
+class KDIS_EXPORT RadioAudioReceiver : public ConnectionSubscriber
+{
+protected:
+
+    struct Stream
+    {
+        KUINT64 m_ui64Key;
+        KUINT64 m_ui64LastActivity;
+        KDIS::UTILS::AudioJitterBuffer m_Buffer;
+
+        Stream( KUINT32 RingSamples, KUINT32 FrameSamples, KUINT32 DelaySamples );
+    };
+
+    // Stream pool and the free streams, the map holds the streams in use by key.
+    std::vector<Stream> m_vStreams;
+    std::vector<KUINT32> m_vFree;
+    std::map<KUINT64, KUINT32> m_mStreams;
+
+    // The frame passed to the handler.
+    std::vector<KOCTET> m_vFrame;
+
+    KBOOL m_bConsume;
+
+    KUINT64 m_ui64Signals;
+    KUINT64 m_ui64Ignored;
+    KUINT64 m_ui64NoStream;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::RadioAudioReceiver::makeKey
+    // Description: Packs the entity and radio ID into a stream key.
+    // Parameter:   const EntityIdentifier & ID
+    // Parameter:   KUINT16 RadioID
+    //************************************
+    static KUINT64 makeKey( const KDIS::DATA_TYPE::EntityIdentifier & ID, KUINT16 RadioID );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::RadioAudioReceiver::handleSignal
+    // Description: Adds the samples of a Signal PDU to its stream.
+    // Parameter:   const Signal_View & S
+    // Parameter:   KUINT64 Now
+    //************************************
+    void handleSignal( const KDIS::PDU::Signal_View & S, KUINT64 Now ) throw( KException );
+
+public:
+
+    //************************************
+    // FullName:    KDIS::NETWORK::RadioAudioReceiver::RadioAudioReceiver
+    // Description: Allocates the streams, the sizes are in samples, see AudioJitterBuffer.
+    // Parameter:   KUINT32 MaxStreams
+    // Parameter:   KUINT32 RingSamples
+    // Parameter:   KUINT32 FrameSamples
+    // Parameter:   KUINT32 DelaySamples
+    //************************************
+    RadioAudioReceiver( KUINT32 MaxStreams = 512, KUINT32 RingSamples = 16384, KUINT32 FrameSamples = 160,
+                        KUINT32 DelaySamples = 480 ) throw( KException );
+
+    virtual ~RadioAudioReceiver();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::RadioAudioReceiver::SetConsumeSignals
+    //              KDIS::NETWORK::RadioAudioReceiver::GetConsumeSignals
+    // Description: When set, a datagram that holds only Signal PDU is not decoded any
+    //              further by the Connection. Off by default.
+    // Parameter:   KBOOL C
+    //************************************
+    void SetConsumeSignals( KBOOL C );
+    KBOOL GetConsumeSignals() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::RadioAudioReceiver::HandleDatagram
+    // Description: Adds the audio of each Signal PDU in a datagram, the other PDU are skipped.
+    //              Returns true if the datagram held only Signal PDU.
+    // Parameter:   const KOCTET * Data
+    // Parameter:   KUINT32 DataLength
+    // Parameter:   KUINT64 ArrivalTime - The kernel arrival time in nanoseconds since the epoch,
+    //                                    0 to use the current time(see GetWallTime).
+    //************************************
+    KBOOL HandleDatagram( const KOCTET * Data, KUINT32 DataLength, KUINT64 ArrivalTime = 0 );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::RadioAudioReceiver::ReadFrames
+    // Description: Passes the next frame of each stream that has one ready to the handler.
+    //              Returns the number of frames passed.
+    // Parameter:   RadioAudioHandler & H
+    //************************************
+    KUINT32 ReadFrames( RadioAudioHandler & H );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::RadioAudioReceiver::RemoveIdleStreams
+    // Description: Frees the streams of transmitters that have not been heard for
+    //              the idle time, in nanoseconds. Returns the number removed.
+    // Parameter:   KUINT64 IdleTime
+    //************************************
+    KUINT32 RemoveIdleStreams( KUINT64 IdleTime );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::RadioAudioReceiver::GetJitterBuffer
+    // Description: The buffer of a transmitter's stream, for its counters, or NULL.
+    // Parameter:   const EntityIdentifier & ID
+    // Parameter:   KUINT16 RadioID
+    //************************************
+    const KDIS::UTILS::AudioJitterBuffer * GetJitterBuffer( const KDIS::DATA_TYPE::EntityIdentifier & ID, KUINT16 RadioID ) const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::RadioAudioReceiver::GetStreamCount
+    //              KDIS::NETWORK::RadioAudioReceiver::GetSignalCount
+    //              KDIS::NETWORK::RadioAudioReceiver::GetIgnoredCount
+    //              KDIS::NETWORK::RadioAudioReceiver::GetNoStreamCount
+    // Description: Streams in use, Signal PDU received, Signal PDU that do not carry
+    //              encoded audio or are malformed and Signal PDU dropped because every
+    //              stream was in use.
+    //************************************
+    KUINT32 GetStreamCount() const;
+    KUINT64 GetSignalCount() const;
+    KUINT64 GetIgnoredCount() const;
+    KUINT64 GetNoStreamCount() const;
+
+    // ConnectionSubscriber
+    using ConnectionSubscriber::OnDataReceived;
+    virtual KBOOL OnDataReceived( const KOCTET * Data, KUINT32 DataLength, const sockaddr_in & Sender, KUINT64 ArrivalTime );
+};
+
+} // END namespace NETWORK
+} // END namespace KDIS
@@ -0,0 +1,665 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./ReceiveShards.h"
+#include "./SocketUtils.h"
+
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 ) // Windows Headers //
+
+#include <ws2tcpip.h>
+
+#define CLOSE_SOCKET closesocket
+
+#else   // Linux Headers //
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sched.h>
+
+#define INVALID_SOCKET -1
+#define SOCKET_ERROR -1
+#define CLOSE_SOCKET close
+
+#endif
+
+using namespace std;
+using namespace KDIS;
+using namespace PDU;
+using namespace UTILS;
+using namespace NETWORK;
+
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::lock()
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    EnterCriticalSection( &m_Lock );
+#else
+    pthread_mutex_lock( &m_Lock );
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::unlock()
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    LeaveCriticalSection( &m_Lock );
+#else
+    pthread_mutex_unlock( &m_Lock );
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::lock( Shard & S )
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    EnterCriticalSection( &S.m_Lock );
+#else
+    pthread_mutex_lock( &S.m_Lock );
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::unlock( Shard & S )
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    LeaveCriticalSection( &S.m_Lock );
+#else
+    pthread_mutex_unlock( &S.m_Lock );
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ReceiveShards::Datagram * ReceiveShards::acquire()
+{
+    Datagram * D = 0;
+
+    lock();
+    if( !m_vpFree.empty() )
+    {
+        D = m_vpFree.back();
+        m_vpFree.pop_back();
+    }
+    unlock();
+
+    return D ? D : new Datagram;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::run( Shard & S )
+{
+    // Pin the worker if requested.
+    if( S.m_iCPU >= 0 )
+    {
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+        SetThreadAffinityMask( GetCurrentThread(), ( DWORD_PTR )1 << S.m_iCPU );
+#elif defined( __linux__ )
+        cpu_set_t cpus;
+        CPU_ZERO( &cpus );
+        CPU_SET( S.m_iCPU, &cpus );
+        pthread_setaffinity_np( pthread_self(), sizeof( cpus ), &cpus );
+#endif
+    }
+
+    while( !m_bStop )
+    {
+        // Wake up regularly to check for stop.
+        fd_set fd;
+        FD_ZERO( &fd );
+        FD_SET( S.m_iSocket, &fd );
+        timeval tval;
+        tval.tv_sec = 0;
+        tval.tv_usec = 100000;
+        if( select( S.m_iSocket + 1, &fd, 0, 0, &tval ) <= 0 )continue;
+
+        Datagram * D = acquire();
+        D->m_vData.resize( MAX_PDU_SIZE );
+
+        // The socket is non-blocking so the lock is never held waiting for a datagram.
+        lock( S );
+
+        KUINT32 ui32DropCount = S.m_ui32DropCount;
+        KBOOL bGroup = false;
+        KINT32 iRecv = ReceiveDatagram( S.m_iSocket, &D->m_vData[0], MAX_PDU_SIZE, D->m_Sender, S.m_bTiming ? &D->m_ui64ArrivalTime : 0,
+                                        S.m_bDetectDrops ? &ui32DropCount : 0, S.m_bUnicastOnly ? &bGroup : 0 );
+
+        // Every shard gets a copy of the group traffic, only the first one keeps it.
+        if( iRecv <= 0 || bGroup )
+        {
+            unlock( S );
+            Recycle( D );
+            continue;
+        }
+
+        // The kernel reports a running total, it wraps at 32 bits.
+        D->m_ui32Dropped = ui32DropCount - S.m_ui32DropCount;
+        S.m_ui32DropCount = ui32DropCount;
+
+        if( !S.m_bTiming )D->m_ui64ArrivalTime = 0;
+        D->m_ui64ReceiveTime = S.m_bTiming ? GetWallTime() : 0;
+
+        if( S.m_pStats )
+        {
+            if( D->m_ui32Dropped )S.m_pStats->OnDatagramsDropped( D->m_ui32Dropped );
+            S.m_pStats->OnDatagramReceived( iRecv );
+        }
+
+        D->m_vData.resize( iRecv );
+        decode( S, *D );
+        unlock( S );
+
+        lock();
+
+        // Wait for room, the socket is not read meanwhile so the kernel drops any excess.
+        while( m_qpReady.size() >= m_ui32MaxReady && !m_bStop )
+        {
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+            SleepConditionVariableCS( &m_Space, &m_Lock, INFINITE );
+#else
+            pthread_cond_wait( &m_Space, &m_Lock );
+#endif
+        }
+
+        m_qpReady.push_back( D );
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+        WakeConditionVariable( &m_Ready );
+#else
+        pthread_cond_signal( &m_Ready );
+#endif
+        unlock();
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::decode( Shard & S, Datagram & D )
+{
+    PDU_Statistics * Stats = S.m_pStats;
+    D.m_Error = NO_ERRORS;
+
+    S.m_Stream.Clear();
+    S.m_Stream.Write( &D.m_vData[0], D.m_vData.size() );
+
+    // As Connection::GetNextPDU but all the PDU in a bundle are decoded up front.
+    while( S.m_Stream.GetBufferSize() > 0 )
+    {
+        KUINT16 currentPos = S.m_Stream.GetCurrentWritePosition();
+
+        Header H;
+        ErrorCodes e = H.TryDecode( S.m_Stream );
+
+        // We step through the stream by the PDU length, one smaller than a header would never move on.
+        if( e == NO_ERRORS && H.GetPDULength() < Header::HEADER6_PDU_SIZE )e = INVALID_DATA;
+
+        if( e != NO_ERRORS )
+        {
+            if( Stats )Stats->OnFailed( e );
+            D.m_Error = e;
+            return;
+        }
+
+        const KBOOL bBundled = currentPos || H.GetPDULength() < D.m_vData.size();
+        if( Stats && !currentPos && bBundled )Stats->OnBundleReceived();
+
+        if( !S.m_pPduFact->IsDecodeEnabled( H ) )
+        {
+            if( Stats )Stats->OnFiltered( H );
+            S.m_Stream.SetCurrentWritePosition( currentPos + H.GetPDULength() );
+            continue;
+        }
+
+        const KUINT64 ui64Start = Stats ? PDU_Statistics::GetTime() : 0;
+
+        PduUniquePtr pdu;
+        e = S.m_pPduFact->TryDecode( H, S.m_Stream, pdu );
+        if( e != NO_ERRORS )
+        {
+            if( Stats )Stats->OnFailed( H, e );
+            D.m_Error = e;
+            return;
+        }
+
+        // Without a PDU there is no way to know where the next one starts.
+        if( !pdu.get() )return;
+
+        if( Stats )Stats->OnDecoded( *pdu, PDU_Statistics::GetTime() - ui64Start, bBundled );
+
+        S.m_Stream.SetCurrentWritePosition( currentPos + pdu->GetPDULength() );
+        D.m_vpPDU.push_back( pdu.release() );
+        D.m_vui64DecodedTime.push_back( S.m_bTiming ? GetWallTime() : 0 );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::setMembership( const KString & A, KBOOL Join ) throw( KException )
+{
+    if( m_vpShards.empty() )return;
+
+    ip_mreq mc;
+    mc.imr_multiaddr.s_addr = inet_addr( A.c_str() );
+    mc.imr_interface.s_addr = htonl( INADDR_ANY );
+
+    // The kernel delivers the group to every socket on the port, joining once is enough.
+    KINT32 iRet = setsockopt( m_vpShards[0]->m_iSocket, IPPROTO_IP, Join ? IP_ADD_MEMBERSHIP : IP_DROP_MEMBERSHIP,
+                              ( KOCTET* )&mc, sizeof( mc ) );
+    if( iRet == SOCKET_ERROR )throw KException( __FUNCTION__, CONNECTION_SOCKET_ERROR );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::stop()
+{
+    // Wake any shard waiting for room in the queue.
+    lock();
+    m_bStop = true;
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    WakeAllConditionVariable( &m_Space );
+#else
+    pthread_cond_broadcast( &m_Space );
+#endif
+    unlock();
+
+    vector<Shard*>::iterator itr = m_vpShards.begin();
+    vector<Shard*>::iterator itrEnd = m_vpShards.end();
+    for( ; itr != itrEnd; ++itr )
+    {
+        if( ( *itr )->m_bRunning )
+        {
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+            WaitForSingleObject( ( *itr )->m_Thread, INFINITE );
+            CloseHandle( ( *itr )->m_Thread );
+#else
+            pthread_join( ( *itr )->m_Thread, 0 );
+#endif
+        }
+
+        if( ( *itr )->m_iSocket != INVALID_SOCKET )CLOSE_SOCKET( ( *itr )->m_iSocket );
+        delete ( *itr )->m_pPduFact;
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+        DeleteCriticalSection( &( *itr )->m_Lock );
+#else
+        pthread_mutex_destroy( &( *itr )->m_Lock );
+#endif
+        delete *itr;
+    }
+    m_vpShards.clear();
+
+    // No workers are left so the queues can be emptied without the lock.
+    while( !m_qpReady.empty() )
+    {
+        m_vpFree.push_back( m_qpReady.front() );
+        m_qpReady.pop_front();
+    }
+
+    vector<Datagram*>::iterator itrD = m_vpFree.begin();
+    vector<Datagram*>::iterator itrDEnd = m_vpFree.end();
+    for( ; itrD != itrDEnd; ++itrD )
+    {
+        vector<Header*>::iterator itrP = ( *itrD )->m_vpPDU.begin();
+        vector<Header*>::iterator itrPEnd = ( *itrD )->m_vpPDU.end();
+        for( ; itrP != itrPEnd; ++itrP )
+        {
+            delete *itrP;
+        }
+        delete *itrD;
+    }
+    m_vpFree.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+DWORD WINAPI ReceiveShards::threadEntry( LPVOID P )
+#else
+void * ReceiveShards::threadEntry( void * P )
+#endif
+{
+    Shard * S = static_cast<Shard*>( P );
+    S->m_pOwner->run( *S );
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+ReceiveShards::ReceiveShards( KUINT32 Port, KUINT16 Count, const vector<KINT32> & CPUs, FactoryCreator FC /* = 0 */ ) throw( KException ) :
+    m_ui32MaxReady( 1024 ),
+    m_bStop( false )
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    InitializeCriticalSection( &m_Lock );
+    InitializeConditionVariable( &m_Ready );
+    InitializeConditionVariable( &m_Space );
+#else
+    pthread_mutex_init( &m_Lock, 0 );
+    pthread_cond_init( &m_Ready, 0 );
+    pthread_cond_init( &m_Space, 0 );
+#endif
+
+    try
+    {
+        for( KUINT16 i = 0; i < Count; ++i )
+        {
+            Shard * S = new Shard;
+            S->m_pOwner = this;
+            S->m_iCPU = i < CPUs.size() ? CPUs[i] : -1;
+            S->m_pPduFact = FC ? FC() : new PDU_Factory;
+            S->m_bRunning = false;
+            S->m_bUnicastOnly = false;
+            S->m_ui32DropCount = 0;
+            S->m_bTiming = false;
+            S->m_bDetectDrops = false;
+            S->m_pStats = 0;
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+            InitializeCriticalSection( &S->m_Lock );
+#else
+            pthread_mutex_init( &S->m_Lock, 0 );
+#endif
+            S->m_iSocket = socket( AF_INET, SOCK_DGRAM, IPPROTO_UDP );
+            m_vpShards.push_back( S );
+
+            if( S->m_iSocket == INVALID_SOCKET )throw KException( __FUNCTION__, CONNECTION_SOCKET_ERROR );
+
+            // Every socket in the group must allow the port to be reused.
+            KINT32 yes = 1;
+            KINT32 iRet = setsockopt( S->m_iSocket, SOL_SOCKET, SO_REUSEADDR, ( const char * )&yes, sizeof( yes ) );
+#if defined( SO_REUSEPORT )
+            if( iRet != SOCKET_ERROR )iRet = setsockopt( S->m_iSocket, SOL_SOCKET, SO_REUSEPORT, ( const char * )&yes, sizeof( yes ) );
+#endif
+            if( iRet == SOCKET_ERROR )throw KException( __FUNCTION__, CONNECTION_SOCKET_ERROR );
+
+            sockaddr_in Address;
+            memset( &Address, 0, sizeof( Address ) );
+            Address.sin_family = AF_INET;
+            Address.sin_addr.s_addr = htonl( INADDR_ANY );
+            Address.sin_port = htons( Port );
+            iRet = bind( S->m_iSocket, ( sockaddr* )&Address, sizeof( Address ) );
+            if( iRet == SOCKET_ERROR )throw KException( __FUNCTION__, CONNECTION_SOCKET_ERROR );
+
+            // The worker holds the shard lock while reading so it must never block.
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+            u_long ulOn = 1;
+            iRet = ioctlsocket( S->m_iSocket, FIONBIO, &ulOn );
+#else
+            KINT32 iFlags = fcntl( S->m_iSocket, F_GETFL, 0 );
+            iRet = iFlags < 0 ? SOCKET_ERROR : fcntl( S->m_iSocket, F_SETFL, iFlags | O_NONBLOCK );
+#endif
+            if( iRet == SOCKET_ERROR )throw KException( __FUNCTION__, CONNECTION_SOCKET_ERROR );
+
+            // Only the first shard keeps multicast and broadcast datagrams, see the class note.
+            if( i > 0 )S->m_bUnicastOnly = SetPacketInfoEnabled( S->m_iSocket, true );
+        }
+    }
+    catch( const KException & )
+    {
+        stop();
+        throw;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ReceiveShards::~ReceiveShards()
+{
+    stop();
+
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    DeleteCriticalSection( &m_Lock );
+#else
+    pthread_cond_destroy( &m_Space );
+    pthread_cond_destroy( &m_Ready );
+    pthread_mutex_destroy( &m_Lock );
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::Start() throw( KException )
+{
+    vector<Shard*>::iterator itr = m_vpShards.begin();
+    vector<Shard*>::iterator itrEnd = m_vpShards.end();
+    for( ; itr != itrEnd; ++itr )
+    {
+        if( ( *itr )->m_bRunning )continue;
+
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+        ( *itr )->m_Thread = CreateThread( 0, 0, threadEntry, *itr, 0, 0 );
+        if( !( *itr )->m_Thread )throw KException( __FUNCTION__, CONNECTION_SOCKET_ERROR );
+#else
+        if( pthread_create( &( *itr )->m_Thread, 0, threadEntry, *itr ) != 0 )throw KException( __FUNCTION__, CONNECTION_SOCKET_ERROR );
+#endif
+        ( *itr )->m_bRunning = true;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT16 ReceiveShards::GetShardCount() const
+{
+    return m_vpShards.size();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+PDU_Factory * ReceiveShards::GetPDU_Factory( KUINT16 Index )
+{
+    return Index < m_vpShards.size() ? m_vpShards[Index]->m_pPduFact : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::CopyDecodeEnabled( const PDU_Factory & F )
+{
+    vector<Shard*>::iterator itr = m_vpShards.begin();
+    vector<Shard*>::iterator itrEnd = m_vpShards.end();
+    for( ; itr != itrEnd; ++itr )
+    {
+        lock( **itr );
+        ( *itr )->m_pPduFact->CopyDecodeEnabled( F );
+        unlock( **itr );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::SetMaxReady( KUINT32 Max )
+{
+    lock();
+    m_ui32MaxReady = Max ? Max : 1;
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    WakeAllConditionVariable( &m_Space );
+#else
+    pthread_cond_broadcast( &m_Space );
+#endif
+    unlock();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 ReceiveShards::GetMaxReady() const
+{
+    return m_ui32MaxReady;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::SetTimingEnabled( KBOOL E )
+{
+    vector<Shard*>::iterator itr = m_vpShards.begin();
+    vector<Shard*>::iterator itrEnd = m_vpShards.end();
+    for( ; itr != itrEnd; ++itr )
+    {
+        lock( **itr );
+        SetReceiveTimestampsEnabled( ( *itr )->m_iSocket, E );
+        ( *itr )->m_bTiming = E;
+        unlock( **itr );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::SetDropDetectionEnabled( KBOOL E )
+{
+    vector<Shard*>::iterator itr = m_vpShards.begin();
+    vector<Shard*>::iterator itrEnd = m_vpShards.end();
+    for( ; itr != itrEnd; ++itr )
+    {
+        lock( **itr );
+        SetDropCountEnabled( ( *itr )->m_iSocket, E );
+        ( *itr )->m_bDetectDrops = E;
+        unlock( **itr );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::SetReceiveBufferSize( KUINT32 Size ) throw( KException )
+{
+    vector<Shard*>::iterator itr = m_vpShards.begin();
+    vector<Shard*>::iterator itrEnd = m_vpShards.end();
+    for( ; itr != itrEnd; ++itr )
+    {
+        if( !SetSocketBufferSize( ( *itr )->m_iSocket, true, Size ) )throw KException( __FUNCTION__, CONNECTION_SOCKET_ERROR );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 ReceiveShards::GetReceiveBufferSize() const
+{
+    return m_vpShards.empty() ? 0 : GetSocketBufferSize( m_vpShards[0]->m_iSocket, true );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::SetStatistics( PDU_Statistics * S )
+{
+    vector<Shard*>::iterator itr = m_vpShards.begin();
+    vector<Shard*>::iterator itrEnd = m_vpShards.end();
+    for( ; itr != itrEnd; ++itr )
+    {
+        lock( **itr );
+        ( *itr )->m_pPduFact->SetStatistics( S );
+        ( *itr )->m_pStats = S;
+        unlock( **itr );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::AddMulticastAddress( const KString & A ) throw( KException )
+{
+    setMembership( A, true );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::RemoveMulticastAddress( const KString & A ) throw( KException )
+{
+    setMembership( A, false );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ReceiveShards::Datagram * ReceiveShards::Pop( const timeval & Timeout )
+{
+    Datagram * D = 0;
+
+    lock();
+
+    if( m_qpReady.empty() && ( Timeout.tv_sec || Timeout.tv_usec ) )
+    {
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+        SleepConditionVariableCS( &m_Ready, &m_Lock, Timeout.tv_sec * 1000 + Timeout.tv_usec / 1000 );
+#else
+        // The wait takes an absolute time.
+        timeval now;
+        gettimeofday( &now, 0 );
+        timespec until;
+        KUINT64 ui64USec = ( KUINT64 )now.tv_usec + Timeout.tv_usec;
+        until.tv_sec = now.tv_sec + Timeout.tv_sec + ui64USec / 1000000;
+        until.tv_nsec = ( ui64USec % 1000000 ) * 1000;
+
+        while( m_qpReady.empty() )
+        {
+            if( pthread_cond_timedwait( &m_Ready, &m_Lock, &until ) != 0 )break;
+        }
+#endif
+    }
+
+    if( !m_qpReady.empty() )
+    {
+        D = m_qpReady.front();
+        m_qpReady.pop_front();
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+        WakeConditionVariable( &m_Space );
+#else
+        pthread_cond_signal( &m_Space );
+#endif
+    }
+
+    unlock();
+
+    return D;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReceiveShards::Recycle( Datagram * D )
+{
+    if( !D )return;
+
+    vector<Header*>::iterator itr = D->m_vpPDU.begin();
+    vector<Header*>::iterator itrEnd = D->m_vpPDU.end();
+    for( ; itr != itrEnd; ++itr )
+    {
+        delete *itr;
+    }
+    D->m_vpPDU.clear();
+    D->m_vui64DecodedTime.clear();
+    D->m_ui32Dropped = 0;
+
+    lock();
+    m_vpFree.push_back( D );
+    unlock();
+}
+
+//////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,319 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      ReceiveShards
+    created:    18/10/2026
+
+    purpose:    Spreads receiving across several sockets bound to the same port with
+                SO_REUSEPORT, each read by its own worker thread which decodes the
+                datagrams with its own PDU_Factory. The decoded datagrams are queued
+                and collected from a single thread with Pop, see
+                Connection::SetReceiveShards which merges them into GetNextPDU.
+
+                The queue is bounded, see SetMaxReady. When it is full the shards stop
+                reading until Pop makes room and any excess is dropped by the kernel.
+
+                Note: The kernel balances unicast datagrams across the sockets by sender, so
+                the PDU from one sender stay in order. Only Linux(3.9+) balances reuse port
+                sockets, elsewhere the sockets are bound with SO_REUSEADDR only.
+                Multicast and broadcast datagrams are not balanced, every socket bound to the
+                port gets a copy. So only the first shard joins the multicast groups and the
+                other shards discard group traffic, which they recognise with IP_PKTINFO.
+                That is only supported on Linux, elsewhere use a single shard when receiving
+                multicast or broadcast or each PDU is received once per shard.
+*********************************************************************/
+
+#pragma once
+
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+#include <WinSock2.h>
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#endif
+
+#include "./../Extras/PDU_Factory.h"
+#include <vector>
+#include <deque>
+
+#ifdef KDIS_USE_CPP11
+#include <atomic>
+#endif
+
+namespace KDIS {
+namespace NETWORK {
+
+class KDIS_EXPORT ReceiveShards
+{
+public:
+
+    // A datagram received by a shard along with the PDU decoded from it, in stream order.
+    struct Datagram
+    {
+        std::vector<KOCTET> m_vData;
+        sockaddr_in m_Sender;
+        std::vector<KDIS::PDU::Header*> m_vpPDU;
+        KDIS::ErrorCodes m_Error; // Set if decoding stopped early because of an error.
+
+        // Only set when timing is enabled, see SetTimingEnabled. Times are nanoseconds since the epoch.
+        KUINT64 m_ui64ArrivalTime;
+        KUINT64 m_ui64ReceiveTime;
+        std::vector<KUINT64> m_vui64DecodedTime; // One for each PDU.
+
+        // Datagrams the kernel dropped on this shard's socket since its previous datagram, see SetDropDetectionEnabled.
+        KUINT32 m_ui32Dropped;
+    };
+
+    // Creates the PDU_Factory used by a shard, called once per shard.
+    typedef KDIS::UTILS::PDU_Factory * ( *FactoryCreator )();
+
+protected:
+
+    struct Shard
+    {
+        ReceiveShards * m_pOwner;
+        KINT32 m_iSocket;
+        KINT32 m_iCPU; // -1 if not pinned.
+        KDIS::UTILS::PDU_Factory * m_pPduFact;
+        KDataStream m_Stream;
+        KBOOL m_bRunning;
+        KBOOL m_bUnicastOnly; // Discards multicast and broadcast datagrams, see the class note.
+        KUINT32 m_ui32DropCount; // Total reported by the kernel.
+
+        // Guarded by the lock so they can be changed while the worker runs.
+        KBOOL m_bTiming;
+        KBOOL m_bDetectDrops;
+        KDIS::UTILS::PDU_Statistics * m_pStats;
+
+        #if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+        HANDLE m_Thread;
+        CRITICAL_SECTION m_Lock; // Held while receiving and decoding.
+        #else
+        pthread_t m_Thread;
+        pthread_mutex_t m_Lock; // Held while receiving and decoding.
+        #endif
+    };
+
+    std::vector<Shard*> m_vpShards;
+
+    // Decoded datagrams waiting for Pop and spare ones to reuse, guarded by the lock.
+    std::deque<Datagram*> m_qpReady;
+    std::vector<Datagram*> m_vpFree;
+    KUINT32 m_ui32MaxReady;
+
+    // Set under the lock, polled by the workers.
+    #ifdef KDIS_USE_CPP11
+    std::atomic<KBOOL> m_bStop;
+    #else
+    volatile KBOOL m_bStop;
+    #endif
+
+    #if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    CRITICAL_SECTION m_Lock;
+    CONDITION_VARIABLE m_Ready;
+    CONDITION_VARIABLE m_Space;
+    #else
+    pthread_mutex_t m_Lock;
+    pthread_cond_t m_Ready;
+    pthread_cond_t m_Space;
+    #endif
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::lock
+    //              KDIS::NETWORK::ReceiveShards::unlock
+    // Description: Guard the queues or, when given a shard, its socket, factory and settings.
+    // Parameter:   Shard & S
+    //************************************
+    void lock();
+    void unlock();
+    static void lock( Shard & S );
+    static void unlock( Shard & S );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::acquire
+    // Description: Returns a spare datagram or a new one.
+    //************************************
+    Datagram * acquire();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::run
+    // Description: The shard worker loop, receives and decodes until stopped.
+    // Parameter:   Shard & S
+    //************************************
+    void run( Shard & S );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::decode
+    // Description: Decodes all the PDU in the datagram with the shard's factory. Called with the shard locked.
+    // Parameter:   Shard & S
+    // Parameter:   Datagram & D
+    //************************************
+    void decode( Shard & S, Datagram & D );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::setMembership
+    // Description: Join or leave a multicast group on the first shard's socket, see the class note.
+    // Parameter:   const KString & A
+    // Parameter:   KBOOL Join
+    //************************************
+    void setMembership( const KString & A, KBOOL Join ) throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::stop
+    // Description: Stops the workers and releases the sockets, factories and datagrams.
+    //************************************
+    void stop();
+
+    #if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    static DWORD WINAPI threadEntry( LPVOID P );
+    #else
+    static void * threadEntry( void * P );
+    #endif
+
+private:
+
+    // The shards own sockets and threads.
+    ReceiveShards( const ReceiveShards & );
+    ReceiveShards & operator = ( const ReceiveShards & );
+
+public:
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::ReceiveShards
+    // Description: Creates and binds Count sockets to the port. The workers are not started until Start
+    //              so multicast groups and the factories can be configured first.
+    //              CPUs optionally gives the CPU to pin each shard's thread to, -1 or a missing entry
+    //              leaves the thread unpinned.
+    // Parameter:   KUINT32 Port
+    // Parameter:   KUINT16 Count
+    // Parameter:   const std::vector<KINT32> & CPUs
+    // Parameter:   FactoryCreator FC - Optional, by default each shard uses the standard PDU_Factory.
+    //************************************
+    ReceiveShards( KUINT32 Port, KUINT16 Count, const std::vector<KINT32> & CPUs, FactoryCreator FC = 0 ) throw( KException );
+
+    virtual ~ReceiveShards();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::Start
+    // Description: Starts a worker thread for each shard.
+    //************************************
+    void Start() throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::GetShardCount
+    //              KDIS::NETWORK::ReceiveShards::GetPDU_Factory
+    // Description: The number of shards and the factory a shard decodes with.
+    //              Note: Only change a factory before Start, once running use CopyDecodeEnabled and SetStatistics.
+    // Parameter:   KUINT16 Index
+    //************************************
+    KUINT16 GetShardCount() const;
+    KDIS::UTILS::PDU_Factory * GetPDU_Factory( KUINT16 Index );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::CopyDecodeEnabled
+    // Description: Enables the same PDU types and families as F in every shard factory.
+    //              Safe to call while the shards are running, see PDU_Factory::CopyDecodeEnabled.
+    // Parameter:   const PDU_Factory & F
+    //************************************
+    void CopyDecodeEnabled( const KDIS::UTILS::PDU_Factory & F );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::SetMaxReady
+    //              KDIS::NETWORK::ReceiveShards::GetMaxReady
+    // Description: The most decoded datagrams held for Pop, a shard waits for room when the
+    //              queue is full. Default 1024, 0 is treated as 1.
+    // Parameter:   KUINT32 Max
+    //************************************
+    void SetMaxReady( KUINT32 Max );
+    KUINT32 GetMaxReady() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::SetTimingEnabled
+    // Description: Enables kernel arrival timestamps on the shard sockets and records the receive and
+    //              decode times of each datagram.
+    // Parameter:   KBOOL E
+    //************************************
+    void SetTimingEnabled( KBOOL E );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::SetDropDetectionEnabled
+    // Description: Reads the kernel drop count(SO_RXQ_OVFL) with each datagram, see Datagram::m_ui32Dropped.
+    // Parameter:   KBOOL E
+    //************************************
+    void SetDropDetectionEnabled( KBOOL E );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::SetReceiveBufferSize
+    //              KDIS::NETWORK::ReceiveShards::GetReceiveBufferSize
+    // Description: The kernel receive buffer size of each shard socket in bytes.
+    // Parameter:   KUINT32 Size
+    //************************************
+    void SetReceiveBufferSize( KUINT32 Size ) throw( KException );
+    KUINT32 GetReceiveBufferSize() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::SetStatistics
+    // Description: The statistics the shards count their datagrams and PDU in, also set on the shard
+    //              factories. The shards update them concurrently. NULL to stop counting.
+    //              Safe to call while the shards are running, no shard uses the previous statistics
+    //              once it returns.
+    // Parameter:   PDU_Statistics * S
+    //************************************
+    void SetStatistics( KDIS::UTILS::PDU_Statistics * S );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::AddMulticastAddress
+    //              KDIS::NETWORK::ReceiveShards::RemoveMulticastAddress
+    // Description: Join/Leave a multicast group. Only the first shard receives the group, see the class note.
+    // Parameter:   const KString & A
+    //************************************
+    void AddMulticastAddress( const KString & A ) throw( KException );
+    void RemoveMulticastAddress( const KString & A ) throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::Pop
+    // Description: Returns the next decoded datagram from any shard, waiting up to Timeout for one.
+    //              Returns NULL if none arrived in time. Pass the datagram to Recycle when done.
+    // Parameter:   const timeval & Timeout
+    //************************************
+    Datagram * Pop( const timeval & Timeout );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReceiveShards::Recycle
+    // Description: Deletes any PDU left in the datagram and keeps it for reuse by the shards.
+    // Parameter:   Datagram * D
+    //************************************
+    void Recycle( Datagram * D );
+};
+
+} // END namespace NETWORK
+} // END namespace KDIS
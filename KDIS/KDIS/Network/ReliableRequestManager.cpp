@@ -0,0 +1,627 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./ReliableRequestManager.h"
+#include "./../Extras/PDU_Statistics.h"
+#include "./../PDU/Simulation_Management/Acknowledge_PDU.h"
+#include "./../PDU/Simulation_Management/Action_Request_PDU.h"
+#include "./../PDU/Simulation_Management/Action_Response_PDU.h"
+#include "./../PDU/Simulation_Management/Create_Entity_PDU.h"
+#include "./../PDU/Simulation_Management/Data_PDU.h"
+#include "./../PDU/Simulation_Management/Data_Query_PDU.h"
+#include "./../PDU/Simulation_Management/Remove_Entity_PDU.h"
+#include "./../PDU/Simulation_Management/Set_Data_PDU.h"
+#include "./../PDU/Simulation_Management/Start_Resume_PDU.h"
+#include "./../PDU/Simulation_Management/Stop_Freeze_PDU.h"
+#include "./../PDU/Simulation_Management_With_Reliability/Acknowledge_R_PDU.h"
+#include "./../PDU/Simulation_Management_With_Reliability/Action_Request_R_PDU.h"
+#include "./../PDU/Simulation_Management_With_Reliability/Action_Response_R_PDU.h"
+#include "./../PDU/Simulation_Management_With_Reliability/Create_Entity_R_PDU.h"
+#include "./../PDU/Simulation_Management_With_Reliability/Data_Query_R_PDU.h"
+#include "./../PDU/Simulation_Management_With_Reliability/Data_R_PDU.h"
+#include "./../PDU/Simulation_Management_With_Reliability/Record_Query_R_PDU.h"
+#include "./../PDU/Simulation_Management_With_Reliability/Record_R_PDU.h"
+#include "./../PDU/Simulation_Management_With_Reliability/Remove_Entity_R_PDU.h"
+#include "./../PDU/Simulation_Management_With_Reliability/Set_Data_R_PDU.h"
+#include "./../PDU/Simulation_Management_With_Reliability/Set_Record_R_PDU.h"
+#include "./../PDU/Simulation_Management_With_Reliability/Start_Resume_R_PDU.h"
+#include "./../PDU/Simulation_Management_With_Reliability/Stop_Freeze_R_PDU.h"
+
+using namespace std;
+using namespace KDIS;
+using namespace PDU;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+using namespace NETWORK;
+using namespace UTILS;
+
+//////////////////////////////////////////////////////////////////////////
+
+// The request ID of the requests and responses, false for any other PDU.
+static KBOOL getRequestID( const Header & H, KUINT32 & ID )
+{
+    switch( H.GetPDUType() )
+    {
+    case Create_Entity_PDU_Type:
+    case Remove_Entity_PDU_Type:
+    case CreateEntity_R_PDU_Type:
+    case RemoveEntity_R_PDU_Type:
+        ID = static_cast<const Create_Entity_PDU &>( H ).GetRequestID();
+        return true;
+    case Start_Resume_PDU_Type:
+    case Start_Resume_R_PDU_Type:
+        ID = static_cast<const Start_Resume_PDU &>( H ).GetRequestID();
+        return true;
+    case Stop_Freeze_PDU_Type:
+    case Stop_Freeze_R_PDU_Type:
+        ID = static_cast<const Stop_Freeze_PDU &>( H ).GetRequestID();
+        return true;
+    case Acknowledge_PDU_Type:
+    case Acknowledge_R_PDU_Type:
+        ID = static_cast<const Acknowledge_PDU &>( H ).GetRequestID();
+        return true;
+    case Action_Request_PDU_Type:
+    case Action_Response_PDU_Type:
+    case Set_Data_PDU_Type:
+    case Data_PDU_Type:
+    case ActionRequest_R_PDU_Type:
+    case ActionResponse_R_PDU_Type:
+    case SetData_R_PDU_Type:
+    case Data_R_PDU_Type:
+        ID = static_cast<const Data_PDU &>( H ).GetRequestID();
+        return true;
+    case Data_Query_PDU_Type:
+    case DataQuery_R_PDU_Type:
+        ID = static_cast<const Data_Query_PDU &>( H ).GetRequestID();
+        return true;
+    case Record_R_PDU_Type:
+    case SetRecord_R_PDU_Type:
+        ID = static_cast<const Set_Record_R_PDU &>( H ).GetRequestID();
+        return true;
+    case RecordQuery_R_PDU_Type:
+        ID = static_cast<const Record_Query_R_PDU &>( H ).GetRequestID();
+        return true;
+    default:
+        return false;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+// Sets the request ID of a request.
+static void setRequestID( Header & H, KUINT32 ID )
+{
+    switch( H.GetPDUType() )
+    {
+    case Create_Entity_PDU_Type:
+    case Remove_Entity_PDU_Type:
+    case CreateEntity_R_PDU_Type:
+    case RemoveEntity_R_PDU_Type:
+        static_cast<Create_Entity_PDU &>( H ).SetRequestID( ID );
+        break;
+    case Start_Resume_PDU_Type:
+    case Start_Resume_R_PDU_Type:
+        static_cast<Start_Resume_PDU &>( H ).SetRequestID( ID );
+        break;
+    case Stop_Freeze_PDU_Type:
+    case Stop_Freeze_R_PDU_Type:
+        static_cast<Stop_Freeze_PDU &>( H ).SetRequestID( ID );
+        break;
+    case Action_Request_PDU_Type:
+    case Set_Data_PDU_Type:
+    case ActionRequest_R_PDU_Type:
+    case SetData_R_PDU_Type:
+        static_cast<Data_PDU &>( H ).SetRequestID( ID );
+        break;
+    case Data_Query_PDU_Type:
+    case DataQuery_R_PDU_Type:
+        static_cast<Data_Query_PDU &>( H ).SetRequestID( ID );
+        break;
+    case SetRecord_R_PDU_Type:
+        static_cast<Set_Record_R_PDU &>( H ).SetRequestID( ID );
+        break;
+    case RecordQuery_R_PDU_Type:
+        static_cast<Record_Query_R_PDU &>( H ).SetRequestID( ID );
+        break;
+    default:
+        throw KException( __FUNCTION__, INVALID_DATA, "The PDU type has no request ID" );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+// The reliability header of an _R request, NULL for any other PDU.
+static const Reliability_Header * getReliabilityHeader( const Header & H )
+{
+    switch( H.GetPDUType() )
+    {
+    case CreateEntity_R_PDU_Type:
+    case RemoveEntity_R_PDU_Type:
+        return &static_cast<const Create_Entity_R_PDU &>( H );
+    case Start_Resume_R_PDU_Type:
+        return &static_cast<const Start_Resume_R_PDU &>( H );
+    case Stop_Freeze_R_PDU_Type:
+        return &static_cast<const Stop_Freeze_R_PDU &>( H );
+    case ActionRequest_R_PDU_Type:
+        return &static_cast<const Action_Request_R_PDU &>( H );
+    case DataQuery_R_PDU_Type:
+        return &static_cast<const Data_Query_R_PDU &>( H );
+    case SetData_R_PDU_Type:
+        return &static_cast<const Set_Data_R_PDU &>( H );
+    case SetRecord_R_PDU_Type:
+        return &static_cast<const Set_Record_R_PDU &>( H );
+    case RecordQuery_R_PDU_Type:
+        return &static_cast<const Record_Query_R_PDU &>( H );
+    default:
+        return 0;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+// The time interval of a periodic Data_Query in nanoseconds, 0 for any other PDU.
+static KUINT64 getInterval( const Header & H )
+{
+    if( H.GetPDUType() != Data_Query_PDU_Type && H.GetPDUType() != DataQuery_R_PDU_Type )return 0;
+
+    // Time stamp units are 3600 / 2^31 seconds.
+    const KUINT32 ui32Time = static_cast<const Data_Query_PDU &>( H ).GetTimeInterval().GetTime();
+    return ( KUINT64 )( ui32Time * ( 3600.0 / 2147483648.0 ) * 1e9 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 ReliableRequestManager::toTick( KUINT64 Now ) const
+{
+    return Now > m_ui64Start ? ( Now - m_ui64Start ) / m_ui64TickNS : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 ReliableRequestManager::find( KUINT32 ID ) const
+{
+    KUINT32 i = m_vBuckets[ID & ( m_vBuckets.size() - 1 )];
+    while( i && m_vRequests[i - 1].m_ui32ID != ID )
+    {
+        i = m_vRequests[i - 1].m_ui32NextInBucket;
+    }
+    return i;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 ReliableRequestManager::allocate( KUINT32 ID )
+{
+    KUINT32 i = m_ui32Free;
+    if( i )
+    {
+        m_ui32Free = m_vRequests[i - 1].m_ui32NextInBucket;
+    }
+    else
+    {
+        m_vRequests.push_back( RequestEntry() );
+        i = m_vRequests.size();
+    }
+    ++m_ui32Pending;
+
+    // Keep no more requests than buckets, request IDs are sequential so they spread evenly.
+    if( m_ui32Pending > m_vBuckets.size() )
+    {
+        m_vBuckets.assign( m_vBuckets.size() * 2, 0 );
+        const KUINT32 ui32Mask = m_vBuckets.size() - 1;
+        for( KUINT32 j = 0; j < m_vRequests.size(); ++j )
+        {
+            RequestEntry & E = m_vRequests[j];
+            if( !E.m_ui32ID || j + 1 == i )continue;
+            E.m_ui32NextInBucket = m_vBuckets[E.m_ui32ID & ui32Mask];
+            m_vBuckets[E.m_ui32ID & ui32Mask] = j + 1;
+        }
+    }
+
+    RequestEntry & E = m_vRequests[i - 1];
+    E.m_ui32ID = ID;
+    E.m_ui32NextInBucket = m_vBuckets[ID & ( m_vBuckets.size() - 1 )];
+    m_vBuckets[ID & ( m_vBuckets.size() - 1 )] = i;
+    return i;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReliableRequestManager::release( KUINT32 Index )
+{
+    RequestEntry & E = m_vRequests[Index - 1];
+
+    KUINT32 * pLink = &m_vBuckets[E.m_ui32ID & ( m_vBuckets.size() - 1 )];
+    while( *pLink != Index )
+    {
+        pLink = &m_vRequests[*pLink - 1].m_ui32NextInBucket;
+    }
+    *pLink = E.m_ui32NextInBucket;
+
+    // The data is cleared but its memory is kept for the next request.
+    E.m_ui32ID = 0;
+    E.m_pHandler = 0;
+    E.m_vData.clear();
+    E.m_ui32NextInBucket = m_ui32Free;
+    m_ui32Free = Index;
+    --m_ui32Pending;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReliableRequestManager::schedule( KUINT32 Index )
+{
+    RequestEntry & E = m_vRequests[Index - 1];
+    KUINT32 & ui32Head = m_vWheel[E.m_ui64Expiry & ( WHEEL_SIZE - 1 )];
+
+    E.m_ui32TimerPrev = 0;
+    E.m_ui32TimerNext = ui32Head;
+    if( ui32Head )m_vRequests[ui32Head - 1].m_ui32TimerPrev = Index;
+    ui32Head = Index;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReliableRequestManager::unschedule( KUINT32 Index )
+{
+    RequestEntry & E = m_vRequests[Index - 1];
+
+    if( E.m_ui32TimerPrev )
+    {
+        m_vRequests[E.m_ui32TimerPrev - 1].m_ui32TimerNext = E.m_ui32TimerNext;
+    }
+    else
+    {
+        m_vWheel[E.m_ui64Expiry & ( WHEEL_SIZE - 1 )] = E.m_ui32TimerNext;
+    }
+
+    if( E.m_ui32TimerNext )m_vRequests[E.m_ui32TimerNext - 1].m_ui32TimerPrev = E.m_ui32TimerPrev;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReliableRequestManager::complete( KUINT32 Index, ReliableRequestHandler::Result R, const Header * Response )
+{
+    const KUINT32 ui32ID = m_vRequests[Index - 1].m_ui32ID;
+    ReliableRequestHandler * pHandler = m_vRequests[Index - 1].m_pHandler;
+
+    // Release first, the handler may send or cancel requests.
+    unschedule( Index );
+    release( Index );
+
+    if( pHandler )pHandler->OnRequestComplete( ui32ID, R, Response );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+ReliableRequestManager::ReliableRequestManager( Connection & C, KUINT32 TickMS /* = 10 */ ) throw( KException ) :
+    m_Conn( C ),
+    m_ui32Free( 0 ),
+    m_ui32Pending( 0 ),
+    m_ui64Start( PDU_Statistics::GetTime() ),
+    m_ui64TickNS( ( KUINT64 )TickMS * 1000000 ),
+    m_ui64Tick( 0 ),
+    m_ui32NextID( 1 ),
+    m_ui32TimeoutMS( 1000 ),
+    m_ui32Retries( 3 ),
+    m_ui64Retransmissions( 0 ),
+    m_ui64Unmatched( 0 )
+{
+    if( !TickMS )throw KException( __FUNCTION__, INVALID_DATA, "The tick must not be 0" );
+
+    m_vBuckets.resize( 64, 0 );
+    m_vWheel.resize( WHEEL_SIZE, 0 );
+
+    fill( m_ui8ResponseTypes, m_ui8ResponseTypes + 256, 0 );
+    fill( m_bIsResponse, m_bIsResponse + 256, false );
+    SetResponseType( Create_Entity_PDU_Type, Acknowledge_PDU_Type );
+    SetResponseType( Remove_Entity_PDU_Type, Acknowledge_PDU_Type );
+    SetResponseType( Start_Resume_PDU_Type, Acknowledge_PDU_Type );
+    SetResponseType( Stop_Freeze_PDU_Type, Acknowledge_PDU_Type );
+    SetResponseType( Action_Request_PDU_Type, Action_Response_PDU_Type );
+    SetResponseType( Data_Query_PDU_Type, Data_PDU_Type );
+    SetResponseType( Set_Data_PDU_Type, Data_PDU_Type );
+    SetResponseType( CreateEntity_R_PDU_Type, Acknowledge_R_PDU_Type );
+    SetResponseType( RemoveEntity_R_PDU_Type, Acknowledge_R_PDU_Type );
+    SetResponseType( Start_Resume_R_PDU_Type, Acknowledge_R_PDU_Type );
+    SetResponseType( Stop_Freeze_R_PDU_Type, Acknowledge_R_PDU_Type );
+    SetResponseType( ActionRequest_R_PDU_Type, ActionResponse_R_PDU_Type );
+    SetResponseType( DataQuery_R_PDU_Type, Data_R_PDU_Type );
+    SetResponseType( SetData_R_PDU_Type, Data_R_PDU_Type );
+    SetResponseType( RecordQuery_R_PDU_Type, Record_R_PDU_Type );
+    SetResponseType( SetRecord_R_PDU_Type, Record_R_PDU_Type );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ReliableRequestManager::~ReliableRequestManager()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReliableRequestManager::SetTimeout( KUINT32 MS )
+{
+    m_ui32TimeoutMS = MS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 ReliableRequestManager::GetTimeout() const
+{
+    return m_ui32TimeoutMS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReliableRequestManager::SetRetries( KUINT32 R )
+{
+    m_ui32Retries = R;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 ReliableRequestManager::GetRetries() const
+{
+    return m_ui32Retries;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReliableRequestManager::SetResponseType( PDUType Request, PDUType Response )
+{
+    m_ui8ResponseTypes[( KUINT8 )Request] = Response;
+
+    fill( m_bIsResponse, m_bIsResponse + 256, false );
+    for( KUINT16 i = 0; i < 256; ++i )
+    {
+        if( m_ui8ResponseTypes[i] )m_bIsResponse[m_ui8ResponseTypes[i]] = true;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+PDUType ReliableRequestManager::GetResponseType( PDUType Request ) const
+{
+    return ( PDUType )m_ui8ResponseTypes[( KUINT8 )Request];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 ReliableRequestManager::Send( Header & R, ReliableRequestHandler * H /* = 0 */,
+                                      KUINT32 TimeoutMS /* = 0 */, KINT32 Retries /* = -1 */ ) throw( KException )
+{
+    const KUINT8 ui8ResponseType = m_ui8ResponseTypes[R.GetPDUType()];
+    if( !ui8ResponseType )throw KException( __FUNCTION__, INVALID_DATA, "The PDU type is not a request" );
+
+    KUINT32 ui32ID = 0;
+    do
+    {
+        ui32ID = m_ui32NextID++;
+    }
+    while( !ui32ID || find( ui32ID ) );
+
+    setRequestID( R, ui32ID );
+
+    KDataStream stream;
+    R.Encode( stream );
+
+    const Reliability_Header * pRH = getReliabilityHeader( R );
+    if( pRH && pRH->GetRequiredReliabilityService() == Unacknowledged )
+    {
+        m_Conn.Send( stream );
+        return ui32ID;
+    }
+
+    const KUINT64 ui64IntervalNS = getInterval( R );
+    const KUINT64 ui64TimeoutNS = ( KUINT64 )( TimeoutMS ? TimeoutMS : m_ui32TimeoutMS ) * 1000000 + ui64IntervalNS;
+    KUINT64 ui64TimeoutTicks = ( ui64TimeoutNS + m_ui64TickNS - 1 ) / m_ui64TickNS;
+    if( !ui64TimeoutTicks )ui64TimeoutTicks = 1;
+
+    const KUINT32 i = allocate( ui32ID );
+    RequestEntry & E = m_vRequests[i - 1];
+    E.m_ui8ResponseType = ui8ResponseType;
+    E.m_Originator = static_cast<const Simulation_Management_Header &>( R ).GetOriginatingEntityID();
+    E.m_ui32Retries = !pRH ? 0 : Retries < 0 ? m_ui32Retries : Retries;
+    E.m_ui32TimeoutTicks = ui64TimeoutTicks;
+    E.m_bPeriodic = ui64IntervalNS != 0;
+    E.m_ui64Expiry = max( toTick( PDU_Statistics::GetTime() ), m_ui64Tick ) + ui64TimeoutTicks;
+    E.m_pHandler = H;
+    E.m_vData.assign( stream.GetBufferPtr(), stream.GetBufferPtr() + stream.GetBufferSize() );
+    schedule( i );
+
+    try
+    {
+        m_Conn.Send( &E.m_vData[0], E.m_vData.size() );
+    }
+    catch( KException & )
+    {
+        unschedule( i );
+        release( i );
+        throw;
+    }
+
+    return ui32ID;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL ReliableRequestManager::Cancel( KUINT32 RequestID )
+{
+    const KUINT32 i = RequestID ? find( RequestID ) : 0;
+    if( !i )return false;
+
+    complete( i, ReliableRequestHandler::Cancelled, 0 );
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReliableRequestManager::CancelAll()
+{
+    // Requests sent by the handlers are left alone.
+    const KUINT32 ui32Size = m_vRequests.size();
+    for( KUINT32 i = 1; i <= ui32Size; ++i )
+    {
+        if( m_vRequests[i - 1].m_ui32ID )complete( i, ReliableRequestHandler::Cancelled, 0 );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL ReliableRequestManager::HandlePDU( const Header & H )
+{
+    if( !m_bIsResponse[H.GetPDUType()] )return false;
+
+    KUINT32 ui32ID = 0;
+    if( !getRequestID( H, ui32ID ) )return false;
+
+    const KUINT32 i = ui32ID ? find( ui32ID ) : 0;
+    if( !i || m_vRequests[i - 1].m_ui8ResponseType != H.GetPDUType() ||
+        m_vRequests[i - 1].m_Originator != static_cast<const Simulation_Management_Header &>( H ).GetReceivingEntityID() )
+    {
+        ++m_ui64Unmatched;
+        return false;
+    }
+
+    RequestEntry & E = m_vRequests[i - 1];
+    if( !E.m_bPeriodic )
+    {
+        complete( i, ReliableRequestHandler::Responded, &H );
+        return true;
+    }
+
+    // A periodic query has been answered so it is not sent again, its timeout restarts with each Data PDU.
+    E.m_ui32Retries = 0;
+    unschedule( i );
+    E.m_ui64Expiry = max( toTick( PDU_Statistics::GetTime() ), m_ui64Tick ) + E.m_ui32TimeoutTicks;
+    schedule( i );
+
+    if( E.m_pHandler )E.m_pHandler->OnRequestUpdate( ui32ID, H );
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 ReliableRequestManager::Process() throw( KException )
+{
+    return Process( PDU_Statistics::GetTime() );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 ReliableRequestManager::Process( KUINT64 Now ) throw( KException )
+{
+    const KUINT64 ui64Now = toTick( Now );
+
+    // Gather the expired requests first, handlers may change the wheel.
+    m_vExpired.clear();
+    while( m_ui64Tick < ui64Now )
+    {
+        ++m_ui64Tick;
+
+        // After a long gap each slot only needs to be visited once.
+        if( ui64Now - m_ui64Tick >= WHEEL_SIZE )m_ui64Tick = ui64Now - WHEEL_SIZE + 1;
+
+        for( KUINT32 i = m_vWheel[m_ui64Tick & ( WHEEL_SIZE - 1 )]; i; i = m_vRequests[i - 1].m_ui32TimerNext )
+        {
+            if( m_vRequests[i - 1].m_ui64Expiry <= m_ui64Tick )
+            {
+                m_vExpired.push_back( make_pair( i, m_vRequests[i - 1].m_ui32ID ) );
+            }
+        }
+    }
+
+    KUINT32 ui32Count = 0;
+    for( KUINT32 j = 0; j < m_vExpired.size(); ++j )
+    {
+        const KUINT32 i = m_vExpired[j].first;
+
+        // Skip requests a handler has completed or cancelled.
+        if( m_vRequests[i - 1].m_ui32ID != m_vExpired[j].second )continue;
+        ++ui32Count;
+
+        RequestEntry & E = m_vRequests[i - 1];
+        if( !E.m_ui32Retries )
+        {
+            complete( i, ReliableRequestHandler::TimedOut, 0 );
+            continue;
+        }
+
+        --E.m_ui32Retries;
+        ++m_ui64Retransmissions;
+        unschedule( i );
+        E.m_ui64Expiry = ui64Now + E.m_ui32TimeoutTicks;
+        schedule( i );
+        m_Conn.Send( &E.m_vData[0], E.m_vData.size() );
+    }
+
+    return ui32Count;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL ReliableRequestManager::IsPending( KUINT32 RequestID ) const
+{
+    return RequestID && find( RequestID );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 ReliableRequestManager::GetPendingCount() const
+{
+    return m_ui32Pending;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 ReliableRequestManager::GetRetransmissionCount() const
+{
+    return m_ui64Retransmissions;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 ReliableRequestManager::GetUnmatchedCount() const
+{
+    return m_ui64Unmatched;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ReliableRequestManager::OnPDUReceived( const Header * H )
+{
+    if( H )HandlePDU( *H );
+}
+
+//////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,313 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      ReliableRequestManager
+    created:    19/10/2026
+
+    purpose:    Request/response correlation for the simulation management PDU, with
+                acknowledgement and retransmission for the simulation management with
+                reliability (_R) PDU. Each request sent through the manager is given a
+                request ID and is kept until the matching response arrives:
+
+                    Create_Entity(_R), Remove_Entity(_R),
+                    Start_Resume(_R), Stop_Freeze(_R) -> Acknowledge(_R)
+                    Action_Request(_R)                -> Action_Response(_R)
+                    Data_Query(_R), Set_Data(_R)      -> Data(_R)
+                    Record_Query_R, Set_Record_R      -> Record_R
+
+                A request that is not answered within its timeout fails. An _R request whose
+                required reliability service is Acknowledged is first sent again until its
+                retries are used up, one that is Unacknowledged is not tracked at all.
+                A Data_Query with a time interval asks for periodic Data PDU, it stays pending
+                and each Data PDU is passed to the handler until the data stops arriving or the
+                query is cancelled. The outcome is passed to the request's handler. Outstanding requests are held in a hash table keyed by request ID
+                and their timeouts in a timer wheel, so matching a response and processing
+                the timers costs the same with one or thousands of requests in flight.
+
+                Add the manager to the Connection as a subscriber, or pass it each received
+                PDU with HandlePDU, and call Process regularly to run the timers.
+                Note: Not thread safe, call from the thread that receives the PDU.
+*********************************************************************/
+
+#pragma once
+
+#include "./Connection.h"
+#include "./../DataTypes/EntityIdentifier.h"
+#include <vector>
+
+namespace KDIS {
+namespace NETWORK {
+
+//////////////////////////////////////////////////////////////////////////
+// The outcome of a request sent by the ReliableRequestManager.         //
+//////////////////////////////////////////////////////////////////////////
+class KDIS_EXPORT ReliableRequestHandler
+{
+public:
+
+    enum Result
+    {
+        Responded,
+        TimedOut,
+        Cancelled
+    };
+
+    ReliableRequestHandler() {};
+
+    virtual ~ReliableRequestHandler() {};
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReliableRequestHandler::OnRequestUpdate
+    // Description: Called for each Data PDU answering a periodic Data_Query.
+    // Parameter:   KUINT32 RequestID
+    // Parameter:   const Header & Response
+    //************************************
+    virtual void OnRequestUpdate( KUINT32 /*RequestID*/, const KDIS::PDU::Header & /*Response*/ ) {};
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReliableRequestHandler::OnRequestComplete
+    // Description: Called once for each request. Response is the matching PDU when R is
+    //              Responded, else NULL. Periodic queries complete with TimedOut or Cancelled.
+    // Parameter:   KUINT32 RequestID
+    // Parameter:   Result R
+    // Parameter:   const Header * Response
+    //************************************
+    virtual void OnRequestComplete( KUINT32 RequestID, Result R, const KDIS::PDU::Header * Response ) = 0;
+};
+
+class KDIS_EXPORT ReliableRequestManager : public ConnectionSubscriber
+{
+public:
+
+    static const KUINT32 WHEEL_SIZE = 256;
+
+protected:
+
+    struct RequestEntry
+    {
+        KUINT32 m_ui32ID;
+        KUINT8 m_ui8ResponseType;
+        KDIS::DATA_TYPE::EntityIdentifier m_Originator;
+        KUINT32 m_ui32Retries;
+        KUINT32 m_ui32TimeoutTicks;
+        KUINT64 m_ui64Expiry;
+        KBOOL m_bPeriodic;
+        ReliableRequestHandler * m_pHandler;
+        std::vector<KOCTET> m_vData;
+
+        // Links are pool index + 1, 0 ends the list.
+        KUINT32 m_ui32NextInBucket;
+        KUINT32 m_ui32TimerPrev;
+        KUINT32 m_ui32TimerNext;
+    };
+
+    Connection & m_Conn;
+
+    // Request pool, free entries are chained through m_ui32NextInBucket.
+    std::vector<RequestEntry> m_vRequests;
+    KUINT32 m_ui32Free;
+    KUINT32 m_ui32Pending;
+
+    // Hash table of request ID to pool index + 1, the size is a power of 2.
+    std::vector<KUINT32> m_vBuckets;
+
+    // Timer wheel, each slot lists the requests expiring on ticks that map to it.
+    std::vector<KUINT32> m_vWheel;
+    KUINT64 m_ui64Start;
+    KUINT64 m_ui64TickNS;
+    KUINT64 m_ui64Tick;
+
+    KUINT32 m_ui32NextID;
+    KUINT32 m_ui32TimeoutMS;
+    KUINT32 m_ui32Retries;
+
+    // The response type of each request type, 0 if it is not a request.
+    KUINT8 m_ui8ResponseTypes[256];
+    KBOOL m_bIsResponse[256];
+
+    // Requests whose timeout has passed, gathered before any is handled. Pool index + 1 and ID.
+    std::vector<std::pair<KUINT32, KUINT32> > m_vExpired;
+
+    KUINT64 m_ui64Retransmissions;
+    KUINT64 m_ui64Unmatched;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReliableRequestManager::toTick
+    // Description: Converts a time from PDU_Statistics::GetTime to a wheel tick.
+    // Parameter:   KUINT64 Now
+    //************************************
+    KUINT64 toTick( KUINT64 Now ) const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReliableRequestManager::find
+    //              KDIS::NETWORK::ReliableRequestManager::allocate
+    //              KDIS::NETWORK::ReliableRequestManager::release
+    // Description: Pool and hash table management, indexes are pool index + 1.
+    // Parameter:   KUINT32 ID, KUINT32 Index
+    //************************************
+    KUINT32 find( KUINT32 ID ) const;
+    KUINT32 allocate( KUINT32 ID );
+    void release( KUINT32 Index );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReliableRequestManager::schedule
+    //              KDIS::NETWORK::ReliableRequestManager::unschedule
+    // Description: Adds/Removes a request to/from the timer wheel.
+    // Parameter:   KUINT32 Index
+    //************************************
+    void schedule( KUINT32 Index );
+    void unschedule( KUINT32 Index );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReliableRequestManager::complete
+    // Description: Removes a request and calls its handler.
+    // Parameter:   KUINT32 Index
+    // Parameter:   ReliableRequestHandler::Result R
+    // Parameter:   const Header * Response
+    //************************************
+    void complete( KUINT32 Index, ReliableRequestHandler::Result R, const KDIS::PDU::Header * Response );
+
+private:
+
+    ReliableRequestManager( const ReliableRequestManager & );
+    ReliableRequestManager & operator = ( const ReliableRequestManager & );
+
+public:
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReliableRequestManager::ReliableRequestManager
+    // Description: Requests are sent with C. Timeouts are rounded up to whole ticks of TickMS.
+    // Parameter:   Connection & C
+    // Parameter:   KUINT32 TickMS
+    //************************************
+    ReliableRequestManager( Connection & C, KUINT32 TickMS = 10 ) throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReliableRequestManager::~ReliableRequestManager
+    // Description: Outstanding requests are discarded without calling their handlers.
+    //************************************
+    virtual ~ReliableRequestManager();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReliableRequestManager::SetTimeout
+    //              KDIS::NETWORK::ReliableRequestManager::GetTimeout
+    //              KDIS::NETWORK::ReliableRequestManager::SetRetries
+    //              KDIS::NETWORK::ReliableRequestManager::GetRetries
+    // Description: The time to wait for a response before sending a request again and the
+    //              number of times it is sent again before it fails. Used by requests sent
+    //              without their own values. Default 1000 ms and 3.
+    // Parameter:   KUINT32 MS, KUINT32 R
+    //************************************
+    void SetTimeout( KUINT32 MS );
+    KUINT32 GetTimeout() const;
+    void SetRetries( KUINT32 R );
+    KUINT32 GetRetries() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReliableRequestManager::SetResponseType
+    //              KDIS::NETWORK::ReliableRequestManager::GetResponseType
+    // Description: The PDU type that answers a request type, Other_PDU_Type if the type
+    //              can not be sent as a request.
+    // Parameter:   PDUType Request
+    // Parameter:   PDUType Response
+    //************************************
+    void SetResponseType( KDIS::DATA_TYPE::ENUMS::PDUType Request, KDIS::DATA_TYPE::ENUMS::PDUType Response );
+    KDIS::DATA_TYPE::ENUMS::PDUType GetResponseType( KDIS::DATA_TYPE::ENUMS::PDUType Request ) const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReliableRequestManager::Send
+    // Description: Sets a new request ID in the request, sends it and returns the ID.
+    //              A response matches when it has the ID and the request's originating entity
+    //              as its receiving entity.
+    //              Unacknowledged _R requests are sent once and not tracked, H is never called.
+    //              PDU without a reliability service are never sent again.
+    //              A periodic Data_Query times out when no Data PDU arrives within its timeout
+    //              plus its time interval.
+    //              Throws INVALID_DATA if the PDU type has no response type.
+    //              Note: Requests are sent with Connection::Send, subscribers are not notified.
+    // Parameter:   Header & R
+    // Parameter:   ReliableRequestHandler * H - Optional handler for the outcome.
+    // Parameter:   KUINT32 TimeoutMS - 0 uses GetTimeout.
+    // Parameter:   KINT32 Retries - Negative uses GetRetries.
+    //************************************
+    KUINT32 Send( KDIS::PDU::Header & R, ReliableRequestHandler * H = 0,
+                  KUINT32 TimeoutMS = 0, KINT32 Retries = -1 ) throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReliableRequestManager::Cancel
+    //              KDIS::NETWORK::ReliableRequestManager::CancelAll
+    // Description: Stops tracking requests, their handlers are called with Cancelled.
+    //              Returns false if the request is not outstanding.
+    // Parameter:   KUINT32 RequestID
+    //************************************
+    KBOOL Cancel( KUINT32 RequestID );
+    void CancelAll();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReliableRequestManager::HandlePDU
+    // Description: Completes the request a response answers. Returns true if the PDU
+    //              matched an outstanding request.
+    // Parameter:   const Header & H
+    //************************************
+    KBOOL HandlePDU( const KDIS::PDU::Header & H );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReliableRequestManager::Process
+    // Description: Sends again or fails the requests whose timeout has passed.
+    //              Returns the number of requests that were sent again or failed.
+    // Parameter:   KUINT64 Now - Time from PDU_Statistics::GetTime.
+    //************************************
+    KUINT32 Process() throw( KException );
+    KUINT32 Process( KUINT64 Now ) throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReliableRequestManager::IsPending
+    //              KDIS::NETWORK::ReliableRequestManager::GetPendingCount
+    // Description: Outstanding requests.
+    // Parameter:   KUINT32 RequestID
+    //************************************
+    KBOOL IsPending( KUINT32 RequestID ) const;
+    KUINT32 GetPendingCount() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::ReliableRequestManager::GetRetransmissionCount
+    //              KDIS::NETWORK::ReliableRequestManager::GetUnmatchedCount
+    // Description: Requests sent again and responses that matched no outstanding request,
+    //              such as a second acknowledgement of a request that was sent twice.
+    //************************************
+    KUINT64 GetRetransmissionCount() const;
+    KUINT64 GetUnmatchedCount() const;
+
+    // ConnectionSubscriber interface.
+    virtual void OnPDUReceived( const KDIS::PDU::Header * H );
+};
+
+} // END namespace NETWORK
+} // END namespace KDIS
@@ -0,0 +1,436 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./SharedMemoryRing.h"
+#include <cstring>
+
+#if !( defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 ) )
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <errno.h>
+#include <sched.h>
+#if defined( __linux__ )
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <climits>
+#endif
+#endif
+
+using namespace KDIS;
+using namespace NETWORK;
+
+static const KUINT32 RING_MAGIC = 0x4B524E47; // KRNG
+
+// How long a writer waits for the previous writer of its slot before assuming it died.
+static const KUINT64 CLAIM_TAKEOVER_US = 1000000;
+
+//////////////////////////////////////////////////////////////////////////
+
+#if !( defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 ) )
+
+// The largest ring that can be mapped, mmap takes a size_t and ftruncate an off_t.
+static KUINT64 mapLimit()
+{
+    const KUINT64 ui64SizeT = ( KUINT64 )( ( size_t )-1 );
+    const KUINT64 ui64OffT = ( ( KUINT64 )1 << ( sizeof( off_t ) * 8 - 1 ) ) - 1;
+    return ui64SizeT < ui64OffT ? ui64SizeT : ui64OffT;
+}
+
+// The ring is shared between processes so only lock free atomics are used.
+static KUINT64 loadAcquire( KUINT64 * P )
+{
+#if defined( __ATOMIC_ACQUIRE )
+    return __atomic_load_n( P, __ATOMIC_ACQUIRE );
+#else
+    return __sync_fetch_and_add( P, 0 );
+#endif
+}
+
+static KUINT32 loadAcquire( KUINT32 * P )
+{
+#if defined( __ATOMIC_ACQUIRE )
+    return __atomic_load_n( P, __ATOMIC_ACQUIRE );
+#else
+    return __sync_fetch_and_add( P, 0 );
+#endif
+}
+
+static void storeRelease( KUINT64 * P, KUINT64 V )
+{
+#if defined( __ATOMIC_RELEASE )
+    __atomic_store_n( P, V, __ATOMIC_RELEASE );
+#else
+    __sync_synchronize();
+    *( volatile KUINT64 * )P = V;
+#endif
+}
+
+static void storeRelease( KUINT32 * P, KUINT32 V )
+{
+#if defined( __ATOMIC_RELEASE )
+    __atomic_store_n( P, V, __ATOMIC_RELEASE );
+#else
+    __sync_synchronize();
+    *( volatile KUINT32 * )P = V;
+#endif
+}
+
+static KUINT64 getMonotonicTimeUS()
+{
+    timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ( KUINT64 )ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+SharedMemoryRing::Slot & SharedMemoryRing::getSlot( KUINT64 Position )
+{
+    return m_pSlots[Position % m_pHeader->m_ui32SlotCount];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void SharedMemoryRing::wait( KUINT32 Signal, KINT32 TimeoutUS )
+{
+#if defined( __linux__ )
+    // Writers only wake when there are waiters. Both sides use full barriers so either the
+    // writer sees the waiter or the futex sees the new signal.
+    __sync_fetch_and_add( &m_pHeader->m_ui32Waiters, 1 );
+
+    timespec ts;
+    ts.tv_sec = TimeoutUS / 1000000;
+    ts.tv_nsec = ( TimeoutUS % 1000000 ) * 1000;
+    syscall( SYS_futex, &m_pHeader->m_ui32Signal, FUTEX_WAIT, Signal, TimeoutUS < 0 ? 0 : &ts, 0, 0 );
+
+    __sync_fetch_and_sub( &m_pHeader->m_ui32Waiters, 1 );
+#elif !( defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 ) )
+    timespec ts;
+    ts.tv_sec = 0;
+    ts.tv_nsec = ( TimeoutUS >= 0 && TimeoutUS < 100 ? TimeoutUS : 100 ) * 1000;
+    nanosleep( &ts, 0 );
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void SharedMemoryRing::close()
+{
+#if !( defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 ) )
+    if( m_pHeader )munmap( m_pHeader, ( size_t )m_ui64MapSize );
+    if( m_iFd >= 0 )::close( m_iFd );
+#endif
+    m_pHeader = 0;
+    m_pSlots = 0;
+    m_iFd = -1;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+SharedMemoryRing::SharedMemoryRing( const KString & Name, KUINT32 Slots /* = DEFAULT_SLOTS */, KUINT32 Mode /* = 0600 */ ) throw( KException ) :
+    m_sName( Name.empty() || Name[0] != '/' ? "/" + Name : Name ),
+    m_iFd( -1 ),
+    m_ui64MapSize( 0 ),
+    m_pHeader( 0 ),
+    m_pSlots( 0 ),
+    m_ui64ReadPos( 0 ),
+    m_ui64Dropped( 0 )
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    throw KException( __FUNCTION__, INVALID_OPERATION, "Shared memory rings are not supported on this platform" );
+#else
+    if( !Slots )throw KException( __FUNCTION__, INVALID_DATA, "The ring needs at least 1 slot" );
+
+    const KUINT64 ui64CreateSize = sizeof( RingHeader ) + ( KUINT64 )Slots * sizeof( Slot );
+    if( ui64CreateSize > mapLimit() )throw KException( __FUNCTION__, INVALID_DATA, "The ring is too large to map" );
+
+    KBOOL bCreator = true;
+    m_iFd = shm_open( m_sName.c_str(), O_RDWR | O_CREAT | O_EXCL, ( mode_t )Mode );
+    if( m_iFd < 0 && errno == EEXIST )
+    {
+        bCreator = false;
+        m_iFd = shm_open( m_sName.c_str(), O_RDWR, 0 );
+    }
+    if( m_iFd < 0 )throw KException( __FUNCTION__, CONNECTION_SOCKET_ERROR, strerror( errno ) );
+
+    if( bCreator )
+    {
+        m_ui64MapSize = ui64CreateSize;
+        if( ftruncate( m_iFd, ( off_t )m_ui64MapSize ) != 0 )
+        {
+            close();
+            shm_unlink( m_sName.c_str() );
+            throw KException( __FUNCTION__, CONNECTION_SOCKET_ERROR, strerror( errno ) );
+        }
+    }
+    else
+    {
+        // The creator may not have sized it yet.
+        struct stat st;
+        for( KUINT32 i = 0; i < 1000; ++i )
+        {
+            if( fstat( m_iFd, &st ) != 0 || st.st_size >= ( off_t )sizeof( RingHeader ) )break;
+            usleep( 1000 );
+        }
+        if( st.st_size < ( off_t )sizeof( RingHeader ) )
+        {
+            close();
+            throw KException( __FUNCTION__, INVALID_DATA, "The shared memory is not a ring" );
+        }
+        if( ( KUINT64 )st.st_size > mapLimit() )
+        {
+            close();
+            throw KException( __FUNCTION__, INVALID_DATA, "The ring is too large to map" );
+        }
+        m_ui64MapSize = st.st_size;
+    }
+
+    void * pMap = mmap( 0, ( size_t )m_ui64MapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_iFd, 0 );
+    if( pMap == MAP_FAILED )
+    {
+        m_ui64MapSize = 0;
+        close();
+        throw KException( __FUNCTION__, CONNECTION_SOCKET_ERROR, strerror( errno ) );
+    }
+
+    m_pHeader = ( RingHeader * )pMap;
+    m_pSlots = ( Slot * )( ( KOCTET * )pMap + sizeof( RingHeader ) );
+
+    if( bCreator )
+    {
+        // The memory is zeroed so all slots are empty.
+        m_pHeader->m_ui32SlotCount = Slots;
+        m_pHeader->m_ui32SlotSize = SLOT_SIZE;
+        storeRelease( &m_pHeader->m_ui32Magic, RING_MAGIC );
+    }
+    else
+    {
+        for( KUINT32 i = 0; i < 1000 && loadAcquire( &m_pHeader->m_ui32Magic ) != RING_MAGIC; ++i )
+        {
+            usleep( 1000 );
+        }
+
+        if( loadAcquire( &m_pHeader->m_ui32Magic ) != RING_MAGIC || m_pHeader->m_ui32SlotSize != SLOT_SIZE ||
+            sizeof( RingHeader ) + ( KUINT64 )m_pHeader->m_ui32SlotCount * sizeof( Slot ) > m_ui64MapSize )
+        {
+            close();
+            throw KException( __FUNCTION__, INVALID_DATA, "The shared memory is not a compatible ring" );
+        }
+    }
+
+    // Like joining a group, only what is written from now on is received.
+    m_ui64ReadPos = loadAcquire( &m_pHeader->m_ui64WriteIndex );
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+SharedMemoryRing::~SharedMemoryRing()
+{
+    close();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void SharedMemoryRing::Remove( const KString & Name )
+{
+#if !( defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 ) )
+    shm_unlink( ( Name.empty() || Name[0] != '/' ? "/" + Name : Name ).c_str() );
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const KString & SharedMemoryRing::GetName() const
+{
+    return m_sName;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 SharedMemoryRing::GetSlotCount() const
+{
+    return m_pHeader ? m_pHeader->m_ui32SlotCount : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KOCTET * SharedMemoryRing::Claim( KUINT64 & Position )
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    return 0;
+#else
+    Position = __sync_fetch_and_add( &m_pHeader->m_ui64WriteIndex, 1 );
+
+    // The slot is free once the position a lap behind has been published, or it was never used.
+    // A writer that laps a slower one waits here rather than writing into the same slot.
+    Slot & s = getSlot( Position );
+    const KUINT64 ui64Slots = m_pHeader->m_ui32SlotCount;
+    const KUINT64 ui64Free = Position < ui64Slots ? 0 : ( Position - ui64Slots ) * 2 + 2;
+    KUINT64 ui64Deadline = 0;
+
+    for( ;; )
+    {
+        if( __sync_bool_compare_and_swap( &s.m_ui64Sequence, ui64Free, Position * 2 + 1 ) )break;
+
+        const KUINT64 ui64Now = getMonotonicTimeUS();
+        if( !ui64Deadline )
+        {
+            ui64Deadline = ui64Now + CLAIM_TAKEOVER_US;
+        }
+        else if( ui64Now >= ui64Deadline )
+        {
+            // The previous writer never published, it most likely died between Claim and Publish.
+            const KUINT64 ui64Seq = loadAcquire( &s.m_ui64Sequence );
+            if( ui64Seq < Position * 2 && __sync_bool_compare_and_swap( &s.m_ui64Sequence, ui64Seq, Position * 2 + 1 ) )break;
+        }
+
+        sched_yield();
+    }
+
+    return s.m_Data;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void SharedMemoryRing::Publish( KUINT64 Position, KUINT32 Size )
+{
+#if !( defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 ) )
+    Slot & s = getSlot( Position );
+    s.m_ui32Size = Size;
+    storeRelease( &s.m_ui64Sequence, Position * 2 + 2 );
+
+    __sync_fetch_and_add( &m_pHeader->m_ui32Signal, 1 );
+    #if defined( __linux__ )
+    if( __sync_fetch_and_add( &m_pHeader->m_ui32Waiters, 0 ) )
+    {
+        syscall( SYS_futex, &m_pHeader->m_ui32Signal, FUTEX_WAKE, INT_MAX, 0, 0, 0 );
+    }
+    #endif
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void SharedMemoryRing::Write( const KOCTET * Data, KUINT32 Size ) throw( KException )
+{
+    if( Size > SLOT_SIZE )throw KException( __FUNCTION__, PDU_TOO_LARGE );
+
+    KUINT64 ui64Pos = 0;
+    KOCTET * pSlot = Claim( ui64Pos );
+    memcpy( pSlot, Data, Size );
+    Publish( ui64Pos, Size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 SharedMemoryRing::Read( KOCTET * Buffer, KUINT32 BufferSz, KINT32 TimeoutUS )
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    return 0;
+#else
+    const KUINT64 ui64Slots = m_pHeader->m_ui32SlotCount;
+    const KUINT64 ui64Deadline = TimeoutUS > 0 ? getMonotonicTimeUS() + TimeoutUS : 0;
+
+    for( ;; )
+    {
+        // Taken before checking so a write in between changes it and the wait returns.
+        const KUINT32 ui32Signal = loadAcquire( &m_pHeader->m_ui32Signal );
+        const KUINT64 ui64Write = loadAcquire( &m_pHeader->m_ui64WriteIndex );
+
+        // Lapped, skip to the oldest datagram still in the ring.
+        if( ui64Write > m_ui64ReadPos + ui64Slots )
+        {
+            m_ui64Dropped += ui64Write - ui64Slots - m_ui64ReadPos;
+            m_ui64ReadPos = ui64Write - ui64Slots;
+        }
+
+        if( m_ui64ReadPos < ui64Write )
+        {
+            Slot & s = getSlot( m_ui64ReadPos );
+            const KUINT64 ui64Expected = m_ui64ReadPos * 2 + 2;
+            const KUINT64 ui64Seq = loadAcquire( &s.m_ui64Sequence );
+
+            if( ui64Seq == ui64Expected )
+            {
+                KUINT32 ui32Size = s.m_ui32Size;
+                if( ui32Size > BufferSz )ui32Size = BufferSz;
+                memcpy( Buffer, s.m_Data, ui32Size );
+
+                // A writer may have reused the slot while we copied.
+                __sync_synchronize();
+                if( loadAcquire( &s.m_ui64Sequence ) == ui64Expected )
+                {
+                    ++m_ui64ReadPos;
+                    return ui32Size;
+                }
+                continue;
+            }
+
+            // Already overwritten, the write index shows how far on the next pass.
+            if( ui64Seq > ui64Expected )continue;
+
+            // Otherwise the datagram is still being written, wait for it to be published.
+        }
+
+        KINT32 iWait = TimeoutUS;
+        if( TimeoutUS > 0 )
+        {
+            const KUINT64 ui64Now = getMonotonicTimeUS();
+            if( ui64Now >= ui64Deadline )return 0;
+            iWait = ( KINT32 )( ui64Deadline - ui64Now );
+        }
+        else if( TimeoutUS == 0 )
+        {
+            return 0;
+        }
+
+        wait( ui32Signal, iWait );
+    }
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 SharedMemoryRing::GetDroppedCount() const
+{
+    return m_ui64Dropped;
+}
+
+//////////////////////////////////////////////////////////////////////////
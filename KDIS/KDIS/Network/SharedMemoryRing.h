@@ -0,0 +1,193 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      SharedMemoryRing
+    created:    19/10/2026
+
+    purpose:    A ring of datagrams in POSIX shared memory for exchanging PDU between
+                processes on the same host without the network stack.
+                Any number of processes can write to and read from the ring. Each reader
+                has its own position and receives every datagram written after it opened
+                the ring, as it would from a multicast group. Writers never wait for readers,
+                a reader that falls a whole ring behind loses the oldest datagrams, these
+                are counted in GetDroppedCount. Waiting readers are woken with a futex on
+                Linux, elsewhere they poll.
+
+                A writer only waits when the writer of the same slot a lap earlier has not
+                published yet, so two writers never write into one slot.
+                Note: A writer that dies between Claim and Publish stalls the readers at its
+                position until they are lapped, and the writer of the same slot on the next
+                lap for up to a second before it takes the slot over.
+
+                The ring is created by the first process that opens the name and stays
+                until Remove is called, even when no process has it open.
+                Note: Not supported on Windows, the constructor throws INVALID_OPERATION.
+*********************************************************************/
+
+#pragma once
+
+#include "./../KDefines.h"
+
+namespace KDIS {
+namespace NETWORK {
+
+class KDIS_EXPORT SharedMemoryRing
+{
+public:
+
+    static const KUINT32 DEFAULT_SLOTS = 1024;
+    static const KUINT32 SLOT_SIZE = MAX_PDU_SIZE;
+
+protected:
+
+    // Shared by all processes at the start of the memory.
+    struct RingHeader
+    {
+        KUINT32 m_ui32Magic;       // Set last by the creator.
+        KUINT32 m_ui32SlotCount;
+        KUINT32 m_ui32SlotSize;
+        KUINT32 m_ui32Signal;      // Incremented on each write, readers wait on it.
+        KUINT32 m_ui32Waiters;
+        KUINT32 m_ui32Padding[11];
+        KUINT64 m_ui64WriteIndex;  // The next position to claim, on its own cache line.
+        KUINT64 m_ui64Padding[7];
+    };
+
+    // A slot holds position P when its sequence is 2P + 2, it is odd while being written.
+    struct Slot
+    {
+        KUINT64 m_ui64Sequence;
+        KUINT32 m_ui32Size;
+        KUINT32 m_ui32Padding;
+        KOCTET m_Data[SLOT_SIZE];
+    };
+
+    KString m_sName;
+    KINT32 m_iFd;
+    KUINT64 m_ui64MapSize;
+    RingHeader * m_pHeader;
+    Slot * m_pSlots;
+
+    KUINT64 m_ui64ReadPos;
+    KUINT64 m_ui64Dropped;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::SharedMemoryRing::getSlot
+    // Description: The slot a position maps to.
+    // Parameter:   KUINT64 Position
+    //************************************
+    Slot & getSlot( KUINT64 Position );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::SharedMemoryRing::wait
+    // Description: Waits until the signal differs from Signal or the timeout passes.
+    // Parameter:   KUINT32 Signal
+    // Parameter:   KINT32 TimeoutUS
+    //************************************
+    void wait( KUINT32 Signal, KINT32 TimeoutUS );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::SharedMemoryRing::close
+    // Description: Unmaps the ring.
+    //************************************
+    void close();
+
+public:
+
+    //************************************
+    // FullName:    KDIS::NETWORK::SharedMemoryRing::SharedMemoryRing
+    // Description: Opens the named ring, creating it if it does not exist yet.
+    //              If it exists its own slot count is used.
+    //              Throws INVALID_DATA if the ring would be too large to map.
+    // Parameter:   const KString & Name - e.g "/kdis_exercise1"
+    // Parameter:   KUINT32 Slots - the number of datagrams the ring holds when created.
+    // Parameter:   KUINT32 Mode - the permissions of the shared memory when created, owner only by default.
+    //              Use 0660 or 0666 to share the ring with processes run by other users.
+    //************************************
+    SharedMemoryRing( const KString & Name, KUINT32 Slots = DEFAULT_SLOTS, KUINT32 Mode = 0600 ) throw( KException );
+
+    virtual ~SharedMemoryRing();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::SharedMemoryRing::Remove
+    // Description: Removes the named ring. Processes that have it open keep using it, the next one
+    //              to open the name creates a new ring.
+    // Parameter:   const KString & Name
+    //************************************
+    static void Remove( const KString & Name );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::SharedMemoryRing::GetName
+    //              KDIS::NETWORK::SharedMemoryRing::GetSlotCount
+    // Description: The name of the ring and the number of datagrams it holds.
+    //************************************
+    const KString & GetName() const;
+    KUINT32 GetSlotCount() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::SharedMemoryRing::Claim
+    //              KDIS::NETWORK::SharedMemoryRing::Publish
+    // Description: Writes a datagram in place. Claim returns the slot to write up to SLOT_SIZE octets
+    //              to and its position, Publish makes the datagram visible to the readers.
+    //              Every claimed position must be published, readers wait for it in order.
+    //              Claim waits while the slot is still being written by a writer a lap behind.
+    // Parameter:   KUINT64 & Position
+    // Parameter:   KUINT32 Size
+    //************************************
+    KOCTET * Claim( KUINT64 & Position );
+    void Publish( KUINT64 Position, KUINT32 Size );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::SharedMemoryRing::Write
+    // Description: Copies a datagram into the ring. Throws PDU_TOO_LARGE if larger than SLOT_SIZE.
+    // Parameter:   const KOCTET * Data
+    // Parameter:   KUINT32 Size
+    //************************************
+    void Write( const KOCTET * Data, KUINT32 Size ) throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::SharedMemoryRing::Read
+    // Description: Copies the next datagram into the buffer and returns its size, a datagram larger
+    //              than the buffer is truncated. Returns 0 if none arrives within the timeout.
+    // Parameter:   KOCTET * Buffer
+    // Parameter:   KUINT32 BufferSz
+    // Parameter:   KINT32 TimeoutUS - 0 to poll, negative to wait forever.
+    //************************************
+    KUINT32 Read( KOCTET * Buffer, KUINT32 BufferSz, KINT32 TimeoutUS );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::SharedMemoryRing::GetDroppedCount
+    // Description: The number of datagrams this reader lost because it fell a whole ring behind.
+    //************************************
+    KUINT64 GetDroppedCount() const;
+};
+
+} // END namespace NETWORK
+} // END namespace KDIS
@@ -0,0 +1,110 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./SharedMemoryTransport.h"
+#include <string.h>
+
+using namespace KDIS;
+using namespace NETWORK;
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+SharedMemoryTransport::SharedMemoryTransport( const KString & Name, KUINT32 Slots /* = SharedMemoryRing::DEFAULT_SLOTS */,
+                                              KUINT32 Mode /* = 0600 */ ) throw( KException ) :
+    m_Ring( Name, Slots, Mode ),
+    m_ui64Dropped( 0 )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+SharedMemoryTransport::~SharedMemoryTransport()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+SharedMemoryRing & SharedMemoryTransport::GetRing()
+{
+    return m_Ring;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 SharedMemoryTransport::Send( const KOCTET * Data, KUINT32 DataSz ) throw( KException )
+{
+    m_Ring.Write( Data, DataSz );
+    return DataSz;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 SharedMemoryTransport::SendGather( const KIOVEC * Parts, KUINT32 Count ) throw( KException )
+{
+    KUINT32 ui32Size = 0;
+    for( KUINT32 i = 0; i < Count; ++i )
+    {
+        ui32Size += GetIOVecSize( Parts[i] );
+    }
+    if( ui32Size > SharedMemoryRing::SLOT_SIZE )throw KException( __FUNCTION__, PDU_TOO_LARGE );
+
+    // Gather straight into the ring.
+    KUINT64 ui64Pos = 0;
+    KOCTET * pSlot = m_Ring.Claim( ui64Pos );
+    for( KUINT32 i = 0; i < Count; ++i )
+    {
+        memcpy( pSlot, GetIOVecData( Parts[i] ), GetIOVecSize( Parts[i] ) );
+        pSlot += GetIOVecSize( Parts[i] );
+    }
+    m_Ring.Publish( ui64Pos, ui32Size );
+
+    return ui32Size;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 SharedMemoryTransport::Receive( KOCTET * Buffer, KUINT32 BufferSz, sockaddr_in & Sender, KINT32 TimeoutUS,
+                                       KUINT64 * ArrivalTime /* = 0 */, KUINT32 * Dropped /* = 0 */ ) throw( KException )
+{
+    if( ArrivalTime )*ArrivalTime = 0;
+
+    const KUINT32 ui32Size = m_Ring.Read( Buffer, BufferSz, TimeoutUS );
+
+    if( Dropped )*Dropped = ( KUINT32 )( m_Ring.GetDroppedCount() - m_ui64Dropped );
+    m_ui64Dropped = m_Ring.GetDroppedCount();
+
+    memset( &Sender, 0, sizeof( Sender ) );
+    Sender.sin_family = AF_INET;
+    Sender.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+    return ui32Size;
+}
+
+//////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,83 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      SharedMemoryTransport
+    created:    19/10/2026
+
+    purpose:    A Transport that exchanges datagrams through a SharedMemoryRing with the other
+                processes on this host that open the same name, bypassing the network stack.
+                Datagrams appear to come from 127.0.0.1 and those lost by falling a whole ring
+                behind are reported as dropped.
+                Note: Not supported on Windows, the constructor throws INVALID_OPERATION.
+*********************************************************************/
+
+#pragma once
+
+#include "./Transport.h"
+#include "./SharedMemoryRing.h"
+
+namespace KDIS {
+namespace NETWORK {
+
+class KDIS_EXPORT SharedMemoryTransport : public Transport
+{
+protected:
+
+    SharedMemoryRing m_Ring;
+    KUINT64 m_ui64Dropped;
+
+public:
+
+    //************************************
+    // FullName:    KDIS::NETWORK::SharedMemoryTransport::SharedMemoryTransport
+    // Description: Opens the named ring, see SharedMemoryRing.
+    // Parameter:   const KString & Name
+    // Parameter:   KUINT32 Slots - used if this process creates the ring.
+    // Parameter:   KUINT32 Mode - used if this process creates the ring.
+    //************************************
+    SharedMemoryTransport( const KString & Name, KUINT32 Slots = SharedMemoryRing::DEFAULT_SLOTS, KUINT32 Mode = 0600 ) throw( KException );
+
+    virtual ~SharedMemoryTransport();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::SharedMemoryTransport::GetRing
+    // Description: The ring the datagrams are exchanged through.
+    //************************************
+    SharedMemoryRing & GetRing();
+
+    // Transport interface.
+    virtual KINT32 Send( const KOCTET * Data, KUINT32 DataSz ) throw( KException );
+    virtual KINT32 SendGather( const KIOVEC * Parts, KUINT32 Count ) throw( KException );
+    virtual KINT32 Receive( KOCTET * Buffer, KUINT32 BufferSz, sockaddr_in & Sender, KINT32 TimeoutUS,
+                            KUINT64 * ArrivalTime = 0, KUINT32 * Dropped = 0 ) throw( KException );
+};
+
+} // END namespace NETWORK
+} // END namespace KDIS
@@ -0,0 +1,204 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./SocketUtils.h"
+
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 ) // Windows Headers //
+
+#include <ws2tcpip.h>
+
+#else   // Linux Headers //
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <time.h>
+
+#endif
+
+using namespace KDIS;
+using namespace NETWORK;
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 KDIS::NETWORK::GetWallTime()
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    // 100ns intervals since 1601.
+    FILETIME ft;
+    GetSystemTimeAsFileTime( &ft );
+    KUINT64 ui64Time = ( ( KUINT64 )ft.dwHighDateTime << 32 ) | ft.dwLowDateTime;
+    return ( ui64Time - 116444736000000000ULL ) * 100;
+#else
+    timespec ts;
+    clock_gettime( CLOCK_REALTIME, &ts );
+    return ( KUINT64 )ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL KDIS::NETWORK::SetReceiveTimestampsEnabled( KINT32 Socket, KBOOL E )
+{
+#if defined( SO_TIMESTAMPNS )
+    KINT32 iOn = E ? 1 : 0;
+    return setsockopt( Socket, SOL_SOCKET, SO_TIMESTAMPNS, ( const char * )&iOn, sizeof( iOn ) ) == 0;
+#else
+    return false;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL KDIS::NETWORK::SetDropCountEnabled( KINT32 Socket, KBOOL E )
+{
+#if defined( SO_RXQ_OVFL )
+    KINT32 iOn = E ? 1 : 0;
+    return setsockopt( Socket, SOL_SOCKET, SO_RXQ_OVFL, ( const char * )&iOn, sizeof( iOn ) ) == 0;
+#else
+    return false;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL KDIS::NETWORK::SetPacketInfoEnabled( KINT32 Socket, KBOOL E )
+{
+#if defined( __linux__ ) && defined( IP_PKTINFO )
+    KINT32 iOn = E ? 1 : 0;
+    return setsockopt( Socket, IPPROTO_IP, IP_PKTINFO, ( const char * )&iOn, sizeof( iOn ) ) == 0;
+#else
+    return false;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL KDIS::NETWORK::SetSocketBufferSize( KINT32 Socket, KBOOL Receive, KUINT32 Size )
+{
+    KINT32 iSize = Size;
+
+#if defined( SO_RCVBUFFORCE ) && defined( SO_SNDBUFFORCE )
+    // Only permitted with CAP_NET_ADMIN, else the size is capped by the system maximum.
+    if( setsockopt( Socket, SOL_SOCKET, Receive ? SO_RCVBUFFORCE : SO_SNDBUFFORCE, ( const char * )&iSize, sizeof( iSize ) ) == 0 )
+    {
+        return true;
+    }
+#endif
+
+    return setsockopt( Socket, SOL_SOCKET, Receive ? SO_RCVBUF : SO_SNDBUF, ( const char * )&iSize, sizeof( iSize ) ) == 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 KDIS::NETWORK::GetSocketBufferSize( KINT32 Socket, KBOOL Receive )
+{
+    KINT32 iSize = 0;
+    socklen_t iLen = sizeof( iSize );
+    if( getsockopt( Socket, SOL_SOCKET, Receive ? SO_RCVBUF : SO_SNDBUF, ( char * )&iSize, &iLen ) != 0 )
+    {
+        return 0;
+    }
+    return iSize;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 KDIS::NETWORK::ReceiveDatagram( KINT32 Socket, KOCTET * Buffer, KUINT32 BufferSz, sockaddr_in & Sender,
+                                       KUINT64 * ArrivalTime, KUINT32 * DropCount /* = 0 */, KBOOL * GroupTraffic /* = 0 */ )
+{
+    if( ArrivalTime )*ArrivalTime = 0;
+    if( GroupTraffic )*GroupTraffic = false;
+
+#if !( defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 ) )
+    if( ArrivalTime || DropCount || GroupTraffic )
+    {
+        iovec iov;
+        iov.iov_base = Buffer;
+        iov.iov_len = BufferSz;
+
+        // Room for the timestamp, drop count and packet info control messages.
+        union
+        {
+            cmsghdr m_Align;
+            KOCTET m_Buf[CMSG_SPACE( sizeof( timespec ) ) + CMSG_SPACE( sizeof( KUINT32 ) ) + CMSG_SPACE( sizeof( KINT32 ) + 2 * sizeof( in_addr ) )];
+        } Control;
+
+        msghdr msg;
+        memset( &msg, 0, sizeof( msg ) );
+        msg.msg_name = &Sender;
+        msg.msg_namelen = sizeof( Sender );
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = Control.m_Buf;
+        msg.msg_controllen = sizeof( Control.m_Buf );
+
+        KINT32 iRet = recvmsg( Socket, &msg, 0 );
+        if( iRet < 0 )return iRet;
+
+        for( cmsghdr * cm = CMSG_FIRSTHDR( &msg ); cm; cm = CMSG_NXTHDR( &msg, cm ) )
+        {
+            #if defined( __linux__ ) && defined( IP_PKTINFO )
+            if( GroupTraffic && cm->cmsg_level == IPPROTO_IP && cm->cmsg_type == IP_PKTINFO )
+            {
+                // The local address is only the header destination for unicast datagrams.
+                in_pktinfo pi;
+                memcpy( &pi, CMSG_DATA( cm ), sizeof( pi ) );
+                *GroupTraffic = pi.ipi_addr.s_addr != pi.ipi_spec_dst.s_addr;
+            }
+            #endif
+
+            if( cm->cmsg_level != SOL_SOCKET )continue;
+
+            #if defined( SO_TIMESTAMPNS )
+            if( ArrivalTime && cm->cmsg_type == SO_TIMESTAMPNS )
+            {
+                timespec ts;
+                memcpy( &ts, CMSG_DATA( cm ), sizeof( ts ) );
+                *ArrivalTime = ( KUINT64 )ts.tv_sec * 1000000000 + ts.tv_nsec;
+            }
+            #endif
+
+            #if defined( SO_RXQ_OVFL )
+            if( DropCount && cm->cmsg_type == SO_RXQ_OVFL )
+            {
+                memcpy( DropCount, CMSG_DATA( cm ), sizeof( KUINT32 ) );
+            }
+            #endif
+        }
+
+        return iRet;
+    }
+#endif
+
+    socklen_t iSz = sizeof( Sender );
+    return recvfrom( Socket, Buffer, BufferSz, 0, ( sockaddr * )&Sender, &iSz );
+}
+
+//////////////////////////////////////////////////////////////////////////
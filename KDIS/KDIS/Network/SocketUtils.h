@@ -0,0 +1,121 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    SocketUtils
+    created:    19/10/2026
+
+    purpose:    Socket helpers shared by Connection and ReceiveShards for
+                sizing the socket buffers and receiving datagrams with their
+                kernel arrival time and drop count.
+*********************************************************************/
+
+#pragma once
+
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+#include <WinSock2.h>
+#else
+#include <netinet/in.h>
+#endif
+
+#include "./../KDefines.h"
+
+namespace KDIS {
+namespace NETWORK {
+
+//************************************
+// FullName:    KDIS::NETWORK::GetWallTime
+// Description: The current time in nanoseconds since the epoch, the same clock as the arrival times.
+//************************************
+KDIS_EXPORT KUINT64 GetWallTime();
+
+//************************************
+// FullName:    KDIS::NETWORK::SetReceiveTimestampsEnabled
+// Description: Asks the kernel to timestamp each datagram on arrival(SO_TIMESTAMPNS).
+//              Returns false if the platform does not support it.
+// Parameter:   KINT32 Socket
+// Parameter:   KBOOL E
+//************************************
+KDIS_EXPORT KBOOL SetReceiveTimestampsEnabled( KINT32 Socket, KBOOL E );
+
+//************************************
+// FullName:    KDIS::NETWORK::SetDropCountEnabled
+// Description: Asks the kernel to report the number of datagrams it dropped because the receive
+//              buffer was full with each datagram(SO_RXQ_OVFL). Returns false if the platform does not support it.
+// Parameter:   KINT32 Socket
+// Parameter:   KBOOL E
+//************************************
+KDIS_EXPORT KBOOL SetDropCountEnabled( KINT32 Socket, KBOOL E );
+
+//************************************
+// FullName:    KDIS::NETWORK::SetPacketInfoEnabled
+// Description: Asks the kernel for the destination of each datagram(IP_PKTINFO) so ReceiveDatagram can
+//              tell multicast and broadcast datagrams from unicast ones. Returns false if the platform
+//              does not support it, currently only Linux does.
+// Parameter:   KINT32 Socket
+// Parameter:   KBOOL E
+//************************************
+KDIS_EXPORT KBOOL SetPacketInfoEnabled( KINT32 Socket, KBOOL E );
+
+//************************************
+// FullName:    KDIS::NETWORK::SetSocketBufferSize
+//              KDIS::NETWORK::GetSocketBufferSize
+// Description: Sets/Gets the kernel receive(SO_RCVBUF) or send(SO_SNDBUF) buffer size in bytes.
+//              Where permitted the system maximum is bypassed(SO_RCVBUFFORCE/SO_SNDBUFFORCE).
+//              The kernel may round or double the size so read it back to see what was applied.
+//              Set returns false if the size could not be set, Get returns 0 on error.
+// Parameter:   KINT32 Socket
+// Parameter:   KBOOL Receive - true for the receive buffer, false for the send buffer.
+// Parameter:   KUINT32 Size
+//************************************
+KDIS_EXPORT KBOOL SetSocketBufferSize( KINT32 Socket, KBOOL Receive, KUINT32 Size );
+KDIS_EXPORT KUINT32 GetSocketBufferSize( KINT32 Socket, KBOOL Receive );
+
+//************************************
+// FullName:    KDIS::NETWORK::ReceiveDatagram
+// Description: As recvfrom but when ArrivalTime is not NULL it is set to the kernel arrival time in
+//              nanoseconds since the epoch, or 0 if the datagram was not timestamped.
+//              When DropCount is not NULL and the kernel reports drops it is set to the total number of
+//              datagrams dropped by the socket so far, else it is left unchanged.
+//              When GroupTraffic is not NULL it is set to true if the datagram was sent to a multicast or
+//              broadcast address, this needs SetPacketInfoEnabled and is always false elsewhere.
+//              Returns the size received or -1 on error.
+// Parameter:   KINT32 Socket
+// Parameter:   KOCTET * Buffer
+// Parameter:   KUINT32 BufferSz
+// Parameter:   sockaddr_in & Sender
+// Parameter:   KUINT64 * ArrivalTime
+// Parameter:   KUINT32 * DropCount
+// Parameter:   KBOOL * GroupTraffic
+//************************************
+KDIS_EXPORT KINT32 ReceiveDatagram( KINT32 Socket, KOCTET * Buffer, KUINT32 BufferSz, sockaddr_in & Sender,
+                                    KUINT64 * ArrivalTime, KUINT32 * DropCount = 0, KBOOL * GroupTraffic = 0 );
+
+} // END namespace NETWORK
+} // END namespace KDIS
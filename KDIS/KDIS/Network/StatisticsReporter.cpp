@@ -0,0 +1,116 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./StatisticsReporter.h"
+#include <cstring>
+
+using namespace KDIS;
+using namespace PDU;
+using namespace UTILS;
+using namespace NETWORK;
+
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+void StatisticsReporter::poll()
+{
+    if( PDU_Statistics::GetTime() - m_ui64LastReport >= m_ui64Interval )
+    {
+        ReportNow();
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+StatisticsReporter::StatisticsReporter( const PDU_Statistics & S, KUINT32 IntervalMS, std::ostream & Out /* = std::cout */ ) :
+    m_Stats( S ),
+    m_Out( Out ),
+    m_ui64Interval( ( KUINT64 )IntervalMS * 1000000 ),
+    m_ui64LastReport( PDU_Statistics::GetTime() )
+{
+    memset( &m_Last, 0, sizeof( m_Last ) );
+    memset( &m_Current, 0, sizeof( m_Current ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+StatisticsReporter::~StatisticsReporter()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void StatisticsReporter::Report( const PDU_Statistics::Snapshot & Current, const PDU_Statistics::Snapshot & Last, KUINT64 Elapsed )
+{
+    const KFLOAT64 f64Seconds = Elapsed / 1000000000.0;
+
+    m_Out << Current.GetAsString();
+    if( f64Seconds > 0 )
+    {
+        m_Out << "\tLast " << f64Seconds << "s: "
+              << ( Current.m_ui64DatagramsReceived - Last.m_ui64DatagramsReceived ) / f64Seconds << " datagrams/s in, "
+              << ( Current.m_ui64BytesReceived - Last.m_ui64BytesReceived ) / f64Seconds << " bytes/s in, "
+              << ( Current.m_ui64DatagramsSent - Last.m_ui64DatagramsSent ) / f64Seconds << " datagrams/s out, "
+              << ( Current.m_ui64BytesSent - Last.m_ui64BytesSent ) / f64Seconds << " bytes/s out\n";
+    }
+    m_Out.flush();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void StatisticsReporter::ReportNow()
+{
+    const KUINT64 ui64Now = PDU_Statistics::GetTime();
+
+    m_Stats.GetSnapshot( m_Current );
+    Report( m_Current, m_Last, ui64Now - m_ui64LastReport );
+
+    m_Last = m_Current;
+    m_ui64LastReport = ui64Now;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL StatisticsReporter::OnDataReceived( const KOCTET *, KUINT32, const sockaddr_in &, KUINT64 )
+{
+    poll();
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void StatisticsReporter::OnPDUTransmit( Header * )
+{
+    poll();
+}
+
+//////////////////////////////////////////////////////////////////////////
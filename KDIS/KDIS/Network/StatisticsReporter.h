@@ -0,0 +1,108 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      StatisticsReporter
+    created:    19/10/2026
+
+    purpose:    A ConnectionSubscriber that periodically writes a snapshot of a PDU_Statistics
+                to a stream, along with the datagram and byte rates since the last report.
+                The time is checked as data is received and sent so nothing is reported while
+                the connection is idle. Override Report to send the snapshot elsewhere.
+
+                Example:
+                    Connection conn( "192.168.3.255" );
+                    conn.SetStatisticsEnabled( true );
+                    StatisticsReporter reporter( conn.GetStatistics(), 10000 );
+                    conn.AddSubscriber( &reporter );
+*********************************************************************/
+
+#pragma once
+
+#include "./ConnectionSubscriber.h"
+#include "./../Extras/PDU_Statistics.h"
+#include <iostream>
+
+namespace KDIS {
+namespace NETWORK {
+
+class KDIS_EXPORT StatisticsReporter : public ConnectionSubscriber
+{
+protected:
+
+    const KDIS::UTILS::PDU_Statistics & m_Stats;
+    std::ostream & m_Out;
+    KUINT64 m_ui64Interval;
+    KUINT64 m_ui64LastReport;
+    KDIS::UTILS::PDU_Statistics::Snapshot m_Last;
+    KDIS::UTILS::PDU_Statistics::Snapshot m_Current;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::StatisticsReporter::poll
+    // Description: Reports if the interval has passed.
+    //************************************
+    void poll();
+
+public:
+
+    //************************************
+    // FullName:    KDIS::NETWORK::StatisticsReporter::StatisticsReporter
+    // Description: Ctor.
+    // Parameter:   const PDU_Statistics & S - Must outlive the reporter.
+    // Parameter:   KUINT32 IntervalMS - Time between reports in milliseconds.
+    // Parameter:   std::ostream & Out - Where the default Report writes to.
+    //************************************
+    StatisticsReporter( const KDIS::UTILS::PDU_Statistics & S, KUINT32 IntervalMS, std::ostream & Out = std::cout );
+
+    virtual ~StatisticsReporter();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::StatisticsReporter::Report
+    // Description: Called once per interval. By default writes the counters and the rates to the stream.
+    // Parameter:   const PDU_Statistics::Snapshot & Current
+    // Parameter:   const PDU_Statistics::Snapshot & Last - The previous report, all 0 for the first.
+    // Parameter:   KUINT64 Elapsed - Nanoseconds since the previous report.
+    //************************************
+    virtual void Report( const KDIS::UTILS::PDU_Statistics::Snapshot & Current,
+                         const KDIS::UTILS::PDU_Statistics::Snapshot & Last, KUINT64 Elapsed );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::StatisticsReporter::ReportNow
+    // Description: Reports regardless of the interval and restarts it.
+    //************************************
+    void ReportNow();
+
+    // ConnectionSubscriber
+    using ConnectionSubscriber::OnDataReceived;
+    virtual KBOOL OnDataReceived( const KOCTET * Data, KUINT32 DataLength, const sockaddr_in & Sender, KUINT64 ArrivalTime );
+    virtual void OnPDUTransmit( KDIS::PDU::Header * H );
+};
+
+} // END namespace NETWORK
+} // END namespace KDIS
@@ -0,0 +1,642 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./TCP_Transport.h"
+#include "./../Extras/PDU_Statistics.h"
+#include "./../PDU/Header.h"
+#include <string.h>
+
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 ) // Windows Headers //
+
+#include <ws2tcpip.h>
+
+#define CLOSE_SOCKET closesocket
+#define SOCKET_ERRNO WSAGetLastError()
+#define WOULD_BLOCK( e ) ( e == WSAEWOULDBLOCK )
+#define IN_PROGRESS( e ) ( e == WSAEWOULDBLOCK )
+#define THROW_ERROR throw KException( __FUNCTION__, CONNECTION_SOCKET_ERROR )
+
+#else   // Linux Headers //
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+
+#define INVALID_SOCKET -1
+#define SOCKET_ERROR -1
+#define CLOSE_SOCKET ::close
+#define SOCKET_ERRNO errno
+#define WOULD_BLOCK( e ) ( e == EAGAIN || e == EWOULDBLOCK )
+#define IN_PROGRESS( e ) ( e == EINPROGRESS )
+#define THROW_ERROR throw KException( __FUNCTION__, CONNECTION_SOCKET_ERROR, strerror( errno ) )
+
+#endif
+
+// A lost peer must not raise SIGPIPE.
+#if defined( MSG_NOSIGNAL )
+#define SEND_FLAGS MSG_NOSIGNAL
+#else
+#define SEND_FLAGS 0
+#endif
+
+using namespace KDIS;
+using namespace PDU;
+using namespace UTILS;
+using namespace NETWORK;
+
+// The PDU length is the last field of the part of the header common to all versions.
+static const KUINT32 LENGTH_OFFSET = 8;
+
+//////////////////////////////////////////////////////////////////////////
+
+static KUINT16 getPDULength( const KOCTET * Data )
+{
+    return ( ( KUINT8 )Data[LENGTH_OFFSET] << 8 ) | ( KUINT8 )Data[LENGTH_OFFSET + 1];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+static void setNonBlocking( KINT32 Socket )
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    unsigned long int uliIoctBlock = 1;
+    ioctlsocket( Socket, FIONBIO, &uliIoctBlock );
+#else
+    fcntl( Socket, F_SETFL, fcntl( Socket, F_GETFL, 0 ) | O_NONBLOCK );
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+static KBOOL waitFor( KINT32 Socket, KBOOL Write, KINT32 TimeoutUS )
+{
+    fd_set fd;
+    FD_ZERO( &fd );
+    FD_SET( Socket, &fd );
+
+    timeval tval;
+    tval.tv_sec = TimeoutUS / 1000000;
+    tval.tv_usec = TimeoutUS % 1000000;
+
+    return select( Socket + 1, Write ? 0 : &fd, Write ? &fd : 0, 0, TimeoutUS < 0 ? 0 : &tval ) > 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL TCP_Transport::progress( KINT32 TimeoutUS ) throw( KException )
+{
+    if( m_State == Connected )return true;
+
+    if( m_bListen )
+    {
+        if( !waitFor( m_iListenSocket, false, TimeoutUS ) )return false;
+
+        // The peer may already have gone again.
+        KINT32 iSocket = accept( m_iListenSocket, 0, 0 );
+        if( iSocket == INVALID_SOCKET )return false;
+
+        connected( iSocket );
+        return true;
+    }
+
+    if( m_State == Disconnected )
+    {
+        const KUINT64 ui64Now = PDU_Statistics::GetTime();
+        if( ui64Now < m_ui64NextConnect )return false;
+        m_ui64NextConnect = ui64Now + m_ui32ReconnectIntervalMS * 1000000ULL;
+
+        KINT32 iSocket = socket( AF_INET, SOCK_STREAM, IPPROTO_TCP );
+        if( iSocket == INVALID_SOCKET )
+        {
+            THROW_ERROR;
+        }
+
+        setNonBlocking( iSocket );
+        if( connect( iSocket, ( sockaddr * )&m_Address, sizeof( m_Address ) ) == 0 )
+        {
+            connected( iSocket );
+            return true;
+        }
+
+        if( !IN_PROGRESS( SOCKET_ERRNO ) )
+        {
+            CLOSE_SOCKET( iSocket );
+            return false;
+        }
+
+        m_iSocket = iSocket;
+        m_State = Connecting;
+    }
+
+    // The connect has finished when the socket becomes writable.
+    if( !waitFor( m_iSocket, true, TimeoutUS ) )return false;
+
+    KINT32 iError = 0;
+    socklen_t iLen = sizeof( iError );
+    getsockopt( m_iSocket, SOL_SOCKET, SO_ERROR, ( char * )&iError, &iLen );
+
+    KINT32 iSocket = m_iSocket;
+    m_iSocket = INVALID_SOCKET;
+    m_State = Disconnected;
+
+    if( iError )
+    {
+        CLOSE_SOCKET( iSocket );
+        return false;
+    }
+
+    connected( iSocket );
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void TCP_Transport::connected( KINT32 Socket )
+{
+    setNonBlocking( Socket );
+
+    // We do our own coalescing.
+    KINT32 yes = 1;
+    setsockopt( Socket, IPPROTO_TCP, TCP_NODELAY, ( const char * )&yes, sizeof( yes ) );
+
+    socklen_t iLen = sizeof( m_Peer );
+    getpeername( Socket, ( sockaddr * )&m_Peer, &iLen );
+
+    m_iSocket = Socket;
+    m_State = Connected;
+    ++m_ui32Connections;
+
+    m_ui32ReadStart = m_ui32ReadEnd = 0;
+    m_ui32WriteStart = m_ui32WriteEnd = 0;
+    m_bBackPressure = false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void TCP_Transport::disconnect()
+{
+    if( m_iSocket != INVALID_SOCKET )
+    {
+        CLOSE_SOCKET( m_iSocket );
+        m_iSocket = INVALID_SOCKET;
+    }
+
+    m_State = Disconnected;
+    m_ui64NextConnect = PDU_Statistics::GetTime() + m_ui32ReconnectIntervalMS * 1000000ULL;
+
+    m_ui32ReadStart = m_ui32ReadEnd = 0;
+    m_ui32WriteStart = m_ui32WriteEnd = 0;
+    m_bBackPressure = false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL TCP_Transport::reserve( KUINT32 Size )
+{
+    const KUINT32 ui32Capacity = m_vWriteBuffer.size();
+
+    if( m_ui32WriteEnd - m_ui32WriteStart + Size > ui32Capacity )
+    {
+        write();
+        if( m_ui32WriteEnd - m_ui32WriteStart + Size > ui32Capacity )return false;
+    }
+
+    // Move the waiting data to the front to make room behind it.
+    if( m_ui32WriteEnd + Size > ui32Capacity )
+    {
+        memmove( &m_vWriteBuffer[0], &m_vWriteBuffer[m_ui32WriteStart], m_ui32WriteEnd - m_ui32WriteStart );
+        m_ui32WriteEnd -= m_ui32WriteStart;
+        m_ui32WriteStart = 0;
+    }
+
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void TCP_Transport::commit( KUINT32 Size )
+{
+    if( m_ui32WriteStart == m_ui32WriteEnd )m_ui64CoalesceStart = PDU_Statistics::GetTime();
+    m_ui32WriteEnd += Size;
+    writeDue();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void TCP_Transport::writeDue()
+{
+    const KUINT32 ui32Pending = m_ui32WriteEnd - m_ui32WriteStart;
+    if( !ui32Pending )return;
+
+    if( m_bCoalesce && ui32Pending < m_ui32CoalesceMaxSize &&
+        PDU_Statistics::GetTime() - m_ui64CoalesceStart < m_ui32CoalesceDeadline * 1000ULL )return;
+
+    write();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void TCP_Transport::write()
+{
+    if( m_State != Connected )return;
+
+    while( m_ui32WriteStart != m_ui32WriteEnd )
+    {
+        KINT32 iSent = send( m_iSocket, &m_vWriteBuffer[m_ui32WriteStart], m_ui32WriteEnd - m_ui32WriteStart, SEND_FLAGS );
+        if( iSent == SOCKET_ERROR )
+        {
+            if( WOULD_BLOCK( SOCKET_ERRNO ) )
+            {
+                // The peer is not keeping up, try again later.
+                m_bBackPressure = true;
+            }
+            else
+            {
+                disconnect();
+            }
+            return;
+        }
+
+        m_ui32WriteStart += iSent;
+    }
+
+    m_ui32WriteStart = m_ui32WriteEnd = 0;
+    m_bBackPressure = false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL TCP_Transport::read( KINT32 TimeoutUS )
+{
+    if( TimeoutUS && !waitFor( m_iSocket, false, TimeoutUS ) )return false;
+
+    KINT32 iRead = recv( m_iSocket, &m_vReadBuffer[m_ui32ReadEnd], m_vReadBuffer.size() - m_ui32ReadEnd, 0 );
+    if( iRead > 0 )
+    {
+        m_ui32ReadEnd += iRead;
+        return true;
+    }
+
+    // 0 is an orderly shutdown by the peer.
+    if( iRead == 0 || !WOULD_BLOCK( SOCKET_ERRNO ) )disconnect();
+    return false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL TCP_Transport::isFramed( const KOCTET * Data, KUINT32 Size )
+{
+    KUINT32 ui32Offset = 0;
+    while( Size - ui32Offset >= LENGTH_OFFSET + 2 )
+    {
+        const KUINT16 ui16Length = getPDULength( Data + ui32Offset );
+        if( ui16Length < Header::HEADER6_PDU_SIZE || ui16Length > Size - ui32Offset )return false;
+        ui32Offset += ui16Length;
+    }
+
+    return ui32Offset == Size;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+TCP_Transport::TCP_Transport( const KString & Address, KUINT32 Port /* = 3000 */, KBOOL Listen /* = false */,
+                              KUINT32 ReadBufferSize /* = DEFAULT_READ_BUFFER_SIZE */,
+                              KUINT32 WriteBufferSize /* = DEFAULT_WRITE_BUFFER_SIZE */ ) throw( KException ) :
+    m_iSocket( INVALID_SOCKET ),
+    m_iListenSocket( INVALID_SOCKET ),
+    m_bListen( Listen ),
+    m_State( Disconnected ),
+    m_ui32ReconnectIntervalMS( 1000 ),
+    m_ui64NextConnect( 0 ),
+    m_ui32Connections( 0 ),
+    m_ui32ReadStart( 0 ),
+    m_ui32ReadEnd( 0 ),
+    m_ui32WriteStart( 0 ),
+    m_ui32WriteEnd( 0 ),
+    m_bCoalesce( false ),
+    m_ui32CoalesceDeadline( 0 ),
+    m_ui32CoalesceMaxSize( 0 ),
+    m_ui64CoalesceStart( 0 ),
+    m_bBackPressure( false ),
+    m_ui64Rejected( 0 )
+{
+    if( ReadBufferSize < MAX_PDU_SIZE || WriteBufferSize < MAX_PDU_SIZE )
+    {
+        throw KException( __FUNCTION__, INVALID_DATA, "The buffers must hold at least MAX_PDU_SIZE" );
+    }
+
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    WSADATA w;
+    static KINT32 iWinSockInit = WSAStartup( 0x0202, &w ); // Init with winsock version 2.2
+    if( iWinSockInit != NO_ERROR )
+    {
+        THROW_ERROR;
+    }
+#endif
+
+    m_vReadBuffer.resize( ReadBufferSize );
+    m_vWriteBuffer.resize( WriteBufferSize );
+
+    memset( &m_Peer, 0, sizeof( m_Peer ) );
+    memset( &m_Address, 0, sizeof( m_Address ) );
+    m_Address.sin_family = AF_INET;
+    m_Address.sin_addr.s_addr = inet_addr( Address.c_str() );
+    m_Address.sin_port = htons( Port );
+
+    if( m_bListen )
+    {
+        m_iListenSocket = socket( AF_INET, SOCK_STREAM, IPPROTO_TCP );
+        if( m_iListenSocket == INVALID_SOCKET )
+        {
+            THROW_ERROR;
+        }
+
+        KINT32 yes = 1;
+        setsockopt( m_iListenSocket, SOL_SOCKET, SO_REUSEADDR, ( const char * )&yes, sizeof( yes ) );
+
+        if( bind( m_iListenSocket, ( sockaddr * )&m_Address, sizeof( m_Address ) ) == SOCKET_ERROR ||
+            listen( m_iListenSocket, 1 ) == SOCKET_ERROR )
+        {
+            KException e( __FUNCTION__, CONNECTION_SOCKET_ERROR, strerror( errno ) );
+            CLOSE_SOCKET( m_iListenSocket );
+            throw e;
+        }
+
+        setNonBlocking( m_iListenSocket );
+    }
+
+    // Start connecting.
+    progress( 0 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+TCP_Transport::~TCP_Transport()
+{
+    // Send what the socket will take, there is nobody to report a failure to.
+    write();
+    disconnect();
+
+    if( m_iListenSocket != INVALID_SOCKET )CLOSE_SOCKET( m_iListenSocket );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+TCP_Transport::LinkState TCP_Transport::GetState() const
+{
+    return m_State;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL TCP_Transport::IsConnected() const
+{
+    return m_State == Connected;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const sockaddr_in & TCP_Transport::GetPeer() const
+{
+    return m_Peer;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 TCP_Transport::GetConnectionCount() const
+{
+    return m_ui32Connections;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void TCP_Transport::SetReconnectInterval( KUINT32 MS )
+{
+    m_ui32ReconnectIntervalMS = MS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 TCP_Transport::GetReconnectInterval() const
+{
+    return m_ui32ReconnectIntervalMS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void TCP_Transport::SetCoalescingEnabled( KBOOL E, KUINT32 DeadlineUS /* = 1000 */, KUINT32 MaxSize /* = 65536 */ )
+{
+    m_bCoalesce = E;
+    m_ui32CoalesceDeadline = DeadlineUS;
+    m_ui32CoalesceMaxSize = MaxSize > m_vWriteBuffer.size() ? m_vWriteBuffer.size() : MaxSize;
+
+    if( !E )Flush();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL TCP_Transport::IsCoalescingEnabled() const
+{
+    return m_bCoalesce;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void TCP_Transport::Flush()
+{
+    write();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 TCP_Transport::GetPendingBytes() const
+{
+    return m_ui32WriteEnd - m_ui32WriteStart;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL TCP_Transport::IsBackPressured() const
+{
+    return m_bBackPressure;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT64 TCP_Transport::GetRejectedCount() const
+{
+    return m_ui64Rejected;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const KOCTET * TCP_Transport::ReceivePDU( KUINT32 & Size, KINT32 TimeoutUS ) throw( KException )
+{
+    Size = 0;
+    writeDue();
+
+    if( m_State != Connected )
+    {
+        if( !progress( TimeoutUS ) )return 0;
+        TimeoutUS = 0;
+    }
+
+    // The last PDU returned is no longer needed.
+    if( m_ui32ReadStart == m_ui32ReadEnd )m_ui32ReadStart = m_ui32ReadEnd = 0;
+
+    const KUINT32 ui32Capacity = m_vReadBuffer.size();
+    while( true )
+    {
+        const KUINT32 ui32Available = m_ui32ReadEnd - m_ui32ReadStart;
+        KUINT32 ui32Needed = LENGTH_OFFSET + 2;
+
+        if( ui32Available >= ui32Needed )
+        {
+            const KOCTET * pPDU = &m_vReadBuffer[m_ui32ReadStart];
+            const KUINT16 ui16Length = getPDULength( pPDU );
+
+            // We can not find the next PDU in a corrupt stream, start again with a new one.
+            if( ui16Length < Header::HEADER6_PDU_SIZE )
+            {
+                disconnect();
+                throw KException( __FUNCTION__, INVALID_DATA, "The stream does not contain PDU" );
+            }
+            if( ui16Length > ui32Capacity )
+            {
+                disconnect();
+                throw KException( __FUNCTION__, PDU_TOO_LARGE );
+            }
+
+            if( ui32Available >= ui16Length )
+            {
+                m_ui32ReadStart += ui16Length;
+                Size = ui16Length;
+                return pPDU;
+            }
+
+            ui32Needed = ui16Length;
+        }
+
+        // Make room for the rest of the PDU.
+        if( m_ui32ReadStart + ui32Needed > ui32Capacity )
+        {
+            memmove( &m_vReadBuffer[0], &m_vReadBuffer[m_ui32ReadStart], ui32Available );
+            m_ui32ReadStart = 0;
+            m_ui32ReadEnd = ui32Available;
+        }
+
+        // Only wait once.
+        if( !read( TimeoutUS ) )return 0;
+        TimeoutUS = 0;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 TCP_Transport::Send( const KOCTET * Data, KUINT32 DataSz ) throw( KException )
+{
+    if( !isFramed( Data, DataSz ) )throw KException( __FUNCTION__, INVALID_DATA, "Only whole PDU can be sent on a stream" );
+
+    if( !progress( 0 ) || !reserve( DataSz ) || m_State != Connected )
+    {
+        ++m_ui64Rejected;
+        return 0;
+    }
+
+    memcpy( &m_vWriteBuffer[m_ui32WriteEnd], Data, DataSz );
+    commit( DataSz );
+    return DataSz;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 TCP_Transport::SendGather( const KIOVEC * Parts, KUINT32 Count ) throw( KException )
+{
+    KUINT32 ui32Size = 0;
+    for( KUINT32 i = 0; i < Count; ++i )
+    {
+        ui32Size += GetIOVecSize( Parts[i] );
+    }
+
+    if( !progress( 0 ) || !reserve( ui32Size ) || m_State != Connected )
+    {
+        ++m_ui64Rejected;
+        return 0;
+    }
+
+    // Gather straight into the write buffer, it is only committed once we know it is whole PDU.
+    KOCTET * pEnd = &m_vWriteBuffer[m_ui32WriteEnd];
+    for( KUINT32 i = 0; i < Count; ++i )
+    {
+        memcpy( pEnd, GetIOVecData( Parts[i] ), GetIOVecSize( Parts[i] ) );
+        pEnd += GetIOVecSize( Parts[i] );
+    }
+
+    if( !isFramed( &m_vWriteBuffer[m_ui32WriteEnd], ui32Size ) )throw KException( __FUNCTION__, INVALID_DATA, "Only whole PDU can be sent on a stream" );
+
+    commit( ui32Size );
+    return ui32Size;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 TCP_Transport::SendBatch( const KIOVEC * Datagrams, KUINT32 Count ) throw( KException )
+{
+    // The datagrams are all framed PDU so they can go in a single write.
+    return SendGather( Datagrams, Count );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 TCP_Transport::Receive( KOCTET * Buffer, KUINT32 BufferSz, sockaddr_in & Sender, KINT32 TimeoutUS,
+                               KUINT64 * ArrivalTime /* = 0 */, KUINT32 * Dropped /* = 0 */ ) throw( KException )
+{
+    if( ArrivalTime )*ArrivalTime = 0;
+    if( Dropped )*Dropped = 0;
+
+    KUINT32 ui32Size = 0;
+    const KOCTET * pPDU = ReceivePDU( ui32Size, TimeoutUS );
+    if( !pPDU )return 0;
+
+    if( ui32Size > BufferSz )ui32Size = BufferSz;
+    memcpy( Buffer, pPDU, ui32Size );
+    Sender = m_Peer;
+    return ui32Size;
+}
+
+//////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,258 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      TCP_Transport
+    created:    19/10/2026
+
+    purpose:    A Transport over a TCP stream for links where UDP multicast is not
+                available, e.g bridging exercises between sites over a WAN.
+                PDU are written back to back and framed by the length in their own header,
+                no extra prefix is added. Writes are collected in a preallocated buffer and
+                optionally held back for a short time so many PDU go out in one write, under
+                our control rather than the kernel's Nagle algorithm(TCP_NODELAY is set).
+                Reads fill a large buffer with a single call and PDU are returned from it in
+                place, see ReceivePDU.
+
+                One end listens and accepts a single peer at a time, the other connects and
+                keeps reconnecting when the link is lost. The sockets never block the caller,
+                while there is no peer datagrams are discarded and counted as rejected, as
+                they are when the peer does not keep up and the write buffer is full.
+*********************************************************************/
+
+#pragma once
+
+#include "./Transport.h"
+#include <vector>
+
+namespace KDIS {
+namespace NETWORK {
+
+class KDIS_EXPORT TCP_Transport : public Transport
+{
+public:
+
+    enum LinkState
+    {
+        Disconnected,
+        Connecting,
+        Connected
+    };
+
+    static const KUINT32 DEFAULT_READ_BUFFER_SIZE = 262144;
+    static const KUINT32 DEFAULT_WRITE_BUFFER_SIZE = 1048576;
+
+protected:
+
+    KINT32 m_iSocket;       // The peer, INVALID_SOCKET when there is none.
+    KINT32 m_iListenSocket; // Only when listening.
+
+    sockaddr_in m_Address;
+    KBOOL m_bListen;
+    LinkState m_State;
+    sockaddr_in m_Peer;
+
+    KUINT32 m_ui32ReconnectIntervalMS;
+    KUINT64 m_ui64NextConnect;
+    KUINT32 m_ui32Connections;
+
+    // Received data is between start and end.
+    std::vector<KOCTET> m_vReadBuffer;
+    KUINT32 m_ui32ReadStart;
+    KUINT32 m_ui32ReadEnd;
+
+    // Data waiting to be written is between start and end.
+    std::vector<KOCTET> m_vWriteBuffer;
+    KUINT32 m_ui32WriteStart;
+    KUINT32 m_ui32WriteEnd;
+
+    KBOOL m_bCoalesce;
+    KUINT32 m_ui32CoalesceDeadline;
+    KUINT32 m_ui32CoalesceMaxSize;
+    KUINT64 m_ui64CoalesceStart;
+
+    KBOOL m_bBackPressure;
+    KUINT64 m_ui64Rejected;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::TCP_Transport::progress
+    // Description: Moves the link towards being connected, waiting up to TimeoutUS for a pending
+    //              connect or a peer to accept. Returns true when connected.
+    // Parameter:   KINT32 TimeoutUS
+    //************************************
+    KBOOL progress( KINT32 TimeoutUS ) throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::TCP_Transport::connected
+    //              KDIS::NETWORK::TCP_Transport::disconnect
+    // Description: Sets up a new peer socket and drops it. Buffered data belongs to the stream
+    //              of the old peer so it is discarded.
+    // Parameter:   KINT32 Socket
+    //************************************
+    void connected( KINT32 Socket );
+    void disconnect();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::TCP_Transport::reserve
+    // Description: Makes room for Size more octets in the write buffer, returns false if there is
+    //              not enough room even after writing what the socket will take.
+    // Parameter:   KUINT32 Size
+    //************************************
+    KBOOL reserve( KUINT32 Size );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::TCP_Transport::commit
+    // Description: Adds Size octets written after the end of the write buffer to it and
+    //              writes the buffer if it is due.
+    // Parameter:   KUINT32 Size
+    //************************************
+    void commit( KUINT32 Size );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::TCP_Transport::writeDue
+    //              KDIS::NETWORK::TCP_Transport::write
+    // Description: Writes as much of the write buffer as the socket will take, the due version
+    //              only does so when it is not being held back by coalescing.
+    //              A failed write drops the link.
+    //************************************
+    void writeDue();
+    void write();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::TCP_Transport::read
+    // Description: Reads as much as is available into the read buffer, waiting up to TimeoutUS
+    //              for data. Returns false if nothing was read.
+    // Parameter:   KINT32 TimeoutUS
+    //************************************
+    KBOOL read( KINT32 TimeoutUS );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::TCP_Transport::isFramed
+    // Description: True if the data is one or more whole PDU, anything else would break the
+    //              framing of the stream.
+    // Parameter:   const KOCTET * Data
+    // Parameter:   KUINT32 Size
+    //************************************
+    static KBOOL isFramed( const KOCTET * Data, KUINT32 Size );
+
+public:
+
+    //************************************
+    // FullName:    KDIS::NETWORK::TCP_Transport::TCP_Transport
+    // Description: Listens on Address:Port for a peer or connects to it, the connect is
+    //              started here and completed by later calls.
+    // Parameter:   const KString & Address - the address to listen on or connect to.
+    // Parameter:   KUINT32 Port
+    // Parameter:   KBOOL Listen
+    // Parameter:   KUINT32 ReadBufferSize
+    // Parameter:   KUINT32 WriteBufferSize - the most data that can be waiting to be written.
+    //************************************
+    TCP_Transport( const KString & Address, KUINT32 Port = 3000, KBOOL Listen = false,
+                   KUINT32 ReadBufferSize = DEFAULT_READ_BUFFER_SIZE,
+                   KUINT32 WriteBufferSize = DEFAULT_WRITE_BUFFER_SIZE ) throw( KException );
+
+    virtual ~TCP_Transport();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::TCP_Transport::GetState
+    //              KDIS::NETWORK::TCP_Transport::IsConnected
+    //              KDIS::NETWORK::TCP_Transport::GetPeer
+    //              KDIS::NETWORK::TCP_Transport::GetConnectionCount
+    // Description: The state of the link, the current or last peer and the number of times a
+    //              peer has been connected, more than 1 means the link has been re-established.
+    //              The link only makes progress during the send and receive calls.
+    //************************************
+    LinkState GetState() const;
+    KBOOL IsConnected() const;
+    const sockaddr_in & GetPeer() const;
+    KUINT32 GetConnectionCount() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::TCP_Transport::SetReconnectInterval
+    //              KDIS::NETWORK::TCP_Transport::GetReconnectInterval
+    // Description: How long to wait between connect attempts, 1000 ms by default.
+    // Parameter:   KUINT32 MS
+    //************************************
+    void SetReconnectInterval( KUINT32 MS );
+    KUINT32 GetReconnectInterval() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::TCP_Transport::SetCoalescingEnabled
+    //              KDIS::NETWORK::TCP_Transport::IsCoalescingEnabled
+    // Description: When enabled sent datagrams are held in the write buffer until MaxSize octets
+    //              are waiting or the oldest has waited DeadlineUS microseconds, then written together.
+    //              The deadline is checked on each send and receive call, else use Flush.
+    //              Disabled by default, each send call is then written straight away.
+    // Parameter:   KBOOL E
+    // Parameter:   KUINT32 DeadlineUS = 1000
+    // Parameter:   KUINT32 MaxSize = 65536
+    //************************************
+    void SetCoalescingEnabled( KBOOL E, KUINT32 DeadlineUS = 1000, KUINT32 MaxSize = 65536 );
+    KBOOL IsCoalescingEnabled() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::TCP_Transport::Flush
+    // Description: Writes any coalesced data, as much as the socket will take.
+    //************************************
+    void Flush();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::TCP_Transport::GetPendingBytes
+    //              KDIS::NETWORK::TCP_Transport::IsBackPressured
+    //              KDIS::NETWORK::TCP_Transport::GetRejectedCount
+    // Description: Back-pressure from the peer. Pending bytes are waiting in the write buffer.
+    //              The link is back pressured when the socket last refused to take all of them
+    //              because the peer or link is not keeping up. Rejected is the number of send calls
+    //              whose data was discarded because there was no room for it or no peer, those calls return 0.
+    //************************************
+    KUINT32 GetPendingBytes() const;
+    KBOOL IsBackPressured() const;
+    KUINT64 GetRejectedCount() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::TCP_Transport::ReceivePDU
+    // Description: Returns the next whole PDU in place in the read buffer and its size, or NULL if none
+    //              arrives within the timeout. The PDU is valid until the next receive call.
+    //              Throws INVALID_DATA or PDU_TOO_LARGE if the stream is corrupt, the link is
+    //              then dropped and re-established.
+    // Parameter:   KUINT32 & Size
+    // Parameter:   KINT32 TimeoutUS - 0 to poll, negative to wait forever.
+    //************************************
+    const KOCTET * ReceivePDU( KUINT32 & Size, KINT32 TimeoutUS ) throw( KException );
+
+    // Transport interface. The data sent must be whole PDU or INVALID_DATA is thrown.
+    virtual KINT32 Send( const KOCTET * Data, KUINT32 DataSz ) throw( KException );
+    virtual KINT32 SendGather( const KIOVEC * Parts, KUINT32 Count ) throw( KException );
+    virtual KINT32 SendBatch( const KIOVEC * Datagrams, KUINT32 Count ) throw( KException );
+    virtual KINT32 Receive( KOCTET * Buffer, KUINT32 BufferSz, sockaddr_in & Sender, KINT32 TimeoutUS,
+                            KUINT64 * ArrivalTime = 0, KUINT32 * Dropped = 0 ) throw( KException );
+};
+
+} // END namespace NETWORK
+} // END namespace KDIS
@@ -0,0 +1,89 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./Transport.h"
+#include <string.h>
+
+using namespace KDIS;
+using namespace NETWORK;
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+Transport::~Transport()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 Transport::SendGather( const KIOVEC * Parts, KUINT32 Count ) throw( KException )
+{
+    KOCTET Buffer[MAX_PDU_SIZE];
+    KUINT32 ui32Size = 0;
+
+    for( KUINT32 i = 0; i < Count; ++i )
+    {
+        const KUINT32 ui32PartSz = GetIOVecSize( Parts[i] );
+        if( ui32Size + ui32PartSz > MAX_PDU_SIZE )throw KException( __FUNCTION__, PDU_TOO_LARGE );
+
+        memcpy( Buffer + ui32Size, GetIOVecData( Parts[i] ), ui32PartSz );
+        ui32Size += ui32PartSz;
+    }
+
+    return Send( Buffer, ui32Size );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 Transport::SendBatch( const KIOVEC * Datagrams, KUINT32 Count ) throw( KException )
+{
+    KINT32 iBytesSent = 0;
+
+    for( KUINT32 i = 0; i < Count; ++i )
+    {
+        iBytesSent += Send( GetIOVecData( Datagrams[i] ), GetIOVecSize( Datagrams[i] ) );
+    }
+
+    return iBytesSent;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Transport::AddMulticastAddress( const KString & ) throw( KException )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Transport::RemoveMulticastAddress( const KString & ) throw( KException )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,162 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      Transport
+    created:    19/10/2026
+
+    purpose:    The interface between a Connection and whatever carries its datagrams.
+                A Connection hands each encoded datagram(a PDU or a bundle) to its transport
+                and decodes, filters and dispatches whatever the transport receives, so the
+                same subscribers, factory and handlers work over any carrier.
+                See UDP_Transport, LoopbackTransport and SharedMemoryTransport.
+*********************************************************************/
+
+#pragma once
+
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+#include <WinSock2.h>
+#else
+#include <netinet/in.h>
+#include <sys/uio.h>
+#endif
+
+#include "./../KDefines.h"
+
+namespace KDIS {
+namespace NETWORK {
+
+// A single buffer of a scatter-gather send.
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+typedef WSABUF KIOVEC;
+#else
+typedef iovec KIOVEC;
+#endif
+
+//************************************
+// FullName:    KDIS::NETWORK::SetIOVec
+//              KDIS::NETWORK::GetIOVecData
+//              KDIS::NETWORK::GetIOVecSize
+// Description: Access to a KIOVEC that is the same on all platforms.
+// Parameter:   KIOVEC & V
+// Parameter:   const KOCTET * Data
+// Parameter:   KUINT32 Size
+//************************************
+inline void SetIOVec( KIOVEC & V, const KOCTET * Data, KUINT32 Size )
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    V.buf = ( CHAR * )Data;
+    V.len = Size;
+#else
+    V.iov_base = ( void * )Data;
+    V.iov_len = Size;
+#endif
+}
+
+inline const KOCTET * GetIOVecData( const KIOVEC & V )
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    return V.buf;
+#else
+    return ( const KOCTET * )V.iov_base;
+#endif
+}
+
+inline KUINT32 GetIOVecSize( const KIOVEC & V )
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    return V.len;
+#else
+    return ( KUINT32 )V.iov_len;
+#endif
+}
+
+class KDIS_EXPORT Transport
+{
+public:
+
+    virtual ~Transport();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Transport::Send
+    // Description: Sends a single datagram. Returns number of bytes sent.
+    // Parameter:   const KOCTET * Data
+    // Parameter:   KUINT32 DataSz
+    //************************************
+    virtual KINT32 Send( const KOCTET * Data, KUINT32 DataSz ) throw( KException ) = 0;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Transport::SendGather
+    // Description: Sends the parts as a single datagram, in order. Returns number of bytes sent.
+    //              By default the parts are copied into one buffer and passed to Send, transports
+    //              that can gather in place should override it.
+    //              Throws PDU_TOO_LARGE if the parts total more than MAX_PDU_SIZE.
+    // Parameter:   const KIOVEC * Parts
+    // Parameter:   KUINT32 Count
+    //************************************
+    virtual KINT32 SendGather( const KIOVEC * Parts, KUINT32 Count ) throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Transport::SendBatch
+    // Description: Sends each buffer as its own datagram. Returns number of bytes sent.
+    //              By default Send is called for each, transports that can hand several datagrams
+    //              to the system in one call should override it.
+    // Parameter:   const KIOVEC * Datagrams
+    // Parameter:   KUINT32 Count
+    //************************************
+    virtual KINT32 SendBatch( const KIOVEC * Datagrams, KUINT32 Count ) throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Transport::Receive
+    // Description: Receives the next datagram, returns its size or 0 if none arrived within the timeout.
+    // Parameter:   KOCTET * Buffer
+    // Parameter:   KUINT32 BufferSz
+    // Parameter:   sockaddr_in & Sender - set to the sender of the datagram.
+    // Parameter:   KINT32 TimeoutUS - 0 to poll, negative to wait forever.
+    // Parameter:   KUINT64 * ArrivalTime - Optional field. Set to the arrival time in nanoseconds since
+    //                                      the epoch if the transport records it, else 0.
+    // Parameter:   KUINT32 * Dropped - Optional field. Set to the number of datagrams the transport
+    //                                  has lost since the last call, else 0.
+    //************************************
+    virtual KINT32 Receive( KOCTET * Buffer, KUINT32 BufferSz, sockaddr_in & Sender, KINT32 TimeoutUS,
+                            KUINT64 * ArrivalTime = 0, KUINT32 * Dropped = 0 ) throw( KException ) = 0;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::Transport::AddMulticastAddress
+    //              KDIS::NETWORK::Transport::RemoveMulticastAddress
+    // Description: Joins/leaves a multicast group. Transports without groups ignore these,
+    //              which is the default.
+    // Parameter:   const KString & A
+    //************************************
+    virtual void AddMulticastAddress( const KString & A ) throw( KException );
+    virtual void RemoveMulticastAddress( const KString & A ) throw( KException );
+};
+
+} // END namespace NETWORK
+} // END namespace KDIS
@@ -0,0 +1,435 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./UDP_Transport.h"
+#include "./SocketUtils.h"
+#include <string.h>
+
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 ) // Windows Headers //
+
+#include <ws2tcpip.h>
+
+#define CLOSE_SOCKET closesocket
+#define THROW_ERROR throw KException( __FUNCTION__, CONNECTION_SOCKET_ERROR )
+
+#else   // Linux Headers //
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+
+#define INVALID_SOCKET -1
+#define SOCKET_ERROR -1
+#define CLOSE_SOCKET ::close
+#define THROW_ERROR throw KException( __FUNCTION__, CONNECTION_SOCKET_ERROR, strerror( errno ) )
+
+#endif
+
+#define SEND_SOCK 0
+#define RECEIVE_SOCK 1
+
+using namespace KDIS;
+using namespace NETWORK;
+
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+void UDP_Transport::setMembership( const KString & A, KBOOL Join ) throw( KException )
+{
+    ip_mreq mc;
+    mc.imr_multiaddr.s_addr = inet_addr( A.c_str() );
+    mc.imr_interface.s_addr = htonl( INADDR_ANY );
+    KINT32 iRet = setsockopt( m_iSocket[RECEIVE_SOCK], IPPROTO_IP, Join ? IP_ADD_MEMBERSHIP : IP_DROP_MEMBERSHIP,
+                              ( KOCTET* )&mc, sizeof( mc ) );
+    if( iRet == SOCKET_ERROR )
+    {
+        THROW_ERROR;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void UDP_Transport::bindReceiveSocket() throw( KException )
+{
+    // Set the receive socket to be reusable. Useful if your server has
+    // been shut down, and then restarted right away.
+    KINT32 yes = 1;
+    KINT32 iRet = setsockopt( m_iSocket[RECEIVE_SOCK], SOL_SOCKET, SO_REUSEADDR, ( const char * )&yes, sizeof( yes ) );
+    if( iRet == SOCKET_ERROR )
+    {
+        THROW_ERROR;
+    }
+
+    sockaddr_in Address;
+    memset( &Address, 0, sizeof( Address ) );
+    Address.sin_family = AF_INET;
+    Address.sin_addr.s_addr = htonl( INADDR_ANY );
+    Address.sin_port = htons( m_uiPort );
+    iRet = bind( m_iSocket[RECEIVE_SOCK], ( sockaddr* )&Address, sizeof( Address ) );
+    if( iRet == SOCKET_ERROR )
+    {
+        THROW_ERROR;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void UDP_Transport::close()
+{
+    for( KUINT8 i = 0; i < 2; ++i )
+    {
+        if( m_iSocket[i] != INVALID_SOCKET )
+        {
+            CLOSE_SOCKET( m_iSocket[i] );
+            m_iSocket[i] = INVALID_SOCKET;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+UDP_Transport::UDP_Transport( const KString & SendAddress, KUINT32 Port /* = 3000 */, KBOOL SendAddressIsMulticast /* = false */,
+                              KBOOL SendOnly /* = false */ ) throw( KException ) :
+    m_uiPort( Port ),
+    m_bSendOnly( SendOnly ),
+    m_bBlocking( true ),
+    m_bTimestamps( false ),
+    m_bDetectDrops( false ),
+    m_ui32DropCount( 0 )
+{
+    m_iSocket[SEND_SOCK] = INVALID_SOCKET;
+    m_iSocket[RECEIVE_SOCK] = INVALID_SOCKET;
+
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    WSADATA w;
+    static KINT32 iWinSockInit = WSAStartup( 0x0202, &w ); // Init with winsock version 2.2
+    if( iWinSockInit != NO_ERROR )
+    {
+        THROW_ERROR;
+    }
+#endif
+
+    try
+    {
+        for( KUINT8 i = 0; i < 2; ++i )
+        {
+            m_iSocket[i] = socket( AF_INET, SOCK_DGRAM, IPPROTO_UDP );
+            if( m_iSocket[i] == INVALID_SOCKET )
+            {
+                THROW_ERROR;
+            }
+        }
+
+        if( !SendOnly )
+        {
+            bindReceiveSocket();
+        }
+
+        SetSendAddress( SendAddress, SendAddressIsMulticast );
+    }
+    catch( const KException & )
+    {
+        close();
+        throw;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+UDP_Transport::~UDP_Transport()
+{
+    close();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void UDP_Transport::SetSendAddress( const KString & A, KBOOL Multicast /* = false */ ) throw( KException )
+{
+    m_sSendAddress = A;
+
+    memset( &m_SendToAddr, 0, sizeof( m_SendToAddr ) );
+    m_SendToAddr.sin_family = AF_INET;
+    m_SendToAddr.sin_addr.s_addr = inet_addr( m_sSendAddress.c_str() );
+    m_SendToAddr.sin_port = htons( m_uiPort );
+
+    if( Multicast )
+    {
+        AddMulticastAddress( A );
+    }
+    else
+    {
+        KINT32 yes = 1;
+        KINT32 iRet = setsockopt( m_iSocket[SEND_SOCK], SOL_SOCKET, SO_BROADCAST, ( const char * )&yes, sizeof( yes ) );
+        if( iRet == SOCKET_ERROR )
+        {
+            THROW_ERROR;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const KString & UDP_Transport::GetSendAddress() const
+{
+    return m_sSendAddress;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 UDP_Transport::GetPort() const
+{
+    return m_uiPort;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 UDP_Transport::GetSocket( KBOOL Receive ) const
+{
+    return m_iSocket[Receive ? RECEIVE_SOCK : SEND_SOCK];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void UDP_Transport::ResetReceiveSocket( KBOOL Bind ) throw( KException )
+{
+    if( m_iSocket[RECEIVE_SOCK] != INVALID_SOCKET )
+    {
+        CLOSE_SOCKET( m_iSocket[RECEIVE_SOCK] );
+    }
+
+    m_iSocket[RECEIVE_SOCK] = socket( AF_INET, SOCK_DGRAM, IPPROTO_UDP );
+    if( m_iSocket[RECEIVE_SOCK] == INVALID_SOCKET )
+    {
+        THROW_ERROR;
+    }
+
+    if( Bind && !m_bSendOnly )
+    {
+        bindReceiveSocket();
+    }
+
+    if( m_bTimestamps )KDIS::NETWORK::SetReceiveTimestampsEnabled( m_iSocket[RECEIVE_SOCK], true );
+    if( m_bDetectDrops )SetDropCountEnabled( m_iSocket[RECEIVE_SOCK], true );
+    m_ui32DropCount = 0;
+
+    if( !m_bBlocking )SetBlockingModeEnabled( false );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void UDP_Transport::SetBlockingModeEnabled( KBOOL E ) throw( KException )
+{
+    m_bBlocking = E;
+
+    for( KUINT8 i = 0; i < 2; ++i )
+    {
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+        unsigned long int uliIoctBlock = !E; // 1 enable, 0 disable.
+        KINT32 iRet = ioctlsocket( m_iSocket[i], FIONBIO, &uliIoctBlock );
+#else
+        KINT32 iRet = fcntl( m_iSocket[i], F_GETFL, 0 );
+        if( iRet != SOCKET_ERROR )
+        {
+            iRet = fcntl( m_iSocket[i], F_SETFL, E ? iRet & ~O_NONBLOCK : iRet | O_NONBLOCK );
+        }
+#endif
+        if( iRet == SOCKET_ERROR )
+        {
+            THROW_ERROR;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL UDP_Transport::IsBlockingModeEnabled() const
+{
+    return m_bBlocking;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void UDP_Transport::SetReceiveTimestampsEnabled( KBOOL E )
+{
+    m_bTimestamps = E;
+    KDIS::NETWORK::SetReceiveTimestampsEnabled( m_iSocket[RECEIVE_SOCK], E );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void UDP_Transport::SetDropDetectionEnabled( KBOOL E )
+{
+    m_bDetectDrops = E;
+    SetDropCountEnabled( m_iSocket[RECEIVE_SOCK], E );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 UDP_Transport::Send( const KOCTET * Data, KUINT32 DataSz ) throw( KException )
+{
+    KINT32 iBytesSent = sendto( m_iSocket[SEND_SOCK], Data, DataSz, 0, ( sockaddr * )&m_SendToAddr, sizeof( m_SendToAddr ) );
+    if( iBytesSent == SOCKET_ERROR )
+    {
+        THROW_ERROR;
+    }
+
+    return iBytesSent;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 UDP_Transport::SendGather( const KIOVEC * Parts, KUINT32 Count ) throw( KException )
+{
+#if defined( WIN32 ) | defined( _WIN32 ) | defined( WIN64 ) | defined( _WIN64 )
+    DWORD dwBytesSent = 0;
+    KINT32 iRet = WSASendTo( m_iSocket[SEND_SOCK], ( LPWSABUF )Parts, ( DWORD )Count, &dwBytesSent, 0,
+                             ( sockaddr * )&m_SendToAddr, sizeof( m_SendToAddr ), NULL, NULL );
+    KINT32 iBytesSent = ( iRet == SOCKET_ERROR ) ? SOCKET_ERROR : ( KINT32 )dwBytesSent;
+#else
+    msghdr msg;
+    memset( &msg, 0, sizeof( msg ) );
+    msg.msg_name = &m_SendToAddr;
+    msg.msg_namelen = sizeof( m_SendToAddr );
+    msg.msg_iov = ( iovec * )Parts;
+    msg.msg_iovlen = Count;
+    KINT32 iBytesSent = sendmsg( m_iSocket[SEND_SOCK], &msg, 0 );
+#endif
+
+    if( iBytesSent == SOCKET_ERROR )
+    {
+        THROW_ERROR;
+    }
+
+    return iBytesSent;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 UDP_Transport::SendBatch( const KIOVEC * Datagrams, KUINT32 Count ) throw( KException )
+{
+#if defined( __linux__ )
+    // Hand the datagrams to the kernel a block at a time, the headers live on the stack.
+    const KUINT32 BLOCK = 64;
+    mmsghdr msgs[BLOCK];
+    KINT32 iBytesSent = 0;
+
+    KUINT32 ui32Sent = 0;
+    while( ui32Sent < Count )
+    {
+        const KUINT32 ui32Block = Count - ui32Sent < BLOCK ? Count - ui32Sent : BLOCK;
+        memset( msgs, 0, sizeof( mmsghdr ) * ui32Block );
+        for( KUINT32 i = 0; i < ui32Block; ++i )
+        {
+            msgs[i].msg_hdr.msg_name = &m_SendToAddr;
+            msgs[i].msg_hdr.msg_namelen = sizeof( m_SendToAddr );
+            msgs[i].msg_hdr.msg_iov = ( iovec * )&Datagrams[ui32Sent + i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        KINT32 iRet = sendmmsg( m_iSocket[SEND_SOCK], msgs, ui32Block, 0 );
+        if( iRet == SOCKET_ERROR )
+        {
+            THROW_ERROR;
+        }
+
+        // The kernel may accept fewer than asked, carry on from there.
+        for( KINT32 i = 0; i < iRet; ++i )
+        {
+            iBytesSent += msgs[i].msg_len;
+        }
+        ui32Sent += iRet;
+    }
+
+    return iBytesSent;
+#else
+    return Transport::SendBatch( Datagrams, Count );
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KINT32 UDP_Transport::Receive( KOCTET * Buffer, KUINT32 BufferSz, sockaddr_in & Sender, KINT32 TimeoutUS,
+                               KUINT64 * ArrivalTime /* = 0 */, KUINT32 * Dropped /* = 0 */ ) throw( KException )
+{
+    if( ArrivalTime )*ArrivalTime = 0;
+    if( Dropped )*Dropped = 0;
+
+    fd_set fd;
+    FD_ZERO( &fd );
+    FD_SET( m_iSocket[RECEIVE_SOCK], &fd );
+
+    timeval tval;
+    tval.tv_sec = TimeoutUS / 1000000;
+    tval.tv_usec = TimeoutUS % 1000000;
+
+    KINT32 iRet = select( m_iSocket[RECEIVE_SOCK] + 1, &fd, 0, 0, TimeoutUS < 0 ? 0 : &tval );
+    if( iRet == SOCKET_ERROR )
+    {
+        THROW_ERROR;
+    }
+
+    if( !iRet )return 0;
+
+    KUINT32 ui32DropCount = m_ui32DropCount;
+    iRet = ReceiveDatagram( m_iSocket[RECEIVE_SOCK], Buffer, BufferSz, Sender, m_bTimestamps ? ArrivalTime : 0,
+                            m_bDetectDrops ? &ui32DropCount : 0 );
+    if( iRet == SOCKET_ERROR )
+    {
+        THROW_ERROR;
+    }
+
+    // The kernel reports a running total, it wraps at 32 bits.
+    if( Dropped )*Dropped = ui32DropCount - m_ui32DropCount;
+    m_ui32DropCount = ui32DropCount;
+
+    return iRet;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void UDP_Transport::AddMulticastAddress( const KString & A ) throw( KException )
+{
+    setMembership( A, true );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void UDP_Transport::RemoveMulticastAddress( const KString & A ) throw( KException )
+{
+    setMembership( A, false );
+}
+
+//////////////////////////////////////////////////////////////////////////
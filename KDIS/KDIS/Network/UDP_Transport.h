@@ -0,0 +1,154 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      UDP_Transport
+    created:    19/10/2026
+
+    purpose:    A Transport over IPv4 UDP sockets, one for sending and one bound to the port
+                for receiving, as used by Connection. Batches are handed to the kernel with a
+                single sendmmsg call where it is available.
+*********************************************************************/
+
+#pragma once
+
+#include "./Transport.h"
+
+namespace KDIS {
+namespace NETWORK {
+
+class KDIS_EXPORT UDP_Transport : public Transport
+{
+protected:
+
+    KINT32 m_iSocket[2]; // 1 for sending & 1 for receiving.
+
+    KUINT32 m_uiPort;
+
+    KBOOL m_bSendOnly;
+    KBOOL m_bBlocking;
+
+    sockaddr_in m_SendToAddr;
+    KString m_sSendAddress;
+
+    KBOOL m_bTimestamps;
+    KBOOL m_bDetectDrops;
+    KUINT32 m_ui32DropCount;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::UDP_Transport::setMembership
+    // Description: Joins or leaves a multicast group.
+    // Parameter:   const KString & A
+    // Parameter:   KBOOL Join
+    //************************************
+    void setMembership( const KString & A, KBOOL Join ) throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::UDP_Transport::bindReceiveSocket
+    // Description: Binds the receive socket to the port to receive data from all.
+    //************************************
+    void bindReceiveSocket() throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::UDP_Transport::close
+    // Description: Closes the sockets.
+    //************************************
+    void close();
+
+public:
+
+    // Note: If using multicast you should ensure you use a correct multicast address or an exception will occur.
+    UDP_Transport( const KString & SendAddress, KUINT32 Port = 3000, KBOOL SendAddressIsMulticast = false,
+                   KBOOL SendOnly = false ) throw( KException );
+
+    virtual ~UDP_Transport();
+
+    //************************************
+    // FullName:    KDIS::NETWORK::UDP_Transport::SetSendAddress
+    //              KDIS::NETWORK::UDP_Transport::GetSendAddress
+    // Description: The address data is being sent to, if multicast then
+    //              AddMulticastAddress will also be called.
+    // Parameter:   const KString & A
+    // Parameter:   KBOOL Multicast = false
+    //************************************
+    void SetSendAddress( const KString & A, KBOOL Multicast = false ) throw( KException );
+    const KString & GetSendAddress() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::UDP_Transport::GetPort
+    //              KDIS::NETWORK::UDP_Transport::GetSocket
+    // Description: The port and sockets, the sockets can be tuned with the SocketUtils functions.
+    //              The receive socket is only bound when the transport is not send only.
+    // Parameter:   KBOOL Receive
+    //************************************
+    KUINT32 GetPort() const;
+    KINT32 GetSocket( KBOOL Receive ) const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::UDP_Transport::ResetReceiveSocket
+    // Description: Replaces the receive socket with a new one, e.g so that receive shards can take over
+    //              the port. When Bind is set and the transport is not send only the new socket is bound
+    //              to the port. Timestamps, drop detection and the blocking mode are applied again,
+    //              multicast groups must be joined again by the caller.
+    // Parameter:   KBOOL Bind
+    //************************************
+    void ResetReceiveSocket( KBOOL Bind ) throw( KException );
+
+    //************************************
+    // FullName:    KDIS::NETWORK::UDP_Transport::SetBlockingModeEnabled
+    //              KDIS::NETWORK::UDP_Transport::IsBlockingModeEnabled
+    // Description: Blocking or non blocking sockets, Receive always waits with select so this only
+    //              changes whether sending waits for space in the send buffer. Enabled by default.
+    // Parameter:   KBOOL E
+    //************************************
+    void SetBlockingModeEnabled( KBOOL E ) throw( KException );
+    KBOOL IsBlockingModeEnabled() const;
+
+    //************************************
+    // FullName:    KDIS::NETWORK::UDP_Transport::SetReceiveTimestampsEnabled
+    //              KDIS::NETWORK::UDP_Transport::SetDropDetectionEnabled
+    // Description: Report the kernel arrival time and the datagrams the kernel dropped from Receive,
+    //              see the SocketUtils functions of the same name. Both are disabled by default.
+    // Parameter:   KBOOL E
+    //************************************
+    void SetReceiveTimestampsEnabled( KBOOL E );
+    void SetDropDetectionEnabled( KBOOL E );
+
+    // Transport interface.
+    virtual KINT32 Send( const KOCTET * Data, KUINT32 DataSz ) throw( KException );
+    virtual KINT32 SendGather( const KIOVEC * Parts, KUINT32 Count ) throw( KException );
+    virtual KINT32 SendBatch( const KIOVEC * Datagrams, KUINT32 Count ) throw( KException );
+    virtual KINT32 Receive( KOCTET * Buffer, KUINT32 BufferSz, sockaddr_in & Sender, KINT32 TimeoutUS,
+                            KUINT64 * ArrivalTime = 0, KUINT32 * Dropped = 0 ) throw( KException );
+    virtual void AddMulticastAddress( const KString & A ) throw( KException );
+    virtual void RemoveMulticastAddress( const KString & A ) throw( KException );
+};
+
+} // END namespace NETWORK
+} // END namespace KDIS
@@ -82,6 +82,17 @@ void Bundle::AddPDU( const KDataStream & K ) throw( KException )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Bundle::AddPDU( KDataStream && K ) throw( KException )
+{
+    m_ui16Length += K.GetBufferSize();
+    m_vStreams.push_back( std::move( K ) );
+    if( m_ui16Length > MAX_PDU_SIZE )throw KException( __FUNCTION__, PDU_TOO_LARGE );
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 void Bundle::AddPDU( PduPtr H ) throw( KException )
 {
     m_vRefHeaders.push_back( H );
@@ -100,6 +111,17 @@ void Bundle::SetPDUs( const vector<KDataStream> & P ) throw( KException )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Bundle::SetPDUs( vector<KDataStream> && P ) throw( KException )
+{
+    m_vStreams = std::move( P );
+    calculateLength();
+    if( m_ui16Length > MAX_PDU_SIZE )throw KException( __FUNCTION__, PDU_TOO_LARGE );
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 void Bundle::SetPDUs( const vector<PduPtr> & P ) throw( KException )
 {
     m_vRefHeaders = P;
@@ -109,6 +131,17 @@ void Bundle::SetPDUs( const vector<PduPtr> & P ) throw( KException )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Bundle::SetPDUs( vector<PduPtr> && P ) throw( KException )
+{
+    m_vRefHeaders = std::move( P );
+    calculateLength();
+    if( m_ui16Length > MAX_PDU_SIZE )throw KException( __FUNCTION__, PDU_TOO_LARGE );
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 void Bundle::SetPDUs( const vector<KDataStream> & Streams, const vector<PduPtr> & References ) throw( KException )
 {
     m_vStreams = Streams;
@@ -119,6 +152,18 @@ void Bundle::SetPDUs( const vector<KDataStream> & Streams, const vector<PduPtr>
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Bundle::SetPDUs( vector<KDataStream> && Streams, vector<PduPtr> && References ) throw( KException )
+{
+    m_vStreams = std::move( Streams );
+    m_vRefHeaders = std::move( References );
+    calculateLength();
+    if( m_ui16Length > MAX_PDU_SIZE )throw KException( __FUNCTION__, PDU_TOO_LARGE );
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<KDataStream> & Bundle::GetPDUStreams() const
 {
     return m_vStreams;
@@ -195,13 +240,23 @@ void Bundle::Encode( KDataStream & stream ) const
 {
     // TODO: Check for 64 bit alignment and pad
 
+    // Every member is written straight into the stream, size it once up front.
+    stream.Reserve( m_ui16Length );
+
     vector<KDataStream>::const_iterator citrObj = m_vStreams.begin();
     vector<KDataStream>::const_iterator citrObjEnd = m_vStreams.end();
     for( ; citrObj != citrObjEnd; ++citrObj )
     {
-        stream.CopyFromBuffer( citrObj->GetBufferPtr(), citrObj->GetBufferSize() );
+        if( citrObj->GetBufferSize() )stream.Write( citrObj->GetBufferPtr(), citrObj->GetBufferSize() );
     }
 
+    EncodeRefPDUs( stream );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Bundle::EncodeRefPDUs( KDataStream & stream ) const
+{
     vector<PduPtr>::const_iterator citrRef = m_vRefHeaders.begin();
     vector<PduPtr>::const_iterator citrRefEnd = m_vRefHeaders.end();
     for( ; citrRef != citrRefEnd; ++citrRef )
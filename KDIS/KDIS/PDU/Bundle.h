@@ -89,6 +89,8 @@ public:
 
     virtual ~Bundle();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Bundle )
+
     //************************************
     // FullName:    KDIS::PDU::Bundle::AddPDU
     // Description: Adds a PDU stream or referenced PDU to the bundle.
@@ -96,6 +98,9 @@ public:
     // Parameter:   const Header & H, PduPtr H.
     //************************************
     void AddPDU( const KDataStream & K ) throw( KException );
+    #ifdef KDIS_USE_CPP11
+    void AddPDU( KDataStream && K ) throw( KException );
+    #endif
     void AddPDU( PduPtr H ) throw( KException );
 
     //************************************
@@ -107,6 +112,11 @@ public:
     void SetPDUs( const std::vector<KDataStream> & P ) throw( KException );
     void SetPDUs( const std::vector<PduPtr> & P ) throw( KException );
     void SetPDUs( const std::vector<KDataStream> & Streams, const std::vector<PduPtr> & References ) throw( KException );
+    #ifdef KDIS_USE_CPP11
+    void SetPDUs( std::vector<KDataStream> && P ) throw( KException );
+    void SetPDUs( std::vector<PduPtr> && P ) throw( KException );
+    void SetPDUs( std::vector<KDataStream> && Streams, std::vector<PduPtr> && References ) throw( KException );
+    #endif
 
     //************************************
     // FullName:    KDIS::PDU::Bundle::GetPDUStreams
@@ -137,11 +147,21 @@ public:
     //************************************
     // FullName:    KDIS::PDU::Bundle::Encode
     // Description: Convert To Network Data.
+    //              All members are written straight into the stream, pass a cleared stream with
+    //              MAX_PDU_SIZE reserved to reuse it as an encode arena between bundles.
+    //              Connection::SendBundle avoids this copy altogether.
     // Parameter:   KDataStream & stream
     //************************************
     virtual KDataStream Encode() const;
     virtual void Encode( KDataStream & stream ) const;
 
+    //************************************
+    // FullName:    KDIS::PDU::Bundle::EncodeRefPDUs
+    // Description: Encodes only the referenced PDUs, these follow the PDU streams in the bundle.
+    // Parameter:   KDataStream & stream
+    //************************************
+    void EncodeRefPDUs( KDataStream & stream ) const;
+
     KBOOL operator == ( const Bundle & Value ) const;
     KBOOL operator != ( const Bundle & Value ) const;
 };
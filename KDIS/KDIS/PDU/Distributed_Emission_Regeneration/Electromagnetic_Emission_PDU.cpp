@@ -205,6 +205,28 @@ void Electromagnetic_Emission_PDU::SetEmissionSystem( const vector<EmissionSyste
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Electromagnetic_Emission_PDU::SetEmissionSystem( vector<EmissionSystem> && ES )
+{
+    m_vEmissionSystem = std::move( ES );
+    m_ui8NumberOfEmissionSystems = m_vEmissionSystem.size();
+
+    // Data length values are in 32 bits so multiply by 4 to get the PDU length
+    // which is stored in octets.
+    m_ui16PDULength = ELECTROMAGNETIC_EMISSION_PDU_SIZE;
+
+    vector<EmissionSystem>::const_iterator citr = m_vEmissionSystem.begin();
+    vector<EmissionSystem>::const_iterator citrEnd = m_vEmissionSystem.end();
+
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui16PDULength += citr->GetSystemDataLength() * 4;
+    }
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<EmissionSystem> & Electromagnetic_Emission_PDU::GetEmissionSystems() const
 {
     return m_vEmissionSystem;
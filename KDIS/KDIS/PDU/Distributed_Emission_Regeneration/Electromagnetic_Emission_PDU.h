@@ -83,6 +83,8 @@ public:
 
     virtual ~Electromagnetic_Emission_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Electromagnetic_Emission_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Electromagnetic_Emission_PDU::SetEmittingEntityID
     //              KDIS::PDU::Electromagnetic_Emission_PDU::GetEmittingEntityID
@@ -130,6 +132,9 @@ public:
     //************************************
     void AddEmissionSystem( const KDIS::DATA_TYPE::EmissionSystem & ES );
 	void SetEmissionSystem( const std::vector<KDIS::DATA_TYPE::EmissionSystem> & ES );
+	#ifdef KDIS_USE_CPP11
+	void SetEmissionSystem( std::vector<KDIS::DATA_TYPE::EmissionSystem> && ES );
+	#endif
 	const std::vector<KDIS::DATA_TYPE::EmissionSystem> & GetEmissionSystems() const;
     void ClearEmissionSystem();
 
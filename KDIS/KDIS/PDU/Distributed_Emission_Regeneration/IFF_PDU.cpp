@@ -271,6 +271,22 @@ void IFF_PDU::SetLayers( const vector<LyrHdrPtr> & L )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void IFF_PDU::SetLayers( vector<LyrHdrPtr> && L )
+{
+	m_vLayers = std::move( L );
+	m_ui16PDULength = IFF_PDU_SIZE;
+	vector<LyrHdrPtr>::const_iterator citr = m_vLayers.begin();
+	vector<LyrHdrPtr>::const_iterator citrEnd = m_vLayers.end();
+	for( ; citr != citrEnd; ++citr )
+	{
+		m_ui16PDULength += ( *citr )->GetLayerLength();
+	}
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const std::vector<LyrHdrPtr> & IFF_PDU::GetLayers() const
 {
 	return m_vLayers;
@@ -118,6 +118,8 @@ public:
 
     virtual ~IFF_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( IFF_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::IFF_PDU::SetEmittingEntityID
     //              KDIS::PDU::IFF_PDU::GetEmittingEntityID
@@ -204,6 +206,9 @@ public:
     //************************************
     void AddLayer( const KDIS::DATA_TYPE::LyrHdrPtr & L );
 	void SetLayers( const std::vector<KDIS::DATA_TYPE::LyrHdrPtr> & L );
+	#ifdef KDIS_USE_CPP11
+	void SetLayers( std::vector<KDIS::DATA_TYPE::LyrHdrPtr> && L );
+	#endif
 	const std::vector<KDIS::DATA_TYPE::LyrHdrPtr> & GetLayers() const;
 	void ClearLayers();
 	
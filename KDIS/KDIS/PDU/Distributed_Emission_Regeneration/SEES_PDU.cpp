@@ -190,7 +190,19 @@ void SEES_PDU::SetPropulsionSystem( const vector<PropulsionSystem> & PS )
 
 //////////////////////////////////////////////////////////////////////////
 
-const vector<PropulsionSystem> SEES_PDU::GetPropulsionSystem() const
+#ifdef KDIS_USE_CPP11
+void SEES_PDU::SetPropulsionSystem( vector<PropulsionSystem> && PS )
+{
+    m_ui16PDULength -= PropulsionSystem::PROPULSION_SYSTEM_SIZE * m_vPropSys.size();
+    m_vPropSys = std::move( PS );
+    m_ui16NumPropulsionSys = m_vPropSys.size();
+    m_ui16PDULength += m_vPropSys.size() * PropulsionSystem::PROPULSION_SYSTEM_SIZE;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
+const vector<PropulsionSystem> & SEES_PDU::GetPropulsionSystem() const
 {
     return m_vPropSys;
 }
@@ -216,7 +228,19 @@ void SEES_PDU::SetVectoringNozzleSystem( const vector<VectoringNozzleSystem> & V
 
 //////////////////////////////////////////////////////////////////////////
 
-const vector<VectoringNozzleSystem> SEES_PDU::GetVectoringNozzleSystem() const
+#ifdef KDIS_USE_CPP11
+void SEES_PDU::SetVectoringNozzleSystem( vector<VectoringNozzleSystem> && VNS )
+{
+    m_ui16PDULength -= VectoringNozzleSystem::VECTORING_NOZZLE_SYSTEM_SIZE * m_vVecNozzleSys.size();
+    m_vVecNozzleSys = std::move( VNS );
+    m_ui16NumVectoringNozzleSys = m_vVecNozzleSys.size();
+    m_ui16PDULength += VectoringNozzleSystem::VECTORING_NOZZLE_SYSTEM_SIZE * m_vVecNozzleSys.size();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
+const vector<VectoringNozzleSystem> & SEES_PDU::GetVectoringNozzleSystem() const
 {
     return m_vVecNozzleSys;
 }
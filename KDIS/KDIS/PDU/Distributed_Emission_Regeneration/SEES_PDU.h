@@ -85,6 +85,8 @@ public:
 
     virtual ~SEES_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( SEES_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::SEES_PDU::SetOriginatingEntityID
     //              KDIS::PDU::SEES_PDU::GetOriginatingEntityID
@@ -151,7 +153,10 @@ public:
     //************************************
     void AddPropulsionSystem( const KDIS::DATA_TYPE::PropulsionSystem & PS );
 	void SetPropulsionSystem( const std::vector<KDIS::DATA_TYPE::PropulsionSystem> & PS );
-	const std::vector<KDIS::DATA_TYPE::PropulsionSystem> GetPropulsionSystem() const;
+	#ifdef KDIS_USE_CPP11
+	void SetPropulsionSystem( std::vector<KDIS::DATA_TYPE::PropulsionSystem> && PS );
+	#endif
+	const std::vector<KDIS::DATA_TYPE::PropulsionSystem> & GetPropulsionSystem() const;
 
     //************************************
     // FullName:    KDIS::PDU::SEES_PDU::AddVectoringNozzleSystem
@@ -162,7 +167,10 @@ public:
     //************************************
     void AddVectoringNozzleSystem( const KDIS::DATA_TYPE::VectoringNozzleSystem & VNS );
 	void SetVectoringNozzleSystem( const std::vector<KDIS::DATA_TYPE::VectoringNozzleSystem> & VNS );
-	const std::vector<KDIS::DATA_TYPE::VectoringNozzleSystem> GetVectoringNozzleSystem() const;
+	#ifdef KDIS_USE_CPP11
+	void SetVectoringNozzleSystem( std::vector<KDIS::DATA_TYPE::VectoringNozzleSystem> && VNS );
+	#endif
+	const std::vector<KDIS::DATA_TYPE::VectoringNozzleSystem> & GetVectoringNozzleSystem() const;
 
     //************************************
     // FullName:    KDIS::PDU::SEES_PDU::GetAsString
@@ -209,6 +209,23 @@ void Underwater_Acoustic_PDU::SetShafts( const vector<Shaft> & S )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Underwater_Acoustic_PDU::SetShafts( vector<Shaft> && S )
+{
+    // Reset PDU length
+    m_ui16PDULength -= m_vShafts.size() * Shaft::SHAFT_SIZE;
+
+    m_vShafts = std::move( S );
+
+    // Calculate the new PDU length
+    m_ui16PDULength += m_vShafts.size() * Shaft::SHAFT_SIZE;
+
+    m_ui8NumShafts = m_vShafts.size();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<Shaft> & Underwater_Acoustic_PDU::GetShafts() const
 {
     return m_vShafts;
@@ -240,6 +257,23 @@ void Underwater_Acoustic_PDU::SetAPA( const vector<APA> & A )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Underwater_Acoustic_PDU::SetAPA( vector<APA> && A )
+{
+    // Reset PDU length
+    m_ui16PDULength -= m_vAPA.size() * APA::APA_SIZE;
+
+    m_vAPA = std::move( A );
+
+    // Calculate the new PDU length
+    m_ui16PDULength += m_vAPA.size() * APA::APA_SIZE;
+
+    m_ui8NumAPA = m_vAPA.size();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<APA> & Underwater_Acoustic_PDU::GetAPA() const
 {
     return m_vAPA;
@@ -281,6 +315,33 @@ void Underwater_Acoustic_PDU::SetUnderwaterAcousticEmitterSystem( const vector<U
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Underwater_Acoustic_PDU::SetUnderwaterAcousticEmitterSystem( vector<UnderwaterAcousticEmitterSystem> && UAES )
+{
+    // Reset PDU length
+    vector<UnderwaterAcousticEmitterSystem>::const_iterator citr = m_vUAES.begin();
+    vector<UnderwaterAcousticEmitterSystem>::const_iterator citrEnd = m_vUAES.end();
+
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui16PDULength -= citr->GetEmitterSystemDataLength() * 4;
+    }
+
+    m_vUAES = std::move( UAES );
+
+    citr = m_vUAES.begin();
+
+    for( ; citr != m_vUAES.end(); ++citr )
+    {
+        m_ui16PDULength += citr->GetEmitterSystemDataLength() * 4;
+    }
+
+    m_ui8NumEmitterSys = m_vUAES.size();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<UnderwaterAcousticEmitterSystem> & Underwater_Acoustic_PDU::GetUnderwaterAcousticEmitterSystem() const
 {
     return m_vUAES;
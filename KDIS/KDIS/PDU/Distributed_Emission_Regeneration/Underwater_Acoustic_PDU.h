@@ -90,6 +90,8 @@ public:
 
     virtual ~Underwater_Acoustic_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Underwater_Acoustic_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Underwater_Acoustic_PDU::SetEmittingEntityID
     //              KDIS::PDU::Underwater_Acoustic_PDU::GetEmittingEntityID
@@ -173,6 +175,9 @@ public:
     //************************************
     void AddShaft( const KDIS::DATA_TYPE::Shaft & S );
 	void SetShafts( const std::vector<KDIS::DATA_TYPE::Shaft> & S );
+	#ifdef KDIS_USE_CPP11
+	void SetShafts( std::vector<KDIS::DATA_TYPE::Shaft> && S );
+	#endif
 	const std::vector<KDIS::DATA_TYPE::Shaft> & GetShafts() const;
 
     //************************************
@@ -184,6 +189,9 @@ public:
     //************************************
     void AddAPA( const KDIS::DATA_TYPE::APA & A );
 	void SetAPA( const std::vector<KDIS::DATA_TYPE::APA> & A );
+	#ifdef KDIS_USE_CPP11
+	void SetAPA( std::vector<KDIS::DATA_TYPE::APA> && A );
+	#endif
 	const std::vector<KDIS::DATA_TYPE::APA> & GetAPA() const;
 
     //************************************
@@ -195,6 +203,9 @@ public:
     //************************************
     void AddUnderwaterAcousticEmitterSystem( const KDIS::DATA_TYPE::UnderwaterAcousticEmitterSystem & UAES );
 	void SetUnderwaterAcousticEmitterSystem( const std::vector<KDIS::DATA_TYPE::UnderwaterAcousticEmitterSystem> & UAES );
+	#ifdef KDIS_USE_CPP11
+	void SetUnderwaterAcousticEmitterSystem( std::vector<KDIS::DATA_TYPE::UnderwaterAcousticEmitterSystem> && UAES );
+	#endif
 	const std::vector<KDIS::DATA_TYPE::UnderwaterAcousticEmitterSystem> & GetUnderwaterAcousticEmitterSystem() const;
 
     //************************************
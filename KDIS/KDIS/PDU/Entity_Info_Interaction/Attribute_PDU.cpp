@@ -211,6 +211,26 @@ void Attribute_PDU::SetAttributeRecordSets( const vector<AttributeRecordSet> & A
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Attribute_PDU::SetAttributeRecordSets( vector<AttributeRecordSet> && AR )
+{
+    ClearAttributeRecordSet();
+
+    m_vAttributeRecordSets = std::move( AR );
+    m_ui16NumAttrRecSets = m_vAttributeRecordSets.size();
+
+    // Calculate the new pdu length
+    vector<AttributeRecordSet>::const_iterator citr = m_vAttributeRecordSets.begin();
+    vector<AttributeRecordSet>::const_iterator citrEnd = m_vAttributeRecordSets.end();
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui16PDULength += citr->GetRecordLength();
+    }
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<AttributeRecordSet> & Attribute_PDU::GetAttributeRecordSets() const
 {
     return m_vAttributeRecordSets;
@@ -90,6 +90,8 @@ public:
 
     virtual ~Attribute_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Attribute_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Attribute_PDU::SetOriginatingSimulationAddress
     //              KDIS::PDU::Attribute_PDU::GetOriginatingSimulationAddress
@@ -154,6 +156,9 @@ public:
     //************************************
     void AddAttributeRecordSet( const KDIS::DATA_TYPE::AttributeRecordSet & AR );
     void SetAttributeRecordSets( const std::vector<KDIS::DATA_TYPE::AttributeRecordSet> & AR );
+    #ifdef KDIS_USE_CPP11
+    void SetAttributeRecordSets( std::vector<KDIS::DATA_TYPE::AttributeRecordSet> && AR );
+    #endif
     const std::vector<KDIS::DATA_TYPE::AttributeRecordSet> & GetAttributeRecordSets() const;
     void ClearAttributeRecordSet();	
 
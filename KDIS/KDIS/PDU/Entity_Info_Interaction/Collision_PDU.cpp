@@ -249,9 +249,10 @@ KString Collision_PDU::GetAsString() const
 
 //////////////////////////////////////////////////////////////////////////
 
-void Collision_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= true*/ ) throw( KException )
+ErrorCodes Collision_PDU::TryDecode( KDataStream & stream, bool ignoreHeader /*= false*/ )
 {
-    if( ( stream.GetBufferSize() + ( ignoreHeader ? Header::HEADER6_PDU_SIZE : 0 ) ) < COLLISION_PDU_SIZE  )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    // Validate the whole PDU once, none of the reads below can run out of data.
+    if( ( stream.GetBufferSize() + ( ignoreHeader ? Header::HEADER6_PDU_SIZE : 0 ) ) < COLLISION_PDU_SIZE )return NOT_ENOUGH_DATA_IN_BUFFER;
 
     Header::Decode( stream, ignoreHeader );
 
@@ -263,6 +264,16 @@ void Collision_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= true*/ )
            >> KDIS_STREAM m_Velocity
            >> m_f32Mass
            >> KDIS_STREAM m_Location;
+
+    return NO_ERRORS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Collision_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= false*/ ) throw( KException )
+{
+    const ErrorCodes e = Collision_PDU::TryDecode( stream, ignoreHeader );
+    if( e != NO_ERRORS )throw KException( __FUNCTION__, e );
 }
 
 //////////////////////////////////////////////////////////////////////////
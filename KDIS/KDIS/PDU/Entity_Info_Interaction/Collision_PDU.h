@@ -169,11 +169,15 @@ public:
 
     //************************************
     // FullName:    KDIS::PDU::Collision_PDU::Decode
+    //              KDIS::PDU::Collision_PDU::TryDecode
     // Description: Convert From Network Data.
+    //              The stream is checked before the fields are read, TryDecode returns an error
+    //              code instead of throwing.
     // Parameter:   KDataStream & stream
     // Parameter:   bool ignoreHeader = false - Decode the header from the stream?
     //************************************
     virtual void Decode( KDataStream & stream, bool ignoreHeader = false ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream, bool ignoreHeader = false );
 
     //************************************
     // FullName:    KDIS::PDU::Collision_PDU::Encode
@@ -89,13 +89,41 @@ Entity_State_PDU::Entity_State_PDU( const Entity_State_PDU & ESPDU ) :
     m_DeadReckoningParameter( ESPDU.m_DeadReckoningParameter ),
     m_EntityMarking( ESPDU.m_EntityMarking ),
     m_EntityCapabilities( ESPDU.m_EntityCapabilities ),
-    m_vVariableParameters( ESPDU.m_vVariableParameters ),
+    m_VariableParameters( ESPDU.m_VariableParameters ),
     m_pDrCalc( ESPDU.m_pDrCalc ? new DeadReckoningCalculator( *ESPDU.m_pDrCalc ) : NULL )
 {
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+Entity_State_PDU::Entity_State_PDU( Entity_State_PDU && ESPDU ) :
+    Header( ESPDU ),
+    m_EntityID( ESPDU.m_EntityID ),
+    m_ui8ForceID( ESPDU.m_ui8ForceID ),
+    m_ui8NumOfVariableParams( ESPDU.m_ui8NumOfVariableParams ),
+    m_EntityType( ESPDU.m_EntityType ),
+    m_AltEntityType( ESPDU.m_AltEntityType ),
+    m_EntityLinearVelocity( ESPDU.m_EntityLinearVelocity ),
+    m_EntityLocation( ESPDU.m_EntityLocation ),
+    m_EntityOrientation( ESPDU.m_EntityOrientation ),
+    m_EntityAppearance( ESPDU.m_EntityAppearance ),
+    m_DeadReckoningParameter( ESPDU.m_DeadReckoningParameter ),
+    m_EntityMarking( ESPDU.m_EntityMarking ),
+    m_EntityCapabilities( ESPDU.m_EntityCapabilities ),
+    m_VariableParameters( std::move( ESPDU.m_VariableParameters ) ),
+    m_pDrCalc( ESPDU.m_pDrCalc )
+{
+    // We now own the dead reckoning calculator.
+    ESPDU.m_pDrCalc = NULL;
+    ESPDU.m_VariableParameters.Clear();
+    ESPDU.m_ui8NumOfVariableParams = 0;
+    ESPDU.m_ui16PDULength = ENTITY_STATE_PDU_SIZE;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 Entity_State_PDU::Entity_State_PDU( const EntityIdentifier & EI, ForceID ID, const EntityType & Type, const EntityType & AltType,
                                     const Vector & EntityLinearVelocity, const WorldCoordinates & EntityLocation,
                                     const EulerAngles & EntityOrientation, const EntityAppearance & EA,
@@ -411,7 +439,7 @@ EntityCapabilities & Entity_State_PDU::GetEntityCapabilities()
 
 void Entity_State_PDU::AddVariableParameter( VarPrmPtr VP )
 {
-    m_vVariableParameters.push_back( VP );
+    m_VariableParameters.Add( VP );
     ++m_ui8NumOfVariableParams;
     m_ui16PDULength += VariableParameter::VARIABLE_PARAMETER_SIZE;
 }
@@ -420,29 +448,79 @@ void Entity_State_PDU::AddVariableParameter( VarPrmPtr VP )
 
 void Entity_State_PDU::SetVariableParameters( const vector<VarPrmPtr> & VP )
 {
-    m_vVariableParameters = VP;
-    m_ui8NumOfVariableParams = m_vVariableParameters.size();
+    m_VariableParameters.Set( VP );
+    m_ui8NumOfVariableParams = m_VariableParameters.GetCount();
     m_ui16PDULength = ENTITY_STATE_PDU_SIZE + ( m_ui8NumOfVariableParams * VariableParameter::VARIABLE_PARAMETER_SIZE );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Entity_State_PDU::SetVariableParameters( vector<VarPrmPtr> && VP )
+{
+    m_VariableParameters.Set( std::move( VP ) );
+    m_ui8NumOfVariableParams = m_VariableParameters.GetCount();
+    m_ui16PDULength = ENTITY_STATE_PDU_SIZE + ( m_ui8NumOfVariableParams * VariableParameter::VARIABLE_PARAMETER_SIZE );
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<VarPrmPtr> & Entity_State_PDU::GetVariableParameters() const
 {
-    return m_vVariableParameters;
+    return m_VariableParameters.GetVariableParameters();
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 void Entity_State_PDU::ClearVariableParameters()
 {
-    m_vVariableParameters.clear();
+    m_VariableParameters.Clear();
     m_ui8NumOfVariableParams = 0;
     m_ui16PDULength = ENTITY_STATE_PDU_SIZE;
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+void Entity_State_PDU::AddArticulatedPart( const ArticulatedPart & AP )
+{
+    m_VariableParameters.AddArticulatedPart( AP );
+    ++m_ui8NumOfVariableParams;
+    m_ui16PDULength += VariableParameter::VARIABLE_PARAMETER_SIZE;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Entity_State_PDU::AddAttachedPart( const AttachedPart & AP )
+{
+    m_VariableParameters.AddAttachedPart( AP );
+    ++m_ui8NumOfVariableParams;
+    m_ui16PDULength += VariableParameter::VARIABLE_PARAMETER_SIZE;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Entity_State_PDU::SetArticulatedPart( KUINT16 Index, const ArticulatedPart & AP ) throw( KException )
+{
+    m_VariableParameters.SetArticulatedPart( Index, AP );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Entity_State_PDU::SetAttachedPart( KUINT16 Index, const AttachedPart & AP ) throw( KException )
+{
+    m_VariableParameters.SetAttachedPart( Index, AP );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const VariableParameterList & Entity_State_PDU::GetVariableParameterList() const
+{
+    return m_VariableParameters;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 KString Entity_State_PDU::GetAsString() const
 {
     KStringStream ss;
@@ -464,23 +542,24 @@ KString Entity_State_PDU::GetAsString() const
        << m_EntityCapabilities.GetAsString();
 
     // Add the articulated parts
-    vector<VarPrmPtr>::const_iterator citr = m_vVariableParameters.begin();
-    vector<VarPrmPtr>::const_iterator citrEnd = m_vVariableParameters.end();
-    for( ; citr != citrEnd; ++ citr )
-    {
-        ss << ( *citr )->GetAsString();
-    }
+    ss << m_VariableParameters.GetAsString();
 
     return ss.str();
 }
 
 //////////////////////////////////////////////////////////////////////////
 
-void Entity_State_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= true*/ ) throw( KException )
+ErrorCodes Entity_State_PDU::TryDecode( KDataStream & stream, bool ignoreHeader /*= false*/ )
 {
-    if( ( stream.GetBufferSize() + ( ignoreHeader ? Header::HEADER6_PDU_SIZE : 0 ) ) < ENTITY_STATE_PDU_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    // Validate the whole PDU once, including the variable parameters, none of the reads below can run out of data.
+    const KUINT16 ui16HeaderOffset = ignoreHeader ? Header::HEADER6_PDU_SIZE : 0;
+    const KUINT32 ui32Available = stream.GetBufferSize() + ui16HeaderOffset;
+    if( ui32Available < ENTITY_STATE_PDU_SIZE )return NOT_ENOUGH_DATA_IN_BUFFER;
+
+    const KUINT8 ui8NumVarParams = stream.GetBufferPtr()[stream.GetCurrentWritePosition() + 19 - ui16HeaderOffset];
+    if( ui32Available < ( KUINT32 )( ENTITY_STATE_PDU_SIZE + ui8NumVarParams * VariableParameter::VARIABLE_PARAMETER_SIZE ) )return NOT_ENOUGH_DATA_IN_BUFFER;
 
-    m_vVariableParameters.clear();
+    m_VariableParameters.Clear();
 
     Header::Decode( stream, ignoreHeader );
 
@@ -497,43 +576,15 @@ void Entity_State_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= true*
            >> KDIS_STREAM m_EntityMarking
            >> KDIS_STREAM m_EntityCapabilities;
 
-    for( KUINT8 i = 0; i < m_ui8NumOfVariableParams; ++i )
-    {
-        // Save the current write position so we can peek.
-        KUINT16 pos = stream.GetCurrentWritePosition();
-        KUINT8 paramTyp;
-
-        // Extract the  type then reset the stream.
-        stream >> paramTyp;
-        stream.SetCurrentWritePosition( pos );
-
-        // Use the factory decoder.
-        VariableParameter * p = VariableParameter::FactoryDecode( paramTyp, stream );
-
-        // Did we find a custom decoder? if not then use the default.
-        if( p )
-        {
-            m_vVariableParameters.push_back( VarPrmPtr( p ) );
-        }
-        else
-        {
-            // Default internals
-            switch( paramTyp )
-            {
-                case ArticulatedPartType:
-                    m_vVariableParameters.push_back( VarPrmPtr( new ArticulatedPart( stream ) ) );
-                    break;
-
-                case AttachedPartType:
-                    m_vVariableParameters.push_back( VarPrmPtr( new AttachedPart( stream ) ) );
-                    break;
-
-                default:
-                    m_vVariableParameters.push_back( VarPrmPtr( new VariableParameter( stream ) ) );
-                    break;
-            }
-        }
-    }
+    return m_VariableParameters.TryDecode( stream, m_ui8NumOfVariableParams );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Entity_State_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= false*/ ) throw( KException )
+{
+    const ErrorCodes e = Entity_State_PDU::TryDecode( stream, ignoreHeader );
+    if( e != NO_ERRORS )throw KException( __FUNCTION__, e );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -566,12 +617,7 @@ void Entity_State_PDU::Encode( KDataStream & stream ) const
            << KDIS_STREAM m_EntityCapabilities;
 
     // Add the articulated parts
-    vector<VarPrmPtr>::const_iterator citr = m_vVariableParameters.begin();
-    vector<VarPrmPtr>::const_iterator citrEnd = m_vVariableParameters.end();
-    for( ; citr != citrEnd; ++ citr )
-    {
-        ( *citr )->Encode( stream );
-    }
+    m_VariableParameters.Encode( stream );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -591,7 +637,7 @@ Entity_State_PDU & Entity_State_PDU::operator=( const Entity_State_PDU & Other )
     m_DeadReckoningParameter = Other.m_DeadReckoningParameter;
     m_EntityMarking = Other.m_EntityMarking;
     m_EntityCapabilities = Other.m_EntityCapabilities;
-    m_vVariableParameters = Other.m_vVariableParameters;
+    m_VariableParameters = Other.m_VariableParameters;
 
     if (m_pDrCalc && m_pDrCalc != Other.m_pDrCalc)
         delete m_pDrCalc;
@@ -601,6 +647,39 @@ Entity_State_PDU & Entity_State_PDU::operator=( const Entity_State_PDU & Other )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+Entity_State_PDU & Entity_State_PDU::operator=( Entity_State_PDU && Other )
+{
+    if( this == &Other )return *this;
+
+    Header::operator=( Other );
+    m_EntityID = Other.m_EntityID;
+    m_ui8ForceID = Other.m_ui8ForceID;
+    m_ui8NumOfVariableParams = Other.m_ui8NumOfVariableParams;
+    m_EntityType = Other.m_EntityType;
+    m_AltEntityType = Other.m_AltEntityType;
+    m_EntityLinearVelocity = Other.m_EntityLinearVelocity;
+    m_EntityLocation = Other.m_EntityLocation;
+    m_EntityOrientation = Other.m_EntityOrientation;
+    m_EntityAppearance = Other.m_EntityAppearance;
+    m_DeadReckoningParameter = Other.m_DeadReckoningParameter;
+    m_EntityMarking = Other.m_EntityMarking;
+    m_EntityCapabilities = Other.m_EntityCapabilities;
+    m_VariableParameters = std::move( Other.m_VariableParameters );
+    Other.m_VariableParameters.Clear();
+    Other.m_ui8NumOfVariableParams = 0;
+    Other.m_ui16PDULength = ENTITY_STATE_PDU_SIZE;
+
+    // Take the dead reckoning calculator.
+    delete m_pDrCalc;
+    m_pDrCalc = Other.m_pDrCalc;
+    Other.m_pDrCalc = NULL;
+    return *this;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 KBOOL Entity_State_PDU::operator == ( const Entity_State_PDU & Value ) const
 {
     if( Header::operator              !=( Value ) )                              return false;
@@ -616,7 +695,7 @@ KBOOL Entity_State_PDU::operator == ( const Entity_State_PDU & Value ) const
     if( m_DeadReckoningParameter      != Value.m_DeadReckoningParameter )        return false;
     if( m_EntityMarking               != Value.m_EntityMarking )                 return false;
     if( m_EntityCapabilities          != Value.m_EntityCapabilities )            return false;
-    if( m_vVariableParameters         != Value.m_vVariableParameters )           return false;
+    if( m_VariableParameters         != Value.m_VariableParameters )           return false;
     return true;
 }
 
@@ -49,7 +49,7 @@ http://p.sf.net/kdis/UserGuide
 #include "./../../DataTypes/DeadReckoningParameter.h"
 #include "./../../DataTypes/EntityMarking.h"
 #include "./../../DataTypes/EntityCapabilities.h"
-#include "./../../DataTypes/VariableParameter.h"
+#include "./../../DataTypes/VariableParameterList.h"
 #include "./../../Extras/DeadReckoningCalculator.h"
 #include <vector>
 
@@ -84,7 +84,7 @@ protected:
 
     KDIS::DATA_TYPE::EntityCapabilities m_EntityCapabilities;
 
-    std::vector<KDIS::DATA_TYPE::VarPrmPtr> m_vVariableParameters;
+    KDIS::DATA_TYPE::VariableParameterList m_VariableParameters;
 
     KDIS::UTILS::DeadReckoningCalculator * m_pDrCalc;
 
@@ -101,6 +101,10 @@ public:
 
     Entity_State_PDU( const Entity_State_PDU & ESPDU );
 
+    #ifdef KDIS_USE_CPP11
+    Entity_State_PDU( Entity_State_PDU && ESPDU );
+    #endif
+
     Entity_State_PDU( const KDIS::DATA_TYPE::EntityIdentifier & EI, KDIS::DATA_TYPE::ENUMS::ForceID ID, const KDIS::DATA_TYPE::EntityType & Type,
                       const KDIS::DATA_TYPE::EntityType & AltType, const KDIS::DATA_TYPE::Vector & EntityLinearVelocity,
                       const KDIS::DATA_TYPE::WorldCoordinates & EntityLocation, const KDIS::DATA_TYPE::EulerAngles & EntityOrientation,
@@ -284,13 +288,37 @@ public:
     // Description: Information associated with an entity or detonation, not otherwise accounted
     //	            for in a PDU such as Articulated and Attached Parts.
     //              See VariableParameter for supported/implemented types.
+    //              Changes made through the objects from GetVariableParameters are encoded,
+    //              see VariableParameterList::GetVariableParameters.
     // Parameter:   VarPrmPtr VP, vector<VarPrmPtr> & VP
     //************************************
     void AddVariableParameter( KDIS::DATA_TYPE::VarPrmPtr VP );
     void SetVariableParameters( const std::vector<KDIS::DATA_TYPE::VarPrmPtr> & VP );
+    #ifdef KDIS_USE_CPP11
+    void SetVariableParameters( std::vector<KDIS::DATA_TYPE::VarPrmPtr> && VP );
+    #endif
     const std::vector<KDIS::DATA_TYPE::VarPrmPtr> & GetVariableParameters() const;
     void ClearVariableParameters();
 
+    //************************************
+    // FullName:    KDIS::PDU::Entity_State_PDU::AddArticulatedPart
+    //              KDIS::PDU::Entity_State_PDU::AddAttachedPart
+    //              KDIS::PDU::Entity_State_PDU::SetArticulatedPart
+    //              KDIS::PDU::Entity_State_PDU::SetAttachedPart
+    //              KDIS::PDU::Entity_State_PDU::GetVariableParameterList
+    // Description: Adds a part by value, it is stored inline in the PDU without allocating.
+    //              Set replaces the record at Index, throws OUT_OF_BOUNDS if Index is invalid.
+    //              GetVariableParameterList gives typed access to the records without
+    //              allocating objects as GetVariableParameters does.
+    // Parameter:   KUINT16 Index
+    // Parameter:   const ArticulatedPart & AP, const AttachedPart & AP
+    //************************************
+    void AddArticulatedPart( const KDIS::DATA_TYPE::ArticulatedPart & AP );
+    void AddAttachedPart( const KDIS::DATA_TYPE::AttachedPart & AP );
+    void SetArticulatedPart( KUINT16 Index, const KDIS::DATA_TYPE::ArticulatedPart & AP ) throw( KException );
+    void SetAttachedPart( KUINT16 Index, const KDIS::DATA_TYPE::AttachedPart & AP ) throw( KException );
+    const KDIS::DATA_TYPE::VariableParameterList & GetVariableParameterList() const;
+
     //************************************
     // FullName:    KDIS::PDU::Entity_State_PDU::GetAsString
     // Description: Returns a string representation of the PDU. Great for debugging!
@@ -299,11 +327,15 @@ public:
 
     //************************************
     // FullName:    KDIS::PDU::Entity_State_PDU::Decode
+    //              KDIS::PDU::Entity_State_PDU::TryDecode
     // Description: Convert From Network Data.
+    //              The stream is checked once for the whole PDU and the fields are then read
+    //              without further checks, TryDecode returns an error code instead of throwing.
     // Parameter:   KDataStream & stream
     // Parameter:   bool ignoreHeader = false - Decode the header from the stream?
     //************************************
     virtual void Decode( KDataStream & stream, bool ignoreHeader = false ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream, bool ignoreHeader = false );
 
     //************************************
     // FullName:    KDIS::PDU::Entity_State_PDU::Encode
@@ -314,6 +346,9 @@ public:
     virtual void Encode( KDataStream & stream ) const;
 
     Entity_State_PDU & operator=( const Entity_State_PDU & Other );
+    #ifdef KDIS_USE_CPP11
+    Entity_State_PDU & operator=( Entity_State_PDU && Other );
+    #endif
 
     KBOOL operator == ( const Entity_State_PDU & Value ) const;
     KBOOL operator != ( const Entity_State_PDU & Value ) const;
@@ -119,7 +119,7 @@ EntityIdentifier & Entity_State_Update_PDU::GetEntityIdentifier()
 
 KUINT8 Entity_State_Update_PDU::GetNumberOfVariableParams() const
 {
-    return m_vVariableParameters.size();
+    return m_VariableParameters.GetCount();
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -210,7 +210,7 @@ EntityAppearance & Entity_State_Update_PDU::GetEntityAppearance()
 
 void Entity_State_Update_PDU::AddVariableParameter( VarPrmPtr VP )
 {
-    m_vVariableParameters.push_back( VP );
+    m_VariableParameters.Add( VP );
     ++m_ui8NumOfVariableParams;
     m_ui16PDULength += VariableParameter::VARIABLE_PARAMETER_SIZE;
 }
@@ -219,29 +219,79 @@ void Entity_State_Update_PDU::AddVariableParameter( VarPrmPtr VP )
 
 void Entity_State_Update_PDU::SetVariableParameters( const vector<VarPrmPtr> & VP )
 {
-    m_vVariableParameters = VP;
-    m_ui8NumOfVariableParams = m_vVariableParameters.size();
+    m_VariableParameters.Set( VP );
+    m_ui8NumOfVariableParams = m_VariableParameters.GetCount();
     m_ui16PDULength = ENTITY_STATE_UPDATE_PDU_SIZE + ( m_ui8NumOfVariableParams * VariableParameter::VARIABLE_PARAMETER_SIZE );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Entity_State_Update_PDU::SetVariableParameters( vector<VarPrmPtr> && VP )
+{
+    m_VariableParameters.Set( std::move( VP ) );
+    m_ui8NumOfVariableParams = m_VariableParameters.GetCount();
+    m_ui16PDULength = ENTITY_STATE_UPDATE_PDU_SIZE + ( m_ui8NumOfVariableParams * VariableParameter::VARIABLE_PARAMETER_SIZE );
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<VarPrmPtr> & Entity_State_Update_PDU::GetVariableParameters() const
 {
-    return m_vVariableParameters;
+    return m_VariableParameters.GetVariableParameters();
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 void Entity_State_Update_PDU::ClearVariableParameters()
 {
-    m_vVariableParameters.clear();
+    m_VariableParameters.Clear();
     m_ui8NumOfVariableParams = 0;
     m_ui16PDULength = ENTITY_STATE_UPDATE_PDU_SIZE;
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+void Entity_State_Update_PDU::AddArticulatedPart( const ArticulatedPart & AP )
+{
+    m_VariableParameters.AddArticulatedPart( AP );
+    ++m_ui8NumOfVariableParams;
+    m_ui16PDULength += VariableParameter::VARIABLE_PARAMETER_SIZE;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Entity_State_Update_PDU::AddAttachedPart( const AttachedPart & AP )
+{
+    m_VariableParameters.AddAttachedPart( AP );
+    ++m_ui8NumOfVariableParams;
+    m_ui16PDULength += VariableParameter::VARIABLE_PARAMETER_SIZE;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Entity_State_Update_PDU::SetArticulatedPart( KUINT16 Index, const ArticulatedPart & AP ) throw( KException )
+{
+    m_VariableParameters.SetArticulatedPart( Index, AP );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Entity_State_Update_PDU::SetAttachedPart( KUINT16 Index, const AttachedPart & AP ) throw( KException )
+{
+    m_VariableParameters.SetAttachedPart( Index, AP );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const VariableParameterList & Entity_State_Update_PDU::GetVariableParameterList() const
+{
+    return m_VariableParameters;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 KString Entity_State_Update_PDU::GetAsString() const
 {
     KStringStream ss;
@@ -257,23 +307,24 @@ KString Entity_State_Update_PDU::GetAsString() const
     // We can not print the entity appearance as we do not have the entity type.
 
     // Variable params
-    vector<VarPrmPtr>::const_iterator citr = m_vVariableParameters.begin();
-    vector<VarPrmPtr>::const_iterator citrEnd = m_vVariableParameters.end();
-    for( ; citr != citrEnd; ++ citr )
-    {
-        ss << IndentString( ( *citr )->GetAsString(), 1 );
-    }
+    ss << IndentString( m_VariableParameters.GetAsString(), 1 );
 
     return ss.str();
 }
 
 //////////////////////////////////////////////////////////////////////////
 
-void Entity_State_Update_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= true*/ ) throw( KException )
+ErrorCodes Entity_State_Update_PDU::TryDecode( KDataStream & stream, bool ignoreHeader /*= false*/ )
 {
-    if( ( stream.GetBufferSize() + ( ignoreHeader ? Header::HEADER6_PDU_SIZE : 0 ) ) < ENTITY_STATE_UPDATE_PDU_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    // Validate the whole PDU once, including the variable parameters, none of the reads below can run out of data.
+    const KUINT16 ui16HeaderOffset = ignoreHeader ? Header::HEADER6_PDU_SIZE : 0;
+    const KUINT32 ui32Available = stream.GetBufferSize() + ui16HeaderOffset;
+    if( ui32Available < ENTITY_STATE_UPDATE_PDU_SIZE )return NOT_ENOUGH_DATA_IN_BUFFER;
 
-    m_vVariableParameters.clear();
+    const KUINT8 ui8NumVarParams = stream.GetBufferPtr()[stream.GetCurrentWritePosition() + 19 - ui16HeaderOffset];
+    if( ui32Available < ( KUINT32 )( ENTITY_STATE_UPDATE_PDU_SIZE + ui8NumVarParams * VariableParameter::VARIABLE_PARAMETER_SIZE ) )return NOT_ENOUGH_DATA_IN_BUFFER;
+
+    m_VariableParameters.Clear();
 
     Header::Decode( stream, ignoreHeader );
 
@@ -285,43 +336,15 @@ void Entity_State_Update_PDU::Decode( KDataStream & stream, bool ignoreHeader /*
            >> KDIS_STREAM m_EntityOrientation
            >> KDIS_STREAM m_EntityAppearance;
 
-    for( KUINT8 i = 0; i < m_ui8NumOfVariableParams; ++i )
-    {
-        // Save the current write position so we can peek.
-        KUINT16 pos = stream.GetCurrentWritePosition();
-        KUINT8 paramTyp;
-
-        // Extract the  type then reset the stream.
-        stream >> paramTyp;
-        stream.SetCurrentWritePosition( pos );
-
-        // Use the factory decoder.
-        VariableParameter * p = VariableParameter::FactoryDecode( paramTyp, stream );
-
-        // Did we find a custom decoder? if not then use the default.
-        if( p )
-        {
-            m_vVariableParameters.push_back( VarPrmPtr( p ) );
-        }
-        else
-        {
-            // Default internals
-            switch( paramTyp )
-            {
-                case ArticulatedPartType:
-                    m_vVariableParameters.push_back( VarPrmPtr( new ArticulatedPart( stream ) ) );
-                    break;
+    return m_VariableParameters.TryDecode( stream, m_ui8NumOfVariableParams );
+}
 
-                case AttachedPartType:
-                    m_vVariableParameters.push_back( VarPrmPtr( new AttachedPart( stream ) ) );
-                    break;
+//////////////////////////////////////////////////////////////////////////
 
-                default:
-                    m_vVariableParameters.push_back( VarPrmPtr( new VariableParameter( stream ) ) );
-                    break;
-            }
-        }
-    }
+void Entity_State_Update_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= false*/ ) throw( KException )
+{
+    const ErrorCodes e = Entity_State_Update_PDU::TryDecode( stream, ignoreHeader );
+    if( e != NO_ERRORS )throw KException( __FUNCTION__, e );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -349,12 +372,7 @@ void Entity_State_Update_PDU::Encode( KDataStream & stream ) const
            << KDIS_STREAM m_EntityAppearance;
 
     // Add the articulated parts
-    vector<VarPrmPtr>::const_iterator citr = m_vVariableParameters.begin();
-    vector<VarPrmPtr>::const_iterator citrEnd = m_vVariableParameters.end();
-    for( ; citr != citrEnd; ++ citr )
-    {
-        ( *citr )->Encode( stream );
-    }
+    m_VariableParameters.Encode( stream );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -368,7 +386,7 @@ KBOOL Entity_State_Update_PDU::operator == ( const Entity_State_Update_PDU & Val
     if( m_EntityLocation         != Value.m_EntityLocation )         return false;
     if( m_EntityOrientation      != Value.m_EntityOrientation )      return false;
     if( m_EntityAppearance       != Value.m_EntityAppearance )       return false;
-    if( m_vVariableParameters    != Value.m_vVariableParameters )    return false;
+    if( m_VariableParameters    != Value.m_VariableParameters )    return false;
     return true;
 }
 
@@ -48,7 +48,7 @@ http://p.sf.net/kdis/UserGuide
 #include "./../../DataTypes/EntityType.h"
 #include "./../../DataTypes/EulerAngles.h"
 #include "./../../DataTypes/EntityAppearance.h"
-#include "./../../DataTypes/VariableParameter.h"
+#include "./../../DataTypes/VariableParameterList.h"
 #include <vector>
 
 namespace KDIS {
@@ -72,7 +72,7 @@ protected:
 
     KDIS::DATA_TYPE::EntityAppearance m_EntityAppearance;
 
-    std::vector<KDIS::DATA_TYPE::VarPrmPtr> m_vVariableParameters;
+    KDIS::DATA_TYPE::VariableParameterList m_VariableParameters;
 
 public:
 
@@ -91,6 +91,8 @@ public:
 
     virtual ~Entity_State_Update_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Entity_State_Update_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Entity_State_Update_PDU::SetEntityIdentifier
     //              KDIS::PDU::Entity_State_Update_PDU::GetEntityIdentifier
@@ -154,13 +156,37 @@ public:
     // Description: Information associated with an entity or detonation, not otherwise accounted
     //	            for in a PDU such as Articulated and Attached Parts.
     //              See VariableParameter for supported/implemented types.
+    //              Changes made through the objects from GetVariableParameters are encoded,
+    //              see VariableParameterList::GetVariableParameters.
     // Parameter:   VarPrmPtr VP, vector<VarPrmPtr> & VP
     //************************************
     void AddVariableParameter( KDIS::DATA_TYPE::VarPrmPtr VP );
     void SetVariableParameters( const std::vector<KDIS::DATA_TYPE::VarPrmPtr> & VP );
+    #ifdef KDIS_USE_CPP11
+    void SetVariableParameters( std::vector<KDIS::DATA_TYPE::VarPrmPtr> && VP );
+    #endif
     const std::vector<KDIS::DATA_TYPE::VarPrmPtr> & GetVariableParameters() const;
     void ClearVariableParameters();
 
+    //************************************
+    // FullName:    KDIS::PDU::Entity_State_Update_PDU::AddArticulatedPart
+    //              KDIS::PDU::Entity_State_Update_PDU::AddAttachedPart
+    //              KDIS::PDU::Entity_State_Update_PDU::SetArticulatedPart
+    //              KDIS::PDU::Entity_State_Update_PDU::SetAttachedPart
+    //              KDIS::PDU::Entity_State_Update_PDU::GetVariableParameterList
+    // Description: Adds a part by value, it is stored inline in the PDU without allocating.
+    //              Set replaces the record at Index, throws OUT_OF_BOUNDS if Index is invalid.
+    //              GetVariableParameterList gives typed access to the records without
+    //              allocating objects as GetVariableParameters does.
+    // Parameter:   KUINT16 Index
+    // Parameter:   const ArticulatedPart & AP, const AttachedPart & AP
+    //************************************
+    void AddArticulatedPart( const KDIS::DATA_TYPE::ArticulatedPart & AP );
+    void AddAttachedPart( const KDIS::DATA_TYPE::AttachedPart & AP );
+    void SetArticulatedPart( KUINT16 Index, const KDIS::DATA_TYPE::ArticulatedPart & AP ) throw( KException );
+    void SetAttachedPart( KUINT16 Index, const KDIS::DATA_TYPE::AttachedPart & AP ) throw( KException );
+    const KDIS::DATA_TYPE::VariableParameterList & GetVariableParameterList() const;
+
     //************************************
     // FullName:    KDIS::PDU::Entity_State_Update_PDU::GetAsString
     // Description: Returns a string representation of the PDU.
@@ -169,11 +195,15 @@ public:
 
     //************************************
     // FullName:    KDIS::PDU::Entity_State_Update_PDU::Decode
+    //              KDIS::PDU::Entity_State_Update_PDU::TryDecode
     // Description: Convert From Network Data.
+    //              The stream is checked before the fields are read, TryDecode returns an error
+    //              code instead of throwing.
     // Parameter:   KDataStream & stream
     // Parameter:   bool ignoreHeader = false - Decode the header from the stream?
     //************************************
     virtual void Decode( KDataStream & stream, bool ignoreHeader = false ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream, bool ignoreHeader = false );
 
     //************************************
     // FullName:    KDIS::PDU::Entity_State_Update_PDU::Encode
@@ -0,0 +1,184 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./Entity_State_View.h"
+#include "./../../DataTypes/VariableParameterList.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace KDIS;
+using namespace PDU;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+Entity_State_View::Entity_State_View( const KOCTET * Data, KUINT16 Size ) throw( KException ) :
+    PDU_View( Data, Size )
+{
+    checkPDU( Entity_State_PDU_Type, ENTITY_STATE_VIEW_SIZE );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Entity_State_View::Entity_State_View( const KDataStream & stream ) throw( KException ) :
+    PDU_View( stream )
+{
+    checkPDU( Entity_State_PDU_Type, ENTITY_STATE_VIEW_SIZE );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Entity_State_View::~Entity_State_View()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+EntityIdentifier Entity_State_View::GetEntityIdentifier() const
+{
+    return getEntityIdentifier( 12 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ForceID Entity_State_View::GetForceID() const
+{
+    return ( ForceID )m_pData[18];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT8 Entity_State_View::GetNumberOfVariableParams() const
+{
+    return m_pData[19];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+EntityType Entity_State_View::GetEntityType() const
+{
+    return getEntityType( 20 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+EntityType Entity_State_View::GetAltEntityType() const
+{
+    return getEntityType( 28 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Vector Entity_State_View::GetEntityLinearVelocity() const
+{
+    return getVector( 36 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+WorldCoordinates Entity_State_View::GetEntityLocation() const
+{
+    return getWorldCoordinates( 48 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+EulerAngles Entity_State_View::GetEntityOrientation() const
+{
+    return getEulerAngles( 72 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 Entity_State_View::GetEntityAppearanceBits() const
+{
+    return get<KUINT32>( 84 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 Entity_State_View::GetEntityCapabilitiesBits() const
+{
+    return get<KUINT32>( 140 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+DeadReckoningAlgorithm Entity_State_View::GetDeadReckoningAlgorithm() const
+{
+    return ( DeadReckoningAlgorithm )m_pData[88];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Vector Entity_State_View::GetDeadReckoningLinearAcceleration() const
+{
+    return getVector( 104 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Vector Entity_State_View::GetDeadReckoningAngularVelocity() const
+{
+    return getVector( 116 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+EntityMarking Entity_State_View::GetEntityMarking() const throw( KException )
+{
+    return EntityMarking( ( EntityMarkingCharacterSet )m_pData[128], ( const KCHAR8 * )m_pData + 129, 11 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+VariableParameterType Entity_State_View::GetVariableParameterType( KUINT16 Index ) const throw( KException )
+{
+    return ( VariableParameterType )getRecord( ENTITY_STATE_VIEW_SIZE, VariableParameter::VARIABLE_PARAMETER_SIZE, GetNumberOfVariableParams(), Index )[0];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL Entity_State_View::GetArticulatedPart( KUINT16 Index, ArticulatedPart & AP ) const throw( KException )
+{
+    return VariableParameterList::DecodeArticulatedPart( getRecord( ENTITY_STATE_VIEW_SIZE, VariableParameter::VARIABLE_PARAMETER_SIZE, GetNumberOfVariableParams(), Index ), AP );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL Entity_State_View::GetAttachedPart( KUINT16 Index, AttachedPart & AP ) const throw( KException )
+{
+    return VariableParameterList::DecodeAttachedPart( getRecord( ENTITY_STATE_VIEW_SIZE, VariableParameter::VARIABLE_PARAMETER_SIZE, GetNumberOfVariableParams(), Index ), AP );
+}
+
+//////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,132 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      Entity_State_View
+    created:    18/10/2026
+
+    purpose:    Read only view of an encoded Entity_State_PDU.
+                Fields are converted from the buffer when accessed, the variable
+                parameters are only decoded when requested by index.
+                See PDU_View.
+
+    size:       1152 bits / 144 octets - Min size
+*********************************************************************/
+
+#pragma once
+
+#include "./../PDU_View.h"
+#include "./../../DataTypes/EntityMarking.h"
+#include "./../../DataTypes/ArticulatedPart.h"
+#include "./../../DataTypes/AttachedPart.h"
+
+namespace KDIS {
+namespace PDU {
+
+class KDIS_EXPORT Entity_State_View : public PDU_View
+{
+public:
+
+    static const KUINT16 ENTITY_STATE_VIEW_SIZE = 144;
+
+    //************************************
+    // FullName:    KDIS::PDU::Entity_State_View::Entity_State_View
+    // Description: Throws WRONG_PDU_TYPE_IN_HEADER if the buffer does not hold an
+    //              Entity State PDU or NOT_ENOUGH_DATA_IN_BUFFER if it is too small.
+    // Parameter:   const KOCTET * Data
+    // Parameter:   KUINT16 Size
+    //************************************
+    Entity_State_View( const KOCTET * Data, KUINT16 Size ) throw( KException );
+
+    Entity_State_View( const KDataStream & stream ) throw( KException );
+
+    virtual ~Entity_State_View();
+
+    //************************************
+    // FullName:    KDIS::PDU::Entity_State_View::GetEntityIdentifier
+    //              KDIS::PDU::Entity_State_View::GetForceID
+    //              KDIS::PDU::Entity_State_View::GetNumberOfVariableParams
+    //              KDIS::PDU::Entity_State_View::GetEntityType
+    //              KDIS::PDU::Entity_State_View::GetAltEntityType
+    //              KDIS::PDU::Entity_State_View::GetEntityLinearVelocity
+    //              KDIS::PDU::Entity_State_View::GetEntityLocation
+    //              KDIS::PDU::Entity_State_View::GetEntityOrientation
+    // Description: See Entity_State_PDU.
+    //************************************
+    KDIS::DATA_TYPE::EntityIdentifier GetEntityIdentifier() const;
+    KDIS::DATA_TYPE::ENUMS::ForceID GetForceID() const;
+    KUINT8 GetNumberOfVariableParams() const;
+    KDIS::DATA_TYPE::EntityType GetEntityType() const;
+    KDIS::DATA_TYPE::EntityType GetAltEntityType() const;
+    KDIS::DATA_TYPE::Vector GetEntityLinearVelocity() const;
+    KDIS::DATA_TYPE::WorldCoordinates GetEntityLocation() const;
+    KDIS::DATA_TYPE::EulerAngles GetEntityOrientation() const;
+
+    //************************************
+    // FullName:    KDIS::PDU::Entity_State_View::GetEntityAppearanceBits
+    //              KDIS::PDU::Entity_State_View::GetEntityCapabilitiesBits
+    // Description: The appearance and capabilities as their raw 32 bit fields.
+    //************************************
+    KUINT32 GetEntityAppearanceBits() const;
+    KUINT32 GetEntityCapabilitiesBits() const;
+
+    //************************************
+    // FullName:    KDIS::PDU::Entity_State_View::GetDeadReckoningAlgorithm
+    //              KDIS::PDU::Entity_State_View::GetDeadReckoningLinearAcceleration
+    //              KDIS::PDU::Entity_State_View::GetDeadReckoningAngularVelocity
+    // Description: Dead reckoning parameter fields.
+    //************************************
+    KDIS::DATA_TYPE::ENUMS::DeadReckoningAlgorithm GetDeadReckoningAlgorithm() const;
+    KDIS::DATA_TYPE::Vector GetDeadReckoningLinearAcceleration() const;
+    KDIS::DATA_TYPE::Vector GetDeadReckoningAngularVelocity() const;
+
+    //************************************
+    // FullName:    KDIS::PDU::Entity_State_View::GetEntityMarking
+    // Description: See Entity_State_PDU.
+    //************************************
+    KDIS::DATA_TYPE::EntityMarking GetEntityMarking() const throw( KException );
+
+    //************************************
+    // FullName:    KDIS::PDU::Entity_State_View::GetVariableParameterType
+    //              KDIS::PDU::Entity_State_View::GetArticulatedPart
+    //              KDIS::PDU::Entity_State_View::GetAttachedPart
+    // Description: Decodes a variable parameter record. The part versions return false
+    //              if the record is of a different type.
+    //              Throws OUT_OF_BOUNDS if Index is invalid or NOT_ENOUGH_DATA_IN_BUFFER
+    //              if the record is missing from the buffer.
+    // Parameter:   KUINT16 Index
+    // Parameter:   ArticulatedPart & AP, AttachedPart & AP
+    //************************************
+    KDIS::DATA_TYPE::ENUMS::VariableParameterType GetVariableParameterType( KUINT16 Index ) const throw( KException );
+    KBOOL GetArticulatedPart( KUINT16 Index, KDIS::DATA_TYPE::ArticulatedPart & AP ) const throw( KException );
+    KBOOL GetAttachedPart( KUINT16 Index, KDIS::DATA_TYPE::AttachedPart & AP ) const throw( KException );
+};
+
+} // END namespace PDU
+} // END namespace KDIS
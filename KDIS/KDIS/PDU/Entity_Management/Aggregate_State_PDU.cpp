@@ -383,6 +383,21 @@ void Aggregate_State_PDU::SetAggregateIDList( const vector<AggregateIdentifier>
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Aggregate_State_PDU::SetAggregateIDList( vector<AggregateIdentifier> && AI )
+{
+    // Reset the PDU length field
+    m_ui16PDULength -= m_ui16NumAggregates * AggregateIdentifier::AGGREGATE_IDENTIFER_SIZE;
+
+    m_vAI = std::move( AI );
+    m_ui16NumAggregates = m_vAI.size();
+    m_ui16PDULength += m_ui16NumAggregates * AggregateIdentifier::AGGREGATE_IDENTIFER_SIZE;
+    updatePadding();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<AggregateIdentifier> & Aggregate_State_PDU::GetAggregateIDList() const
 {
     return m_vAI;
@@ -413,6 +428,21 @@ void Aggregate_State_PDU::SetEntityIDList( const vector<EntityIdentifier> & EI )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Aggregate_State_PDU::SetEntityIDList( vector<EntityIdentifier> && EI )
+{
+    // Reset the PDU length field
+    m_ui16PDULength -= m_ui16NumEntities * EntityIdentifier::ENTITY_IDENTIFER_SIZE;
+
+    m_vEI = std::move( EI );
+    m_ui16NumEntities = m_vEI.size();
+    m_ui16PDULength += m_ui16NumEntities * EntityIdentifier::ENTITY_IDENTIFER_SIZE;
+    updatePadding();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<EntityIdentifier> & Aggregate_State_PDU::GetEntityIDList() const
 {
     return m_vEI;
@@ -442,6 +472,20 @@ void Aggregate_State_PDU::SetSilentAggregateSystemList( const vector<SilentAggre
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Aggregate_State_PDU::SetSilentAggregateSystemList( vector<SilentAggregateSystem> && SAS )
+{
+    // Reset the PDU length
+    m_ui16PDULength -= m_ui16NumSilentAggregateTypes * SilentAggregateSystem::SILENT_AGGREGATE_SYSTEM_SIZE;
+
+    m_vSASL = std::move( SAS );
+    m_ui16NumSilentAggregateTypes = m_vSASL.size();
+    m_ui16PDULength += m_ui16NumSilentAggregateTypes * SilentAggregateSystem::SILENT_AGGREGATE_SYSTEM_SIZE;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<SilentAggregateSystem> & Aggregate_State_PDU::GetSilentAggregateSystemList() const
 {
     return m_vSASL;
@@ -481,6 +525,31 @@ void Aggregate_State_PDU::SetSilentEntitySystemList( const vector<SilentEntitySy
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Aggregate_State_PDU::SetSilentEntitySystemList( vector<SilentEntitySystem> && SES )
+{
+    // Reset the PDU length
+    vector<SilentEntitySystem>::const_iterator citr = m_vSESL.begin();
+    vector<SilentEntitySystem>::const_iterator citrEnd = m_vSESL.end();
+
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui16PDULength -= SilentEntitySystem::SILENT_ENTITY_SYSTEM_SIZE + ( citr->GetNumberOfAppearanceRecords() * EntityAppearance::ENTITY_APPEARANCE_SIZE );
+    }
+
+    m_vSESL = std::move( SES );
+
+    for( citr = m_vSESL.begin(); citr!= m_vSESL.end(); ++citr )
+    {
+        m_ui16PDULength += SilentEntitySystem::SILENT_ENTITY_SYSTEM_SIZE + ( citr->GetNumberOfAppearanceRecords() * EntityAppearance::ENTITY_APPEARANCE_SIZE );
+    }
+
+    m_ui16NumSilentEntityTypes = m_vSESL.size();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<SilentEntitySystem> & Aggregate_State_PDU::GetSilentEntitySystemList() const
 {
     return m_vSESL;
@@ -525,6 +594,26 @@ void Aggregate_State_PDU::SetVariableDatumList( const vector<VarDtmPtr> & VD )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Aggregate_State_PDU::SetVariableDatumList( vector<VarDtmPtr> && VD )
+{
+    ClearVariableDatumList();
+
+    m_vVD = std::move( VD );
+
+    vector<VarDtmPtr>::const_iterator citr = m_vVD.begin();
+    vector<VarDtmPtr>::const_iterator citrEnd = m_vVD.end();
+    for( citr = m_vVD.begin(); citr != m_vVD.end(); ++citr )
+    {
+        m_ui16PDULength += VariableDatum::VARIABLE_DATUM_SIZE + ( ( *citr )->GetDatumLength() / 8 );
+    }
+
+    m_ui32NumVariableDatum = m_vVD.size();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 void Aggregate_State_PDU::ClearVariableDatumList()
 {
     // Reset the PDU length
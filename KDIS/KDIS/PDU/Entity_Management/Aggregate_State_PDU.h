@@ -140,6 +140,8 @@ public:
 
     virtual ~Aggregate_State_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Aggregate_State_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Aggregate_State_PDU::SetAggregateIdentifier
     //              KDIS::PDU::Aggregate_State_PDU::GetAggregateIdentifier
@@ -284,6 +286,9 @@ public:
     //************************************
     void AddAggregateID( const KDIS::DATA_TYPE::AggregateIdentifier & AI );
     void SetAggregateIDList( const std::vector<KDIS::DATA_TYPE::AggregateIdentifier> & AI );
+    #ifdef KDIS_USE_CPP11
+    void SetAggregateIDList( std::vector<KDIS::DATA_TYPE::AggregateIdentifier> && AI );
+    #endif
     const std::vector<KDIS::DATA_TYPE::AggregateIdentifier> & GetAggregateIDList() const;
 
     //************************************
@@ -296,6 +301,9 @@ public:
     //************************************
     void AddEntityID( const KDIS::DATA_TYPE::EntityIdentifier & EI );
     void SetEntityIDList( const std::vector<KDIS::DATA_TYPE::EntityIdentifier> & EI );
+    #ifdef KDIS_USE_CPP11
+    void SetEntityIDList( std::vector<KDIS::DATA_TYPE::EntityIdentifier> && EI );
+    #endif
     const std::vector<KDIS::DATA_TYPE::EntityIdentifier> & GetEntityIDList() const;
 
     //************************************
@@ -308,6 +316,9 @@ public:
     //************************************
     void AddSilentAggregateSystem( const KDIS::DATA_TYPE::SilentAggregateSystem & SAS );
     void SetSilentAggregateSystemList( const std::vector<KDIS::DATA_TYPE::SilentAggregateSystem> & SAS );
+    #ifdef KDIS_USE_CPP11
+    void SetSilentAggregateSystemList( std::vector<KDIS::DATA_TYPE::SilentAggregateSystem> && SAS );
+    #endif
     const std::vector<KDIS::DATA_TYPE::SilentAggregateSystem> & GetSilentAggregateSystemList() const;
 
     //************************************
@@ -320,6 +331,9 @@ public:
     //************************************
     void AddSilentEntitySystem( const KDIS::DATA_TYPE::SilentEntitySystem & SES );
     void SetSilentEntitySystemList( const std::vector<KDIS::DATA_TYPE::SilentEntitySystem> & SES );
+    #ifdef KDIS_USE_CPP11
+    void SetSilentEntitySystemList( std::vector<KDIS::DATA_TYPE::SilentEntitySystem> && SES );
+    #endif
     const std::vector<KDIS::DATA_TYPE::SilentEntitySystem> & GetSilentEntitySystemList() const;
 
     //************************************
@@ -344,6 +358,9 @@ public:
     //************************************
     void AddVariableDatum( KDIS::DATA_TYPE::VarDtmPtr VD );
     void SetVariableDatumList( const std::vector<KDIS::DATA_TYPE::VarDtmPtr> & VD );
+    #ifdef KDIS_USE_CPP11
+    void SetVariableDatumList( std::vector<KDIS::DATA_TYPE::VarDtmPtr> && VD );
+    #endif
     const std::vector<KDIS::DATA_TYPE::VarDtmPtr> & GetVariableDatumList() const;
     void ClearVariableDatumList();
 
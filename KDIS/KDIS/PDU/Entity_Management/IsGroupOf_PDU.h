@@ -107,6 +107,8 @@ public:
 
     virtual ~IsGroupOf_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( IsGroupOf_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::IsGroupOf_PDU::SetGroupedEntityID
     //              KDIS::PDU::IsGroupOf_PDU::GetGroupedEntityID
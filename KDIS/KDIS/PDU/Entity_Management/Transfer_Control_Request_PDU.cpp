@@ -192,6 +192,28 @@ void Transfer_Control_Request_PDU::SetRecordSets( const vector<RecordSet> & RS )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Transfer_Control_Request_PDU::SetRecordSets( vector<RecordSet> && RS )
+{
+    m_vRecs.clear();
+    m_vRecs = std::move( RS );
+    m_ui32NumRecSets = m_vRecs.size();
+
+    // Calculate the PDU size
+    m_ui16PDULength = TRANSFER_CONTROL_REQUEST_PDU_SIZE;
+
+    vector<RecordSet>::const_iterator citr = m_vRecs.begin();
+    vector<RecordSet>::const_iterator citrEnd = m_vRecs.end();
+
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui16PDULength += citr->GetRecordLength();
+    }
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<RecordSet> & Transfer_Control_Request_PDU::GetRecordSets() const
 {
     return m_vRecs;
@@ -86,6 +86,8 @@ public:
 
     virtual ~Transfer_Control_Request_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Transfer_Control_Request_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Transfer_Control_Request_PDU::SetRequestID
     //              KDIS::PDU::Transfer_Control_Request_PDU::GetRequestID
@@ -140,6 +142,9 @@ public:
     //************************************
     void AddRecordSet( const KDIS::DATA_TYPE::RecordSet & RS );
     void SetRecordSets( const std::vector<KDIS::DATA_TYPE::RecordSet> & RS );
+    #ifdef KDIS_USE_CPP11
+    void SetRecordSets( std::vector<KDIS::DATA_TYPE::RecordSet> && RS );
+    #endif
     const std::vector<KDIS::DATA_TYPE::RecordSet> & GetRecordSets() const;
 
     //************************************
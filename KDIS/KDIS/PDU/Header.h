@@ -34,6 +34,7 @@ http://p.sf.net/kdis/UserGuide
 //
 
 #include "./../KDefines.h"
+#include <memory>
 
 #if DIS_VERSION > 6
 	#include "./Header7.h"
@@ -50,5 +51,12 @@ namespace PDU {
 	typedef Header6 Header;
 #endif
 
+// Sole owner of a decoded PDU, returned by the PDU_Factory and Connection.
+#ifdef KDIS_USE_CPP11
+	typedef std::unique_ptr<Header> PduUniquePtr;
+#else
+	typedef std::auto_ptr<Header> PduUniquePtr;
+#endif
+
 } // END namespace PDU
 } // END namespace KDIS
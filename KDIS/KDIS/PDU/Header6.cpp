@@ -36,6 +36,32 @@ using namespace PDU;
 using namespace DATA_TYPE;
 using namespace ENUMS;
 
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+ErrorCodes Header6::checkPDULength( const KDataStream & stream, bool ignoreHeader ) const
+{
+    KUINT32 ui32Available = stream.GetBufferSize();
+    KUINT16 ui16PDULength = m_ui16PDULength;
+
+    if( ignoreHeader )
+    {
+        ui32Available += HEADER6_PDU_SIZE;
+    }
+    else
+    {
+        if( ui32Available < HEADER6_PDU_SIZE )return NOT_ENOUGH_DATA_IN_BUFFER;
+
+        // Peek at the PDU length, octets 8-9 of the header.
+        const KOCTET * pHeader = stream.GetBufferPtr() + stream.GetCurrentWritePosition();
+        ui16PDULength = NetToKUINT16( pHeader + 8, stream.GetMachineEndian() != stream.GetNetWorkEndian() ).m_Value;
+    }
+
+    if( ui32Available < ui16PDULength )return NOT_ENOUGH_DATA_IN_BUFFER;
+    return NO_ERRORS;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // public:
 //////////////////////////////////////////////////////////////////////////
@@ -219,6 +245,24 @@ void Header6::Decode( KDataStream & stream, bool ignoreHeader /*= false*/  ) thr
 
 //////////////////////////////////////////////////////////////////////////
 
+ErrorCodes Header6::TryDecode( KDataStream & stream, bool ignoreHeader /*= false*/ )
+{
+    const ErrorCodes e = checkPDULength( stream, ignoreHeader );
+    if( e != NO_ERRORS )return e;
+
+    try
+    {
+        Decode( stream, ignoreHeader );
+    }
+    catch( const KException & Ex )
+    {
+        return static_cast<ErrorCodes>( Ex.m_ui16ErrorCode );
+    }
+    return NO_ERRORS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 KDataStream Header6::Encode() const
 {
     KDataStream stream;
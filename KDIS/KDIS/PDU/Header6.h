@@ -72,6 +72,15 @@ protected:
 
     KUINT8 m_ui8Padding2;
 
+    //************************************
+    // FullName:    KDIS::PDU::Header6::checkPDULength
+    // Description: PDU level bounds check used by TryDecode. Returns NOT_ENOUGH_DATA_IN_BUFFER if the
+    //              stream does not hold the whole PDU declared by the header, nothing is read.
+    // Parameter:   const KDataStream & stream
+    // Parameter:   bool ignoreHeader - Has the header already been decoded?
+    //************************************
+    KDIS::ErrorCodes checkPDULength( const KDataStream & stream, bool ignoreHeader ) const;
+
 public:
 
     static const KUINT16 HEADER6_PDU_SIZE = 12;
@@ -164,6 +173,21 @@ public:
     //************************************
     virtual void Decode( KDataStream & stream, bool ignoreHeader = false ) throw( KException );
 
+    //************************************
+    // FullName:    KDIS::PDU::Header6::TryDecode
+    // Description: Convert From Network Data without throwing, returns NO_ERRORS on success.
+    //              The stream is checked once for the whole PDU declared by the header, so truncated
+    //              data is rejected before anything is decoded. The common receive path PDUs,
+    //              Entity_State_PDU, Entity_State_Update_PDU, Fire_PDU, Detonation_PDU, Collision_PDU
+    //              and Signal_PDU, override this with a bounds checked decode that never throws.
+    //              For every other PDU this falls back to catching the KException raised by Decode
+    //              for malformed content, such as a record count that disagrees with the PDU length,
+    //              so those still pay for the throw.
+    // Parameter:   KDataStream & stream
+    // Parameter:   bool ignoreHeader = false - Decode the header from the stream?
+    //************************************
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream, bool ignoreHeader = false );
+
     //************************************
     // FullName:    KDIS::PDU::Header6::Encode
     // Description: Convert To Network Data.
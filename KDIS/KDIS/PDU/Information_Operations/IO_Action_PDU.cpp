@@ -271,6 +271,29 @@ void IO_Action_PDU::SetStandardVariableRecords( const vector<StdVarPtr> & SVR )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void IO_Action_PDU::SetStandardVariableRecords( vector<StdVarPtr> && SVR )
+{
+    m_vStdVarRecs = std::move( SVR );
+
+    // Reset the PDU length.
+    m_ui16PDULength = IO_ACTION_PDU_SIZE;
+
+    // Calculate the new pdu length.
+    KUINT16 ui16Length = 0;
+    vector<StdVarPtr>::const_iterator citr = m_vStdVarRecs.begin();
+    vector<StdVarPtr>::const_iterator citrEnd = m_vStdVarRecs.end();
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui16PDULength += ( *citr )->GetRecordLength();
+    }
+
+    m_ui16NumStdVarRec = m_vStdVarRecs.size();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<StdVarPtr> & IO_Action_PDU::GetStandardVariableRecords() const
 {
     return m_vStdVarRecs;
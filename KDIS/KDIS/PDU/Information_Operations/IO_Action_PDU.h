@@ -101,6 +101,8 @@ public:
 
     virtual ~IO_Action_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( IO_Action_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::IO_Action_PDU::SetReceivingEntityID
     //              KDIS::PDU::IO_Action_PDU::GetReceivingEntityID
@@ -202,6 +204,9 @@ public:
     //************************************
     void AddStandardVariableRecord( KDIS::DATA_TYPE::StdVarPtr SVR );
     void SetStandardVariableRecords( const std::vector<KDIS::DATA_TYPE::StdVarPtr> & SVR );
+    #ifdef KDIS_USE_CPP11
+    void SetStandardVariableRecords( std::vector<KDIS::DATA_TYPE::StdVarPtr> && SVR );
+    #endif
     const std::vector<KDIS::DATA_TYPE::StdVarPtr> & GetStandardVariableRecords() const;
     void ClearStandardVariableRecords();
 
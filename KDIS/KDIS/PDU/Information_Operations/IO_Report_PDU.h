@@ -88,6 +88,8 @@ public:
 
     virtual ~IO_Report_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( IO_Report_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::IO_Report_PDU::SetSimulationSource
     //              KDIS::PDU::IO_Report_PDU::GetSimulationSource
@@ -150,6 +152,9 @@ public:
     //************************************
     void AddStandardVariableRecord( KDIS::DATA_TYPE::StdVarPtr SVR );
     void SetStandardVariableRecords( const std::vector<KDIS::DATA_TYPE::StdVarPtr> & SVR );
+    #ifdef KDIS_USE_CPP11
+    void SetStandardVariableRecords( std::vector<KDIS::DATA_TYPE::StdVarPtr> && SVR );
+    #endif
     const std::vector<KDIS::DATA_TYPE::StdVarPtr> & GetStandardVariableRecords() const;
     void ClearStandardVariableRecords();
 
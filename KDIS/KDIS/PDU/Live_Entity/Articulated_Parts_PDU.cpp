@@ -94,7 +94,7 @@ KUINT8 Articulated_Parts_PDU::GetNumberOfVariableParams() const
 
 void Articulated_Parts_PDU::AddVariableParameter( VarPrmPtr VP )
 {
-    m_vVariableParameters.push_back( VP );
+    m_VariableParameters.Add( VP );
     ++m_ui8NumOfVariableParams;
     m_ui16PDULength += VariableParameter::VARIABLE_PARAMETER_SIZE;
 }
@@ -103,29 +103,65 @@ void Articulated_Parts_PDU::AddVariableParameter( VarPrmPtr VP )
 
 void Articulated_Parts_PDU::SetVariableParameters( const vector<VarPrmPtr> & VP )
 {
-    m_vVariableParameters = VP;
-    m_ui8NumOfVariableParams = m_vVariableParameters.size();
+    m_VariableParameters.Set( VP );
+    m_ui8NumOfVariableParams = m_VariableParameters.GetCount();
     m_ui16PDULength = ARTICULATED_PARTS_PDU_SIZE + ( m_ui8NumOfVariableParams * VariableParameter::VARIABLE_PARAMETER_SIZE );
 }
 
 //////////////////////////////////////////////////////////////////////////
 
-const vector<VarPrmPtr> & Articulated_Parts_PDU::GetVariableParameters() const
+#ifdef KDIS_USE_CPP11
+void Articulated_Parts_PDU::SetVariableParameters( vector<VarPrmPtr> && VP )
 {
-    return m_vVariableParameters;
+    m_VariableParameters.Set( std::move( VP ) );
+    m_ui8NumOfVariableParams = m_VariableParameters.GetCount();
+    m_ui16PDULength = ARTICULATED_PARTS_PDU_SIZE + ( m_ui8NumOfVariableParams * VariableParameter::VARIABLE_PARAMETER_SIZE );
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
+vector<VarPrmPtr> Articulated_Parts_PDU::GetVariableParameters() const
+{
+    return m_VariableParameters.GetVariableParameters();
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 void Articulated_Parts_PDU::ClearVariableParameters()
 {
-    m_vVariableParameters.clear();
+    m_VariableParameters.Clear();
     m_ui8NumOfVariableParams = 0;
     m_ui16PDULength = ARTICULATED_PARTS_PDU_SIZE;
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+void Articulated_Parts_PDU::AddArticulatedPart( const ArticulatedPart & AP )
+{
+    m_VariableParameters.AddArticulatedPart( AP );
+    ++m_ui8NumOfVariableParams;
+    m_ui16PDULength += VariableParameter::VARIABLE_PARAMETER_SIZE;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Articulated_Parts_PDU::AddAttachedPart( const AttachedPart & AP )
+{
+    m_VariableParameters.AddAttachedPart( AP );
+    ++m_ui8NumOfVariableParams;
+    m_ui16PDULength += VariableParameter::VARIABLE_PARAMETER_SIZE;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const VariableParameterList & Articulated_Parts_PDU::GetVariableParameterList() const
+{
+    return m_VariableParameters;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 KString Articulated_Parts_PDU::GetAsString() const
 {
     KStringStream ss;
@@ -135,12 +171,7 @@ KString Articulated_Parts_PDU::GetAsString() const
        << "Number Of Variable Params: " << ( KUINT16 )m_ui8NumOfVariableParams << "\n";
 
     // Variable params
-    vector<VarPrmPtr>::const_iterator citr = m_vVariableParameters.begin();
-    vector<VarPrmPtr>::const_iterator citrEnd = m_vVariableParameters.end();
-    for( ; citr != citrEnd; ++ citr )
-    {
-        ss << ( *citr )->GetAsString();
-    }
+    ss << m_VariableParameters.GetAsString();
 
     return ss.str();
 }
@@ -151,49 +182,13 @@ void Articulated_Parts_PDU::Decode( KDataStream & stream, bool ignoreHeader /*=
 {
     if( ( stream.GetBufferSize() + ( ignoreHeader ? Header::HEADER6_PDU_SIZE : 0 ) ) < ARTICULATED_PARTS_PDU_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
 
-    m_vVariableParameters.clear();
+    m_VariableParameters.Clear();
 
     LE_Header::Decode( stream, ignoreHeader );
 
     stream >> m_ui8NumOfVariableParams;
 
-    for( KUINT8 i = 0; i < m_ui8NumOfVariableParams; ++i )
-    {
-        // Save the current write position so we can peek.
-        KUINT16 pos = stream.GetCurrentWritePosition();
-        KUINT8 paramTyp;
-
-        // Extract the  type then reset the stream.
-        stream >> paramTyp;
-        stream.SetCurrentWritePosition( pos );
-
-        // Use the factory decoder.
-        VariableParameter * p = VariableParameter::FactoryDecode( paramTyp, stream );
-
-        // Did we find a custom decoder? if not then use the default.
-        if( p )
-        {
-            m_vVariableParameters.push_back( VarPrmPtr( p ) );
-        }
-        else
-        {
-            // Default internals
-            switch( paramTyp )
-            {
-                case ArticulatedPartType:
-                    m_vVariableParameters.push_back( VarPrmPtr( new ArticulatedPart( stream ) ) );
-                    break;
-
-                case AttachedPartType:
-                    m_vVariableParameters.push_back( VarPrmPtr( new AttachedPart( stream ) ) );
-                    break;
-
-                default:
-                    m_vVariableParameters.push_back( VarPrmPtr( new VariableParameter( stream ) ) );
-                    break;
-            }
-        }
-    }
+    m_VariableParameters.Decode( stream, m_ui8NumOfVariableParams );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -216,12 +211,7 @@ void Articulated_Parts_PDU::Encode( KDataStream & stream ) const
     stream << m_ui8NumOfVariableParams;
 
     // Add the variable params
-    vector<VarPrmPtr>::const_iterator citr = m_vVariableParameters.begin();
-    vector<VarPrmPtr>::const_iterator citrEnd = m_vVariableParameters.end();
-    for( ; citr != citrEnd; ++ citr )
-    {
-        ( *citr )->Encode( stream );
-    }
+    m_VariableParameters.Encode( stream );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -230,7 +220,7 @@ KBOOL Articulated_Parts_PDU::operator == ( const Articulated_Parts_PDU & Value )
 {
     if( LE_Header::operator      != ( Value ) )                     return false;
     if( m_ui8NumOfVariableParams != Value.m_ui8NumOfVariableParams )return false;
-    if( m_vVariableParameters    != Value.m_vVariableParameters )   return false;
+    if( m_VariableParameters    != Value.m_VariableParameters )   return false;
     return true;
 }
 
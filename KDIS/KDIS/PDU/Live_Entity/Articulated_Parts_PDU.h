@@ -41,7 +41,7 @@ http://p.sf.net/kdis/UserGuide
 #pragma once
 
 #include "./LE_Header.h"
-#include "./../../DataTypes/VariableParameter.h"
+#include "./../../DataTypes/VariableParameterList.h"
 #include <vector>
 
 namespace KDIS {
@@ -53,7 +53,7 @@ protected:
 
     KUINT8 m_ui8NumOfVariableParams;
 
-    std::vector<KDIS::DATA_TYPE::VarPrmPtr> m_vVariableParameters;
+    KDIS::DATA_TYPE::VariableParameterList m_VariableParameters;
 
 public:
 
@@ -69,6 +69,8 @@ public:
 
     virtual ~Articulated_Parts_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Articulated_Parts_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Articulated_Parts_PDU::GetNumberOfVariableParams
     // Description: Number of variable parameters.
@@ -87,9 +89,25 @@ public:
     //************************************
     void AddVariableParameter( KDIS::DATA_TYPE::VarPrmPtr VP );
     void SetVariableParameters( const std::vector<KDIS::DATA_TYPE::VarPrmPtr> & VP );
-    const std::vector<KDIS::DATA_TYPE::VarPrmPtr> & GetVariableParameters() const;
+    #ifdef KDIS_USE_CPP11
+    void SetVariableParameters( std::vector<KDIS::DATA_TYPE::VarPrmPtr> && VP );
+    #endif
+    std::vector<KDIS::DATA_TYPE::VarPrmPtr> GetVariableParameters() const;
     void ClearVariableParameters();
 
+    //************************************
+    // FullName:    KDIS::PDU::Articulated_Parts_PDU::AddArticulatedPart
+    //              KDIS::PDU::Articulated_Parts_PDU::AddAttachedPart
+    //              KDIS::PDU::Articulated_Parts_PDU::GetVariableParameterList
+    // Description: Adds a part by value, it is stored inline in the PDU without allocating.
+    //              GetVariableParameterList gives typed access to the records without
+    //              allocating objects as GetVariableParameters does.
+    // Parameter:   const ArticulatedPart & AP, const AttachedPart & AP
+    //************************************
+    void AddArticulatedPart( const KDIS::DATA_TYPE::ArticulatedPart & AP );
+    void AddAttachedPart( const KDIS::DATA_TYPE::AttachedPart & AP );
+    const KDIS::DATA_TYPE::VariableParameterList & GetVariableParameterList() const;
+
     //************************************
     // FullName:    KDIS::PDU::Articulated_Parts_PDU::GetAsString
     // Description: Returns a string representation of the PDU
@@ -430,6 +430,21 @@ void TSPI_PDU::SetSystemSpecificData( const std::vector<KOCTET> & SSD )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void TSPI_PDU::SetSystemSpecificData( std::vector<KOCTET> && SSD )
+{
+    ClearSystemSpecificData();
+    SetSystemSpecificDataFlag( true );
+    m_vSSD = std::move( SSD );
+    m_ui8SSDLen = m_vSSD.size();
+
+    // Set the new pdu length
+    m_ui16PDULength += m_vSSD.size();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 void TSPI_PDU::SetSystemSpecificData( const KOCTET * Data, KUINT8 Length )
 {
     ClearSystemSpecificData();
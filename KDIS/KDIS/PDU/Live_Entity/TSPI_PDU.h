@@ -107,6 +107,8 @@ public:
 
     virtual ~TSPI_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( TSPI_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::TSPI_PDU::SetEntityLinearVelocityFlag
     //              KDIS::PDU::TSPI_PDU::GetEntityLinearVelocityFlag
@@ -250,6 +252,9 @@ public:
     // Parameter:   KUINT8 Length
     //************************************
     void SetSystemSpecificData( const std::vector<KOCTET> & SSD );
+    #ifdef KDIS_USE_CPP11
+    void SetSystemSpecificData( std::vector<KOCTET> && SSD );
+    #endif
     void SetSystemSpecificData( const KOCTET * Data, KUINT8 Length );
     const std::vector<KOCTET> & GetSystemSpecificData() const;
     void ClearSystemSpecificData();
@@ -61,6 +61,8 @@ public:
 
     virtual ~Resupply_Offer_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Resupply_Offer_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Resupply_Offer_PDU::GetAsString
     // Description: Returns a string representation of the PDU.
@@ -138,7 +138,22 @@ void Resupply_Received_PDU::SetSupplies( const vector<Supplies> & S )
 
 //////////////////////////////////////////////////////////////////////////
 
-vector<Supplies> Resupply_Received_PDU::GetSupplies() const
+#ifdef KDIS_USE_CPP11
+void Resupply_Received_PDU::SetSupplies( vector<Supplies> && S )
+{
+    m_vSupplies = std::move( S );
+
+    // Update the number of supplies
+    m_ui8NumSupplyTypes = m_vSupplies.size();
+
+    // Update the PDU size
+    m_ui16PDULength = ( RESUPPLY_RECEIVED_PDU_SIZE + ( m_ui8NumSupplyTypes * Supplies::SUPPLIES_SIZE ) );
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
+const vector<Supplies> & Resupply_Received_PDU::GetSupplies() const
 {
     return m_vSupplies;
 }
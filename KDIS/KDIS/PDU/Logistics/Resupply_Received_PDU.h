@@ -73,6 +73,8 @@ public:
 
     virtual ~Resupply_Received_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Resupply_Received_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Resupply_Received_PDU::SetNumberOfSupplyTypes
     //              KDIS::PDU::Resupply_Received_PDU::GetNumberOfSupplyTypes
@@ -95,7 +97,10 @@ public:
     //************************************
     void AddSupply( const KDIS::DATA_TYPE::Supplies & S );
     void SetSupplies( const std::vector<KDIS::DATA_TYPE::Supplies> & S );
-    std::vector<KDIS::DATA_TYPE::Supplies> GetSupplies() const;
+    #ifdef KDIS_USE_CPP11
+    void SetSupplies( std::vector<KDIS::DATA_TYPE::Supplies> && S );
+    #endif
+    const std::vector<KDIS::DATA_TYPE::Supplies> & GetSupplies() const;
 
     //************************************
     // FullName:    KDIS::PDU::Resupply_Received_PDU::GetAsString
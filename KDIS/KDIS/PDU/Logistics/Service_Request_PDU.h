@@ -66,6 +66,8 @@ public:
 
     virtual ~Service_Request_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Service_Request_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Service_Request_PDU::SetServiceTypeRequested
     //              KDIS::PDU::Service_Request_PDU::GetServiceTypeRequested
@@ -286,6 +286,22 @@ void Minefield_Data_PDU::SetSensorTypes( const vector<KUINT16> & ST )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Minefield_Data_PDU::SetSensorTypes( vector<KUINT16> && ST )
+{
+    // Subtract old values from pdu length.
+    m_ui16PDULength -= m_ui8NumSensTyp * 2; // 2 = size of sensor type.
+
+    m_vui16SensorTypes = std::move( ST );
+    m_ui8NumSensTyp = m_vui16SensorTypes.size();
+
+    // Calculate the new size
+    m_ui16PDULength += m_ui8NumSensTyp * 2;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<KUINT16> & Minefield_Data_PDU::GetSensorTypes() const
 {
     return m_vui16SensorTypes;
@@ -340,6 +356,38 @@ void Minefield_Data_PDU::SetMines( const std::vector<Mine> & M ) throw( KExcepti
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Minefield_Data_PDU::SetMines( std::vector<Mine> && M ) throw( KException )
+{
+    // First check the mines all have the same optional fields set as MinefieldDataFilter.
+    vector<Mine>::const_iterator citr = M.begin();
+    vector<Mine>::const_iterator citrEnd = M.end();
+    for( ; citr != citrEnd; ++citr )
+    {
+        if( citr->MinefieldDataFilter::operator != ( m_DataFilter ) )
+        {
+            throw KException( __FUNCTION__, INVALID_OPERATION, "One or more mines do not have the correct filters.				\
+                                                                They must have the same filter as the PDU MinefieldDataFilter.	\
+                                                                This set request has been ignored" );
+        }
+    }
+
+    m_vMines = std::move( M );
+    m_ui8NumMines = m_vMines.size();
+
+    // Calculate the new size
+    m_ui16PDULength = MINEFIELD_DATA_PDU_SIZE + ( m_ui8NumSensTyp * 2 );
+    citr = m_vMines.begin();
+    citrEnd = m_vMines.end();
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui16PDULength += citr->GetLength();
+    }
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const std::vector<Mine> & Minefield_Data_PDU::GetMines() const
 {
     return m_vMines;
@@ -120,6 +120,8 @@ public:
 
     virtual ~Minefield_Data_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Minefield_Data_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Minefield_Data_PDU::SetRequestingSimulationID
     //              KDIS::PDU::Minefield_Data_PDU::GetRequestingSimulationID
@@ -226,6 +228,9 @@ public:
     //************************************
     void AddSensorType( KDIS::DATA_TYPE::ENUMS::SensorType ST );
     void SetSensorTypes( const std::vector<KUINT16> & ST );
+    #ifdef KDIS_USE_CPP11
+    void SetSensorTypes( std::vector<KUINT16> && ST );
+    #endif
     const std::vector<KUINT16> & GetSensorTypes() const;
 
     //************************************
@@ -239,6 +244,9 @@ public:
     //************************************
     void AddMine( const KDIS::DATA_TYPE::Mine & M ) throw( KException );
     void SetMines( const std::vector<KDIS::DATA_TYPE::Mine> & M ) throw( KException );
+    #ifdef KDIS_USE_CPP11
+    void SetMines( std::vector<KDIS::DATA_TYPE::Mine> && M ) throw( KException );
+    #endif
     const std::vector<KDIS::DATA_TYPE::Mine> & GetMines() const;
 
     //************************************
@@ -237,6 +237,22 @@ void Minefield_Query_PDU::SetRequestedPerimeterPointCoordinates( const std::vect
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Minefield_Query_PDU::SetRequestedPerimeterPointCoordinates( std::vector<PerimeterPointCoordinate> && PPC )
+{
+    // Subtract old values from pdu length.
+    m_ui16PDULength -= m_ui8NumPerimPoints * PerimeterPointCoordinate::PERIMETER_POINT_COORDINATE_SIZE;
+
+    m_vPoints = std::move( PPC );
+    m_ui8NumPerimPoints = m_vPoints.size();
+
+    // Calculate the new size
+    m_ui16PDULength += m_ui8NumPerimPoints * PerimeterPointCoordinate::PERIMETER_POINT_COORDINATE_SIZE;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const std::vector<PerimeterPointCoordinate> & Minefield_Query_PDU::GetRequestedPerimeterPointCoordinates() const
 {
     return m_vPoints;
@@ -269,6 +285,23 @@ void Minefield_Query_PDU::SetSensorTypes( const vector<KUINT16> & ST )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Minefield_Query_PDU::SetSensorTypes( vector<KUINT16> && ST )
+{
+    // Subtract old values from pdu length.
+    m_ui16PDULength -= m_ui8NumSensTyp * 2; // 2 = size of sensor type.
+
+    m_vui16SensorTypes = std::move( ST );
+    m_ui8NumSensTyp = m_vui16SensorTypes.size();
+
+    // Calculate the new size
+    m_ui16PDULength += m_ui8NumSensTyp * 2;
+    calcPadding();
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<KUINT16> & Minefield_Query_PDU::GetSensorTypes() const
 {
     return m_vui16SensorTypes;
@@ -94,6 +94,8 @@ public:
 
     virtual ~Minefield_Query_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Minefield_Query_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Minefield_Query_PDU::SetRequestingSimulationID
     //              KDIS::PDU::Minefield_Query_PDU::GetRequestingSimulationID
@@ -163,6 +165,9 @@ public:
     //************************************
     void AddRequestedPerimeterPointCoordinate( const KDIS::DATA_TYPE::PerimeterPointCoordinate & PPC );
     void SetRequestedPerimeterPointCoordinates( const std::vector<KDIS::DATA_TYPE::PerimeterPointCoordinate> & PPC );
+    #ifdef KDIS_USE_CPP11
+    void SetRequestedPerimeterPointCoordinates( std::vector<KDIS::DATA_TYPE::PerimeterPointCoordinate> && PPC );
+    #endif
     const std::vector<KDIS::DATA_TYPE::PerimeterPointCoordinate> & GetRequestedPerimeterPointCoordinates() const;
 
     //************************************
@@ -181,6 +186,9 @@ public:
     //************************************
     void AddSensorType( KDIS::DATA_TYPE::ENUMS::SensorType ST );
     void SetSensorTypes( const std::vector<KUINT16> & ST );
+    #ifdef KDIS_USE_CPP11
+    void SetSensorTypes( std::vector<KUINT16> && ST );
+    #endif
     const std::vector<KUINT16> & GetSensorTypes() const;
 
     //************************************
@@ -158,6 +158,17 @@ void Minefield_Response_NACK_PDU::SetMissingPDUSequenceNumbers( const std::vecto
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Minefield_Response_NACK_PDU::SetMissingPDUSequenceNumbers( std::vector<KUINT8> && N )
+{
+    m_vSeqNums = std::move( N );
+    m_ui8NumMisPdus = m_vSeqNums.size();
+    m_ui16PDULength = MINEFIELD_RESPONSE_NACK_SIZE + m_ui8NumMisPdus;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const std::vector<KUINT8> & Minefield_Response_NACK_PDU::GetMissingPDUSequenceNumbers() const
 {
     return m_vSeqNums;
@@ -79,6 +79,8 @@ public:
 
     virtual ~Minefield_Response_NACK_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Minefield_Response_NACK_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Minefield_Response_NACK_PDU::SetRequestingSimulationID
     //              KDIS::PDU::Minefield_Response_NACK_PDU::GetRequestingSimulationID
@@ -120,6 +122,9 @@ public:
     //************************************
     void AddMissingPDUSequenceNumber( KUINT8 N );
     void SetMissingPDUSequenceNumbers( const std::vector<KUINT8> & N );
+    #ifdef KDIS_USE_CPP11
+    void SetMissingPDUSequenceNumbers( std::vector<KUINT8> && N );
+    #endif
     const std::vector<KUINT8> & GetMissingPDUSequenceNumbers() const;
     void ClearMissingPDUSequenceNumbers();
 
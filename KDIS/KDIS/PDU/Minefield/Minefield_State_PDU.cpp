@@ -259,6 +259,22 @@ void Minefield_State_PDU::SetPerimeterPointCoordinates( const vector<PerimeterPo
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Minefield_State_PDU::SetPerimeterPointCoordinates( vector<PerimeterPointCoordinate> && PPC )
+{
+    // Subtract old values from pdu length.
+    m_ui16PDULength -= m_ui8NumPerimPoints * PerimeterPointCoordinate::PERIMETER_POINT_COORDINATE_SIZE;
+
+    m_vPoints = std::move( PPC );
+    m_ui8NumPerimPoints = m_vPoints.size();
+
+    // Calculate the new size
+    m_ui16PDULength += m_ui8NumPerimPoints * PerimeterPointCoordinate::PERIMETER_POINT_COORDINATE_SIZE;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<PerimeterPointCoordinate> & Minefield_State_PDU::GetPerimeterPointCoordinates() const
 {
     return m_vPoints;
@@ -289,6 +305,22 @@ void Minefield_State_PDU::SetMineTypes( const vector<EntityType> & MT )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Minefield_State_PDU::SetMineTypes( vector<EntityType> && MT )
+{
+    // Subtract old values from pdu length.
+    m_ui16PDULength -= m_ui16NumMineTypes * EntityType::ENTITY_TYPE_SIZE;
+
+    m_vMineTypes = std::move( MT );
+    m_ui16NumMineTypes = m_vMineTypes.size();
+
+    // Calculate the new size
+    m_ui16PDULength += m_ui16NumMineTypes * EntityType::ENTITY_TYPE_SIZE;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<EntityType> & Minefield_State_PDU::GetMineTypes() const
 {
     return m_vMineTypes;
@@ -110,6 +110,8 @@ public:
 
     virtual ~Minefield_State_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Minefield_State_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Minefield_State_PDU::SetSequenceNumber
     //              KDIS::PDU::Minefield_State_PDU::GetSequenceNumber
@@ -208,6 +210,9 @@ public:
     //************************************
     void AddPerimeterPointCoordinate( const KDIS::DATA_TYPE::PerimeterPointCoordinate & PPC );
     void SetPerimeterPointCoordinates( const std::vector<KDIS::DATA_TYPE::PerimeterPointCoordinate> & PPC );
+    #ifdef KDIS_USE_CPP11
+    void SetPerimeterPointCoordinates( std::vector<KDIS::DATA_TYPE::PerimeterPointCoordinate> && PPC );
+    #endif
     const std::vector<KDIS::DATA_TYPE::PerimeterPointCoordinate> & GetPerimeterPointCoordinates() const;
 
     //************************************
@@ -219,6 +224,9 @@ public:
     //************************************
     void AddMineType( const KDIS::DATA_TYPE::EntityType & MT );
     void SetMineTypes( const std::vector<KDIS::DATA_TYPE::EntityType> & MT );
+    #ifdef KDIS_USE_CPP11
+    void SetMineTypes( std::vector<KDIS::DATA_TYPE::EntityType> && MT );
+    #endif
     const std::vector<KDIS::DATA_TYPE::EntityType> & GetMineTypes() const;
 
     //************************************
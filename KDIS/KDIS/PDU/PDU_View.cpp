@@ -0,0 +1,195 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./PDU_View.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace KDIS;
+using namespace PDU;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+EntityIdentifier PDU_View::getEntityIdentifier( KUINT16 Offset ) const
+{
+    return EntityIdentifier( get<KUINT16>( Offset ), get<KUINT16>( Offset + 2 ), get<KUINT16>( Offset + 4 ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+EntityType PDU_View::getEntityType( KUINT16 Offset ) const
+{
+    return EntityType( m_pData[Offset], m_pData[Offset + 1], get<KUINT16>( Offset + 2 ), m_pData[Offset + 4],
+                       m_pData[Offset + 5], m_pData[Offset + 6], m_pData[Offset + 7] );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Vector PDU_View::getVector( KUINT16 Offset ) const
+{
+    return Vector( get<KFLOAT32>( Offset ), get<KFLOAT32>( Offset + 4 ), get<KFLOAT32>( Offset + 8 ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+WorldCoordinates PDU_View::getWorldCoordinates( KUINT16 Offset ) const
+{
+    return WorldCoordinates( get<KFLOAT64>( Offset ), get<KFLOAT64>( Offset + 8 ), get<KFLOAT64>( Offset + 16 ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+EulerAngles PDU_View::getEulerAngles( KUINT16 Offset ) const
+{
+    return EulerAngles( get<KFLOAT32>( Offset ), get<KFLOAT32>( Offset + 4 ), get<KFLOAT32>( Offset + 8 ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const KUOCTET * PDU_View::getRecord( KUINT16 Offset, KUINT16 RecordSize, KUINT16 Count, KUINT16 Index ) const throw( KException )
+{
+    if( Index >= Count )throw KException( __FUNCTION__, OUT_OF_BOUNDS );
+
+    KUINT32 ui32End = Offset + ( ( Index + 1 ) * RecordSize );
+    if( ui32End > m_ui16Size )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+
+    return m_pData + Offset + ( Index * RecordSize );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_View::checkPDU( PDUType T, KUINT16 MinSize ) const throw( KException )
+{
+    if( GetPDUType() != T )throw KException( __FUNCTION__, WRONG_PDU_TYPE_IN_HEADER );
+    if( m_ui16Size < MinSize )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void PDU_View::clampToPDU() throw( KException )
+{
+    if( m_ui16Size < PDU_VIEW_HEADER_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+
+    // The buffer may hold more than one PDU, only view this one.
+    KUINT16 ui16PDULen = GetPDULength();
+    if( ui16PDULen < PDU_VIEW_HEADER_SIZE )throw KException( __FUNCTION__, INVALID_DATA, "PDU length is smaller than the header" );
+    if( ui16PDULen < m_ui16Size )m_ui16Size = ui16PDULen;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+PDU_View::PDU_View( const KOCTET * Data, KUINT16 Size ) throw( KException ) :
+    m_pData( ( const KUOCTET * )Data ),
+    m_ui16Size( Size )
+{
+    clampToPDU();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+PDU_View::PDU_View( const KDataStream & stream ) throw( KException ) :
+    m_pData( 0 ),
+    m_ui16Size( stream.GetBufferSize() )
+{
+    // An empty stream has no buffer to point at.
+    if( m_ui16Size )m_pData = ( const KUOCTET * )stream.GetBufferPtr() + stream.GetCurrentWritePosition();
+
+    clampToPDU();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+PDU_View::~PDU_View()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const KOCTET * PDU_View::GetData() const
+{
+    return ( const KOCTET * )m_pData;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT16 PDU_View::GetSize() const
+{
+    return m_ui16Size;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ProtocolVersion PDU_View::GetProtocolVersion() const
+{
+    return ( ProtocolVersion )m_pData[0];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT8 PDU_View::GetExerciseID() const
+{
+    return m_pData[1];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+PDUType PDU_View::GetPDUType() const
+{
+    return ( PDUType )m_pData[2];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ProtocolFamily PDU_View::GetProtocolFamily() const
+{
+    return ( ProtocolFamily )m_pData[3];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 PDU_View::GetTimeStamp() const
+{
+    return get<KUINT32>( 4 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT16 PDU_View::GetPDULength() const
+{
+    return get<KUINT16>( 8 );
+}
+
+//////////////////////////////////////////////////////////////////////////
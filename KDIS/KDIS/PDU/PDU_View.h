@@ -0,0 +1,177 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      PDU_View
+    created:    18/10/2026
+
+    purpose:    Read only view of an encoded PDU. The view does not copy or decode the
+                PDU, it wraps the buffer and each accessor converts the field at its
+                fixed offset when called. Useful when only a few fields are needed,
+                such as when filtering or routing PDUs.
+
+                The buffer must remain valid for the life of the view.
+                The derived views add the body fields of a PDU type, this class provides
+                the header fields of any PDU. Views exist for the high rate PDUs only,
+                Entity State, Fire, Detonation and Signal. Any other type can be viewed
+                through this class for its header, its body must be decoded.
+
+    size:       96 bits / 12 octets - Min size
+*********************************************************************/
+
+#pragma once
+
+#include "./../KDataStream.h"
+#include "./../DataTypes/EntityIdentifier.h"
+#include "./../DataTypes/EntityType.h"
+#include "./../DataTypes/Vector.h"
+#include "./../DataTypes/WorldCoordinates.h"
+#include "./../DataTypes/EulerAngles.h"
+
+namespace KDIS {
+namespace PDU {
+
+class KDIS_EXPORT PDU_View
+{
+protected:
+
+    const KUOCTET * m_pData;
+
+    KUINT16 m_ui16Size;
+
+    //************************************
+    // FullName:    KDIS::PDU::PDU_View<Type>::get
+    // Description: Returns the value at a fixed offset, converted to machine endian.
+    // Parameter:   KUINT16 Offset
+    //************************************
+    template<class Type>
+    Type get( KUINT16 Offset ) const;
+
+    //************************************
+    // FullName:    KDIS::PDU::PDU_View::getEntityIdentifier
+    //              KDIS::PDU::PDU_View::getEntityType
+    //              KDIS::PDU::PDU_View::getVector
+    //              KDIS::PDU::PDU_View::getWorldCoordinates
+    //              KDIS::PDU::PDU_View::getEulerAngles
+    // Description: Builds the data type from the fields at a fixed offset.
+    // Parameter:   KUINT16 Offset
+    //************************************
+    KDIS::DATA_TYPE::EntityIdentifier getEntityIdentifier( KUINT16 Offset ) const;
+    KDIS::DATA_TYPE::EntityType getEntityType( KUINT16 Offset ) const;
+    KDIS::DATA_TYPE::Vector getVector( KUINT16 Offset ) const;
+    KDIS::DATA_TYPE::WorldCoordinates getWorldCoordinates( KUINT16 Offset ) const;
+    KDIS::DATA_TYPE::EulerAngles getEulerAngles( KUINT16 Offset ) const;
+
+    //************************************
+    // FullName:    KDIS::PDU::PDU_View::getRecord
+    // Description: Returns a record from a section of fixed size records, such as
+    //              variable parameters. Throws OUT_OF_BOUNDS if Index is not less than Count
+    //              and NOT_ENOUGH_DATA_IN_BUFFER if the record is not in the buffer.
+    // Parameter:   KUINT16 Offset - Offset of the first record.
+    // Parameter:   KUINT16 RecordSize
+    // Parameter:   KUINT16 Count
+    // Parameter:   KUINT16 Index
+    //************************************
+    const KUOCTET * getRecord( KUINT16 Offset, KUINT16 RecordSize, KUINT16 Count, KUINT16 Index ) const throw( KException );
+
+    //************************************
+    // FullName:    KDIS::PDU::PDU_View::checkPDU
+    // Description: Throws WRONG_PDU_TYPE_IN_HEADER if the PDU is not of type T
+    //              or NOT_ENOUGH_DATA_IN_BUFFER if the buffer is smaller than MinSize.
+    // Parameter:   KDIS::DATA_TYPE::ENUMS::PDUType T
+    // Parameter:   KUINT16 MinSize
+    //************************************
+    void checkPDU( KDIS::DATA_TYPE::ENUMS::PDUType T, KUINT16 MinSize ) const throw( KException );
+
+    //************************************
+    // FullName:    KDIS::PDU::PDU_View::clampToPDU
+    // Description: Limits the view to the length in the PDU header.
+    //              Throws NOT_ENOUGH_DATA_IN_BUFFER if there is less than a header
+    //              and INVALID_DATA if the PDU length is less than a header.
+    //************************************
+    void clampToPDU() throw( KException );
+
+public:
+
+    static const KUINT16 PDU_VIEW_HEADER_SIZE = 12;
+
+    //************************************
+    // FullName:    KDIS::PDU::PDU_View::PDU_View
+    // Description: Views a buffer or the unread data of a stream. The view covers
+    //              the PDU length from the header or the data available, whichever is less.
+    //              Throws NOT_ENOUGH_DATA_IN_BUFFER if there is less than a header and
+    //              INVALID_DATA if the PDU length is less than a header.
+    // Parameter:   const KOCTET * Data
+    // Parameter:   KUINT16 Size
+    //************************************
+    PDU_View( const KOCTET * Data, KUINT16 Size ) throw( KException );
+
+    PDU_View( const KDataStream & stream ) throw( KException );
+
+    virtual ~PDU_View();
+
+    //************************************
+    // FullName:    KDIS::PDU::PDU_View::GetData
+    //              KDIS::PDU::PDU_View::GetSize
+    // Description: The viewed buffer.
+    //************************************
+    const KOCTET * GetData() const;
+    KUINT16 GetSize() const;
+
+    //************************************
+    // FullName:    KDIS::PDU::PDU_View::GetProtocolVersion
+    //              KDIS::PDU::PDU_View::GetExerciseID
+    //              KDIS::PDU::PDU_View::GetPDUType
+    //              KDIS::PDU::PDU_View::GetProtocolFamily
+    //              KDIS::PDU::PDU_View::GetTimeStamp
+    //              KDIS::PDU::PDU_View::GetPDULength
+    // Description: Header fields. The time stamp is returned as the raw 32 bit field.
+    //************************************
+    KDIS::DATA_TYPE::ENUMS::ProtocolVersion GetProtocolVersion() const;
+    KUINT8 GetExerciseID() const;
+    KDIS::DATA_TYPE::ENUMS::PDUType GetPDUType() const;
+    KDIS::DATA_TYPE::ENUMS::ProtocolFamily GetProtocolFamily() const;
+    KUINT32 GetTimeStamp() const;
+    KUINT16 GetPDULength() const;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// templates
+//////////////////////////////////////////////////////////////////////////
+
+template<class Type>
+Type PDU_View::get( KUINT16 Offset ) const
+{
+    return NetToDataType<Type>( ( const KOCTET * )m_pData + Offset, !KDIS::UTILS::IsMachineBigEndian() ).m_Value;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+} // END namespace PDU
+} // END namespace KDIS
@@ -290,6 +290,26 @@ void Intercom_Control_PDU::SetIntercomCommunicationParameters( const vector<Inte
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Intercom_Control_PDU::SetIntercomCommunicationParameters( vector<IntercomCommunicationParameters> && ICP )
+{
+    m_ui16PDULength = INTERCOM_CONTROL_PDU_SIZE;
+
+    m_vICP = std::move( ICP );
+
+    vector<IntercomCommunicationParameters>::const_iterator citr = m_vICP.begin();
+    vector<IntercomCommunicationParameters>::const_iterator citrEnd = m_vICP.end();
+
+    for( ; citr != citrEnd; ++citr )
+    {
+        // Calculate the PDU length.
+        m_ui16PDULength += citr->GetLength() + IntercomCommunicationParameters::INTERCOM_COMMS_PARAM_SIZE;
+    }
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<IntercomCommunicationParameters> & Intercom_Control_PDU::GetIntercomCommunicationParameters() const
 {
     return m_vICP;
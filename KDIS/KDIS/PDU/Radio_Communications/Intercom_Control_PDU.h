@@ -100,6 +100,8 @@ public:
 
     virtual ~Intercom_Control_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Intercom_Control_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Intercom_Control_PDU::SetControlType
     //              KDIS::PDU::Intercom_Control_PDU::GetControlType
@@ -238,6 +240,9 @@ public:
     //************************************
     void AddIntercomCommunicationParameters( const KDIS::DATA_TYPE::IntercomCommunicationParameters & ICP );
     void SetIntercomCommunicationParameters( const std::vector<KDIS::DATA_TYPE::IntercomCommunicationParameters> & ICP );
+    #ifdef KDIS_USE_CPP11
+    void SetIntercomCommunicationParameters( std::vector<KDIS::DATA_TYPE::IntercomCommunicationParameters> && ICP );
+    #endif
     const std::vector<KDIS::DATA_TYPE::IntercomCommunicationParameters> & GetIntercomCommunicationParameters() const;
 
     //************************************
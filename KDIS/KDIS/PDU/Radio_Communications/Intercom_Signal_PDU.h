@@ -63,6 +63,8 @@ public:
 
     virtual ~Intercom_Signal_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Intercom_Signal_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Intercom_Signal_PDU::GetAsString
     // Description: Returns a string representation of the PDU.
@@ -28,6 +28,7 @@ http://p.sf.net/kdis/UserGuide
 *********************************************************************/
 
 #include "./Signal_PDU.h"
+#include "./../../Extras/AudioCodec.h"
 
 //////////////////////////////////////////////////////////////////////////
 
@@ -38,6 +39,22 @@ using namespace DATA_TYPE;
 using namespace ENUMS;
 using namespace UTILS;
 
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+KUINT16 Signal_PDU::getAudioSamples( KUINT16 MaxSamples ) const throw( KException )
+{
+    const KUINT8 ui8Size = m_EncodingScheme.GetEncodingClass() == EncodedAudio ? AudioCodec::GetSampleSize( m_EncodingScheme.GetEncodingType() ) : 0;
+    if( ui8Size == 0 )throw KException( __FUNCTION__, UNSUPPORTED_DATATYPE );
+
+    // Never read past the data, whatever the sample count says.
+    KUINT16 ui16Samples = m_ui16Samples;
+    if( ui16Samples > m_ui16DataLength / 8 / ui8Size )ui16Samples = m_ui16DataLength / 8 / ui8Size;
+    if( MaxSamples < ui16Samples )throw KException( __FUNCTION__, BUFFER_TOO_SMALL );
+    return ui16Samples;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // public:
 //////////////////////////////////////////////////////////////////////////
@@ -201,6 +218,43 @@ void Signal_PDU::GetData( KOCTET * D, KUINT16 Length ) const throw( KException )
 
 //////////////////////////////////////////////////////////////////////////
 
+void Signal_PDU::SetAudio( const KINT16 * S, KUINT16 Samples ) throw( KException )
+{
+    const KUINT8 ui8Size = m_EncodingScheme.GetEncodingClass() == EncodedAudio ? AudioCodec::GetSampleSize( m_EncodingScheme.GetEncodingType() ) : 0;
+    if( ui8Size == 0 )throw KException( __FUNCTION__, UNSUPPORTED_DATATYPE );
+
+    const KUINT32 ui32DataSz = ( KUINT32 )Samples * ui8Size;
+    if( ui32DataSz * 8 > 0xFFFF )throw KException( __FUNCTION__, DATA_TYPE_TOO_LARGE );
+
+    // Encode straight into the data, zeroing the padding.
+    m_vData.assign( ui32DataSz + ( ui32DataSz % 4 == 0 ? 0 : ( 4 - ui32DataSz % 4 ) ), 0 );
+    if( Samples )AudioCodec::Encode( m_EncodingScheme.GetEncodingType(), S, Samples, &m_vData[0] );
+
+    m_ui16Samples = Samples;
+    m_ui16DataLength = ui32DataSz * 8;
+    m_ui16PDULength = SIGNAL_PDU_SIZE + m_vData.size();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT16 Signal_PDU::GetAudio( KINT16 * S, KUINT16 MaxSamples ) const throw( KException )
+{
+    const KUINT16 ui16Samples = getAudioSamples( MaxSamples );
+    if( ui16Samples )AudioCodec::Decode( m_EncodingScheme.GetEncodingType(), &m_vData[0], ui16Samples, S );
+    return ui16Samples;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT16 Signal_PDU::GetAudio( KFLOAT32 * S, KUINT16 MaxSamples ) const throw( KException )
+{
+    const KUINT16 ui16Samples = getAudioSamples( MaxSamples );
+    if( ui16Samples )AudioCodec::Decode( m_EncodingScheme.GetEncodingType(), &m_vData[0], ui16Samples, S );
+    return ui16Samples;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 KString Signal_PDU::GetAsString() const
 {
     KStringStream ss;
@@ -222,9 +276,10 @@ KString Signal_PDU::GetAsString() const
 
 //////////////////////////////////////////////////////////////////////////
 
-void Signal_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= true*/ ) throw( KException )
+ErrorCodes Signal_PDU::TryDecode( KDataStream & stream, bool ignoreHeader /*= false*/ )
 {
-    if( ( stream.GetBufferSize() + ( ignoreHeader ? Header::HEADER6_PDU_SIZE : 0 ) ) < SIGNAL_PDU_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    // The fixed part first, then the data once its length is known.
+    if( ( stream.GetBufferSize() + ( ignoreHeader ? Header::HEADER6_PDU_SIZE : 0 ) ) < SIGNAL_PDU_SIZE )return NOT_ENOUGH_DATA_IN_BUFFER;
 
     Radio_Communications_Header::Decode( stream, ignoreHeader );
 
@@ -235,12 +290,20 @@ void Signal_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= true*/ ) th
 
     KUINT16 dl =  m_ui16DataLength / 8;
     dl += ( dl % 4 == 0 ? 0 : ( 4 - dl % 4 ) ); // Add padding
-    for( KUINT16 i = 0; i < dl; ++i )
-    {
-        KOCTET o;
-        stream >> o;
-        m_vData.push_back( o );
-    }
+    if( stream.GetBufferSize() < dl )return NOT_ENOUGH_DATA_IN_BUFFER;
+
+    m_vData.resize( dl );
+    if( dl )stream.Read( &m_vData[0], dl );
+
+    return NO_ERRORS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Signal_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= false*/ ) throw( KException )
+{
+    const ErrorCodes e = Signal_PDU::TryDecode( stream, ignoreHeader );
+    if( e != NO_ERRORS )throw KException( __FUNCTION__, e );
 }
 
 //////////////////////////////////////////////////////////////////////////
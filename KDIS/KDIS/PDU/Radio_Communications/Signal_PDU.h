@@ -64,6 +64,14 @@ protected:
 
     std::vector<KOCTET> m_vData;
 
+    //************************************
+    // FullName:    KDIS::PDU::Signal_PDU::getAudioSamples
+    // Description: Checks the data can be decoded as audio and returns the number of samples
+    //              in it, see GetAudio.
+    // Parameter:   KUINT16 MaxSamples
+    //************************************
+    KUINT16 getAudioSamples( KUINT16 MaxSamples ) const throw( KException );
+
 public:
 
     static const KUINT16 SIGNAL_PDU_SIZE = 32; // Min Size
@@ -81,6 +89,8 @@ public:
 
     virtual ~Signal_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Signal_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Signal_PDU::SetEncodingScheme
     //              KDIS::PDU::Signal_PDU::GetEncodingScheme
@@ -131,6 +141,21 @@ public:
     void SetData( const KOCTET * D, KUINT16 Length );
     void GetData( KOCTET * D, KUINT16 Length ) const throw( KException );
 
+    //************************************
+    // FullName:    KDIS::PDU::Signal_PDU::SetAudio
+    //              KDIS::PDU::Signal_PDU::GetAudio
+    // Description: The data as PCM samples, converted with the AudioCodec for the encoding type.
+    //              Set encodes the samples and sets the data and sample count, Get decodes
+    //              them and returns the number of samples. Throws UNSUPPORTED_DATATYPE if the
+    //              encoding scheme is not encoded audio in an AudioCodec encoding and Get
+    //              throws BUFFER_TOO_SMALL if MaxSamples is less than the samples in the PDU.
+    // Parameter:   const KINT16 * S / KINT16 * S / KFLOAT32 * S
+    // Parameter:   KUINT16 Samples / KUINT16 MaxSamples
+    //************************************
+    void SetAudio( const KINT16 * S, KUINT16 Samples ) throw( KException );
+    KUINT16 GetAudio( KINT16 * S, KUINT16 MaxSamples ) const throw( KException );
+    KUINT16 GetAudio( KFLOAT32 * S, KUINT16 MaxSamples ) const throw( KException );
+
     //************************************
     // FullName:    KDIS::PDU::Signal_PDU::GetAsString
     // Description: Returns a string representation of the PDU.
@@ -139,11 +164,15 @@ public:
 
     //************************************
     // FullName:    KDIS::PDU::Signal_PDU::Decode
+    //              KDIS::PDU::Signal_PDU::TryDecode
     // Description: Convert From Network Data.
+    //              The stream is checked before the fields are read, TryDecode returns an error
+    //              code instead of throwing.
     // Parameter:   KDataStream & stream
     // Parameter:   bool ignoreHeader = false - Decode the header from the stream?
     //************************************
     virtual void Decode( KDataStream & stream, bool ignoreHeader = false ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream, bool ignoreHeader = false );
 
     //************************************
     // FullName:    KDIS::PDU::Signal_PDU::Encode
@@ -0,0 +1,179 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./Signal_View.h"
+#include "./../../Extras/AudioCodec.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace KDIS;
+using namespace PDU;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+using namespace UTILS;
+
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+KUINT16 Signal_View::getAudioSamples( KUINT16 MaxSamples ) const throw( KException )
+{
+    const KUINT8 ui8Size = GetEncodingClass() == EncodedAudio ? AudioCodec::GetSampleSize( GetEncodingType() ) : 0;
+    if( ui8Size == 0 )throw KException( __FUNCTION__, UNSUPPORTED_DATATYPE );
+
+    KUINT16 ui16Samples = GetSamples();
+    if( ui16Samples > GetSignalDataSize() / ui8Size )ui16Samples = GetSignalDataSize() / ui8Size;
+    if( MaxSamples < ui16Samples )throw KException( __FUNCTION__, BUFFER_TOO_SMALL );
+    return ui16Samples;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+Signal_View::Signal_View( const KOCTET * Data, KUINT16 Size ) throw( KException ) :
+    PDU_View( Data, Size )
+{
+    checkPDU( Signal_PDU_Type, SIGNAL_VIEW_SIZE );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Signal_View::Signal_View( const KDataStream & stream ) throw( KException ) :
+    PDU_View( stream )
+{
+    checkPDU( Signal_PDU_Type, SIGNAL_VIEW_SIZE );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Signal_View::~Signal_View()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+EntityIdentifier Signal_View::GetEntityID() const
+{
+    return getEntityIdentifier( 12 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT16 Signal_View::GetRadioID() const
+{
+    return get<KUINT16>( 18 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+EncodingScheme Signal_View::GetEncodingScheme() const
+{
+    return EncodingScheme( GetEncodingClass(), GetEncodingType(), GetTDLType() );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+EncodingClass Signal_View::GetEncodingClass() const
+{
+    return ( EncodingClass )( get<KUINT16>( 20 ) >> 14 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT16 Signal_View::GetEncodingType() const
+{
+    return get<KUINT16>( 20 ) & 0x3FFF;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+TDLType Signal_View::GetTDLType() const
+{
+    return ( TDLType )get<KUINT16>( 22 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 Signal_View::GetSampleRate() const
+{
+    return get<KUINT32>( 24 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT16 Signal_View::GetDataLength() const
+{
+    return get<KUINT16>( 28 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT16 Signal_View::GetSamples() const
+{
+    return get<KUINT16>( 30 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const KOCTET * Signal_View::GetSignalData() const throw( KException )
+{
+    GetSignalDataSize(); // Bounds check.
+    return ( const KOCTET * )m_pData + SIGNAL_VIEW_SIZE;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT16 Signal_View::GetSignalDataSize() const throw( KException )
+{
+    KUINT16 ui16Size = ( GetDataLength() + 7 ) / 8;
+    if( SIGNAL_VIEW_SIZE + ui16Size > m_ui16Size )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    return ui16Size;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT16 Signal_View::GetAudio( KINT16 * S, KUINT16 MaxSamples ) const throw( KException )
+{
+    const KUINT16 ui16Samples = getAudioSamples( MaxSamples );
+    AudioCodec::Decode( GetEncodingType(), GetSignalData(), ui16Samples, S );
+    return ui16Samples;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT16 Signal_View::GetAudio( KFLOAT32 * S, KUINT16 MaxSamples ) const throw( KException )
+{
+    const KUINT16 ui16Samples = getAudioSamples( MaxSamples );
+    AudioCodec::Decode( GetEncodingType(), GetSignalData(), ui16Samples, S );
+    return ui16Samples;
+}
+
+//////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,122 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      Signal_View
+    created:    19/10/2026
+
+    purpose:    Read only view of an encoded Signal_PDU.
+                See PDU_View.
+
+                The signal data is not copied, GetSignalData points into the
+                viewed buffer so audio can be passed on without decoding the PDU.
+
+    size:       256 bits / 32 octets - Min size
+*********************************************************************/
+
+#pragma once
+
+#include "./../PDU_View.h"
+#include "./../../DataTypes/EncodingScheme.h"
+
+namespace KDIS {
+namespace PDU {
+
+class KDIS_EXPORT Signal_View : public PDU_View
+{
+protected:
+
+    //************************************
+    // FullName:    KDIS::PDU::Signal_View::getAudioSamples
+    // Description: See Signal_PDU::getAudioSamples.
+    // Parameter:   KUINT16 MaxSamples
+    //************************************
+    KUINT16 getAudioSamples( KUINT16 MaxSamples ) const throw( KException );
+
+public:
+
+    static const KUINT16 SIGNAL_VIEW_SIZE = 32;
+
+    //************************************
+    // FullName:    KDIS::PDU::Signal_View::Signal_View
+    // Description: Throws WRONG_PDU_TYPE_IN_HEADER if the buffer does not hold a
+    //              Signal PDU or NOT_ENOUGH_DATA_IN_BUFFER if it is too small.
+    // Parameter:   const KOCTET * Data
+    // Parameter:   KUINT16 Size
+    //************************************
+    Signal_View( const KOCTET * Data, KUINT16 Size ) throw( KException );
+
+    Signal_View( const KDataStream & stream ) throw( KException );
+
+    virtual ~Signal_View();
+
+    //************************************
+    // FullName:    KDIS::PDU::Signal_View::GetEntityID
+    //              KDIS::PDU::Signal_View::GetRadioID
+    //              KDIS::PDU::Signal_View::GetEncodingScheme
+    //              KDIS::PDU::Signal_View::GetEncodingClass
+    //              KDIS::PDU::Signal_View::GetEncodingType
+    //              KDIS::PDU::Signal_View::GetTDLType
+    //              KDIS::PDU::Signal_View::GetSampleRate
+    //              KDIS::PDU::Signal_View::GetDataLength
+    //              KDIS::PDU::Signal_View::GetSamples
+    // Description: See Signal_PDU. The data length is in bits.
+    //************************************
+    KDIS::DATA_TYPE::EntityIdentifier GetEntityID() const;
+    KUINT16 GetRadioID() const;
+    KDIS::DATA_TYPE::EncodingScheme GetEncodingScheme() const;
+    KDIS::DATA_TYPE::ENUMS::EncodingClass GetEncodingClass() const;
+    KUINT16 GetEncodingType() const;
+    KDIS::DATA_TYPE::ENUMS::TDLType GetTDLType() const;
+    KUINT32 GetSampleRate() const;
+    KUINT16 GetDataLength() const;
+    KUINT16 GetSamples() const;
+
+    //************************************
+    // FullName:    KDIS::PDU::Signal_View::GetSignalData
+    //              KDIS::PDU::Signal_View::GetSignalDataSize
+    // Description: The signal data in the viewed buffer and its size in octets,
+    //              padding excluded. Throws NOT_ENOUGH_DATA_IN_BUFFER if the data
+    //              length runs past the end of the buffer.
+    //************************************
+    const KOCTET * GetSignalData() const throw( KException );
+    KUINT16 GetSignalDataSize() const throw( KException );
+
+    //************************************
+    // FullName:    KDIS::PDU::Signal_View::GetAudio
+    // Description: Decodes the signal data to PCM, see Signal_PDU::GetAudio.
+    // Parameter:   KINT16 * S / KFLOAT32 * S
+    // Parameter:   KUINT16 MaxSamples
+    //************************************
+    KUINT16 GetAudio( KINT16 * S, KUINT16 MaxSamples ) const throw( KException );
+    KUINT16 GetAudio( KFLOAT32 * S, KUINT16 MaxSamples ) const throw( KException );
+};
+
+} // END namespace PDU
+} // END namespace KDIS
@@ -110,6 +110,8 @@ public:
 
     virtual ~Transmitter_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Transmitter_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Transmitter_PDU::SetRadioEntityType
     //              KDIS::PDU::Transmitter_PDU::GetRadioEntityType
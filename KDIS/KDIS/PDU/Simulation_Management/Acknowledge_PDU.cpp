@@ -99,7 +99,7 @@ Acknowledge_PDU::Acknowledge_PDU( const Simulation_Management_Header & SimMgrHea
 //////////////////////////////////////////////////////////////////////////
 
 Acknowledge_PDU::Acknowledge_PDU( const Create_Entity_PDU & pdu, AcknowledgeResponseFlag ARF ) :
-    Simulation_Management_Header( pdu.GetOriginatingEntityID(), pdu.GetReceivingEntityID() ),
+    Simulation_Management_Header( pdu.GetReceivingEntityID(), pdu.GetOriginatingEntityID() ),
     m_ui16AcknowledgeFlag( CreateEntityPDU ),
     m_ui16ResponseFlag( ARF ),
     m_ui32RequestID( pdu.GetRequestID() )
@@ -111,7 +111,7 @@ Acknowledge_PDU::Acknowledge_PDU( const Create_Entity_PDU & pdu, AcknowledgeResp
 //////////////////////////////////////////////////////////////////////////
 
 Acknowledge_PDU::Acknowledge_PDU( const Remove_Entity_PDU & pdu, AcknowledgeResponseFlag ARF ) :
-    Simulation_Management_Header( pdu.GetOriginatingEntityID(), pdu.GetReceivingEntityID() ),
+    Simulation_Management_Header( pdu.GetReceivingEntityID(), pdu.GetOriginatingEntityID() ),
     m_ui16AcknowledgeFlag( RemoveEntityPDU ),
     m_ui16ResponseFlag( ARF ),
     m_ui32RequestID( pdu.GetRequestID() )
@@ -123,7 +123,7 @@ Acknowledge_PDU::Acknowledge_PDU( const Remove_Entity_PDU & pdu, AcknowledgeResp
 //////////////////////////////////////////////////////////////////////////
 
 Acknowledge_PDU::Acknowledge_PDU( const Start_Resume_PDU & pdu, AcknowledgeResponseFlag ARF ) :
-    Simulation_Management_Header( pdu.GetOriginatingEntityID(), pdu.GetReceivingEntityID() ),
+    Simulation_Management_Header( pdu.GetReceivingEntityID(), pdu.GetOriginatingEntityID() ),
     m_ui16AcknowledgeFlag( Start_ResumePDU ),
     m_ui16ResponseFlag( ARF ),
     m_ui32RequestID( pdu.GetRequestID() )
@@ -135,7 +135,7 @@ Acknowledge_PDU::Acknowledge_PDU( const Start_Resume_PDU & pdu, AcknowledgeRespo
 //////////////////////////////////////////////////////////////////////////
 
 Acknowledge_PDU::Acknowledge_PDU( const Stop_Freeze_PDU & pdu, AcknowledgeResponseFlag ARF ) :
-    Simulation_Management_Header( pdu.GetOriginatingEntityID(), pdu.GetReceivingEntityID() ),
+    Simulation_Management_Header( pdu.GetReceivingEntityID(), pdu.GetOriginatingEntityID() ),
     m_ui16AcknowledgeFlag( Stop_FreezePDU ),
     m_ui16ResponseFlag( ARF ),
     m_ui32RequestID( pdu.GetRequestID() )
@@ -71,6 +71,8 @@ public:
 
     virtual ~Action_Request_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Action_Request_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Action_Request_PDU::SetActionID
     //              KDIS::PDU::Action_Request_PDU::GetActionID
@@ -68,6 +68,8 @@ public:
 
     virtual ~Action_Response_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Action_Response_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Action_Response_PDU::SetRequestStatus
     //              KDIS::PDU::Action_Response_PDU::GetRequestStatus
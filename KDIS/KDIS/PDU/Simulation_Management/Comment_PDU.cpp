@@ -132,6 +132,22 @@ void Comment_PDU::SetFixedDatum( const vector<FixDtmPtr> & FD )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Comment_PDU::SetFixedDatum( vector<FixDtmPtr> && FD )
+{
+    // Subtract old length
+    m_ui16PDULength -= m_ui32NumFixedDatum * FixedDatum::FIXED_DATUM_SIZE;
+
+    m_vFixedDatum = std::move( FD );
+    m_ui32NumFixedDatum = m_vFixedDatum.size();
+
+    // Calculate new length
+    m_ui16PDULength += m_ui32NumFixedDatum * FixedDatum::FIXED_DATUM_SIZE;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<FixDtmPtr> & Comment_PDU::GetFixedDatum() const
 {
     return m_vFixedDatum;
@@ -169,6 +185,27 @@ void Comment_PDU::SetVariableDatum( const vector<VarDtmPtr> & VD )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Comment_PDU::SetVariableDatum( vector<VarDtmPtr> && VD )
+{
+    m_vVariableDatum = std::move( VD );
+    m_ui32NumVariableDatum = m_vVariableDatum.size();
+
+    // Reset length
+    m_ui16PDULength = COMMENT_PDU_SIZE + ( m_ui32NumFixedDatum * FixedDatum::FIXED_DATUM_SIZE );
+
+    // Calculate the new length
+    vector<VarDtmPtr>::const_iterator citr = m_vVariableDatum.begin();
+    vector<VarDtmPtr>::const_iterator citrEnd = m_vVariableDatum.end();
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui16PDULength += ( *citr )->GetPDULength();
+    }
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<VarDtmPtr> & Comment_PDU::GetVariableDatum() const
 {
     return m_vVariableDatum;
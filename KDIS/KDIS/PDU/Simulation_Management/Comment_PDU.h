@@ -82,6 +82,8 @@ public:
 
     virtual ~Comment_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Comment_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Comment_PDU::GetNumberFIxedDatum
     // Description: Returns number of fixed datum records
@@ -103,6 +105,9 @@ public:
     //************************************
     void AddFixedDatum( KDIS::DATA_TYPE::FixDtmPtr FD );
     void SetFixedDatum( const std::vector<KDIS::DATA_TYPE::FixDtmPtr> & FD );
+    #ifdef KDIS_USE_CPP11
+    void SetFixedDatum( std::vector<KDIS::DATA_TYPE::FixDtmPtr> && FD );
+    #endif
     const std::vector<FixDtmPtr> & GetFixedDatum() const;
 
     //************************************
@@ -114,6 +119,9 @@ public:
     //************************************
     void AddVariableDatum( KDIS::DATA_TYPE::VarDtmPtr VD );
     virtual void SetVariableDatum( const std::vector<KDIS::DATA_TYPE::VarDtmPtr> & VD );
+    #ifdef KDIS_USE_CPP11
+    virtual void SetVariableDatum( std::vector<KDIS::DATA_TYPE::VarDtmPtr> && VD );
+    #endif
     const std::vector<VarDtmPtr> & GetVariableDatum() const;
 
     //************************************
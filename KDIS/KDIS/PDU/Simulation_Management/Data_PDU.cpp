@@ -117,6 +117,18 @@ void KDIS::PDU::Data_PDU::SetVariableDatum(const std::vector<KDIS::DATA_TYPE::Va
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void KDIS::PDU::Data_PDU::SetVariableDatum(std::vector<KDIS::DATA_TYPE::VarDtmPtr> && VD)
+{
+    Comment_PDU::SetVariableDatum( std::move( VD ) );
+
+    // The calculated length uses COMMENT_PDU_SIZE as the default so we need to add any extra on for this PDU.
+    m_ui16PDULength += DATA_PDU_SIZE - COMMENT_PDU_SIZE;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 KString Data_PDU::GetAsString() const
 {
     KStringStream ss;
@@ -69,6 +69,8 @@ public:
 
     virtual ~Data_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Data_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Data_PDU::SetRequestID
     //              KDIS::PDU::Data_PDU::GetRequestID
@@ -85,6 +87,9 @@ public:
     // Parameter:   const vector<VarDtmPtr> & VD
     //************************************
     virtual void SetVariableDatum(const std::vector<KDIS::DATA_TYPE::VarDtmPtr> & VD);
+    #ifdef KDIS_USE_CPP11
+    virtual void SetVariableDatum(std::vector<KDIS::DATA_TYPE::VarDtmPtr> && VD);
+    #endif
 
     //************************************
     // FullName:    KDIS::PDU::Data_PDU::GetAsString
@@ -164,6 +164,17 @@ void Data_Query_PDU::SetFixedDatum( const vector<KUINT32> & FD )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Data_Query_PDU::SetFixedDatum( vector<KUINT32> && FD )
+{
+    m_vFixedDatum = std::move( FD );
+    m_ui32NumFixedDatum = m_vFixedDatum.size();
+    m_ui16PDULength = DATA_QUERY_PDU_SIZE + ( m_ui32NumFixedDatum + m_ui32NumVariableDatum ) * 4; // Size of KUINT32
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<KUINT32> & Data_Query_PDU::GetFixedDatum() const
 {
     return m_vFixedDatum;
@@ -189,6 +200,17 @@ void Data_Query_PDU::SetVariableDatum( const vector<KUINT32> & VD )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Data_Query_PDU::SetVariableDatum( vector<KUINT32> && VD )
+{
+    m_vVariableDatum = std::move( VD );
+    m_ui32NumVariableDatum = m_vVariableDatum.size();
+    m_ui16PDULength = DATA_QUERY_PDU_SIZE + ( m_ui32NumFixedDatum + m_ui32NumVariableDatum ) * 4; // Size of KUINT32
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<KUINT32> & Data_Query_PDU::GetVariableDatum() const
 {
     return m_vVariableDatum;
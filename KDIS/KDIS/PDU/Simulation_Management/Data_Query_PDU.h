@@ -77,6 +77,8 @@ public:
 
     virtual ~Data_Query_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Data_Query_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Data_Query_PDU::SetRequestID
     //              KDIS::PDU::Data_Query_PDU::GetRequestID
@@ -120,6 +122,9 @@ public:
     //************************************
     void AddFixedDatum( KUINT32 FD );
     void SetFixedDatum( const std::vector<KUINT32> & FD );
+    #ifdef KDIS_USE_CPP11
+    void SetFixedDatum( std::vector<KUINT32> && FD );
+    #endif
     const std::vector<KUINT32> & GetFixedDatum() const;
 
     //************************************
@@ -131,6 +136,9 @@ public:
     //************************************
     void AddVariableDatum( KUINT32 VD );
     void SetVariableDatum( const std::vector<KUINT32> & VD );
+    #ifdef KDIS_USE_CPP11
+    void SetVariableDatum( std::vector<KUINT32> && VD );
+    #endif
     const std::vector<KUINT32> & GetVariableDatum() const;
 
     //************************************
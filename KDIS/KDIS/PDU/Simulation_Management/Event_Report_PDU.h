@@ -70,6 +70,8 @@ public:
 
     virtual ~Event_Report_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Event_Report_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Event_Report_PDU::SetEventType
     //              KDIS::PDU::Event_Report_PDU::GetEventType
@@ -85,6 +87,9 @@ public:
     // Parameter:   const vector<VarDtmPtr> & VD
     //************************************
     virtual void SetVariableDatum(const std::vector<KDIS::DATA_TYPE::VarDtmPtr> & VD);
+    #ifdef KDIS_USE_CPP11
+    virtual void SetVariableDatum(std::vector<KDIS::DATA_TYPE::VarDtmPtr> && VD);
+    #endif
 
     //************************************
     // FullName:    KDIS::PDU::Event_Report_PDU::GetAsString
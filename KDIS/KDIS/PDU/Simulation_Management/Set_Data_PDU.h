@@ -61,6 +61,8 @@ public:
 
     virtual ~Set_Data_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Set_Data_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Set_Data_PDU::GetAsString
     // Description: Returns a string representation of the PDU.
@@ -92,10 +92,10 @@ Acknowledge_R_PDU::Acknowledge_R_PDU( const Simulation_Management_Header & SimMg
 //////////////////////////////////////////////////////////////////////////
 
 Acknowledge_R_PDU::Acknowledge_R_PDU( const Create_Entity_R_PDU & pdu, AcknowledgeResponseFlag ARF ) :
-    Acknowledge_PDU( pdu.GetOriginatingEntityID(), pdu.GetReceivingEntityID(), CreateEntityPDU, ARF, pdu.GetRequestID() )
+    Acknowledge_PDU( pdu.GetReceivingEntityID(), pdu.GetOriginatingEntityID(), CreateEntityPDU, ARF, pdu.GetRequestID() )
 {
-    m_ui8PDUType = Acknowledge_PDU_Type;
-    m_ui16PDULength = ACKNOWLEDGE_PDU_SIZE;
+    m_ui8PDUType = Acknowledge_R_PDU_Type;
+    m_ui16PDULength = ACKNOWLEDGE_R_PDU_SIZE;
     m_ui8ProtocolVersion = IEEE_1278_1A_1998;
     m_ui8ProtocolFamily = SimulationManagementwithReliability;
 }
@@ -103,10 +103,10 @@ Acknowledge_R_PDU::Acknowledge_R_PDU( const Create_Entity_R_PDU & pdu, Acknowled
 //////////////////////////////////////////////////////////////////////////
 
 Acknowledge_R_PDU::Acknowledge_R_PDU( const Remove_Entity_R_PDU & pdu, AcknowledgeResponseFlag ARF ) :
-    Acknowledge_PDU( pdu.GetOriginatingEntityID(), pdu.GetReceivingEntityID(), RemoveEntityPDU, ARF, pdu.GetRequestID() )
+    Acknowledge_PDU( pdu.GetReceivingEntityID(), pdu.GetOriginatingEntityID(), RemoveEntityPDU, ARF, pdu.GetRequestID() )
 {
-    m_ui8PDUType = Acknowledge_PDU_Type;
-    m_ui16PDULength = ACKNOWLEDGE_PDU_SIZE;
+    m_ui8PDUType = Acknowledge_R_PDU_Type;
+    m_ui16PDULength = ACKNOWLEDGE_R_PDU_SIZE;
     m_ui8ProtocolVersion = IEEE_1278_1A_1998;
     m_ui8ProtocolFamily = SimulationManagementwithReliability;
 }
@@ -114,10 +114,10 @@ Acknowledge_R_PDU::Acknowledge_R_PDU( const Remove_Entity_R_PDU & pdu, Acknowled
 //////////////////////////////////////////////////////////////////////////
 
 Acknowledge_R_PDU::Acknowledge_R_PDU( const Start_Resume_R_PDU & pdu, AcknowledgeResponseFlag ARF ) :
-    Acknowledge_PDU( pdu.GetOriginatingEntityID(), pdu.GetReceivingEntityID(), Start_ResumePDU, ARF, pdu.GetRequestID() )
+    Acknowledge_PDU( pdu.GetReceivingEntityID(), pdu.GetOriginatingEntityID(), Start_ResumePDU, ARF, pdu.GetRequestID() )
 {
-    m_ui8PDUType = Acknowledge_PDU_Type;
-    m_ui16PDULength = ACKNOWLEDGE_PDU_SIZE;
+    m_ui8PDUType = Acknowledge_R_PDU_Type;
+    m_ui16PDULength = ACKNOWLEDGE_R_PDU_SIZE;
     m_ui8ProtocolVersion = IEEE_1278_1A_1998;
     m_ui8ProtocolFamily = SimulationManagementwithReliability;
 }
@@ -125,10 +125,10 @@ Acknowledge_R_PDU::Acknowledge_R_PDU( const Start_Resume_R_PDU & pdu, Acknowledg
 //////////////////////////////////////////////////////////////////////////
 
 Acknowledge_R_PDU::Acknowledge_R_PDU( const Stop_Freeze_R_PDU & pdu, AcknowledgeResponseFlag ARF ) :
-    Acknowledge_PDU( pdu.GetOriginatingEntityID(), pdu.GetReceivingEntityID(), Stop_FreezePDU, ARF, pdu.GetRequestID() )
+    Acknowledge_PDU( pdu.GetReceivingEntityID(), pdu.GetOriginatingEntityID(), Stop_FreezePDU, ARF, pdu.GetRequestID() )
 {
-    m_ui8PDUType = Acknowledge_PDU_Type;
-    m_ui16PDULength = ACKNOWLEDGE_PDU_SIZE;
+    m_ui8PDUType = Acknowledge_R_PDU_Type;
+    m_ui16PDULength = ACKNOWLEDGE_R_PDU_SIZE;
     m_ui8ProtocolVersion = IEEE_1278_1A_1998;
     m_ui8ProtocolFamily = SimulationManagementwithReliability;
 }
@@ -136,10 +136,10 @@ Acknowledge_R_PDU::Acknowledge_R_PDU( const Stop_Freeze_R_PDU & pdu, Acknowledge
 //////////////////////////////////////////////////////////////////////////
 
 Acknowledge_R_PDU::Acknowledge_R_PDU( const Transfer_Control_Request_PDU & pdu, AcknowledgeResponseFlag ARF ) :
-    Acknowledge_PDU( pdu.GetOriginatingEntityID(), pdu.GetReceivingEntityID(), TransferControlRequest, ARF, pdu.GetRequestID() )
+    Acknowledge_PDU( pdu.GetReceivingEntityID(), pdu.GetOriginatingEntityID(), TransferControlRequest, ARF, pdu.GetRequestID() )
 {
-    m_ui8PDUType = Acknowledge_PDU_Type;
-    m_ui16PDULength = ACKNOWLEDGE_PDU_SIZE;
+    m_ui8PDUType = Acknowledge_R_PDU_Type;
+    m_ui16PDULength = ACKNOWLEDGE_R_PDU_SIZE;
     m_ui8ProtocolVersion = IEEE_1278_1A_1998;
     m_ui8ProtocolFamily = SimulationManagementwithReliability;
 }
@@ -64,6 +64,8 @@ public:
 
     virtual ~Action_Request_R_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Action_Request_R_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Action_Request_R_PDU::GetAsString
     // Description: Returns a string representation of the PDU.
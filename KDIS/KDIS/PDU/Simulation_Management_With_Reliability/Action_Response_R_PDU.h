@@ -62,6 +62,8 @@ public:
 
     virtual ~Action_Response_R_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Action_Response_R_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Action_Response_R_PDU::GetAsString
     // Description: Returns a string representation of the PDU.
@@ -61,6 +61,8 @@ public:
 
     virtual ~Comment_R_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Comment_R_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Comment_R_PDU::GetAsString
     // Description: Returns a string representation of the PDU.
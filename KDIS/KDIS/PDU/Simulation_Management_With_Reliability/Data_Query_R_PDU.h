@@ -59,6 +59,8 @@ public:
 
     virtual ~Data_Query_R_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Data_Query_R_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Data_Query_R_PDU::GetAsString
     // Description: Returns a string representation of the PDU.
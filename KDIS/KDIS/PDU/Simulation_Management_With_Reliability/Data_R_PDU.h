@@ -65,6 +65,8 @@ public:
 
     virtual ~Data_R_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Data_R_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Data_R_PDU::GetAsString
     // Description: Returns a string representation of the PDU.
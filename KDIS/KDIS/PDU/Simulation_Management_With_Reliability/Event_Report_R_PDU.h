@@ -63,6 +63,8 @@ public:
 
     virtual ~Event_Report_R_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Event_Report_R_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Event_Report_R_PDU::GetAsString
     // Description: Returns a string representation of the PDU.
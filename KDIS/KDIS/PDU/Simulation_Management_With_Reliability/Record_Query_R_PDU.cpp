@@ -163,6 +163,18 @@ void Record_Query_R_PDU::SetRecordIDs( const vector<KUINT32> & ID )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Record_Query_R_PDU::SetRecordIDs( vector<KUINT32> && ID )
+{
+    m_vui32RecID.clear();
+    m_vui32RecID = std::move( ID );
+    m_ui32NumRecs = m_vui32RecID.size();
+    m_ui16PDULength = RECORD_QUERY_R_PDU_SIZE + ( m_ui32NumRecs * 4 );
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<KUINT32> & Record_Query_R_PDU::GetRecordIDs() const
 {
     return m_vui32RecID;
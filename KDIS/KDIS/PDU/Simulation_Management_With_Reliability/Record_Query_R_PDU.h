@@ -77,6 +77,8 @@ public:
 
     virtual ~Record_Query_R_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Record_Query_R_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Record_Query_R_PDU::SetRequestID
     //              KDIS::PDU::Record_Query_R_PDU::GetRequestID
@@ -123,6 +125,9 @@ public:
     //************************************
     void AddRecordID( const KUINT32 ID );
     void SetRecordIDs( const std::vector<KUINT32> & ID );
+    #ifdef KDIS_USE_CPP11
+    void SetRecordIDs( std::vector<KUINT32> && ID );
+    #endif
     const std::vector<KUINT32> & GetRecordIDs() const;
 
     //************************************
@@ -68,6 +68,8 @@ public:
 
     virtual ~Record_R_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Record_R_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Record_R_PDU::SetEventType
     //              KDIS::PDU::Record_R_PDU::GetEventType
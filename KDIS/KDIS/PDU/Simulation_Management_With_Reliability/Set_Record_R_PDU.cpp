@@ -157,6 +157,32 @@ void Set_Record_R_PDU::SetRecordSets( const vector<RecordSet> & RS )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Set_Record_R_PDU::SetRecordSets( vector<RecordSet> && RS )
+{
+    // Reset the PDU size.
+    vector<RecordSet>::const_iterator citr = m_vRecs.begin();
+    vector<RecordSet>::const_iterator citrEnd = m_vRecs.end();
+
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui16PDULength -= citr->GetRecordLength();
+    }
+
+    m_vRecs.clear();
+    m_vRecs = std::move( RS );
+    m_ui32NumRecSets = m_vRecs.size();
+
+    // Calculate the new PDU size
+    for( citr = m_vRecs.begin(); citr != m_vRecs.end(); ++citr )
+    {
+        m_ui16PDULength += citr->GetRecordLength();
+    }
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<RecordSet> & Set_Record_R_PDU::GetRecordSets() const
 {
     return m_vRecs;
@@ -80,6 +80,8 @@ public:
 
     virtual ~Set_Record_R_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Set_Record_R_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Set_Record_R_PDU::SetRequestID
     //              KDIS::PDU::Set_Record_R_PDU::GetRequestID
@@ -104,6 +106,9 @@ public:
     //************************************
     void AddRecordSet( const KDIS::DATA_TYPE::RecordSet & RS );
     void SetRecordSets( const std::vector<KDIS::DATA_TYPE::RecordSet> & RS );
+    #ifdef KDIS_USE_CPP11
+    void SetRecordSets( std::vector<KDIS::DATA_TYPE::RecordSet> && RS );
+    #endif
     const std::vector<KDIS::DATA_TYPE::RecordSet> & GetRecordSets() const;
 
     //************************************
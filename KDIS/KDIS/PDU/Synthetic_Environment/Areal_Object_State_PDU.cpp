@@ -243,6 +243,17 @@ void Areal_Object_State_PDU::SetPoints( const vector<WorldCoordinates> & P )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Areal_Object_State_PDU::SetPoints( vector<WorldCoordinates> && P )
+{
+    m_ui16NumPoints = P.size();
+    m_ui16PDULength = ArealObjectAppearance::AREAL_OBJECT_APPEARANCE_SIZE + ( WorldCoordinates::WORLD_COORDINATES_SIZE * m_ui16NumPoints );
+    m_vPoints = std::move( P );
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<WorldCoordinates> & Areal_Object_State_PDU::GetPoints() const
 {
     return m_vPoints;
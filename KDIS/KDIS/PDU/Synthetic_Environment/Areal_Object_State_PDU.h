@@ -97,6 +97,8 @@ public:
 
     virtual ~Areal_Object_State_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Areal_Object_State_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Areal_Object_State_PDU::SetModification
     //              KDIS::PDU::Areal_Object_State_PDU::GetModification
@@ -169,6 +171,9 @@ public:
     //************************************
     void AddPoint( const KDIS::DATA_TYPE::WorldCoordinates & P );
     void SetPoints( const std::vector<KDIS::DATA_TYPE::WorldCoordinates> & P );
+    #ifdef KDIS_USE_CPP11
+    void SetPoints( std::vector<KDIS::DATA_TYPE::WorldCoordinates> && P );
+    #endif
     const std::vector<KDIS::DATA_TYPE::WorldCoordinates> & GetPoints() const;
 
     //************************************
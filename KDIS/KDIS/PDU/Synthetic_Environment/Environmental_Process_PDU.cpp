@@ -264,6 +264,28 @@ void Environmental_Process_PDU::SetEnvironmentRecords( const vector<EnvironmentR
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Environmental_Process_PDU::SetEnvironmentRecords( vector<EnvironmentRecordPtr> && ER )
+{
+    // Reset the PDU length.
+    m_ui16PDULength = ENVIROMENTAL_PROCESS_PDU_SIZE;
+    m_vEnvRecords = std::move( ER );
+    m_ui16NumEnvRec = m_vEnvRecords.size();
+
+    vector<EnvironmentRecordPtr>::const_iterator citr = m_vEnvRecords.begin();
+    vector<EnvironmentRecordPtr>::const_iterator citrEnd = m_vEnvRecords.end();
+
+    // Calculate the new PDU length
+    for( ; citr != citrEnd; ++citr )
+    {
+        // GetLength returns value in bits so convert to bytes and add the header length
+        m_ui16PDULength += EnvironmentRecord::ENVIRONMENT_RECORD_SIZE + ( ( *citr )->GetLength() / 8 );
+    }
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<EnvironmentRecordPtr> & Environmental_Process_PDU::GetEnvironmentRecords() const
 {
     return m_vEnvRecords;
@@ -120,6 +120,8 @@ public:
 
     virtual ~Environmental_Process_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Environmental_Process_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Environmental_Process_PDU::SetEnvironmentalProcessID
     //              KDIS::PDU::Environmental_Process_PDU::GetEnvironmentalProcessID
@@ -242,6 +244,9 @@ public:
     // Parameter:   const EnvironmentRecordLst & ER, void, const EnvironmentRecordPtr & ER
     //************************************
     void SetEnvironmentRecords( const std::vector<KDIS::DATA_TYPE::EnvironmentRecordPtr> & ER );
+    #ifdef KDIS_USE_CPP11
+    void SetEnvironmentRecords( std::vector<KDIS::DATA_TYPE::EnvironmentRecordPtr> && ER );
+    #endif
     const std::vector<KDIS::DATA_TYPE::EnvironmentRecordPtr> & GetEnvironmentRecords() const;
     void AddEnvironmentRecord( KDIS::DATA_TYPE::EnvironmentRecordPtr ER );
     void ClearEnvironmentRecords();
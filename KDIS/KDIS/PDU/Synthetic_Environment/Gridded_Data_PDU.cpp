@@ -336,6 +336,34 @@ void Gridded_Data_PDU::SetGridAxisDescriptors( const std::vector<GridAxisDescrip
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Gridded_Data_PDU::SetGridAxisDescriptors( std::vector<GridAxisDescriptor> && GADS )
+{
+    // calculate length that needs to be removed.
+    vector<GridAxisDescriptor>::const_iterator citr = m_vpGridAxisDesc.begin();
+    vector<GridAxisDescriptor>::const_iterator citrEnd = m_vpGridAxisDesc.end();
+
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui16PDULength -= ( *citr )->GetLength();
+    }
+
+    m_vpGridAxisDesc = std::move( GADS );
+    m_ui8NumAxis = m_vpGridAxisDesc.size();
+
+    // Calculate the new PDU length.
+    citr = m_vpGridAxisDesc.begin();
+    citrEnd = m_vpGridAxisDesc.end();
+
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui16PDULength += ( *citr )->GetLength();
+    }
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const std::vector<GridAxisDescriptor> & Gridded_Data_PDU::GetSetGridAxisDescriptors() const
 {
     return m_vpGridAxisDesc;
@@ -376,6 +404,32 @@ void Gridded_Data_PDU::SetGridData( const std::vector<GridDataPtr> & GD )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Gridded_Data_PDU::SetGridData( std::vector<GridDataPtr> && GD )
+{
+    // Remove the old grid data from the PDU length.
+    std::vector<GridDataPtr>::const_iterator citr = m_vGridData.begin();
+    std::vector<GridDataPtr>::const_iterator citrEnd = m_vGridData.end();
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui16PDULength -= ( *citr )->GetSize();
+    }
+
+    m_vGridData = std::move( GD );
+    m_ui8VecDim = m_vGridData.size();
+
+    // Now recalculate the PDU length.
+    citr = m_vGridData.begin();
+    citrEnd = m_vGridData.end();
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui16PDULength += ( *citr )->GetSize();
+    }
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const std::vector<GridDataPtr> & Gridded_Data_PDU::GetGridData() const
 {
     return m_vGridData;
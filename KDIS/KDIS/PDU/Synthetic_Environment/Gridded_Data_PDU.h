@@ -115,6 +115,8 @@ public:
 
     virtual ~Gridded_Data_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Gridded_Data_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Gridded_Data_PDU::SetEnvironmentalProcessID
     //              KDIS::PDU::Gridded_Data_PDU::GetEnvironmentalProcessID
@@ -252,6 +254,9 @@ public:
     //************************************
     void AddGridAxisDescriptor( const KDIS::DATA_TYPE::GridAxisDescriptor & GAD );
     void SetGridAxisDescriptors( const std::vector<KDIS::DATA_TYPE::GridAxisDescriptor> & GADS );
+    #ifdef KDIS_USE_CPP11
+    void SetGridAxisDescriptors( std::vector<KDIS::DATA_TYPE::GridAxisDescriptor> && GADS );
+    #endif
     const std::vector<KDIS::DATA_TYPE::GridAxisDescriptor> & GetSetGridAxisDescriptors() const;
 
     //************************************
@@ -264,6 +269,9 @@ public:
     //************************************
     void AddGridData( const KDIS::DATA_TYPE::GridDataPtr & GD );
     void SetGridData( const std::vector<KDIS::DATA_TYPE::GridDataPtr> & GD );
+    #ifdef KDIS_USE_CPP11
+    void SetGridData( std::vector<KDIS::DATA_TYPE::GridDataPtr> && GD );
+    #endif
     const std::vector<KDIS::DATA_TYPE::GridDataPtr> & GetGridData() const;
 
     //************************************
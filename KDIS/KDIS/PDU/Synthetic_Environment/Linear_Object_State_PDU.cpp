@@ -191,6 +191,17 @@ void Linear_Object_State_PDU::SetLinearSegmentParameters( const vector<LinearSeg
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Linear_Object_State_PDU::SetLinearSegmentParameters( vector<LinearSegmentParameter> && L )
+{
+    m_ui8NumSegment = L.size();
+    m_ui16PDULength = LINEAR_OBJECT_STATE_PDU_SIZE + ( LinearSegmentParameter::LINEAR_SEGMENT_PARAMETER_SIZE * m_ui8NumSegment );
+    m_vSegments = std::move( L );
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<LinearSegmentParameter> & Linear_Object_State_PDU::GetLinearSegmentParameters() const
 {
     return m_vSegments;
@@ -85,6 +85,8 @@ public:
 
     virtual ~Linear_Object_State_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Linear_Object_State_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Linear_Object_State_PDU::GetNumberOfSegments
     // Description: The number of Linear Segment Parameter records contained within this PDU.
@@ -130,6 +132,9 @@ public:
     //************************************
     void AddLinearSegmentParameter( const KDIS::DATA_TYPE::LinearSegmentParameter & L );
     void SetLinearSegmentParameters( const std::vector<KDIS::DATA_TYPE::LinearSegmentParameter> & L );
+    #ifdef KDIS_USE_CPP11
+    void SetLinearSegmentParameters( std::vector<KDIS::DATA_TYPE::LinearSegmentParameter> && L );
+    #endif
     const std::vector<KDIS::DATA_TYPE::LinearSegmentParameter> & GetLinearSegmentParameters() const;
 
     //************************************
@@ -276,6 +276,17 @@ void Detonation_PDU::SetVariableParameters( const vector<VarPrmPtr> & VP )
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Detonation_PDU::SetVariableParameters( vector<VarPrmPtr> && VP )
+{
+    m_vVariableParameters = std::move( VP );
+    m_ui8NumOfVariableParams = m_vVariableParameters.size();
+    m_ui16PDULength = DETONATION_PDU_SIZE + ( m_ui8NumOfVariableParams * VariableParameter::VARIABLE_PARAMETER_SIZE );
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<VarPrmPtr> & Detonation_PDU::GetVariableParameters() const
 {
     return m_vVariableParameters;
@@ -320,9 +331,15 @@ KString Detonation_PDU::GetAsString() const
 
 //////////////////////////////////////////////////////////////////////////
 
-void Detonation_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= true*/ ) throw( KException )
+ErrorCodes Detonation_PDU::TryDecode( KDataStream & stream, bool ignoreHeader /*= false*/ )
 {
-    if( ( stream.GetBufferSize() + ( ignoreHeader ? Header::HEADER6_PDU_SIZE : 0 ) ) < DETONATION_PDU_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    // Validate the whole PDU once, including the variable parameters, none of the reads below can run out of data.
+    const KUINT16 ui16HeaderOffset = ignoreHeader ? Header::HEADER6_PDU_SIZE : 0;
+    const KUINT32 ui32Available = stream.GetBufferSize() + ui16HeaderOffset;
+    if( ui32Available < DETONATION_PDU_SIZE )return NOT_ENOUGH_DATA_IN_BUFFER;
+
+    const KUINT8 ui8NumVarParams = stream.GetBufferPtr()[stream.GetCurrentWritePosition() + 101 - ui16HeaderOffset];
+    if( ui32Available < ( KUINT32 )( DETONATION_PDU_SIZE + ui8NumVarParams * VariableParameter::VARIABLE_PARAMETER_SIZE ) )return NOT_ENOUGH_DATA_IN_BUFFER;
 
     m_vVariableParameters.clear();
 
@@ -386,6 +403,9 @@ void Detonation_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= true*/
 
     for( KUINT8 i = 0; i < m_ui8NumOfVariableParams; ++i )
     {
+        // A custom decoder may have read more than a record.
+        if( stream.GetBufferSize() < ( m_ui8NumOfVariableParams - i ) * VariableParameter::VARIABLE_PARAMETER_SIZE )return NOT_ENOUGH_DATA_IN_BUFFER;
+
         // Save the current write position so we can peek.
         KUINT16 pos = stream.GetCurrentWritePosition();
         KUINT8 paramTyp;
@@ -394,8 +414,16 @@ void Detonation_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= true*/
         stream >> paramTyp;
         stream.SetCurrentWritePosition( pos );
 
-        // Use the factory decoder.
-        VariableParameter * p = VariableParameter::FactoryDecode( paramTyp, stream );
+        // Use the factory decoder, the only part that may throw.
+        VariableParameter * p = 0;
+        try
+        {
+            p = VariableParameter::FactoryDecode( paramTyp, stream );
+        }
+        catch( const KException & Ex )
+        {
+            return static_cast<ErrorCodes>( Ex.m_ui16ErrorCode );
+        }
 
         // Did we find a custom decoder? if not then use the default.
         if( p )
@@ -421,6 +449,16 @@ void Detonation_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= true*/
             }
         }
     }
+
+    return NO_ERRORS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Detonation_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= false*/ ) throw( KException )
+{
+    const ErrorCodes e = Detonation_PDU::TryDecode( stream, ignoreHeader );
+    if( e != NO_ERRORS )throw KException( __FUNCTION__, e );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -90,6 +90,8 @@ public:
 
     virtual ~Detonation_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Detonation_PDU )
+
     #if DIS_VERSION > 6
     //************************************
     // FullName:    KDIS::PDU::Detonation_PDU::SetPDUStatusDetonationType
@@ -177,6 +179,9 @@ public:
     //************************************
     void AddVariableParameter( KDIS::DATA_TYPE::VarPrmPtr VP );
     void SetVariableParameters( const std::vector<KDIS::DATA_TYPE::VarPrmPtr> & VP );
+    #ifdef KDIS_USE_CPP11
+    void SetVariableParameters( std::vector<KDIS::DATA_TYPE::VarPrmPtr> && VP );
+    #endif
     const std::vector<KDIS::DATA_TYPE::VarPrmPtr> & GetVariableParameters() const;
     void ClearVariableParameters();
 
@@ -188,11 +193,15 @@ public:
 
     //************************************
     // FullName:    KDIS::PDU::Detonation_PDU::Decode
+    //              KDIS::PDU::Detonation_PDU::TryDecode
     // Description: Convert From Network Data.
+    //              The stream is checked once for the whole PDU and the fields are then read
+    //              without further checks, TryDecode returns an error code instead of throwing.
     // Parameter:   KDataStream & stream
     // Parameter:   bool ignoreHeader = false - Decode the header from the stream?
     //************************************
     virtual void Decode( KDataStream & stream, bool ignoreHeader = false ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream, bool ignoreHeader = false );
 
     //************************************
     // FullName:    KDIS::PDU::Detonation_PDU::Encode
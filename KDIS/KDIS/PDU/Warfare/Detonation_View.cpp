@@ -0,0 +1,135 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./Detonation_View.h"
+#include "./../../DataTypes/VariableParameterList.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace KDIS;
+using namespace PDU;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+Detonation_View::Detonation_View( const KOCTET * Data, KUINT16 Size ) throw( KException ) :
+    Warfare_View( Data, Size )
+{
+    checkPDU( Detonation_PDU_Type, DETONATION_VIEW_SIZE );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Detonation_View::Detonation_View( const KDataStream & stream ) throw( KException ) :
+    Warfare_View( stream )
+{
+    checkPDU( Detonation_PDU_Type, DETONATION_VIEW_SIZE );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Detonation_View::~Detonation_View()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Vector Detonation_View::GetVelocity() const
+{
+    return getVector( 36 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+WorldCoordinates Detonation_View::GetLocationInWorldCoords() const
+{
+    return getWorldCoordinates( 48 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Vector Detonation_View::GetLocationInEntityCoords() const
+{
+    return getVector( 88 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+DetonationResult Detonation_View::GetDetonationResult() const
+{
+    return ( DetonationResult )m_pData[100];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT8 Detonation_View::GetNumberOfVariableParams() const
+{
+    return m_pData[101];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+EntityType Detonation_View::GetDescriptorType() const
+{
+    return getEntityType( 72 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+MunitionDescriptor Detonation_View::GetMunitionDescriptor() const
+{
+    return getMunitionDescriptor( 72 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+VariableParameterType Detonation_View::GetVariableParameterType( KUINT16 Index ) const throw( KException )
+{
+    return ( VariableParameterType )getRecord( DETONATION_VIEW_SIZE, VariableParameter::VARIABLE_PARAMETER_SIZE, GetNumberOfVariableParams(), Index )[0];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL Detonation_View::GetArticulatedPart( KUINT16 Index, ArticulatedPart & AP ) const throw( KException )
+{
+    return VariableParameterList::DecodeArticulatedPart( getRecord( DETONATION_VIEW_SIZE, VariableParameter::VARIABLE_PARAMETER_SIZE, GetNumberOfVariableParams(), Index ), AP );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KBOOL Detonation_View::GetAttachedPart( KUINT16 Index, AttachedPart & AP ) const throw( KException )
+{
+    return VariableParameterList::DecodeAttachedPart( getRecord( DETONATION_VIEW_SIZE, VariableParameter::VARIABLE_PARAMETER_SIZE, GetNumberOfVariableParams(), Index ), AP );
+}
+
+//////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,109 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      Detonation_View
+    created:    18/10/2026
+
+    purpose:    Read only view of an encoded Detonation_PDU.
+                The variable parameters are only decoded when requested by index.
+                See PDU_View.
+
+    size:       832 bits / 104 octets - Min size
+*********************************************************************/
+
+#pragma once
+
+#include "./Warfare_View.h"
+#include "./../../DataTypes/ArticulatedPart.h"
+#include "./../../DataTypes/AttachedPart.h"
+
+namespace KDIS {
+namespace PDU {
+
+class KDIS_EXPORT Detonation_View : public Warfare_View
+{
+public:
+
+    static const KUINT16 DETONATION_VIEW_SIZE = 104;
+
+    //************************************
+    // FullName:    KDIS::PDU::Detonation_View::Detonation_View
+    // Description: Throws WRONG_PDU_TYPE_IN_HEADER if the buffer does not hold a
+    //              Detonation PDU or NOT_ENOUGH_DATA_IN_BUFFER if it is too small.
+    // Parameter:   const KOCTET * Data
+    // Parameter:   KUINT16 Size
+    //************************************
+    Detonation_View( const KOCTET * Data, KUINT16 Size ) throw( KException );
+
+    Detonation_View( const KDataStream & stream ) throw( KException );
+
+    virtual ~Detonation_View();
+
+    //************************************
+    // FullName:    KDIS::PDU::Detonation_View::GetVelocity
+    //              KDIS::PDU::Detonation_View::GetLocationInWorldCoords
+    //              KDIS::PDU::Detonation_View::GetLocationInEntityCoords
+    //              KDIS::PDU::Detonation_View::GetDetonationResult
+    //              KDIS::PDU::Detonation_View::GetNumberOfVariableParams
+    // Description: See Detonation_PDU.
+    //************************************
+    KDIS::DATA_TYPE::Vector GetVelocity() const;
+    KDIS::DATA_TYPE::WorldCoordinates GetLocationInWorldCoords() const;
+    KDIS::DATA_TYPE::Vector GetLocationInEntityCoords() const;
+    KDIS::DATA_TYPE::ENUMS::DetonationResult GetDetonationResult() const;
+    KUINT8 GetNumberOfVariableParams() const;
+
+    //************************************
+    // FullName:    KDIS::PDU::Detonation_View::GetDescriptorType
+    //              KDIS::PDU::Detonation_View::GetMunitionDescriptor
+    // Description: The entity type is common to all descriptors, the munition
+    //              descriptor is only valid when the detonation type is munition.
+    //************************************
+    KDIS::DATA_TYPE::EntityType GetDescriptorType() const;
+    KDIS::DATA_TYPE::MunitionDescriptor GetMunitionDescriptor() const;
+
+    //************************************
+    // FullName:    KDIS::PDU::Detonation_View::GetVariableParameterType
+    //              KDIS::PDU::Detonation_View::GetArticulatedPart
+    //              KDIS::PDU::Detonation_View::GetAttachedPart
+    // Description: Decodes a variable parameter record. The part versions return false
+    //              if the record is of a different type.
+    //              Throws OUT_OF_BOUNDS if Index is invalid or NOT_ENOUGH_DATA_IN_BUFFER
+    //              if the record is missing from the buffer.
+    // Parameter:   KUINT16 Index
+    // Parameter:   ArticulatedPart & AP, AttachedPart & AP
+    //************************************
+    KDIS::DATA_TYPE::ENUMS::VariableParameterType GetVariableParameterType( KUINT16 Index ) const throw( KException );
+    KBOOL GetArticulatedPart( KUINT16 Index, KDIS::DATA_TYPE::ArticulatedPart & AP ) const throw( KException );
+    KBOOL GetAttachedPart( KUINT16 Index, KDIS::DATA_TYPE::AttachedPart & AP ) const throw( KException );
+};
+
+} // END namespace PDU
+} // END namespace KDIS
@@ -382,6 +382,25 @@ void Directed_Energy_Fire_PDU::SetDirectedEnergyRecords( const vector<StdVarPtr>
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Directed_Energy_Fire_PDU::SetDirectedEnergyRecords( vector<StdVarPtr> && DE )
+{
+    m_vDeRec = std::move( DE );
+    m_ui16NumDERecs = m_vDeRec.size();
+    m_ui16PDULength = DIRECTED_ENERGY_PDU_SIZE;
+
+    // Calculate new pdu length
+    vector<StdVarPtr>::const_iterator citr = m_vDeRec.begin();
+    vector<StdVarPtr>::const_iterator citrEnd = m_vDeRec.end();
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui16PDULength += ( *citr )->GetRecordLength();
+    }
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<StdVarPtr> & Directed_Energy_Fire_PDU::GetDirectedEnergyRecords() const
 {
     return m_vDeRec;
@@ -123,6 +123,8 @@ public:
 
     virtual ~Directed_Energy_Fire_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Directed_Energy_Fire_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Directed_Energy_Fire_PDU::SetFiringEntityID
     //              KDIS::PDU::Directed_Energy_Fire_PDU::GetFiringEntityID
@@ -274,6 +276,9 @@ public:
     //************************************
     void AddDirectedEnergyRecord( KDIS::DATA_TYPE::StdVarPtr DE );
     void SetDirectedEnergyRecords( const std::vector<KDIS::DATA_TYPE::StdVarPtr> & DE );
+    #ifdef KDIS_USE_CPP11
+    void SetDirectedEnergyRecords( std::vector<KDIS::DATA_TYPE::StdVarPtr> && DE );
+    #endif
     const std::vector<KDIS::DATA_TYPE::StdVarPtr> & GetDirectedEnergyRecords() const;
     void ClearDirectedEnergyRecords();
 
@@ -141,6 +141,25 @@ void Entity_Damage_Status_PDU::SetDamageDescriptionRecords( const vector<StdVarP
 
 //////////////////////////////////////////////////////////////////////////
 
+#ifdef KDIS_USE_CPP11
+void Entity_Damage_Status_PDU::SetDamageDescriptionRecords( vector<StdVarPtr> && DD )
+{
+    m_vDdRec = std::move( DD );
+    m_ui16NumDmgDescRecs = m_vDdRec.size();
+    m_ui16PDULength = ENTITY_DAMAGE_STATE_PDU;
+
+    // Calculate new pdu length
+    vector<StdVarPtr>::const_iterator citr = m_vDdRec.begin();
+    vector<StdVarPtr>::const_iterator citrEnd = m_vDdRec.end();
+    for( ; citr != citrEnd; ++citr )
+    {
+        m_ui16PDULength += ( *citr )->GetRecordLength();
+    }
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
 const vector<StdVarPtr> & Entity_Damage_Status_PDU::GetDamageDescriptionRecords() const
 {
     return m_vDdRec;
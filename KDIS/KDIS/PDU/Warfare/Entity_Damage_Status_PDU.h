@@ -80,6 +80,8 @@ public:
 
     virtual ~Entity_Damage_Status_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Entity_Damage_Status_PDU )
+
     //************************************
     // FullName:    KDIS::PDU::Entity_Damage_Status_PDU::SetDamagedEntityID
     //              KDIS::PDU::Entity_Damage_Status_PDU::GetDamagedEntityID
@@ -107,6 +109,9 @@ public:
     //************************************
     void AddDamageDescriptionRecord( KDIS::DATA_TYPE::StdVarPtr DD );
     void SetDamageDescriptionRecords( const std::vector<KDIS::DATA_TYPE::StdVarPtr> & DD );
+    #ifdef KDIS_USE_CPP11
+    void SetDamageDescriptionRecords( std::vector<KDIS::DATA_TYPE::StdVarPtr> && DD );
+    #endif
     const std::vector<KDIS::DATA_TYPE::StdVarPtr> & GetDamageDescriptionRecords() const;
     void ClearDamageDescriptionRecords();
 
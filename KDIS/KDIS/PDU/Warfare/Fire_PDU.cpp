@@ -243,9 +243,10 @@ KString Fire_PDU::GetAsString() const
 
 //////////////////////////////////////////////////////////////////////////
 
-void Fire_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= true*/ ) throw( KException )
+ErrorCodes Fire_PDU::TryDecode( KDataStream & stream, bool ignoreHeader /*= false*/ )
 {
-    if( ( stream.GetBufferSize() + ( ignoreHeader ? Header::HEADER6_PDU_SIZE : 0 ) ) < FIRE_PDU_SIZE )throw KException( __FUNCTION__, NOT_ENOUGH_DATA_IN_BUFFER );
+    // Validate the whole PDU once, none of the reads below can run out of data.
+    if( ( stream.GetBufferSize() + ( ignoreHeader ? Header::HEADER6_PDU_SIZE : 0 ) ) < FIRE_PDU_SIZE )return NOT_ENOUGH_DATA_IN_BUFFER;
 
     Warfare_Header::Decode( stream, ignoreHeader );
 
@@ -294,6 +295,16 @@ void Fire_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= true*/ ) thro
 
     stream >> KDIS_STREAM m_Velocity
            >> m_f32Range;
+
+    return NO_ERRORS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void Fire_PDU::Decode( KDataStream & stream, bool ignoreHeader /*= false*/ ) throw( KException )
+{
+    const ErrorCodes e = Fire_PDU::TryDecode( stream, ignoreHeader );
+    if( e != NO_ERRORS )throw KException( __FUNCTION__, e );
 }
 
 //////////////////////////////////////////////////////////////////////////
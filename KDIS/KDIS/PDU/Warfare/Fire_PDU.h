@@ -81,6 +81,8 @@ public:
 
     virtual ~Fire_PDU();
 
+    KDIS_DEFAULT_COPY_AND_MOVE( Fire_PDU )
+
     #if DIS_VERSION > 6
     //************************************
     // FullName:    KDIS::PDU::Fire_PDU::SetPDUStatusFireType
@@ -158,11 +160,15 @@ public:
 
     //************************************
     // FullName:    KDIS::PDU::Fire_PDU::Decode
+    //              KDIS::PDU::Fire_PDU::TryDecode
     // Description: Convert From Network Data.
+    //              The stream is checked once for the whole PDU and the fields are then read
+    //              without further checks, TryDecode returns an error code instead of throwing.
     // Parameter:   KDataStream & stream
     // Parameter:   bool ignoreHeader = false - Decode the header from the stream?
     //************************************
     virtual void Decode( KDataStream & stream, bool ignoreHeader = false ) throw( KException );
+    virtual KDIS::ErrorCodes TryDecode( KDataStream & stream, bool ignoreHeader = false );
 
     //************************************
     // FullName:    KDIS::PDU::Fire_PDU::Encode
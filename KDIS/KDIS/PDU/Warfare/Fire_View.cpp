@@ -0,0 +1,106 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./Fire_View.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace KDIS;
+using namespace PDU;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+Fire_View::Fire_View( const KOCTET * Data, KUINT16 Size ) throw( KException ) :
+    Warfare_View( Data, Size )
+{
+    checkPDU( Fire_PDU_Type, FIRE_VIEW_SIZE );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Fire_View::Fire_View( const KDataStream & stream ) throw( KException ) :
+    Warfare_View( stream )
+{
+    checkPDU( Fire_PDU_Type, FIRE_VIEW_SIZE );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Fire_View::~Fire_View()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KUINT32 Fire_View::GetFireMissionIndex() const
+{
+    return get<KUINT32>( 36 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+WorldCoordinates Fire_View::GetLocation() const
+{
+    return getWorldCoordinates( 40 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Vector Fire_View::GetVelocity() const
+{
+    return getVector( 80 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+KFLOAT32 Fire_View::GetRange() const
+{
+    return get<KFLOAT32>( 92 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+EntityType Fire_View::GetDescriptorType() const
+{
+    return getEntityType( 64 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+MunitionDescriptor Fire_View::GetMunitionDescriptor() const
+{
+    return getMunitionDescriptor( 64 );
+}
+
+//////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,89 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      Fire_View
+    created:    18/10/2026
+
+    purpose:    Read only view of an encoded Fire_PDU.
+                See PDU_View.
+
+    size:       768 bits / 96 octets
+*********************************************************************/
+
+#pragma once
+
+#include "./Warfare_View.h"
+
+namespace KDIS {
+namespace PDU {
+
+class KDIS_EXPORT Fire_View : public Warfare_View
+{
+public:
+
+    static const KUINT16 FIRE_VIEW_SIZE = 96;
+
+    //************************************
+    // FullName:    KDIS::PDU::Fire_View::Fire_View
+    // Description: Throws WRONG_PDU_TYPE_IN_HEADER if the buffer does not hold a
+    //              Fire PDU or NOT_ENOUGH_DATA_IN_BUFFER if it is too small.
+    // Parameter:   const KOCTET * Data
+    // Parameter:   KUINT16 Size
+    //************************************
+    Fire_View( const KOCTET * Data, KUINT16 Size ) throw( KException );
+
+    Fire_View( const KDataStream & stream ) throw( KException );
+
+    virtual ~Fire_View();
+
+    //************************************
+    // FullName:    KDIS::PDU::Fire_View::GetFireMissionIndex
+    //              KDIS::PDU::Fire_View::GetLocation
+    //              KDIS::PDU::Fire_View::GetVelocity
+    //              KDIS::PDU::Fire_View::GetRange
+    // Description: See Fire_PDU.
+    //************************************
+    KUINT32 GetFireMissionIndex() const;
+    KDIS::DATA_TYPE::WorldCoordinates GetLocation() const;
+    KDIS::DATA_TYPE::Vector GetVelocity() const;
+    KFLOAT32 GetRange() const;
+
+    //************************************
+    // FullName:    KDIS::PDU::Fire_View::GetDescriptorType
+    //              KDIS::PDU::Fire_View::GetMunitionDescriptor
+    // Description: The entity type is common to all descriptors, the munition
+    //              descriptor is only valid when the fire type is munition.
+    //************************************
+    KDIS::DATA_TYPE::EntityType GetDescriptorType() const;
+    KDIS::DATA_TYPE::MunitionDescriptor GetMunitionDescriptor() const;
+};
+
+} // END namespace PDU
+} // END namespace KDIS
@@ -0,0 +1,100 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+#include "./Warfare_View.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace KDIS;
+using namespace PDU;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+
+//////////////////////////////////////////////////////////////////////////
+// protected:
+//////////////////////////////////////////////////////////////////////////
+
+MunitionDescriptor Warfare_View::getMunitionDescriptor( KUINT16 Offset ) const
+{
+    return MunitionDescriptor( getEntityType( Offset ), ( WarheadType )get<KUINT16>( Offset + 8 ),
+                               ( FuseType )get<KUINT16>( Offset + 10 ), get<KUINT16>( Offset + 12 ), get<KUINT16>( Offset + 14 ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// public:
+//////////////////////////////////////////////////////////////////////////
+
+Warfare_View::Warfare_View( const KOCTET * Data, KUINT16 Size ) throw( KException ) :
+    PDU_View( Data, Size )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Warfare_View::Warfare_View( const KDataStream & stream ) throw( KException ) :
+    PDU_View( stream )
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Warfare_View::~Warfare_View()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+EntityIdentifier Warfare_View::GetFiringEntityID() const
+{
+    return getEntityIdentifier( 12 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+EntityIdentifier Warfare_View::GetTargetEntityID() const
+{
+    return getEntityIdentifier( 18 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+EntityIdentifier Warfare_View::GetMunitionID() const
+{
+    return getEntityIdentifier( 24 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+EntityIdentifier Warfare_View::GetEventID() const
+{
+    return getEntityIdentifier( 30 );
+}
+
+//////////////////////////////////////////////////////////////////////////
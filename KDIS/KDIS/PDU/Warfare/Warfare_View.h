@@ -0,0 +1,83 @@
+/*********************************************************************
+Copyright 2013 Karl Jones
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+For Further Information Please Contact me at
+Karljj1@yahoo.com
+http://p.sf.net/kdis/UserGuide
+*********************************************************************/
+
+/********************************************************************
+    class:      Warfare_View
+    created:    18/10/2026
+
+    purpose:    Read only view of the Warfare PDU family header.
+                See PDU_View.
+
+    size:       288 bits / 36 octets
+*********************************************************************/
+
+#pragma once
+
+#include "./../PDU_View.h"
+#include "./../../DataTypes/MunitionDescriptor.h"
+
+namespace KDIS {
+namespace PDU {
+
+class KDIS_EXPORT Warfare_View : public PDU_View
+{
+protected:
+
+    //************************************
+    // FullName:    KDIS::PDU::Warfare_View::getMunitionDescriptor
+    // Description: Builds a munition descriptor from the 16 octets at Offset.
+    // Parameter:   KUINT16 Offset
+    //************************************
+    KDIS::DATA_TYPE::MunitionDescriptor getMunitionDescriptor( KUINT16 Offset ) const;
+
+public:
+
+    static const KUINT16 WARFARE_VIEW_HEADER_SIZE = 36;
+
+    Warfare_View( const KOCTET * Data, KUINT16 Size ) throw( KException );
+
+    Warfare_View( const KDataStream & stream ) throw( KException );
+
+    virtual ~Warfare_View();
+
+    //************************************
+    // FullName:    KDIS::PDU::Warfare_View::GetFiringEntityID
+    //              KDIS::PDU::Warfare_View::GetTargetEntityID
+    //              KDIS::PDU::Warfare_View::GetMunitionID
+    //              KDIS::PDU::Warfare_View::GetEventID
+    // Description: See Warfare_Header.
+    //************************************
+    KDIS::DATA_TYPE::EntityIdentifier GetFiringEntityID() const;
+    KDIS::DATA_TYPE::EntityIdentifier GetTargetEntityID() const;
+    KDIS::DATA_TYPE::EntityIdentifier GetMunitionID() const;
+    KDIS::DATA_TYPE::EntityIdentifier GetEventID() const;
+};
+
+} // END namespace PDU
+} // END namespace KDIS
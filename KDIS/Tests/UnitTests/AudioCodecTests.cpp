@@ -0,0 +1,78 @@
+#include <cstring>
+#include <limits>
+#include "gtest/gtest.h"
+
+#include "KDIS/Extras/AudioCodec.h"
+#include "KDIS/DataTypes/Enums/EnumRadio.h"
+
+using namespace KDIS;
+using namespace UTILS;
+using namespace DATA_TYPE::ENUMS;
+
+TEST(AudioCodecTests, ConvertsEachEncoding)
+{
+    // Odd counts cover both the vector and scalar paths.
+    const KUINT32 N = 37;
+
+    // Mu-law, every code survives a round trip except negative zero.
+    KOCTET mulaw[256];
+    KINT16 pcm[256];
+    for (int i = 0; i < 256; ++i) mulaw[i] = (KOCTET)i;
+    AudioCodec::DecodeMuLaw(mulaw, pcm, 256);
+    EXPECT_EQ(-32124, pcm[0x00]);
+    EXPECT_EQ(32124, pcm[0x80]);
+    EXPECT_EQ(0, pcm[0xFF]);
+    KOCTET encoded[256];
+    AudioCodec::EncodeMuLaw(pcm, encoded, 256);
+    for (int i = 0; i < 256; ++i)
+    {
+        if (i != 0x7F) EXPECT_EQ(mulaw[i], encoded[i]);
+    }
+
+    // 16 bit linear in both byte orders.
+    KOCTET wire[N * 2];
+    for (KUINT32 i = 0; i < N; ++i) { wire[i * 2] = 0x12; wire[i * 2 + 1] = (KOCTET)i; }
+    AudioCodec::DecodePCM16(wire, pcm, N, true);
+    EXPECT_EQ(0x1200, pcm[0]);
+    EXPECT_EQ(0x1224, pcm[N - 1]);
+    KOCTET back[N * 2];
+    AudioCodec::EncodePCM16(pcm, back, N, true);
+    EXPECT_EQ(0, memcmp(wire, back, sizeof(wire)));
+    EXPECT_TRUE(AudioCodec::Decode(_16_bit_linear_PCM2sComplementLittleEndian, wire, N, pcm));
+    EXPECT_EQ(0x2412, pcm[N - 1]);
+
+    // 8 bit linear is unsigned.
+    KOCTET pcm8[N];
+    for (KUINT32 i = 0; i < N; ++i) pcm8[i] = (KOCTET)(i * 7);
+    pcm8[0] = (KOCTET)0x80;
+    AudioCodec::DecodePCM8(pcm8, pcm, N);
+    EXPECT_EQ(0, pcm[0]);
+    EXPECT_EQ((7 - 128) * 256, pcm[1]);
+    AudioCodec::EncodePCM8(pcm, back, N);
+    EXPECT_EQ(0, memcmp(pcm8, back, N));
+
+    // Float, clipped to -1 to 1.
+    KFLOAT32 f[N];
+    for (KUINT32 i = 0; i < N; ++i) f[i] = 0.25f;
+    f[0] = 2.0f;
+    f[N - 1] = -2.0f;
+    f[9] = -1.0f;
+    // NaN is silence in both the vector and scalar paths.
+    f[2] = std::numeric_limits<KFLOAT32>::quiet_NaN();
+    f[N - 2] = std::numeric_limits<KFLOAT32>::quiet_NaN();
+    AudioCodec::FloatToPCM16(f, pcm, N);
+    EXPECT_EQ(0, pcm[2]);
+    EXPECT_EQ(0, pcm[N - 2]);
+    EXPECT_EQ(32767, pcm[0]);
+    EXPECT_EQ(8192, pcm[1]);
+    EXPECT_EQ(-32768, pcm[9]);
+    EXPECT_EQ(-32768, pcm[N - 1]);
+    AudioCodec::PCM16ToFloat(pcm, f, N);
+    EXPECT_EQ(0.25f, f[1]);
+    EXPECT_EQ(-1.0f, f[N - 1]);
+
+    EXPECT_TRUE(AudioCodec::Decode(_8_bit_mu_law, mulaw, N, f));
+    EXPECT_EQ(-32124 / 32768.0f, f[0]);
+    EXPECT_FALSE(AudioCodec::Decode(CVSD_per_MIL_STD_188_113, mulaw, N, pcm));
+    EXPECT_EQ(0, AudioCodec::GetSampleSize(GSM_FullRate));
+}
@@ -0,0 +1,80 @@
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "KDIS/Extras/AudioJitterBuffer.h"
+#include "KDIS/DataTypes/Enums/EnumRadio.h"
+
+using namespace KDIS;
+using namespace UTILS;
+using namespace DATA_TYPE::ENUMS;
+
+namespace
+{
+    // Raw absolute DIS time stamp for a time past the hour in milliseconds.
+    KUINT32 AudioTimeStamp(KFLOAT64 MS)
+    {
+        return ((KUINT32)(MS / 3600000.0 * 2147483648.0 + 0.5) << 1) | 1;
+    }
+}
+
+TEST(AudioJitterBufferTests, ReordersAndFillsGaps)
+{
+    // 20ms blocks of 8kHz mu-law, the play delay is one block.
+    AudioJitterBuffer buffer(1024, 160, 160);
+    KOCTET block[160];
+    KOCTET frame[160];
+
+    // Block 1 is late, 2 and 4 jitter and 3 is lost.
+    const KFLOAT64 times[] = { 0, 43, 20, 78 };
+    const KOCTET values[] = { 1, 3, 2, 5 };
+    for (int i = 0; i < 4; ++i)
+    {
+        memset(block, values[i], sizeof(block));
+        EXPECT_TRUE(buffer.Write(AudioTimeStamp(times[i]), _8_bit_mu_law, 8000, block, 160));
+        EXPECT_EQ(i > 0, buffer.IsFrameReady());
+    }
+    EXPECT_EQ(800u, buffer.GetBuffered());
+
+    const KOCTET expected[] = { 1, 2, 3, (KOCTET)0xFF, 5 };
+    for (int i = 0; i < 5; ++i)
+    {
+        ASSERT_TRUE(buffer.ReadFrame(frame));
+        EXPECT_EQ(expected[i], frame[0]);
+        EXPECT_EQ(expected[i], frame[159]);
+    }
+    EXPECT_FALSE(buffer.ReadFrame(frame));
+    EXPECT_EQ(1u, buffer.GetUnderrunCount());
+
+    // Already played.
+    memset(block, 2, sizeof(block));
+    EXPECT_FALSE(buffer.Write(AudioTimeStamp(20), _8_bit_mu_law, 8000, block, 160));
+    EXPECT_EQ(1u, buffer.GetLateCount());
+
+    // A new talk spurt restarts the stream.
+    EXPECT_TRUE(buffer.Write(AudioTimeStamp(2000), _8_bit_mu_law, 8000, block, 160));
+    EXPECT_EQ(1u, buffer.GetResyncCount());
+    EXPECT_EQ(160u, buffer.GetBuffered());
+
+    EXPECT_FALSE(buffer.Write(AudioTimeStamp(2020), CVSD_per_MIL_STD_188_113, 8000, block, 160));
+    EXPECT_EQ(1u, buffer.GetUnsupportedCount());
+    EXPECT_EQ(5u, buffer.GetBlockCount());
+}
+
+TEST(AudioJitterBufferTests, BlockLargerThanRingIsRejected)
+{
+    AudioJitterBuffer buffer(1024, 160, 160);
+    std::vector<KOCTET> block(4096, 1);
+
+    EXPECT_FALSE(buffer.Write(AudioTimeStamp(0), _8_bit_mu_law, 8000, &block[0], 1025));
+    EXPECT_EQ(1u, buffer.GetUnsupportedCount());
+    EXPECT_EQ(0u, buffer.GetBlockCount());
+    EXPECT_EQ(0u, buffer.GetBuffered());
+
+    // The stream is not disturbed and a block that fills the ring is still stored.
+    EXPECT_TRUE(buffer.Write(AudioTimeStamp(0), _8_bit_mu_law, 8000, &block[0], 1024));
+    EXPECT_FALSE(buffer.Write(AudioTimeStamp(20), _16_bit_linear_PCM2sComplementBigEndian, 8000, &block[0], 1024 + 1));
+    EXPECT_EQ(2u, buffer.GetUnsupportedCount());
+    EXPECT_EQ(1024u, buffer.GetBuffered());
+    EXPECT_EQ(_8_bit_mu_law, buffer.GetEncodingType());
+}
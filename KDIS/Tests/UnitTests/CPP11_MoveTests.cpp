@@ -0,0 +1,149 @@
+#include <utility>
+#include <vector>
+#include "gtest/gtest.h"
+
+#ifdef KDIS_USE_CPP11
+
+#include <memory>
+#include <type_traits>
+
+#include "KDIS/Extras/PDU_Factory.h"
+#include "KDIS/PDU/Logistics/Resupply_Received_PDU.h"
+#include "KDIS/PDU/Simulation_Management/Data_Query_PDU.h"
+
+#if DIS_VERSION > 5
+#include "KDIS/PDU/Entity_Management/Transfer_Control_Request_PDU.h"
+#include "KDIS/PDU/Minefield/Minefield_State_PDU.h"
+#endif
+
+using namespace KDIS;
+using namespace DATA_TYPE;
+using namespace PDU;
+using namespace UTILS;
+
+namespace
+{
+    // Move constructs and move assigns a PDU, the moved to copies must match the original
+    // and the containers of the source are handed over rather than copied.
+    template<class PduType, class List>
+    void ExpectMoves(const PduType & pduIn, const List & (PduType::*GetList)() const)
+    {
+        const size_t count = (pduIn.*GetList)().size();
+        ASSERT_GT(count, 0u);
+
+        PduType pduSource(pduIn);
+        PduType pduMoved(std::move(pduSource));
+        EXPECT_EQ(pduIn, pduMoved);
+        EXPECT_TRUE((pduSource.*GetList)().empty());
+
+        PduType pduAssigned;
+        pduAssigned = std::move(pduMoved);
+        EXPECT_EQ(pduIn, pduAssigned);
+        EXPECT_TRUE((pduMoved.*GetList)().empty());
+
+        KDataStream stream = pduAssigned.Encode();
+        PduType pduOut(stream);
+        EXPECT_EQ(pduIn, pduOut);
+        EXPECT_EQ(count, (pduOut.*GetList)().size());
+        EXPECT_EQ(0, stream.GetBufferSize());
+    }
+
+    // Decodes a PDU through the factory and hands the PduUniquePtr on by moving it.
+    template<class PduType>
+    void ExpectFactoryOwnershipMoves(const PduType & pduIn)
+    {
+        KDataStream stream = pduIn.Encode();
+        PDU_Factory factory;
+        PduUniquePtr pduDecoded = factory.Decode(stream);
+        ASSERT_TRUE(pduDecoded.get() != 0);
+
+        std::vector<PduUniquePtr> vQueue;
+        vQueue.push_back(std::move(pduDecoded));
+        EXPECT_TRUE(pduDecoded.get() == 0);
+
+        PduUniquePtr pduOut = std::move(vQueue.front());
+        EXPECT_TRUE(vQueue.front().get() == 0);
+        ASSERT_TRUE(dynamic_cast<PduType *>(pduOut.get()) != 0);
+        EXPECT_EQ(pduIn, *static_cast<PduType *>(pduOut.get()));
+    }
+
+    Data_Query_PDU MakeDataQuery()
+    {
+        Data_Query_PDU pdu;
+        std::vector<KUINT32> vFixed(4, 7), vVariable(2, 9);
+        pdu.SetFixedDatum(std::move(vFixed));
+        pdu.SetVariableDatum(std::move(vVariable));
+        return pdu;
+    }
+
+    Resupply_Received_PDU MakeResupplyReceived()
+    {
+        Resupply_Received_PDU pdu;
+        std::vector<Supplies> vSupplies(3, Supplies(EntityType(), 1.5f));
+        pdu.SetSupplies(std::move(vSupplies));
+        return pdu;
+    }
+
+#if DIS_VERSION > 5
+    Transfer_Control_Request_PDU MakeTransferControlRequest()
+    {
+        Transfer_Control_Request_PDU pdu;
+        std::vector<RecordSet> vRecordSets(2);
+        pdu.SetRecordSets(std::move(vRecordSets));
+        return pdu;
+    }
+#endif
+}
+
+TEST(CPP11_MoveTests, PduUniquePtr_IsMoveOnly)
+{
+    EXPECT_TRUE((std::is_same<std::unique_ptr<Header>, PduUniquePtr>::value));
+    EXPECT_FALSE(std::is_copy_constructible<PduUniquePtr>::value);
+    EXPECT_TRUE(std::is_move_constructible<PduUniquePtr>::value);
+}
+
+TEST(CPP11_MoveTests, RvalueSetterTakesTheContainer)
+{
+    std::vector<KUINT32> vFixed(4, 7);
+    Data_Query_PDU pdu;
+    pdu.SetFixedDatum(std::move(vFixed));
+    EXPECT_TRUE(vFixed.empty());
+    EXPECT_EQ(4u, pdu.GetNumberFIxedDatum());
+    EXPECT_EQ(4u, pdu.GetFixedDatum().size());
+}
+
+TEST(CPP11_MoveTests, Data_Query_PDU_Moves)
+{
+    ExpectMoves(MakeDataQuery(), &Data_Query_PDU::GetFixedDatum);
+}
+
+TEST(CPP11_MoveTests, Resupply_Received_PDU_Moves)
+{
+    ExpectMoves(MakeResupplyReceived(), &Resupply_Received_PDU::GetSupplies);
+}
+
+#if DIS_VERSION > 5
+TEST(CPP11_MoveTests, Minefield_State_PDU_Moves)
+{
+    Minefield_State_PDU pdu;
+    std::vector<EntityType> vMineTypes(5);
+    pdu.SetMineTypes(std::move(vMineTypes));
+    ExpectMoves(pdu, &Minefield_State_PDU::GetMineTypes);
+}
+
+TEST(CPP11_MoveTests, Transfer_Control_Request_PDU_Moves)
+{
+    ExpectMoves(MakeTransferControlRequest(), &Transfer_Control_Request_PDU::GetRecordSets);
+}
+#endif
+
+TEST(CPP11_MoveTests, PduUniquePtr_HandsOverFactoryDecodedPDU)
+{
+    ExpectFactoryOwnershipMoves(MakeDataQuery());
+    ExpectFactoryOwnershipMoves(MakeResupplyReceived());
+#if DIS_VERSION > 5
+    ExpectFactoryOwnershipMoves(MakeTransferControlRequest());
+#endif
+}
+
+#endif
@@ -0,0 +1,476 @@
+#include <iostream>
+#include <cstring>
+#include <sstream>
+#include "gtest/gtest.h"
+
+#include "KDIS/Network/Connection.h"
+#include "KDIS/Network/ConnectionAddressFilter.h"
+#include "KDIS/Network/LoopbackTransport.h"
+#include "KDIS/Network/SharedMemoryTransport.h"
+#include "KDIS/Network/SocketUtils.h"
+#include "KDIS/Network/StatisticsReporter.h"
+#include "KDIS/Network/UDP_Transport.h"
+#include "KDIS/PDU/Bundle.h"
+#include "KDIS/PDU/Entity_Info_Interaction/Entity_State_PDU.h"
+#include "KDIS/PDU/Entity_Info_Interaction/Collision_PDU.h"
+#include "KDIS/PDU/Warfare/Fire_PDU.h"
+#include "KDIS/Extras/PDU_Statistics.h"
+
+using namespace KDIS;
+using namespace PDU;
+using namespace UTILS;
+using namespace NETWORK;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+
+// Loopback port used by the connection tests.
+static const KUINT32 TEST_PORT = 43000;
+
+namespace
+{
+    KUINT16 LastEntityID = 0;
+
+    void OnEntityState(const Entity_State_PDU & pdu)
+    {
+        LastEntityID = pdu.GetEntityIdentifier().GetEntityID();
+    }
+
+    struct DropCounter : public ConnectionSubscriber
+    {
+        KUINT32 Count;
+        DropCounter() : Count(0) {}
+        virtual void OnDatagramsDropped(KUINT32 C) { Count += C; }
+    };
+
+    struct WarfareCounter
+    {
+        int Count;
+        WarfareCounter() : Count(0) {}
+        void OnWarfare(const Header & h) { ++Count; }
+    };
+}
+
+TEST(ConnectionTests, SendBundle_MatchesEncodedBundle)
+{
+    Connection conn("127.0.0.1", TEST_PORT);
+    conn.SetBlockingTimeOut(1, 0);
+
+    Bundle bundle;
+    Entity_State_PDU pdu;
+    pdu.SetEntityIdentifier(EntityIdentifier(1, 2, 3));
+    bundle.AddPDU(pdu.Encode());
+    pdu.SetEntityIdentifier(EntityIdentifier(1, 2, 4));
+    bundle.AddPDU(pdu.Encode());
+    bundle.AddPDU(PduPtr(new Entity_State_PDU(pdu)));
+
+    KDataStream expected = bundle.Encode();
+    EXPECT_EQ(expected.GetBufferSize(), conn.SendBundle(bundle));
+
+    KOCTET buffer[MAX_PDU_SIZE];
+    KINT32 size = conn.Receive(buffer, MAX_PDU_SIZE);
+    ASSERT_EQ(expected.GetBufferSize(), size);
+    EXPECT_EQ(0, memcmp(expected.GetBufferPtr(), buffer, size));
+
+    // The receiver splits the bundle back into its PDU.
+    KDataStream received(buffer, size);
+    PDU_Factory factory;
+    for (int i = 0; i < 3; ++i)
+    {
+        KUINT16 pos = received.GetCurrentWritePosition();
+        PduUniquePtr p = factory.Decode(received);
+        ASSERT_TRUE(p.get() != 0);
+        received.SetCurrentWritePosition(pos + p->GetPDULength());
+    }
+    EXPECT_EQ(0, received.GetBufferSize());
+}
+
+TEST(ConnectionTests, Coalescing_BundlesUntilFlushed)
+{
+    Connection conn("127.0.0.1", TEST_PORT);
+    conn.SetBlockingTimeOut(1, 0);
+    conn.SetCoalescingEnabled(true, 10000000);
+
+    Entity_State_PDU pdu;
+    const KUINT16 len = pdu.GetPDULength();
+    EXPECT_EQ(0, conn.SendPDU(&pdu));
+    EXPECT_EQ(0, conn.SendPDU(&pdu));
+    EXPECT_EQ(0, conn.SendPDU(&pdu));
+
+    // Exempt PDU do not wait but the bundle is sent ahead of them to keep the order.
+    Fire_PDU fire;
+    EXPECT_EQ(len * 3 + fire.GetPDULength(), conn.SendPDU(&fire));
+
+    KOCTET buffer[MAX_PDU_SIZE];
+    EXPECT_EQ(len * 3, conn.Receive(buffer, MAX_PDU_SIZE));
+    EXPECT_EQ(fire.GetPDULength(), conn.Receive(buffer, MAX_PDU_SIZE));
+    EXPECT_EQ(0, conn.FlushCoalescedPDUs());
+
+    EXPECT_EQ(0, conn.SendPDU(&pdu));
+    EXPECT_EQ(len, conn.FlushCoalescedPDUs());
+    EXPECT_EQ(len, conn.Receive(buffer, MAX_PDU_SIZE));
+
+    // GetNextPDU splits the bundle.
+    EXPECT_EQ(0, conn.SendPDU(&pdu));
+    EXPECT_EQ(0, conn.SendPDU(&pdu));
+    conn.SetCoalescingEnabled(false);
+    EXPECT_TRUE(conn.GetNextPDU().get() != 0);
+    EXPECT_TRUE(conn.GetNextPDU().get() != 0);
+}
+
+TEST(ConnectionTests, Coalescing_FlushesWhenFullOrDue)
+{
+    Connection conn("127.0.0.1", TEST_PORT);
+    conn.SetBlockingTimeOut(1, 0);
+
+    Entity_State_PDU pdu;
+    const KUINT16 len = pdu.GetPDULength();
+    conn.SetCoalescingEnabled(true, 10000000, len * 2);
+
+    // The second PDU fills the bundle, the third starts a new one.
+    EXPECT_EQ(0, conn.SendPDU(&pdu));
+    EXPECT_EQ(len * 2, conn.SendPDU(&pdu));
+    EXPECT_EQ(0, conn.SendPDU(&pdu));
+
+    KOCTET buffer[MAX_PDU_SIZE];
+    EXPECT_EQ(len * 2, conn.Receive(buffer, MAX_PDU_SIZE));
+
+    // With no deadline the queued PDU goes out on the next call.
+    conn.SetCoalescingEnabled(true, 0, len * 2);
+    EXPECT_EQ(len, conn.FlushExpiredCoalescedPDUs());
+    EXPECT_EQ(len, conn.Receive(buffer, MAX_PDU_SIZE));
+}
+
+TEST(ConnectionTests, PDUHandlers_DispatchByTypeAndSkipUnhandled)
+{
+    Connection conn("127.0.0.1", TEST_PORT);
+    conn.SetBlockingTimeOut(1, 0);
+
+    WarfareCounter counter;
+    conn.AddPDUHandler(Entity_State_PDU_Type, &OnEntityState);
+    PDU_Handler * pWarfare = conn.AddPDUHandler(Warfare, &counter, &WarfareCounter::OnWarfare);
+    conn.SetDecodeHandledOnly(true);
+
+    Bundle bundle;
+    Collision_PDU collision;
+    Entity_State_PDU es;
+    es.SetEntityIdentifier(EntityIdentifier(1, 2, 3));
+    Fire_PDU fire;
+    bundle.AddPDU(collision.Encode());
+    bundle.AddPDU(es.Encode());
+    bundle.AddPDU(fire.Encode());
+    conn.SendBundle(bundle);
+
+    // The collision PDU has no handler so is stepped over.
+    PduUniquePtr p = conn.GetNextPDU();
+    ASSERT_TRUE(p.get() != 0);
+    EXPECT_EQ(Entity_State_PDU_Type, p->GetPDUType());
+    EXPECT_EQ(3, LastEntityID);
+
+    p = conn.GetNextPDU();
+    ASSERT_TRUE(p.get() != 0);
+    EXPECT_EQ(Fire_PDU_Type, p->GetPDUType());
+    EXPECT_EQ(1, counter.Count);
+
+    // Without a handler the factory no longer decodes the family.
+    conn.RemovePDUHandler(pWarfare);
+    KDataStream stream = fire.Encode();
+    EXPECT_TRUE(conn.GetPDU_Factory()->Decode(stream).get() == 0);
+
+    conn.SetDecodeHandledOnly(false);
+    stream = fire.Encode();
+    EXPECT_TRUE(conn.GetPDU_Factory()->Decode(stream).get() != 0);
+}
+
+TEST(ConnectionTests, TryGetNextPDU_RejectsPDULengthSmallerThanHeader)
+{
+    Connection conn("127.0.0.1", TEST_PORT);
+    conn.SetBlockingTimeOut(1, 0);
+    conn.AddPDUHandler(Entity_State_PDU_Type, &OnEntityState);
+    conn.SetDecodeHandledOnly(true);
+
+    // Both a skipped and a decoded PDU type, neither must loop on the same PDU.
+    Collision_PDU collision;
+    Entity_State_PDU es;
+    KDataStream streams[2] = { collision.Encode(), es.Encode() };
+    for (int i = 0; i < 2; ++i)
+    {
+        std::vector<KOCTET> buffer(streams[i].GetBufferPtr(), streams[i].GetBufferPtr() + streams[i].GetBufferSize());
+        buffer[8] = 0;
+        buffer[9] = 0;
+        conn.Send(&buffer[0], buffer.size());
+
+        PduUniquePtr p;
+        EXPECT_EQ(INVALID_DATA, conn.TryGetNextPDU(p));
+        EXPECT_TRUE(p.get() == 0);
+    }
+
+    // The bad datagram was dropped.
+    conn.SendPDU(&es);
+    PduUniquePtr p;
+    EXPECT_EQ(NO_ERRORS, conn.TryGetNextPDU(p));
+    ASSERT_TRUE(p.get() != 0);
+    EXPECT_EQ(Entity_State_PDU_Type, p->GetPDUType());
+}
+
+TEST(ConnectionTests, AddressFilter_MatchesCIDRRanges)
+{
+    ConnectionAddressFilter filter(ConnectionAddressFilter::AllowAddressesInFilterList);
+    filter.AddAddress("192.168.0.0/16");
+    filter.AddAddress("10.1.2.3");
+
+    EXPECT_TRUE(filter.TestAddress("192.168.5.4"));
+    EXPECT_TRUE(filter.TestAddress("10.1.2.3"));
+    EXPECT_FALSE(filter.TestAddress("10.1.2.4"));
+    EXPECT_FALSE(filter.TestAddress("192.169.0.1"));
+    EXPECT_TRUE(filter.TestAddress(0xC0A80101u));
+
+    sockaddr_in sender;
+    memset(&sender, 0, sizeof(sender));
+    sender.sin_addr.s_addr = inet_addr("192.168.200.1");
+    ConnectionSubscriber & sub = filter;
+    EXPECT_TRUE(sub.OnDataReceived(0, 0, sender));
+
+    filter.RemoveAddress("192.168.0.0/16");
+    EXPECT_FALSE(sub.OnDataReceived(0, 0, sender));
+
+    filter.SetFilterMode(ConnectionAddressFilter::BlockAddressesInFilterList);
+    EXPECT_TRUE(filter.TestAddress("192.168.5.4"));
+    EXPECT_FALSE(filter.TestAddress("10.1.2.3"));
+
+    EXPECT_THROW(filter.AddAddress("10.0.0.0/33"), KException);
+    EXPECT_THROW(filter.AddAddress("not.an.address"), KException);
+}
+
+TEST(ConnectionTests, LatencyTracking_RecordsPerPDUType)
+{
+    Connection conn("127.0.0.1", TEST_PORT);
+    conn.SetBlockingTimeOut(1, 0);
+    EXPECT_TRUE(conn.GetLatencyHistogram(Entity_State_PDU_Type, Connection::ReceiveToDecoded) == 0);
+
+    conn.SetLatencyTrackingEnabled(true);
+    Entity_State_PDU pdu;
+    conn.SendPDU(&pdu);
+    ASSERT_TRUE(conn.GetNextPDU().get() != 0);
+
+    const LatencyHistogram * pDecode = conn.GetLatencyHistogram(Entity_State_PDU_Type, Connection::ReceiveToDecoded);
+    const LatencyHistogram * pHandle = conn.GetLatencyHistogram(Entity_State_PDU_Type, Connection::DecodedToHandled);
+    ASSERT_TRUE(pDecode != 0);
+    ASSERT_TRUE(pHandle != 0);
+    EXPECT_EQ(1u, pDecode->GetCount());
+    EXPECT_EQ(1u, pHandle->GetCount());
+#if defined(__linux__)
+    EXPECT_GT(conn.GetLastArrivalTime(), 0u);
+    ASSERT_TRUE(conn.GetLatencyHistogram(Entity_State_PDU_Type, Connection::KernelToReceive) != 0);
+#endif
+
+    conn.ResetLatencyHistograms();
+    EXPECT_EQ(0u, pDecode->GetCount());
+}
+
+TEST(ConnectionTests, Statistics_CountTrafficPerPDUType)
+{
+    Connection conn("127.0.0.1", TEST_PORT);
+    conn.SetBlockingTimeOut(1, 0);
+    conn.SetStatisticsEnabled(true);
+    conn.GetPDU_Factory()->SetDecodeEnabled(Fire_PDU_Type, false);
+
+    Entity_State_PDU es;
+    Fire_PDU fire;
+    Bundle bundle;
+    bundle.AddPDU(PduPtr(new Fire_PDU(fire)));
+    bundle.AddPDU(PduPtr(new Entity_State_PDU(es)));
+    conn.SendPDU(&es);
+    conn.SendBundle(bundle);
+
+    EXPECT_TRUE(conn.GetNextPDU().get() != 0);
+    EXPECT_TRUE(conn.GetNextPDU().get() != 0);
+
+    PDU_Statistics::Snapshot snap;
+    conn.GetStatistics().GetSnapshot(snap);
+    EXPECT_EQ(2u, snap.m_ui64DatagramsSent);
+    EXPECT_EQ(2u, snap.m_ui64DatagramsReceived);
+    EXPECT_EQ(snap.m_ui64BytesSent, snap.m_ui64BytesReceived);
+    EXPECT_EQ(3u, snap.m_ui64Sent);
+    EXPECT_EQ(2u, snap.m_ui64Decoded);
+    EXPECT_EQ(1u, snap.m_ui64Filtered);
+    EXPECT_EQ(1u, snap.m_ui64Bundles);
+    EXPECT_EQ(1u, snap.m_ui64BundleMembers);
+    EXPECT_EQ(2u, snap.m_Types[Entity_State_PDU_Type].m_ui64Received);
+    EXPECT_EQ(1u, snap.m_Types[Fire_PDU_Type].m_ui64Filtered);
+    EXPECT_EQ(0u, snap.m_ui64Failed);
+
+    std::ostringstream out;
+    StatisticsReporter reporter(conn.GetStatistics(), 60000, out);
+    reporter.ReportNow();
+    EXPECT_NE(std::string::npos, out.str().find("Datagrams Received: 2"));
+
+    conn.GetStatistics().Reset();
+    conn.GetStatistics().GetSnapshot(snap);
+    EXPECT_EQ(0u, snap.m_ui64Decoded);
+}
+
+TEST(ConnectionTests, SocketBuffers_ReportKernelDrops)
+{
+    Connection conn("127.0.0.1", TEST_PORT);
+    conn.SetBlockingTimeOut(0, 100000);
+
+    conn.SetSendBufferSize(256 * 1024);
+    EXPECT_GE(conn.GetSendBufferSize(), 256u * 1024u);
+
+    // Small enough for a burst to overflow it.
+    conn.SetReceiveBufferSize(4096);
+    EXPECT_LT(conn.GetReceiveBufferSize(), 64u * 1024u);
+
+    DropCounter drops;
+    conn.AddSubscriber(&drops);
+    conn.SetDropDetectionEnabled(true);
+    conn.SetStatisticsEnabled(true);
+
+    Entity_State_PDU pdu;
+    for (int i = 0; i < 200; ++i)
+    {
+        conn.SendPDU(&pdu);
+    }
+    while (conn.GetNextPDU().get())
+    {
+    }
+
+    // The kernel reports the drops with the next datagram it queues.
+    conn.SendPDU(&pdu);
+    EXPECT_TRUE(conn.GetNextPDU().get() != 0);
+
+#if defined(__linux__)
+    EXPECT_GT(conn.GetDroppedDatagramCount(), 0u);
+    EXPECT_EQ(conn.GetDroppedDatagramCount(), drops.Count);
+
+    PDU_Statistics::Snapshot snap;
+    conn.GetStatistics().GetSnapshot(snap);
+    EXPECT_EQ(conn.GetDroppedDatagramCount(), snap.m_ui64DatagramsDropped);
+#endif
+    conn.RemoveSubscriber(&drops);
+}
+
+TEST(ConnectionTests, LoopbackTransport_DeliversInOrderAndReportsDrops)
+{
+    Connection conn("127.0.0.1", TEST_PORT, false, true, 0, true);
+    LoopbackTransport * loopback = new LoopbackTransport(2);
+    conn.SetTransport(loopback);
+    DropCounter drops;
+    conn.AddSubscriber(&drops);
+
+    Entity_State_PDU pdu;
+    pdu.SetEntityIdentifier(EntityIdentifier(1, 2, 1));
+    conn.SendPDU(&pdu);
+
+    Bundle bundle;
+    pdu.SetEntityIdentifier(EntityIdentifier(1, 2, 2));
+    bundle.AddPDU(PduPtr(new Entity_State_PDU(pdu)));
+    bundle.AddPDU(PduPtr(new Entity_State_PDU(pdu)));
+    conn.SendBundle(bundle);
+
+    // The queue is full so this one is lost.
+    conn.SendPDU(&pdu);
+    EXPECT_EQ(2u, loopback->GetQueuedCount());
+
+    const KUINT16 expected[] = { 1, 2, 2 };
+    for (int i = 0; i < 3; ++i)
+    {
+        PduUniquePtr p = conn.GetNextPDU();
+        ASSERT_TRUE(p.get() != 0);
+        EXPECT_EQ(expected[i], static_cast<Entity_State_PDU *>(p.get())->GetEntityIdentifier().GetEntityID());
+    }
+    EXPECT_EQ("127.0.0.1", conn.GetLastSenderIp());
+    EXPECT_TRUE(conn.GetNextPDU().get() == 0);
+    EXPECT_EQ(1u, drops.Count);
+    EXPECT_EQ(1u, conn.GetDroppedDatagramCount());
+
+    // Replay the same datagram over and over.
+    loopback->SetReplayEnabled(true);
+    conn.SendPDU(&pdu);
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_TRUE(conn.GetNextPDU().get() != 0);
+    }
+    EXPECT_EQ(1u, loopback->GetQueuedCount());
+
+    conn.SetTransport(0);
+    EXPECT_TRUE(conn.GetTransport() == 0);
+}
+
+TEST(ConnectionTests, UDP_Transport_SendsBatches)
+{
+    Connection conn("127.0.0.1", TEST_PORT, false, true, 0, true);
+    UDP_Transport * udp = new UDP_Transport("127.0.0.1", TEST_PORT);
+    conn.SetTransport(udp);
+    conn.SetBlockingTimeOut(1, 0);
+
+    KDataStream streams[3];
+    KIOVEC datagrams[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        Entity_State_PDU pdu;
+        pdu.SetEntityIdentifier(EntityIdentifier(1, 2, i));
+        pdu.Encode(streams[i]);
+        SetIOVec(datagrams[i], streams[i].GetBufferPtr(), streams[i].GetBufferSize());
+    }
+    EXPECT_EQ(3 * static_cast<KINT32>(streams[0].GetBufferSize()), udp->SendBatch(datagrams, 3));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        PduUniquePtr p = conn.GetNextPDU();
+        ASSERT_TRUE(p.get() != 0);
+        EXPECT_EQ(i, static_cast<Entity_State_PDU *>(p.get())->GetEntityIdentifier().GetEntityID());
+    }
+
+    // The shards take over the port of the transport.
+    conn.SetReceiveShards(2);
+    EXPECT_EQ(2, conn.GetReceiveShardCount());
+    EXPECT_EQ(static_cast<KINT32>(streams[0].GetBufferSize()), conn.Send(streams[0]));
+    EXPECT_TRUE(conn.GetNextPDU().get() != 0);
+    conn.SetReceiveShards(0);
+}
+
+#if !(defined(WIN32) | defined(_WIN32) | defined(WIN64) | defined(_WIN64))
+TEST(ConnectionTests, SharedMemoryTransport_ExchangesBetweenConnections)
+{
+    const KString name = "/kdis_test_ring_conn";
+    SharedMemoryRing::Remove(name);
+
+    Connection sender("127.0.0.1", TEST_PORT);
+    Connection receiver("127.0.0.1", TEST_PORT);
+    sender.SetTransport(new SharedMemoryTransport(name));
+    receiver.SetSharedMemoryTransport(name);
+    receiver.SetBlockingTimeOut(1, 0);
+    ASSERT_TRUE(receiver.GetTransport() != 0);
+    ASSERT_TRUE(receiver.GetSharedMemoryRing() != 0);
+    EXPECT_TRUE(sender.GetSharedMemoryRing() != 0);
+    EXPECT_THROW(receiver.SetReceiveShards(2), KException);
+
+    Entity_State_PDU pdu;
+    pdu.SetEntityIdentifier(EntityIdentifier(1, 2, 3));
+    sender.SendPDU(&pdu);
+
+    Bundle bundle;
+    bundle.AddPDU(PduPtr(new Entity_State_PDU(pdu)));
+    bundle.AddPDU(PduPtr(new Entity_State_PDU(pdu)));
+    sender.SendBundle(bundle);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        PduUniquePtr p = receiver.GetNextPDU();
+        ASSERT_TRUE(p.get() != 0);
+        EXPECT_EQ(3, static_cast<Entity_State_PDU *>(p.get())->GetEntityIdentifier().GetEntityID());
+    }
+    EXPECT_EQ(htonl(INADDR_LOOPBACK), receiver.GetLastSender().sin_addr.s_addr);
+
+    // Back on the network, unicast goes to the socket bound last.
+    sender.SetTransport(0);
+    receiver.SetNetworkTransport();
+    EXPECT_TRUE(receiver.GetTransport() == 0);
+    EXPECT_TRUE(receiver.GetSharedMemoryRing() == 0);
+    sender.SendPDU(&pdu);
+    EXPECT_TRUE(receiver.GetNextPDU().get() != 0);
+
+    SharedMemoryRing::Remove(name);
+}
+#endif
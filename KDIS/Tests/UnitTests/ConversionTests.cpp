@@ -1,4 +1,7 @@
 #include <iostream>
+#include <cstdlib>
+#include <limits>
+#include <vector>
 #include "gtest/gtest.h"
 
 #include "KDIS/KDefines.h"
@@ -22,3 +25,150 @@ TEST(ConversionTests, GeocentricToGeodeticToGeocentric_ProducesSameOriginalValue
     EXPECT_NEAR(Alt, NewAlt, 0.0000001);
 }
 
+
+TEST(ConversionTests, HeadingPitchRollToEulerToHeadingPitchRoll_ProducesSameOriginalValues)
+{
+    KFLOAT64 Lat = DegToRad( 40.664 ), Lon = DegToRad( -122.63 );
+    KFLOAT64 H = 0.5, P = 0.2, R = -0.3;
+
+    KFLOAT64 Psi = 0.0, Theta = 0.0, Phi = 0.0;
+    HeadingPitchRollToEuler( H, P, R, Lat, Lon, Psi, Theta, Phi );
+
+    KFLOAT64 NewH = 0.0, NewP = 0.0, NewR = 0.0;
+    EulerToHeadingPitchRoll( Lat, Lon, Psi, Theta, Phi, NewH, NewP, NewR );
+
+    EXPECT_NEAR(H, NewH, 0.0000001);
+    EXPECT_NEAR(P, NewP, 0.0000001);
+    EXPECT_NEAR(R, NewR, 0.0000001);
+}
+
+TEST(ConversionTests, BatchOrientationConversions_MatchSingleConversionsWithinTileError)
+{
+    const KUINT32 Count = 64;
+    KFLOAT64 Lat[Count], Lon[Count], H[Count], P[Count], R[Count];
+    KFLOAT64 Psi[Count], Theta[Count], Phi[Count];
+    KFLOAT64 NewH[Count], NewP[Count], NewR[Count];
+
+    for( KUINT32 i = 0; i < Count; ++i )
+    {
+        Lat[i] = DegToRad( 40.664 + i * 0.0001 );
+        Lon[i] = DegToRad( -122.63 - i * 0.0001 );
+        H[i] = 0.01 * i;
+        P[i] = 0.2;
+        R[i] = -0.3;
+    }
+
+    LocalFrameCache<KFLOAT64> Cache;
+    HeadingPitchRollToEuler( H, P, R, Lat, Lon, Psi, Theta, Phi, Count, Cache );
+    EulerToHeadingPitchRoll( Lat, Lon, Psi, Theta, Phi, NewH, NewP, NewR, Count, Cache );
+
+    // The entities are clustered so most lookups should be served by the cache.
+    EXPECT_GT( Cache.GetHits(), Cache.GetMisses() );
+
+    for( KUINT32 i = 0; i < Count; ++i )
+    {
+        KFLOAT64 ExpPsi, ExpTheta, ExpPhi;
+        HeadingPitchRollToEuler( H[i], P[i], R[i], Lat[i], Lon[i], ExpPsi, ExpTheta, ExpPhi );
+
+        EXPECT_NEAR(ExpPsi, Psi[i], Cache.GetTileSize());
+        EXPECT_NEAR(ExpTheta, Theta[i], Cache.GetTileSize());
+        EXPECT_NEAR(ExpPhi, Phi[i], Cache.GetTileSize());
+
+        // Using the same cached frame in both directions is exact.
+        EXPECT_NEAR(H[i], NewH[i], 0.0000001);
+        EXPECT_NEAR(P[i], NewP[i], 0.0000001);
+        EXPECT_NEAR(R[i], NewR[i], 0.0000001);
+    }
+}
+
+namespace
+{
+    KFLOAT64 RandomAngle(KFLOAT64 Range)
+    {
+        return (rand() / static_cast<KFLOAT64>(RAND_MAX) * 2.0 - 1.0) * Range;
+    }
+
+    // Difference between two angles, wrapped to -pi..pi.
+    KFLOAT64 AngleDiff(KFLOAT64 A, KFLOAT64 B)
+    {
+        return atan2(sin(A - B), cos(A - B));
+    }
+}
+
+TEST(ConversionTests, BatchOrientationConversions_MatchScalarConversionsForRandomInputs)
+{
+    // Not a multiple of the block size so the last block is partial.
+    const KUINT32 Count = 1000;
+    std::vector<KFLOAT64> Lat(Count), Lon(Count), H(Count), P(Count), R(Count);
+    std::vector<KFLOAT64> Psi(Count), Theta(Count), Phi(Count);
+    std::vector<KFLOAT64> NewH(Count), NewP(Count), NewR(Count);
+
+    srand(1234);
+    for (KUINT32 i = 0; i < Count; ++i)
+    {
+        Lat[i] = RandomAngle(1.5);
+        Lon[i] = RandomAngle(3.1);
+        H[i] = RandomAngle(3.1);
+        // Away from the vertical where heading and roll are not defined.
+        P[i] = RandomAngle(1.4);
+        R[i] = RandomAngle(3.1);
+    }
+
+    LocalFrameCache<KFLOAT64> Cache;
+    HeadingPitchRollToEuler(&H[0], &P[0], &R[0], &Lat[0], &Lon[0], &Psi[0], &Theta[0], &Phi[0], Count, Cache);
+
+    // The scalar conversions that use the frame at the exact position, back from the batch results.
+    for (KUINT32 i = 0; i < Count; ++i)
+    {
+        KFLOAT64 ExpPsi, ExpTheta, ExpPhi;
+        HeadingPitchRollToEuler(H[i], P[i], R[i], Lat[i], Lon[i], ExpPsi, ExpTheta, ExpPhi);
+
+        // Heading and roll about the vertical are less well conditioned as the pitch grows.
+        const KFLOAT64 Tol = Cache.GetTileSize() / cos(ExpTheta);
+        EXPECT_NEAR(0.0, AngleDiff(ExpPsi, Psi[i]), Tol) << i;
+        EXPECT_NEAR(0.0, AngleDiff(ExpTheta, Theta[i]), Cache.GetTileSize()) << i;
+        EXPECT_NEAR(0.0, AngleDiff(ExpPhi, Phi[i]), Tol) << i;
+    }
+
+    EulerToHeadingPitchRoll(&Lat[0], &Lon[0], &Psi[0], &Theta[0], &Phi[0], &NewH[0], &NewP[0], &NewR[0], Count, Cache);
+    for (KUINT32 i = 0; i < Count; ++i)
+    {
+        KFLOAT64 ExpH, ExpP, ExpR;
+        EulerToHeadingPitchRoll(Lat[i], Lon[i], Psi[i], Theta[i], Phi[i], ExpH, ExpP, ExpR);
+
+        const KFLOAT64 Tol = Cache.GetTileSize() / cos(ExpP);
+        EXPECT_NEAR(0.0, AngleDiff(ExpH, NewH[i]), Tol) << i;
+        EXPECT_NEAR(0.0, AngleDiff(ExpP, NewP[i]), Cache.GetTileSize()) << i;
+        EXPECT_NEAR(0.0, AngleDiff(ExpR, NewR[i]), Tol) << i;
+
+        // Both directions used the same cached frame.
+        EXPECT_NEAR(0.0, AngleDiff(H[i], NewH[i]), 0.0000001) << i;
+        EXPECT_NEAR(0.0, AngleDiff(P[i], NewP[i]), 0.0000001) << i;
+        EXPECT_NEAR(0.0, AngleDiff(R[i], NewR[i]), 0.0000001) << i;
+    }
+}
+
+TEST(ConversionTests, LocalFrameCache_RejectsInvalidTileSizes)
+{
+    EXPECT_THROW(LocalFrameCache<KFLOAT64> Cache(0.0), KException);
+
+    LocalFrameCache<KFLOAT64> Cache;
+    EXPECT_THROW(Cache.SetTileSize(0.0), KException);
+    EXPECT_THROW(Cache.SetTileSize(-0.001), KException);
+    EXPECT_THROW(Cache.SetTileSize(1e-12), KException);
+    EXPECT_THROW(Cache.SetTileSize(std::numeric_limits<KFLOAT64>::quiet_NaN()), KException);
+    EXPECT_EQ(0.0001, Cache.GetTileSize());
+
+    // Positions outside of the tile index are converted without the cache.
+    Cache.SetTileSize(LocalFrameCache<KFLOAT64>::MinTileSize());
+    const LocalFrame<KFLOAT64> & F = Cache.GetFrame(1.0, 1000.0);
+    LocalFrame<KFLOAT64> Exp;
+    CalculateLocalFrame(1.0, 1000.0, Exp);
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(Exp.N[i], F.N[i]);
+        EXPECT_EQ(Exp.E[i], F.E[i]);
+        EXPECT_EQ(Exp.D[i], F.D[i]);
+    }
+    EXPECT_EQ(0u, Cache.GetHits());
+}
@@ -1,4 +1,6 @@
 #include <iostream>
+#include <cstring>
+#include <type_traits>
 #include "gtest/gtest.h"
 
 #include "KDIS/DataTypes/AntennaLocation.h"
@@ -89,6 +91,97 @@ TEST(DataType_EncodeDecode5, DeadReckoningParameter)
     EXPECT_EQ(0, stream.GetBufferSize());
 }
 
+TEST(DataType_EncodeDecode5, DeadReckoningParameter_FieldSchema)
+{
+    EXPECT_EQ(40, (KUINT16)DeadReckoningParameter::FieldSchema::SIZE);
+    EXPECT_EQ(6, (KUINT16)EntityIdentifier::FieldSchema::SIZE);
+
+    DeadReckoningParameter dtIn(ENUMS::DRM_R_V_W, Vector(1, 2, 3), Vector(-4, 5.5f, 6));
+
+    // Little endian streams swap each field but keep the field order.
+    KDataStream streamBE, streamLE(Little_Endian);
+    dtIn.Encode(streamBE);
+    dtIn.Encode(streamLE);
+    ASSERT_EQ(40, streamBE.GetBufferSize());
+    ASSERT_EQ(40, streamLE.GetBufferSize());
+    EXPECT_EQ(ENUMS::DRM_R_V_W, (KUINT8)streamBE.GetBufferPtr()[0]);
+    EXPECT_EQ((KOCTET)0x3F, streamBE.GetBufferPtr()[16]);
+    EXPECT_EQ((KOCTET)0x3F, streamLE.GetBufferPtr()[19]);
+
+    DeadReckoningParameter dtOutBE(streamBE), dtOutLE(streamLE);
+    EXPECT_EQ(dtIn, dtOutBE);
+    EXPECT_EQ(dtIn, dtOutLE);
+    EXPECT_EQ(DeadReckoningParameter::FieldSchema::Hash(dtIn), DeadReckoningParameter::FieldSchema::Hash(dtOutLE));
+
+    dtOutLE.SetAngularVelocity(Vector(0, 0, 0));
+    EXPECT_NE(dtIn, dtOutLE);
+    EXPECT_NE(DeadReckoningParameter::FieldSchema::Hash(dtIn), DeadReckoningParameter::FieldSchema::Hash(dtOutLE));
+
+    KDataStream shortStream;
+    shortStream << (KUINT32)0;
+    DeadReckoningParameter dtShort;
+    EXPECT_THROW(dtShort.Decode(shortStream), KException);
+}
+
+TEST(DataType_EncodeDecode5, FieldSchema_SwapsUniformRecordsAsOneRun)
+{
+    // Records made of one element width are swapped in a single run.
+    EXPECT_EQ(4, (int)Vector::FieldSchema::WIDTH);
+    EXPECT_EQ(3, (int)Vector::FieldSchema::RUN_COUNT);
+    EXPECT_EQ(8, (int)WorldCoordinates::FieldSchema::WIDTH);
+    EXPECT_EQ(3, (int)EntityIdentifier::FieldSchema::RUN_COUNT);
+    EXPECT_EQ(KFIELD_MIXED_WIDTH, (int)DeadReckoningParameter::FieldSchema::WIDTH);
+    EXPECT_EQ(0, (int)DeadReckoningParameter::FieldSchema::RUN_COUNT);
+
+    KOCTET net[6] = { 0x00, 0x01, 0x00, 0x02, 0x01, 0x03 };
+    KDataStream stream(net, sizeof(net));
+    EntityIdentifier id(stream);
+    EXPECT_EQ(EntityIdentifier(1, 2, 0x103), id);
+
+    WorldCoordinates wc(1.5, -2.25, 6378137.0);
+    KDataStream streamLE(Little_Endian);
+    wc.Encode(streamLE);
+    KFLOAT64 f64Y;
+    memcpy(&f64Y, streamLE.GetBufferPtr() + 8, sizeof(f64Y));
+    if (!KDIS::UTILS::IsMachineBigEndian())
+    {
+        EXPECT_EQ(-2.25, f64Y);
+    }
+    EXPECT_EQ(wc, WorldCoordinates(streamLE));
+}
+
+TEST(DataType_EncodeDecode5, DeadReckoningParameter_POD)
+{
+    EXPECT_TRUE(std::is_trivially_copyable<DeadReckoningParameterPOD>::value);
+    EXPECT_TRUE(std::is_standard_layout<DeadReckoningParameterPOD>::value);
+    EXPECT_TRUE(std::is_trivially_copyable<WorldCoordinatesPOD>::value);
+    EXPECT_EQ(24, sizeof(WorldCoordinatesPOD));
+
+    DeadReckoningParameter dtIn(ENUMS::DRM_R_V_W, Vector(1, 2, 3), Vector(-4, 5.5f, 6));
+
+    // Dense arrays of mirrors can be copied as raw memory.
+    DeadReckoningParameterPOD pods[2];
+    pods[0] = dtIn.ToPOD();
+    memcpy(&pods[1], &pods[0], sizeof(DeadReckoningParameterPOD));
+    EXPECT_EQ(5.5f, pods[1].m_AngularVelocity.m_f32Y);
+    EXPECT_EQ(dtIn, DeadReckoningParameter(pods[1]));
+
+    // The mirror encodes exactly as the class does.
+    KDataStream streamClass, streamPOD;
+    dtIn.Encode(streamClass);
+    DeadReckoningParameterPOD::FieldSchema::Encode(pods[1], streamPOD);
+    EXPECT_EQ(streamClass, streamPOD);
+
+    DeadReckoningParameterPOD podOut;
+    DeadReckoningParameterPOD::FieldSchema::Decode(streamPOD, podOut);
+    EXPECT_EQ(dtIn, DeadReckoningParameter(podOut));
+
+    EntityIdentifier id(1, 2, 3);
+    EntityIdentifierPOD idPOD = id.ToPOD();
+    EXPECT_EQ(3, idPOD.m_ui16EntityID);
+    EXPECT_EQ(id, EntityIdentifier(idPOD));
+}
+
 TEST(DataType_EncodeDecode5, EmissionSystem)
 {
     EmissionSystem dtIn;
@@ -269,6 +362,29 @@ TEST(DataType_EncodeDecode5, VariableDatum)
     EXPECT_EQ(0, stream.GetBufferSize());
 }
 
+TEST(DataType_EncodeDecode5, VariableDatum_TypedValues)
+{
+    KOCTET data[20];
+    KDataStream values;
+    values << (KUINT64)0x0102030405060708ULL << (KFLOAT64)-12.5 << (KUINT32)7;
+    values.CopyIntoBuffer(data, sizeof(data));
+
+    VariableDatum dtIn(ENUMS::DatumID(1), data, sizeof(data) * 8);
+    EXPECT_EQ(24, dtIn.GetDatumValueSize());
+    EXPECT_EQ(2, dtIn.GetDatumValueCount<KUINT64>());
+    EXPECT_EQ(5, dtIn.GetDatumValueCount<KUINT32>());
+
+    KDataStream stream = dtIn.Encode();
+    VariableDatum dtOut(stream);
+    EXPECT_EQ(dtIn, dtOut);
+    EXPECT_EQ(0, stream.GetBufferSize());
+    EXPECT_EQ(0x0102030405060708ULL, dtOut.GetDatumValueAt<KUINT64>(0));
+    EXPECT_EQ(-12.5, dtOut.GetDatumValueAt<KFLOAT64>(1));
+    EXPECT_EQ(7, dtOut.GetDatumValueAt<KUINT32>(4));
+    EXPECT_EQ(-12.5, dtOut.GetDatumValueAsKFLOAT64()[1]);
+    EXPECT_THROW(dtOut.GetDatumValueAt<KUINT64>(2), KException);
+}
+
 TEST(DataType_EncodeDecode5, VariableParameter)
 {
     VariableParameter dtIn;
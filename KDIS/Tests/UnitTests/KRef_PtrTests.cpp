@@ -0,0 +1,128 @@
+#include <iostream>
+#include "gtest/gtest.h"
+
+#include "KDIS/KDefines.h"
+#include "KDIS/Extras/KRef_Ptr.h"
+#include "KDIS/DataTypes/VariableParameter.h"
+#include "KDIS/DataTypes/ArticulatedPart.h"
+#include "KDIS/PDU/Bundle.h"
+#include "KDIS/PDU/Entity_Info_Interaction/Entity_State_PDU.h"
+
+using namespace KDIS;
+using namespace UTILS;
+using namespace DATA_TYPE;
+using namespace PDU;
+
+namespace
+{
+    class CountedObj
+    {
+    public:
+        static KINT32 Alive;
+        KINT32 m_i32A, m_i32B;
+        CountedObj() : m_i32A( 0 ), m_i32B( 0 ) { ++Alive; }
+        CountedObj( KINT32 A, KINT32 B ) : m_i32A( A ), m_i32B( B ) { ++Alive; }
+        CountedObj( const CountedObj & O ) : m_i32A( O.m_i32A ), m_i32B( O.m_i32B ) { ++Alive; }
+        virtual ~CountedObj() { --Alive; }
+    };
+
+    KINT32 CountedObj::Alive = 0;
+
+    class IntrusiveObj : public KRef_Counted
+    {
+    public:
+        static KINT32 Alive;
+        IntrusiveObj() { ++Alive; }
+        virtual ~IntrusiveObj() { --Alive; }
+    };
+
+    KINT32 IntrusiveObj::Alive = 0;
+}
+
+TEST(KRef_PtrTests, Separate_ReleasesOnLastReference)
+{
+    {
+        KRef_Ptr<CountedObj> p1 = new CountedObj;
+        EXPECT_EQ( 1, p1.GetCount() );
+        {
+            KRef_Ptr<CountedObj> p2 = p1;
+            EXPECT_EQ( 2, p1.GetCount() );
+        }
+        EXPECT_EQ( 1, p1.GetCount() );
+        EXPECT_EQ( 1, CountedObj::Alive );
+    }
+    EXPECT_EQ( 0, CountedObj::Alive );
+
+    KRef_Ptr<CountedObj> pNull;
+    EXPECT_EQ( 0, pNull.GetCount() );
+}
+
+TEST(KRef_PtrTests, Make_CombinedAllocationForwardsArguments)
+{
+    {
+        KRef_Ptr<CountedObj> p = KRef_Ptr<CountedObj>::Make( 3, 4 );
+        EXPECT_EQ( 3, p->m_i32A );
+        EXPECT_EQ( 4, p->m_i32B );
+        EXPECT_EQ( 1, p.GetCount() );
+
+        KRef_Ptr<CountedObj> pCopy = p;
+        p.Clear();
+        EXPECT_EQ( 1, pCopy.GetCount() );
+        EXPECT_EQ( 1, CountedObj::Alive );
+    }
+    EXPECT_EQ( 0, CountedObj::Alive );
+}
+
+TEST(KRef_PtrTests, Intrusive_RawPointerSharesCount)
+{
+    {
+        KRef_Ptr<IntrusiveObj> p1 = new IntrusiveObj;
+        KRef_Ptr<IntrusiveObj> p2 = p1.GetPtr();
+        EXPECT_EQ( 2, p1.GetCount() );
+        p1.Clear();
+        EXPECT_EQ( 1, IntrusiveObj::Alive );
+    }
+    EXPECT_EQ( 0, IntrusiveObj::Alive );
+}
+
+TEST(KRef_PtrTests, Intrusive_DerivedConvertsToBase)
+{
+    VarPrmPtr pBase;
+    {
+        KRef_Ptr<ArticulatedPart> pPart = new ArticulatedPart;
+        pBase = pPart;
+        EXPECT_EQ( 2, pBase.GetCount() );
+    }
+    EXPECT_EQ( 1, pBase.GetCount() );
+
+    // A copied object must start with its own count.
+    ArticulatedPart Copy( *( ArticulatedPart * )pBase.GetPtr() );
+    KRef_Ptr<ArticulatedPart> pCopy = new ArticulatedPart( Copy );
+    EXPECT_EQ( 1, pCopy.GetCount() );
+}
+
+TEST(KRef_PtrTests, Make_DerivedPDUConvertsToPduPtr)
+{
+    // The PDU do not carry a counter, Make places it with the PDU instead.
+    Bundle bundle;
+    {
+        KRef_Ptr<Entity_State_PDU> pES = KRef_Ptr<Entity_State_PDU>::Make();
+        pES->SetEntityIdentifier( EntityIdentifier( 1, 2, 3 ) );
+        bundle.AddPDU( pES );
+        EXPECT_EQ( 2, pES.GetCount() );
+    }
+    ASSERT_EQ( 1u, bundle.GetRefPDUs().size() );
+    EXPECT_EQ( 1, bundle.GetRefPDUs()[0].GetCount() );
+    EXPECT_EQ( 3, static_cast<Entity_State_PDU *>( bundle.GetRefPDUs()[0].GetPtr() )->GetEntityIdentifier().GetEntityID() );
+
+    bundle.ClearPDUs();
+}
+
+TEST(KRef_PtrTests, AtomicPolicy_CountsReferences)
+{
+    KRef_Ptr<CountedObj, KRef_Atomic> p1 = KRef_Ptr<CountedObj, KRef_Atomic>::Make();
+    KRef_Ptr<CountedObj, KRef_Atomic> p2 = p1;
+    EXPECT_EQ( 2, p1.GetCount() );
+    p2.Clear();
+    EXPECT_EQ( 1, p1.GetCount() );
+}
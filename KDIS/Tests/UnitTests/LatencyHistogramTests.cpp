@@ -0,0 +1,32 @@
+#include "gtest/gtest.h"
+
+#include "KDIS/Extras/LatencyHistogram.h"
+
+using namespace KDIS;
+using namespace UTILS;
+
+TEST(LatencyHistogramTests, BucketsAndPercentiles)
+{
+    EXPECT_EQ(0, LatencyHistogram::GetBucket(0));
+    EXPECT_EQ(1, LatencyHistogram::GetBucket(1));
+    EXPECT_EQ(2, LatencyHistogram::GetBucket(3));
+    EXPECT_EQ(11, LatencyHistogram::GetBucket(1024));
+
+    LatencyHistogram h;
+    EXPECT_EQ(0u, h.GetPercentile(50));
+    for (KUINT64 i = 1; i <= 100; ++i)
+    {
+        h.Record(i * 10);
+    }
+    EXPECT_EQ(100u, h.GetCount());
+    EXPECT_EQ(10u, h.GetMin());
+    EXPECT_EQ(1000u, h.GetMax());
+    EXPECT_EQ(505u, h.GetMean());
+
+    // Percentiles are bucket upper bounds, capped to the largest duration.
+    EXPECT_EQ(511u, h.GetPercentile(50));
+    EXPECT_EQ(1000u, h.GetPercentile(99));
+
+    h.Reset();
+    EXPECT_EQ(0u, h.GetCount());
+}
@@ -81,6 +81,87 @@ TEST(PDU_EncodeDecode5, Entity_State_PDU)
     EXPECT_EQ(0, stream.GetBufferSize());
 }
 
+TEST(PDU_EncodeDecode5, Entity_State_PDU_InlineVariableParameters)
+{
+    using namespace DATA_TYPE;
+
+    Entity_State_PDU pduIn;
+    pduIn.AddArticulatedPart(ArticulatedPart(1, 2, 4096 + 11, 1.5f));
+    pduIn.AddAttachedPart(AttachedPart(1, 3, 896, EntityType(1, 2, 225, 4, 5, 6, 7)));
+    pduIn.AddVariableParameter(new ArticulatedPart(3, 4, 4096 + 12, -2.5f));
+    KDataStream stream = pduIn.Encode();
+    Entity_State_PDU pduOut(stream);
+    EXPECT_EQ(pduIn, pduOut);
+    EXPECT_EQ(0, stream.GetBufferSize());
+
+    const VariableParameterList & vpl = pduOut.GetVariableParameterList();
+    ASSERT_EQ(3, vpl.GetCount());
+    EXPECT_TRUE(vpl.IsInline(0));
+    EXPECT_EQ(ENUMS::AttachedPartType, vpl.GetType(1));
+
+    ArticulatedPart ap;
+    AttachedPart at;
+    EXPECT_FALSE(vpl.GetArticulatedPart(1, ap));
+    EXPECT_TRUE(vpl.GetArticulatedPart(2, ap));
+    EXPECT_EQ(4, ap.GetAttachementID());
+    EXPECT_EQ(-2.5f, ap.GetValue());
+    EXPECT_TRUE(vpl.GetAttachedPart(1, at));
+    EXPECT_EQ(3, at.GetPartAttachedToID());
+    EXPECT_EQ(EntityType(1, 2, 225, 4, 5, 6, 7), at.GetAttachedPartType());
+
+    // Parts can be replaced in place without leaving the inline storage.
+    pduOut.SetArticulatedPart(0, ArticulatedPart(1, 9, 4096 + 11, 3.5f));
+    EXPECT_TRUE(vpl.IsInline(0));
+    EXPECT_TRUE(vpl.GetArticulatedPart(0, ap));
+    EXPECT_EQ(9, ap.GetAttachementID());
+    EXPECT_EQ(3.5f, ap.GetValue());
+    EXPECT_THROW(pduOut.SetAttachedPart(3, at), KException);
+
+    // The object interface is a view onto the records, changes made through it are encoded.
+    const std::vector<VarPrmPtr> & vVP = pduOut.GetVariableParameters();
+    ASSERT_EQ(3, vVP.size());
+    EXPECT_EQ(&vVP, &pduOut.GetVariableParameters());
+    EXPECT_EQ(vVP[0].GetPtr(), pduOut.GetVariableParameters()[0].GetPtr());
+    EXPECT_EQ(ENUMS::AttachedPartType, vVP[1]->GetVariableParameterType());
+    static_cast<ArticulatedPart *>(vVP[0].GetPtr())->SetValue(4.5f);
+
+    KDataStream changed = pduOut.Encode();
+    Entity_State_PDU pduChanged(changed);
+    EXPECT_TRUE(pduChanged.GetVariableParameterList().GetArticulatedPart(0, ap));
+    EXPECT_EQ(4.5f, ap.GetValue());
+    EXPECT_EQ(9, ap.GetAttachementID());
+
+    // Setting a part held as an object updates the object.
+    pduOut.SetArticulatedPart(0, ArticulatedPart(1, 8, 4096 + 11, 5.5f));
+    EXPECT_EQ(5.5f, static_cast<ArticulatedPart *>(vVP[0].GetPtr())->GetValue());
+}
+
+#ifdef KDIS_USE_CPP11
+TEST(PDU_EncodeDecode5, Entity_State_PDU_MoveResetsSource)
+{
+    using namespace DATA_TYPE;
+
+    Entity_State_PDU pduIn;
+    pduIn.AddArticulatedPart(ArticulatedPart(1, 2, 4096 + 11, 1.5f));
+    pduIn.AddArticulatedPart(ArticulatedPart(1, 2, 4096 + 12, 2.5f));
+    const KUINT16 ui16Len = pduIn.GetPDULength();
+    const KUINT16 ui16MinLen = Entity_State_PDU::ENTITY_STATE_PDU_SIZE;
+
+    Entity_State_PDU pduMoved(std::move(pduIn));
+    EXPECT_EQ(ui16Len, pduMoved.GetPDULength());
+    EXPECT_EQ(2, pduMoved.GetNumberOfVariableParams());
+    EXPECT_EQ(ui16MinLen, pduIn.GetPDULength());
+    EXPECT_EQ(0, pduIn.GetNumberOfVariableParams());
+    EXPECT_EQ(ui16MinLen, pduIn.Encode().GetBufferSize());
+
+    Entity_State_PDU pduAssigned;
+    pduAssigned = std::move(pduMoved);
+    EXPECT_EQ(ui16Len, pduAssigned.GetPDULength());
+    EXPECT_EQ(ui16MinLen, pduMoved.GetPDULength());
+    EXPECT_EQ(ui16MinLen, pduMoved.Encode().GetBufferSize());
+}
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 // Logistics
 //////////////////////////////////////////////////////////////////////////
@@ -183,6 +264,43 @@ TEST(PDU_EncodeDecode5, Acknowledge_PDU)
     EXPECT_EQ(0, stream.GetBufferSize());
 }
 
+namespace
+{
+    // The acknowledgement is addressed back to the originator of the request.
+    template<class Request>
+    void ExpectAcknowledgeAnswers(Request & req, KDIS::DATA_TYPE::ENUMS::AcknowledgeFlag AF)
+    {
+        req.SetOriginatingEntityID(KDIS::DATA_TYPE::EntityIdentifier(1, 2, 3));
+        req.SetReceivingEntityID(KDIS::DATA_TYPE::EntityIdentifier(4, 5, 6));
+        req.SetRequestID(77);
+
+        Acknowledge_PDU pduIn(req, KDIS::DATA_TYPE::ENUMS::AbleToComply);
+        EXPECT_EQ(KDIS::DATA_TYPE::ENUMS::Acknowledge_PDU_Type, pduIn.GetPDUType());
+        EXPECT_EQ(req.GetReceivingEntityID(), pduIn.GetOriginatingEntityID());
+        EXPECT_EQ(req.GetOriginatingEntityID(), pduIn.GetReceivingEntityID());
+        EXPECT_EQ(AF, pduIn.GetAcknowledgeFlag());
+        EXPECT_EQ(KDIS::DATA_TYPE::ENUMS::AbleToComply, pduIn.GetAcknowledgeResponseFlag());
+        EXPECT_EQ(77u, pduIn.GetRequestID());
+
+        KDataStream stream = pduIn.Encode();
+        Acknowledge_PDU pduOut(stream);
+        EXPECT_EQ(pduIn, pduOut);
+        EXPECT_EQ(0, stream.GetBufferSize());
+    }
+}
+
+TEST(PDU_EncodeDecode5, Acknowledge_PDU_AnswersRequests)
+{
+    Create_Entity_PDU create;
+    ExpectAcknowledgeAnswers(create, KDIS::DATA_TYPE::ENUMS::CreateEntityPDU);
+    Remove_Entity_PDU remove;
+    ExpectAcknowledgeAnswers(remove, KDIS::DATA_TYPE::ENUMS::RemoveEntityPDU);
+    Start_Resume_PDU start;
+    ExpectAcknowledgeAnswers(start, KDIS::DATA_TYPE::ENUMS::Start_ResumePDU);
+    Stop_Freeze_PDU stop;
+    ExpectAcknowledgeAnswers(stop, KDIS::DATA_TYPE::ENUMS::Stop_FreezePDU);
+}
+
 TEST(PDU_EncodeDecode5, Action_Request_PDU)
 {
     Action_Request_PDU pduIn;
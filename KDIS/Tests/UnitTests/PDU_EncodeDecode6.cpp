@@ -33,6 +33,9 @@
 #include "KDIS/PDU/Simulation_Management_With_Reliability/Data_R_PDU.h"
 #include "KDIS/PDU/Simulation_Management_With_Reliability/Event_Report_R_PDU.h"
 #include "KDIS/PDU/Simulation_Management_With_Reliability/Record_Query_R_PDU.h"
+#include "KDIS/PDU/Simulation_Management_With_Reliability/Remove_Entity_R_PDU.h"
+#include "KDIS/PDU/Simulation_Management_With_Reliability/Start_Resume_R_PDU.h"
+#include "KDIS/PDU/Simulation_Management_With_Reliability/Stop_Freeze_R_PDU.h"
 #include "KDIS/PDU/Simulation_Management_With_Reliability/Record_R_PDU.h"
 #include "KDIS/PDU/Simulation_Management_With_Reliability/Remove_Entity_R_PDU.h"
 #include "KDIS/PDU/Simulation_Management_With_Reliability/Set_Data_R_PDU.h"
@@ -116,6 +119,24 @@ TEST(PDU_EncodeDecode5, Aggregate_State_PDU)
     EXPECT_EQ(0, stream.GetBufferSize());
 }
 
+#ifdef KDIS_USE_CPP11
+TEST(PDU_EncodeDecode6, Aggregate_State_PDU_MoveSetterAndMoveConstruct)
+{
+    std::vector<DATA_TYPE::EntityIdentifier> vEI(3);
+    Aggregate_State_PDU pduIn;
+    pduIn.SetEntityIDList(std::move(vEI));
+    EXPECT_EQ(3, pduIn.GetEntityIDList().size());
+
+    Aggregate_State_PDU pduMoved(std::move(pduIn));
+    EXPECT_EQ(3, pduMoved.GetEntityIDList().size());
+
+    KDataStream stream = pduMoved.Encode();
+    Aggregate_State_PDU pduOut(stream);
+    EXPECT_EQ(pduMoved, pduOut);
+    EXPECT_EQ(0, stream.GetBufferSize());
+}
+#endif
+
 TEST(PDU_EncodeDecode5, IsGroupOf_PDU)
 {
     IsGroupOf_PDU pduIn;
@@ -214,6 +235,42 @@ TEST(PDU_EncodeDecode6, Intercom_Signal_PDU)
     EXPECT_EQ(0, stream.GetBufferSize());
 }
 
+TEST(PDU_EncodeDecode6, Intercom_Signal_PDU_Audio)
+{
+    using namespace DATA_TYPE;
+
+    KINT16 samplesIn[37];
+    for (int i = 0; i < 37; ++i) samplesIn[i] = (KINT16)(i * 1000 - 18000);
+
+    Intercom_Signal_PDU pduIn;
+    pduIn.SetEncodingScheme(EncodingScheme(ENUMS::EncodedAudio, ENUMS::_16_bit_linear_PCM2sComplementBigEndian, ENUMS::OtherTDLType));
+    pduIn.SetAudio(samplesIn, 37);
+    EXPECT_EQ(37, pduIn.GetSamples());
+    EXPECT_EQ(37 * 16, pduIn.GetDataLength());
+    EXPECT_EQ(Signal_PDU::SIGNAL_PDU_SIZE + 76, pduIn.GetPDULength());
+
+    KDataStream stream = pduIn.Encode();
+    Intercom_Signal_PDU pduOut(stream);
+    EXPECT_EQ(pduIn, pduOut);
+
+    // Big endian on the wire.
+    KOCTET data[74];
+    pduOut.GetData(data, sizeof(data) * 8);
+    EXPECT_EQ((KOCTET)(samplesIn[0] >> 8), data[0]);
+
+    KINT16 samplesOut[37];
+    ASSERT_EQ(37, pduOut.GetAudio(samplesOut, 37));
+    EXPECT_EQ(0, memcmp(samplesIn, samplesOut, sizeof(samplesIn)));
+
+    KFLOAT32 floats[37];
+    ASSERT_EQ(37, pduOut.GetAudio(floats, 37));
+    EXPECT_EQ(samplesIn[36] / 32768.0f, floats[36]);
+
+    EXPECT_THROW(pduOut.GetAudio(samplesOut, 36), KException);
+    pduOut.SetEncodingScheme(EncodingScheme(ENUMS::RawBinaryData, 0, ENUMS::OtherTDLType));
+    EXPECT_THROW(pduOut.GetAudio(samplesOut, 37), KException);
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Simulation Management With Reliability
 //////////////////////////////////////////////////////////////////////////
@@ -227,6 +284,48 @@ TEST(PDU_EncodeDecode6, Acknowledge_R_PDU)
     EXPECT_EQ(0, stream.GetBufferSize());
 }
 
+namespace
+{
+    // An acknowledgement answers the request it was built from and survives encoding.
+    template<class Request>
+    void ExpectAcknowledgeRAnswers(Request & req, KDIS::DATA_TYPE::ENUMS::AcknowledgeFlag AF)
+    {
+        req.SetOriginatingEntityID(KDIS::DATA_TYPE::EntityIdentifier(1, 2, 3));
+        req.SetReceivingEntityID(KDIS::DATA_TYPE::EntityIdentifier(4, 5, 6));
+        req.SetRequestID(77);
+        const KUINT16 size = Acknowledge_R_PDU::ACKNOWLEDGE_R_PDU_SIZE;
+
+        Acknowledge_R_PDU pduIn(req, KDIS::DATA_TYPE::ENUMS::AbleToComply);
+        EXPECT_EQ(KDIS::DATA_TYPE::ENUMS::Acknowledge_R_PDU_Type, pduIn.GetPDUType());
+        EXPECT_EQ(KDIS::DATA_TYPE::ENUMS::SimulationManagementwithReliability, pduIn.GetProtocolFamily());
+        EXPECT_EQ(size, pduIn.GetPDULength());
+        EXPECT_EQ(req.GetReceivingEntityID(), pduIn.GetOriginatingEntityID());
+        EXPECT_EQ(req.GetOriginatingEntityID(), pduIn.GetReceivingEntityID());
+        EXPECT_EQ(AF, pduIn.GetAcknowledgeFlag());
+        EXPECT_EQ(77u, pduIn.GetRequestID());
+
+        KDataStream stream = pduIn.Encode();
+        EXPECT_EQ(size, stream.GetBufferSize());
+        Acknowledge_R_PDU pduOut(stream);
+        EXPECT_EQ(pduIn, pduOut);
+        EXPECT_EQ(0, stream.GetBufferSize());
+    }
+}
+
+TEST(PDU_EncodeDecode6, Acknowledge_R_PDU_AnswersRequests)
+{
+    Create_Entity_R_PDU create;
+    ExpectAcknowledgeRAnswers(create, KDIS::DATA_TYPE::ENUMS::CreateEntityPDU);
+    Remove_Entity_R_PDU remove;
+    ExpectAcknowledgeRAnswers(remove, KDIS::DATA_TYPE::ENUMS::RemoveEntityPDU);
+    Start_Resume_R_PDU start;
+    ExpectAcknowledgeRAnswers(start, KDIS::DATA_TYPE::ENUMS::Start_ResumePDU);
+    Stop_Freeze_R_PDU stop;
+    ExpectAcknowledgeRAnswers(stop, KDIS::DATA_TYPE::ENUMS::Stop_FreezePDU);
+    Transfer_Control_Request_PDU transfer;
+    ExpectAcknowledgeRAnswers(transfer, KDIS::DATA_TYPE::ENUMS::TransferControlRequest);
+}
+
 TEST(R_PDU_EncodeDecode6, Action_Request_R_PDU)
 {
     Action_Request_R_PDU pduIn;
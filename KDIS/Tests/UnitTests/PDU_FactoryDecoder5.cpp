@@ -49,7 +49,7 @@ TEST(PDU_FactoryDecoder5, Designator_PDU)
     Designator_PDU pduIn;
     KDataStream stream = pduIn.Encode();
     PDU_Factory factory;
-    std::auto_ptr<Header> pduOut = factory.Decode(stream);
+    PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Designator_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -59,7 +59,7 @@ TEST(PDU_FactoryDecoder5, Electromagnetic_Emission_PDU)
     Electromagnetic_Emission_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Electromagnetic_Emission_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -73,7 +73,7 @@ TEST(PDU_FactoryDecoder5, Collision_PDU)
     Collision_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Collision_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -83,11 +83,86 @@ TEST(PDU_FactoryDecoder5, Entity_State_PDU)
     Entity_State_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Entity_State_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
 
+TEST(PDU_FactoryDecoder5, Entity_State_PDU_TryDecode)
+{
+    Entity_State_PDU pduIn;
+    pduIn.AddArticulatedPart(DATA_TYPE::ArticulatedPart());
+    KDataStream stream = pduIn.Encode();
+    PDU_Factory factory;
+
+    PduUniquePtr pduOut;
+    EXPECT_EQ(NO_ERRORS, factory.TryDecode(stream, pduOut));
+    ASSERT_TRUE(pduOut.get() != 0);
+    EXPECT_EQ(pduIn, *(Entity_State_PDU*)pduOut.get());
+    EXPECT_EQ(0, stream.GetBufferSize());
+
+    // Truncated inside the variable parameters.
+    KDataStream encoded = pduIn.Encode();
+    KDataStream truncated((KOCTET*)encoded.GetBufferPtr(), encoded.GetBufferSize() - 1);
+    PduUniquePtr pduTruncated;
+    EXPECT_EQ(NOT_ENOUGH_DATA_IN_BUFFER, factory.TryDecode(truncated, pduTruncated));
+    EXPECT_TRUE(pduTruncated.get() == 0);
+
+    // A variable parameter count that disagrees with the data, caught before decoding.
+    KDataStream body((KOCTET*)encoded.GetBufferPtr() + Header::HEADER6_PDU_SIZE, encoded.GetBufferSize() - Header::HEADER6_PDU_SIZE);
+    std::vector<KOCTET> raw(body.GetBufferPtr(), body.GetBufferPtr() + body.GetBufferSize());
+    raw[19 - Header::HEADER6_PDU_SIZE] = 5;
+    KDataStream badCount(&raw[0], (KUINT16)raw.size());
+    Entity_State_PDU pduBad;
+    EXPECT_EQ(NOT_ENOUGH_DATA_IN_BUFFER, pduBad.TryDecode(badCount, true));
+    EXPECT_EQ(0, badCount.GetCurrentWritePosition());
+    EXPECT_THROW(pduBad.Decode(badCount, true), KException);
+}
+
+namespace
+{
+    struct ThrowingDecoder : public DATA_TYPE::FactoryDecoder<DATA_TYPE::VariableParameter>
+    {
+        virtual DATA_TYPE::VariableParameter * FactoryDecode(KINT32 EnumVal, KDataStream & stream)
+        {
+            throw KException(__FUNCTION__, INVALID_DATA);
+        }
+    };
+}
+
+TEST(PDU_FactoryDecoder5, Entity_State_PDU_TryDecodeCatchesFactoryDecoder)
+{
+    Entity_State_PDU pduIn;
+    pduIn.AddArticulatedPart(DATA_TYPE::ArticulatedPart());
+    KDataStream stream = pduIn.Encode();
+
+    // A custom record decoder that throws is reported as an error code.
+    DATA_TYPE::VariableParameter::RegisterFactoryDecoder(DATA_TYPE::ENUMS::ArticulatedPartType,
+                                                         DATA_TYPE::VariableParameter::FacDecPtr(new ThrowingDecoder));
+    Entity_State_PDU pduOut;
+    ErrorCodes e = NO_ERRORS;
+    EXPECT_NO_THROW(e = pduOut.TryDecode(stream));
+    EXPECT_EQ(INVALID_DATA, e);
+    DATA_TYPE::VariableParameter::ClearFactoryDecoders();
+}
+
+TEST(PDU_FactoryDecoder5, Collision_PDU_TryDecode)
+{
+    Collision_PDU pduIn;
+    KDataStream encoded = pduIn.Encode();
+    PDU_Factory factory;
+
+    KDataStream truncated((KOCTET*)encoded.GetBufferPtr(), encoded.GetBufferSize() - 4);
+    PduUniquePtr pduOut;
+    EXPECT_EQ(NOT_ENOUGH_DATA_IN_BUFFER, factory.TryDecode(truncated, pduOut));
+
+    KDataStream header((KOCTET*)encoded.GetBufferPtr(), 6);
+    EXPECT_EQ(NOT_ENOUGH_DATA_IN_BUFFER, factory.TryDecode(header, pduOut));
+
+    EXPECT_EQ(NO_ERRORS, factory.TryDecode(encoded, pduOut));
+    EXPECT_EQ(pduIn, *(Collision_PDU*)pduOut.get());
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Logistics
 //////////////////////////////////////////////////////////////////////////
@@ -97,7 +172,7 @@ TEST(PDU_FactoryDecoder5, Repair_Complete_PDU)
     Repair_Complete_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Repair_Complete_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -107,7 +182,7 @@ TEST(PDU_FactoryDecoder5, Repair_Response_PDU)
     Repair_Response_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Repair_Response_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -117,7 +192,7 @@ TEST(PDU_FactoryDecoder5, Resupply_Cancel_PDU)
     Resupply_Cancel_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Resupply_Cancel_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -127,7 +202,7 @@ TEST(PDU_FactoryDecoder5, Resupply_Offer_PDU)
     Resupply_Offer_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Resupply_Offer_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -137,7 +212,7 @@ TEST(PDU_FactoryDecoder5, Resupply_Received_PDU)
     Resupply_Received_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Resupply_Received_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -147,7 +222,7 @@ TEST(PDU_FactoryDecoder5, Service_Request_PDU)
     Service_Request_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Service_Request_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -161,7 +236,7 @@ TEST(PDU_FactoryDecoder5, Receiver_PDU)
     Receiver_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Receiver_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -171,17 +246,36 @@ TEST(PDU_FactoryDecoder5, Signal_PDU)
     Signal_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Signal_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
 
+TEST(PDU_FactoryDecoder5, Signal_PDU_TryDecode)
+{
+    Signal_PDU pduIn;
+    KOCTET data[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    pduIn.SetData(data, 64);
+    KDataStream encoded = pduIn.Encode();
+    PDU_Factory factory;
+
+    // The data is checked against its declared length before it is read.
+    KDataStream truncated((KOCTET*)encoded.GetBufferPtr(), encoded.GetBufferSize() - 4);
+    PduUniquePtr pduOut;
+    EXPECT_EQ(NOT_ENOUGH_DATA_IN_BUFFER, factory.TryDecode(truncated, pduOut));
+    EXPECT_TRUE(pduOut.get() == 0);
+
+    EXPECT_EQ(NO_ERRORS, factory.TryDecode(encoded, pduOut));
+    ASSERT_TRUE(pduOut.get() != 0);
+    EXPECT_EQ(pduIn, *(Signal_PDU*)pduOut.get());
+}
+
 TEST(PDU_FactoryDecoder5, Transmitter_PDU)
 {
     Transmitter_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Transmitter_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -195,7 +289,7 @@ TEST(PDU_FactoryDecoder5, Acknowledge_PDU)
     Acknowledge_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Acknowledge_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -205,7 +299,7 @@ TEST(PDU_FactoryDecoder5, Action_Request_PDU)
     Action_Request_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Action_Request_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -215,7 +309,7 @@ TEST(PDU_FactoryDecoder5, Action_Response_PDU)
     Action_Response_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Action_Response_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -225,7 +319,7 @@ TEST(PDU_FactoryDecoder5, Comment_PDU)
     Comment_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Comment_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -235,7 +329,7 @@ TEST(PDU_FactoryDecoder5, Create_Entity_PDU)
     Create_Entity_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Create_Entity_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -245,7 +339,7 @@ TEST(PDU_FactoryDecoder5, Data_PDU)
     Data_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Data_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -255,7 +349,7 @@ TEST(PDU_FactoryDecoder5, Data_Query_PDU)
     Data_Query_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Data_Query_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -265,7 +359,7 @@ TEST(PDU_FactoryDecoder5, Event_Report_PDU)
     Event_Report_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Event_Report_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -275,7 +369,7 @@ TEST(PDU_FactoryDecoder5, Remove_Entity_PDU)
     Remove_Entity_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Remove_Entity_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -285,7 +379,7 @@ TEST(PDU_FactoryDecoder5, Set_Data_PDU)
     Set_Data_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Set_Data_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -295,7 +389,7 @@ TEST(PDU_FactoryDecoder5, Start_Resume_PDU)
     Start_Resume_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Start_Resume_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -305,7 +399,7 @@ TEST(PDU_FactoryDecoder5, Stop_Freeze_PDU)
     Stop_Freeze_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Stop_Freeze_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -319,7 +413,7 @@ TEST(PDU_FactoryDecoder5, Detonation_PDU)
     Detonation_PDU pduIn;
     KDataStream stream = pduIn.Encode();
 	PDU_Factory factory;
-	std::auto_ptr<Header> pduOut = factory.Decode(stream);
+	PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Detonation_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
@@ -329,7 +423,7 @@ TEST(PDU_FactoryDecoder5, Fire_PDU)
     Fire_PDU pduIn;
     KDataStream stream = pduIn.Encode();
     PDU_Factory factory;
-    std::auto_ptr<Header> pduOut = factory.Decode(stream);
+    PduUniquePtr pduOut = factory.Decode(stream);
     EXPECT_EQ(pduIn, *(Fire_PDU*)pduOut.get());
     EXPECT_EQ(0, stream.GetBufferSize());
 }
\ No newline at end of file
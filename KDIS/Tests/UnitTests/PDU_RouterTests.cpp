@@ -0,0 +1,197 @@
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "KDIS/Network/Connection.h"
+#include "KDIS/Network/LoopbackTransport.h"
+#include "KDIS/Network/PDU_Router.h"
+#include "KDIS/PDU/Bundle.h"
+#include "KDIS/PDU/Entity_Info_Interaction/Entity_State_PDU.h"
+#include "KDIS/PDU/Entity_Info_Interaction/Collision_PDU.h"
+#include "KDIS/PDU/Warfare/Fire_PDU.h"
+#include "KDIS/PDU/Radio_Communications/Intercom_Control_PDU.h"
+#include "KDIS/PDU/Entity_Management/Transfer_Control_Request_PDU.h"
+#if DIS_VERSION > 6
+#include "KDIS/PDU/Information_Operations/IO_Action_PDU.h"
+#endif
+
+using namespace KDIS;
+using namespace PDU;
+using namespace NETWORK;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+
+// Loopback port used by the connection tests.
+static const KUINT32 TEST_PORT = 43000;
+
+TEST(PDU_RouterTests, FiltersAndRewritesInPlace)
+{
+    Connection out("127.0.0.1", TEST_PORT, false, true, 0, true);
+    out.SetTransport(new LoopbackTransport());
+
+    RouterFilterPDUType types;
+    types.AddType(Entity_State_PDU_Type);
+    types.AddType(Fire_PDU_Type);
+    RouterFilterSite sites;
+    sites.AddSite(1);
+    RouterRewriteExerciseID exercise(7);
+    RouterRewriteSiteApplication site(1, 2, 10, 20);
+
+    PDU_Router router(out.GetTransport());
+    router.AddRule(&types);
+    router.AddRule(&sites);
+    router.AddRule(&exercise);
+    router.AddRule(&site);
+
+    Bundle bundle;
+    Entity_State_PDU es;
+    es.SetExerciseID(1);
+    es.SetEntityIdentifier(EntityIdentifier(1, 2, 3));
+    bundle.AddPDU(PduPtr(new Entity_State_PDU(es)));
+    es.SetEntityIdentifier(EntityIdentifier(9, 2, 4)); // Wrong site.
+    bundle.AddPDU(PduPtr(new Entity_State_PDU(es)));
+    Fire_PDU fire;
+    fire.SetExerciseID(1);
+    fire.SetFiringEntityID(EntityIdentifier(1, 2, 5));
+    fire.SetTargetEntityID(EntityIdentifier(1, 3, 6));
+    bundle.AddPDU(PduPtr(new Fire_PDU(fire)));
+    Collision_PDU collision; // Wrong type.
+    collision.SetIssuingEntityID(EntityIdentifier(1, 2, 7));
+    bundle.AddPDU(PduPtr(new Collision_PDU(collision)));
+
+    KDataStream stream;
+    bundle.Encode(stream);
+    EXPECT_EQ(2u, router.Route(stream.GetBufferPtr(), stream.GetBufferSize()));
+    EXPECT_EQ(2u, router.GetDroppedCount());
+    EXPECT_EQ(1u, router.GetPendingCount());
+    router.Flush();
+    EXPECT_EQ(0u, router.GetPendingCount());
+
+    PduUniquePtr p1 = out.GetNextPDU();
+    ASSERT_TRUE(p1.get() != 0);
+    ASSERT_EQ(Entity_State_PDU_Type, p1->GetPDUType());
+    EXPECT_EQ(7, p1->GetExerciseID());
+    const EntityIdentifier & id = static_cast<Entity_State_PDU *>(p1.get())->GetEntityIdentifier();
+    EXPECT_EQ(10, id.GetSiteID());
+    EXPECT_EQ(20, id.GetApplicationID());
+    EXPECT_EQ(3, id.GetEntityID());
+
+    PduUniquePtr p2 = out.GetNextPDU();
+    ASSERT_TRUE(p2.get() != 0);
+    ASSERT_EQ(Fire_PDU_Type, p2->GetPDUType());
+    const Fire_PDU * f = static_cast<Fire_PDU *>(p2.get());
+    EXPECT_EQ(10, f->GetFiringEntityID().GetSiteID());
+    EXPECT_EQ(20, f->GetFiringEntityID().GetApplicationID());
+    // Only identifiers with the site and application are changed.
+    EXPECT_EQ(1, f->GetTargetEntityID().GetSiteID());
+    EXPECT_EQ(3, f->GetTargetEntityID().GetApplicationID());
+
+    EXPECT_TRUE(out.GetNextPDU().get() == 0);
+}
+
+TEST(PDU_RouterTests, RewritesIntercomControlIdentifiers)
+{
+    Intercom_Control_PDU pdu;
+    pdu.SetSourceEntityID(EntityIdentifier(1, 2, 3));
+    pdu.SetMasterEntityID(EntityIdentifier(1, 2, 4));
+    KDataStream stream = pdu.Encode();
+    std::vector<KOCTET> data(stream.GetBufferPtr(), stream.GetBufferPtr() + stream.GetBufferSize());
+
+    RouterRewriteSiteApplication site(1, 2, 10, 20);
+    EXPECT_TRUE(site.Apply(&data[0], data.size()));
+
+    KDataStream rewritten(&data[0], data.size());
+    Intercom_Control_PDU out(rewritten);
+    EXPECT_EQ(10, out.GetSourceEntityID().GetSiteID());
+    EXPECT_EQ(20, out.GetSourceEntityID().GetApplicationID());
+    EXPECT_EQ(3, out.GetSourceEntityID().GetEntityID());
+    EXPECT_EQ(10, out.GetMasterEntityID().GetSiteID());
+    EXPECT_EQ(20, out.GetMasterEntityID().GetApplicationID());
+}
+
+TEST(PDU_RouterTests, RewritesEveryEntityOfTransferControlAndIOAction)
+{
+    RouterRewriteSiteApplication site(1, 2, 10, 20);
+
+    Transfer_Control_Request_PDU transfer;
+    transfer.SetOriginatingEntityID(EntityIdentifier(1, 2, 3));
+    transfer.SetReceivingEntityID(EntityIdentifier(1, 2, 4));
+    transfer.SetTransferEntityID(EntityIdentifier(1, 2, 5));
+    KDataStream stream = transfer.Encode();
+    std::vector<KOCTET> data(stream.GetBufferPtr(), stream.GetBufferPtr() + stream.GetBufferSize());
+    EXPECT_TRUE(site.Apply(&data[0], data.size()));
+
+    KDataStream rewritten(&data[0], data.size());
+    Transfer_Control_Request_PDU transferOut(rewritten);
+    EXPECT_EQ(EntityIdentifier(10, 20, 3), transferOut.GetOriginatingEntityID());
+    EXPECT_EQ(EntityIdentifier(10, 20, 4), transferOut.GetReceivingEntityID());
+    EXPECT_EQ(EntityIdentifier(10, 20, 5), transferOut.GetTransferEntityID());
+
+#if DIS_VERSION > 6
+    IO_Action_PDU action;
+    action.SetOriginatingEntityID(EntityIdentifier(1, 2, 3));
+    action.SetReceivingEntityID(EntityIdentifier(1, 2, 4));
+    action.SetAttackerEntityID(EntityIdentifier(1, 2, 5));
+    action.SetPrimaryTargetEntityID(EntityIdentifier(1, 2, 6));
+    stream = action.Encode();
+    data.assign(stream.GetBufferPtr(), stream.GetBufferPtr() + stream.GetBufferSize());
+    EXPECT_TRUE(site.Apply(&data[0], data.size()));
+
+    KDataStream rewrittenAction(&data[0], data.size());
+    IO_Action_PDU actionOut(rewrittenAction);
+    EXPECT_EQ(EntityIdentifier(10, 20, 3), actionOut.GetOriginatingEntityID());
+    EXPECT_EQ(EntityIdentifier(10, 20, 4), actionOut.GetReceivingEntityID());
+    EXPECT_EQ(EntityIdentifier(10, 20, 5), actionOut.GetAttackerEntityID());
+    EXPECT_EQ(EntityIdentifier(10, 20, 6), actionOut.GetPrimaryTargetEntityID());
+
+    // Identifiers past the end of a truncated PDU are left alone.
+    data.assign(stream.GetBufferPtr(), stream.GetBufferPtr() + stream.GetBufferSize());
+    EXPECT_TRUE(site.Apply(&data[0], 44));
+    EXPECT_EQ(10, data[41]);
+    EXPECT_EQ(1, data[47]);
+#endif
+}
+
+TEST(PDU_RouterTests, RebundlesInBatches)
+{
+    const KUINT16 size = Entity_State_PDU::ENTITY_STATE_PDU_SIZE;
+    LoopbackTransport output;
+
+    // Room for two entity states per datagram and two datagrams per batch.
+    PDU_Router router(&output, 2 * size, 2);
+
+    Entity_State_PDU es;
+    KDataStream stream;
+    for (int i = 0; i < 5; ++i)
+    {
+        es.Encode(stream);
+    }
+
+    EXPECT_EQ(5u, router.Route(stream.GetBufferPtr(), stream.GetBufferSize()));
+    // The first two datagrams were sent as a batch, the third is still being built.
+    EXPECT_EQ(2u, output.GetQueuedCount());
+    EXPECT_EQ(1u, router.GetPendingCount());
+    router.Flush();
+
+    KOCTET buffer[MAX_PDU_SIZE];
+    sockaddr_in sender;
+    const KINT32 expected[] = { 2 * size, 2 * size, size };
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(expected[i], output.Receive(buffer, sizeof(buffer), sender, 0));
+    }
+
+    // A length running past the end of the datagram stops the walk.
+    EXPECT_EQ(1u, router.Route(stream.GetBufferPtr(), size + 100));
+    EXPECT_EQ(1u, router.GetMalformedCount());
+    router.Flush();
+    EXPECT_EQ(size, output.Receive(buffer, sizeof(buffer), sender, 0));
+
+    // Single PDU datagrams from the input are bundled together.
+    LoopbackTransport input;
+    input.Send(stream.GetBufferPtr(), size);
+    input.Send(stream.GetBufferPtr(), size);
+    EXPECT_EQ(2u, router.Pump(input, 0));
+    EXPECT_EQ(2 * size, output.Receive(buffer, sizeof(buffer), sender, 0));
+    EXPECT_EQ(0, output.Receive(buffer, sizeof(buffer), sender, 0));
+    EXPECT_EQ(8u, router.GetForwardedCount());
+}
@@ -0,0 +1,137 @@
+#include <iostream>
+#include "gtest/gtest.h"
+
+#include "KDIS/PDU/Entity_Info_Interaction/Entity_State_PDU.h"
+#include "KDIS/PDU/Entity_Info_Interaction/Entity_State_View.h"
+#include "KDIS/PDU/Warfare/Fire_PDU.h"
+#include "KDIS/PDU/Warfare/Fire_View.h"
+#include "KDIS/PDU/Warfare/Detonation_PDU.h"
+#include "KDIS/PDU/Warfare/Detonation_View.h"
+#include "KDIS/PDU/Radio_Communications/Signal_PDU.h"
+#include "KDIS/PDU/Radio_Communications/Signal_View.h"
+
+using namespace KDIS;
+using namespace PDU;
+using namespace DATA_TYPE;
+
+TEST(PDU_ViewTests, Entity_State_View_MatchesDecodedPDU)
+{
+    Entity_State_PDU pdu;
+    pdu.SetExerciseID(3);
+    pdu.SetEntityIdentifier(EntityIdentifier(1, 2, 3));
+    pdu.SetEntityType(EntityType(1, 2, 225, 4, 5, 6, 7));
+    pdu.SetEntityLocation(WorldCoordinates(1.5, -2.5, 6378137.0));
+    pdu.SetEntityOrientation(EulerAngles(0.5f, 0.25f, -0.125f));
+    pdu.SetEntityMarking(EntityMarking(ENUMS::ASCII, "KDIS"));
+    pdu.AddArticulatedPart(ArticulatedPart(1, 2, 4096 + 11, 1.5f));
+    KDataStream stream = pdu.Encode();
+
+    Entity_State_View view(stream);
+    EXPECT_EQ(ENUMS::Entity_State_PDU_Type, view.GetPDUType());
+    EXPECT_EQ(3, view.GetExerciseID());
+    EXPECT_EQ(pdu.GetPDULength(), view.GetPDULength());
+    EXPECT_EQ(pdu.GetEntityIdentifier(), view.GetEntityIdentifier());
+    EXPECT_EQ(pdu.GetEntityType(), view.GetEntityType());
+    EXPECT_EQ(pdu.GetEntityLocation(), view.GetEntityLocation());
+    EXPECT_EQ(pdu.GetEntityOrientation(), view.GetEntityOrientation());
+    EXPECT_EQ(pdu.GetEntityMarking(), view.GetEntityMarking());
+    EXPECT_EQ(pdu.GetDeadReckoningParameter().GetDeadReckoningAlgorithm(), view.GetDeadReckoningAlgorithm());
+
+    ASSERT_EQ(1, view.GetNumberOfVariableParams());
+    ArticulatedPart ap;
+    EXPECT_TRUE(view.GetArticulatedPart(0, ap));
+    EXPECT_EQ(1.5f, ap.GetValue());
+    EXPECT_THROW(view.GetArticulatedPart(1, ap), KException);
+}
+
+TEST(PDU_ViewTests, Warfare_Views_MatchDecodedPDU)
+{
+    Fire_PDU fire;
+    fire.SetTargetEntityID(EntityIdentifier(4, 5, 6));
+    fire.SetLocation(WorldCoordinates(10, 20, 30));
+    fire.SetRange(1000.0f);
+    KDataStream fireStream = fire.Encode();
+
+    Fire_View fireView(fireStream);
+    EXPECT_EQ(fire.GetTargetEntityID(), fireView.GetTargetEntityID());
+    EXPECT_EQ(fire.GetLocation(), fireView.GetLocation());
+    EXPECT_EQ(1000.0f, fireView.GetRange());
+
+    Detonation_PDU det;
+    det.SetTargetEntityID(EntityIdentifier(7, 8, 9));
+    det.SetLocationInWorldCoords(WorldCoordinates(1, 2, 3));
+    KDataStream detStream = det.Encode();
+
+    Detonation_View detView(detStream.GetBufferPtr(), detStream.GetBufferSize());
+    EXPECT_EQ(det.GetTargetEntityID(), detView.GetTargetEntityID());
+    EXPECT_EQ(det.GetLocationInWorldCoords(), detView.GetLocationInWorldCoords());
+    EXPECT_EQ(0, detView.GetNumberOfVariableParams());
+
+    // Wrong type or truncated buffers are rejected.
+    EXPECT_THROW(Fire_View badType(detStream), KException);
+    EXPECT_THROW(Detonation_View tooShort(detStream.GetBufferPtr(), 50), KException);
+}
+
+TEST(PDU_ViewTests, Signal_View_PointsAtSignalData)
+{
+    const KOCTET samples[6] = { 1, 2, 3, 4, 5, 6 };
+    Signal_PDU pdu(EntityIdentifier(1, 2, 3), 4, EncodingScheme(ENUMS::EncodedAudio, ENUMS::_16_bit_linear_PCM2sComplementBigEndian, ENUMS::OtherTDLType),
+                   8000, 3, samples, 6 * 8);
+    KDataStream stream = pdu.Encode();
+
+    Signal_View view(stream.GetBufferPtr(), stream.GetBufferSize());
+    EXPECT_EQ(pdu.GetEntityID(), view.GetEntityID());
+    EXPECT_EQ(4, view.GetRadioID());
+    EXPECT_EQ(pdu.GetEncodingScheme(), view.GetEncodingScheme());
+    EXPECT_EQ(ENUMS::_16_bit_linear_PCM2sComplementBigEndian, view.GetEncodingType());
+    EXPECT_EQ(8000, view.GetSampleRate());
+    EXPECT_EQ(3, view.GetSamples());
+    EXPECT_EQ(6 * 8, view.GetDataLength());
+
+    // The data is not copied.
+    ASSERT_EQ(6, view.GetSignalDataSize());
+    EXPECT_EQ(stream.GetBufferPtr() + Signal_View::SIGNAL_VIEW_SIZE, view.GetSignalData());
+    EXPECT_EQ(0, memcmp(samples, view.GetSignalData(), 6));
+
+    KINT16 audio[3];
+    ASSERT_EQ(3, view.GetAudio(audio, 3));
+    EXPECT_EQ(0x0102, audio[0]);
+    EXPECT_EQ(0x0506, audio[2]);
+
+    // A data length past the end of the buffer is rejected.
+    Signal_View tooShort(stream.GetBufferPtr(), Signal_View::SIGNAL_VIEW_SIZE + 4);
+    EXPECT_THROW(tooShort.GetSignalData(), KException);
+    EXPECT_THROW(Signal_View badType(stream.GetBufferPtr(), 20), KException);
+}
+
+TEST(PDU_ViewTests, View_IsLimitedToThePDULength)
+{
+    const KOCTET samples[4] = { 1, 2, 3, 4 };
+    Signal_PDU pdu(EntityIdentifier(1, 2, 3), 4, EncodingScheme(ENUMS::EncodedAudio, ENUMS::_8_bit_mu_law, ENUMS::OtherTDLType),
+                   8000, 4, samples, 4 * 8);
+    KDataStream stream = pdu.Encode();
+    const KUINT16 ui16PDULen = stream.GetBufferSize();
+    pdu.Encode(stream);
+
+    // Two PDUs back to back, the view only covers the first.
+    Signal_View view(stream);
+    EXPECT_EQ(ui16PDULen, view.GetSize());
+    EXPECT_EQ(4, view.GetSignalDataSize());
+
+    // Claim more signal data than the PDU holds, the second PDU must not be read.
+    std::vector<KOCTET> buffer(stream.GetBufferPtr(), stream.GetBufferPtr() + stream.GetBufferSize());
+    buffer[28] = 0;
+    buffer[29] = 16 * 8;
+    Signal_View tooLong(&buffer[0], buffer.size());
+    EXPECT_EQ(ui16PDULen, tooLong.GetSize());
+    EXPECT_THROW(tooLong.GetSignalDataSize(), KException);
+
+    // A PDU length smaller than the header is rejected.
+    buffer[8] = 0;
+    buffer[9] = 0;
+    EXPECT_THROW(Signal_View bad(&buffer[0], buffer.size()), KException);
+
+    // An empty stream has no buffer at all.
+    KDataStream empty;
+    EXPECT_THROW(PDU_View view(empty), KException);
+}
@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "KDIS/Network/RadioAudioReceiver.h"
+#include "KDIS/Network/SocketUtils.h"
+#include "KDIS/Extras/AudioJitterBuffer.h"
+#include "KDIS/PDU/Entity_Info_Interaction/Entity_State_PDU.h"
+#include "KDIS/PDU/Radio_Communications/Signal_PDU.h"
+
+using namespace KDIS;
+using namespace PDU;
+using namespace UTILS;
+using namespace NETWORK;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+
+namespace
+{
+    const KUINT64 MS = 1000000;
+
+    struct AudioFrames : public RadioAudioHandler
+    {
+        std::vector<std::pair<KUINT16, KOCTET> > Frames; // Radio ID and first octet.
+        virtual void OnAudioFrame(const EntityIdentifier &, KUINT16 RadioID, KUINT16 EncodingType,
+                                  KUINT32, const KOCTET * Frame, KUINT32 Size)
+        {
+            EXPECT_EQ(_16_bit_linear_PCM2sComplementBigEndian, EncodingType);
+            EXPECT_EQ(320u, Size);
+            Frames.push_back(std::make_pair(RadioID, Frame[0]));
+        }
+    };
+}
+
+TEST(RadioAudioReceiverTests, SeparatesTransmitters)
+{
+    RadioAudioReceiver receiver(2, 1024, 160, 0);
+    receiver.SetConsumeSignals(true);
+
+    const EncodingScheme pcm(EncodedAudio, _16_bit_linear_PCM2sComplementBigEndian, OtherTDLType);
+    std::vector<KOCTET> samples(320);
+    KDataStream stream;
+    for (KUINT16 radio = 1; radio <= 3; ++radio)
+    {
+        std::fill(samples.begin(), samples.end(), (KOCTET)radio);
+        Signal_PDU(EntityIdentifier(1, 2, 3), radio, pcm, 8000, 160, &samples[0], 320 * 8).Encode(stream);
+    }
+    Signal_PDU(EntityIdentifier(1, 2, 3), 4, EncodingScheme(RawBinaryData, 0, OtherTDLType), 0, 0, &samples[0], 64).Encode(stream);
+
+    // Only signals, the third transmitter finds no free stream.
+    sockaddr_in sender;
+    memset(&sender, 0, sizeof(sender));
+    EXPECT_FALSE(receiver.OnDataReceived(stream.GetBufferPtr(), stream.GetBufferSize(), sender, 0));
+    EXPECT_EQ(4u, receiver.GetSignalCount());
+    EXPECT_EQ(2u, receiver.GetStreamCount());
+    EXPECT_EQ(1u, receiver.GetNoStreamCount());
+    EXPECT_EQ(1u, receiver.GetIgnoredCount());
+
+    Entity_State_PDU es;
+    es.Encode(stream);
+    EXPECT_TRUE(receiver.OnDataReceived(stream.GetBufferPtr(), stream.GetBufferSize(), sender, 0));
+
+    AudioFrames frames;
+    EXPECT_EQ(2u, receiver.ReadFrames(frames));
+    ASSERT_EQ(2u, frames.Frames.size());
+    EXPECT_EQ(1, frames.Frames[0].first);
+    EXPECT_EQ(1, frames.Frames[0].second);
+    EXPECT_EQ(2, frames.Frames[1].first);
+    EXPECT_EQ(2, frames.Frames[1].second);
+
+    const AudioJitterBuffer * buffer = receiver.GetJitterBuffer(EntityIdentifier(1, 2, 3), 1);
+    ASSERT_TRUE(buffer != 0);
+    EXPECT_EQ(2u, buffer->GetBlockCount());
+    EXPECT_TRUE(receiver.GetJitterBuffer(EntityIdentifier(1, 2, 3), 3) == 0);
+
+    EXPECT_EQ(2u, receiver.RemoveIdleStreams(0));
+    EXPECT_EQ(0u, receiver.GetStreamCount());
+}
+
+TEST(RadioAudioReceiverTests, IdlesByArrivalTime)
+{
+    RadioAudioReceiver receiver(2, 1024, 160, 0);
+    const EncodingScheme pcm(EncodedAudio, _16_bit_linear_PCM2sComplementBigEndian, OtherTDLType);
+    std::vector<KOCTET> samples(320);
+    KDataStream stream;
+    Signal_PDU(EntityIdentifier(1, 2, 3), 1, pcm, 8000, 160, &samples[0], 320 * 8).Encode(stream);
+
+    // Heard a minute ago by the arrival time.
+    sockaddr_in sender;
+    memset(&sender, 0, sizeof(sender));
+    receiver.OnDataReceived(stream.GetBufferPtr(), stream.GetBufferSize(), sender, GetWallTime() - 60000 * MS);
+    EXPECT_EQ(1u, receiver.GetStreamCount());
+    EXPECT_EQ(0u, receiver.RemoveIdleStreams(120000 * MS));
+    EXPECT_EQ(1u, receiver.RemoveIdleStreams(30000 * MS));
+}
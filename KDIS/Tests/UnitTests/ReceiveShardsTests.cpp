@@ -0,0 +1,155 @@
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "KDIS/Network/Connection.h"
+#include "KDIS/Network/ReceiveShards.h"
+#include "KDIS/PDU/Entity_Info_Interaction/Entity_State_PDU.h"
+#include "KDIS/PDU/Entity_Info_Interaction/Collision_PDU.h"
+
+using namespace KDIS;
+using namespace PDU;
+using namespace UTILS;
+using namespace NETWORK;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+
+// Loopback port used by the connection tests.
+static const KUINT32 TEST_PORT = 43000;
+
+namespace
+{
+    KUINT16 LastEntityID = 0;
+
+    void OnEntityState(const Entity_State_PDU & pdu)
+    {
+        LastEntityID = pdu.GetEntityIdentifier().GetEntityID();
+    }
+}
+
+TEST(ReceiveShardsTests, MergeIntoGetNextPDU)
+{
+    Connection conn("127.0.0.1", TEST_PORT);
+    conn.SetBlockingTimeOut(1, 0);
+
+    std::vector<KINT32> cpus(1, 0);
+    conn.SetReceiveShards(2, cpus);
+    EXPECT_EQ(2, conn.GetReceiveShardCount());
+
+    Entity_State_PDU pdu;
+    for (KUINT16 i = 1; i <= 3; ++i)
+    {
+        pdu.SetEntityIdentifier(EntityIdentifier(1, 2, i));
+        conn.SendPDU(&pdu);
+    }
+
+    // A sender always lands on the same shard so its PDU keep their order.
+    for (KUINT16 i = 1; i <= 3; ++i)
+    {
+        PduUniquePtr p = conn.GetNextPDU();
+        ASSERT_TRUE(p.get() != 0);
+        EXPECT_EQ(i, static_cast<Entity_State_PDU *>(p.get())->GetEntityIdentifier().GetEntityID());
+    }
+
+    // Back to the connection's own socket.
+    conn.SetReceiveShards(0);
+    EXPECT_EQ(0, conn.GetReceiveShardCount());
+    conn.SendPDU(&pdu);
+    EXPECT_TRUE(conn.GetNextPDU().get() != 0);
+}
+
+TEST(ReceiveShardsTests, FollowHandlersAndRejectBadLengths)
+{
+    Connection conn("127.0.0.1", TEST_PORT);
+    conn.SetBlockingTimeOut(1, 0);
+    conn.SetDecodeHandledOnly(true);
+    conn.SetReceiveShards(2);
+
+    // A handler added after the shards started must reach their factories.
+    conn.AddPDUHandler(Entity_State_PDU_Type, &OnEntityState);
+    Entity_State_PDU es;
+    es.SetEntityIdentifier(EntityIdentifier(1, 2, 7));
+    conn.SendPDU(&es);
+    PduUniquePtr p;
+    EXPECT_EQ(NO_ERRORS, conn.TryGetNextPDU(p));
+    ASSERT_TRUE(p.get() != 0);
+    EXPECT_EQ(7, LastEntityID);
+
+    // A zero PDU length is reported, for a skipped and a decoded type.
+    Collision_PDU collision;
+    KDataStream streams[2] = { collision.Encode(), es.Encode() };
+    for (int i = 0; i < 2; ++i)
+    {
+        std::vector<KOCTET> buffer(streams[i].GetBufferPtr(), streams[i].GetBufferPtr() + streams[i].GetBufferSize());
+        buffer[8] = 0;
+        buffer[9] = 0;
+        conn.Send(&buffer[0], buffer.size());
+        EXPECT_EQ(INVALID_DATA, conn.TryGetNextPDU(p));
+        EXPECT_TRUE(p.get() == 0);
+    }
+}
+
+TEST(ReceiveShardsTests, QueueIsBounded)
+{
+    ReceiveShards shards(TEST_PORT, 1, std::vector<KINT32>());
+    shards.SetMaxReady(0);
+    EXPECT_EQ(1u, shards.GetMaxReady());
+
+    PDU_Factory mask;
+    mask.SetDecodeEnabled(false);
+    mask.SetDecodeEnabled(Entity_State_PDU_Type, true);
+    shards.CopyDecodeEnabled(mask);
+    Collision_PDU collision;
+    Entity_State_PDU es;
+    EXPECT_TRUE(shards.GetPDU_Factory(0)->IsDecodeEnabled(es));
+    EXPECT_FALSE(shards.GetPDU_Factory(0)->IsDecodeEnabled(collision));
+
+    shards.Start();
+    Connection sender("127.0.0.1", TEST_PORT, false, true, 0, true);
+    for (KUINT16 i = 1; i <= 3; ++i)
+    {
+        es.SetEntityIdentifier(EntityIdentifier(1, 2, i));
+        sender.SendPDU(&es);
+    }
+
+    // The shard waits for room so nothing is lost.
+    timeval tval = { 1, 0 };
+    for (KUINT16 i = 1; i <= 3; ++i)
+    {
+        ReceiveShards::Datagram * D = shards.Pop(tval);
+        ASSERT_TRUE(D != 0);
+        ASSERT_EQ(1u, D->m_vpPDU.size());
+        EXPECT_EQ(i, static_cast<Entity_State_PDU *>(D->m_vpPDU[0])->GetEntityIdentifier().GetEntityID());
+        shards.Recycle(D);
+    }
+}
+
+TEST(ReceiveShardsTests, DeliverGroupTrafficOnce)
+{
+    ReceiveShards shards(TEST_PORT, 4, std::vector<KINT32>());
+    shards.AddMulticastAddress("239.1.2.3");
+    shards.Start();
+
+    // Every shard socket gets a copy of multicast and broadcast datagrams, only one may keep it.
+    const char * addresses[] = { "239.1.2.3", "127.255.255.255", "127.0.0.1" };
+    for (int a = 0; a < 3; ++a)
+    {
+        Connection sender(addresses[a], TEST_PORT, a == 0, true, 0, true);
+        Entity_State_PDU es;
+        for (KUINT16 i = 1; i <= 3; ++i)
+        {
+            es.SetEntityIdentifier(EntityIdentifier(1, 2, i));
+            sender.SendPDU(&es);
+        }
+
+        timeval tval = { 1, 0 };
+        int received = 0;
+        while (ReceiveShards::Datagram * D = shards.Pop(tval))
+        {
+            ++received;
+            shards.Recycle(D);
+            tval.tv_sec = 0;
+            tval.tv_usec = 300000;
+        }
+        EXPECT_EQ(3, received) << addresses[a];
+    }
+}
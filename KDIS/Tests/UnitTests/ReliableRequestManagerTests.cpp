@@ -0,0 +1,173 @@
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "KDIS/Network/Connection.h"
+#include "KDIS/Network/LoopbackTransport.h"
+#include "KDIS/Network/ReliableRequestManager.h"
+#include "KDIS/PDU/Simulation_Management/Action_Request_PDU.h"
+#include "KDIS/PDU/Simulation_Management/Data_PDU.h"
+#include "KDIS/PDU/Simulation_Management/Data_Query_PDU.h"
+#include "KDIS/PDU/Simulation_Management_With_Reliability/Acknowledge_R_PDU.h"
+#include "KDIS/PDU/Simulation_Management_With_Reliability/Action_Request_R_PDU.h"
+#include "KDIS/PDU/Simulation_Management_With_Reliability/Action_Response_R_PDU.h"
+#include "KDIS/PDU/Simulation_Management_With_Reliability/Create_Entity_R_PDU.h"
+#include "KDIS/Extras/PDU_Statistics.h"
+
+using namespace KDIS;
+using namespace PDU;
+using namespace UTILS;
+using namespace NETWORK;
+using namespace DATA_TYPE;
+using namespace ENUMS;
+
+// Loopback port used by the connection tests.
+static const KUINT32 TEST_PORT = 43000;
+
+namespace
+{
+    struct RequestResults : public ReliableRequestHandler
+    {
+        std::vector<std::pair<KUINT32, Result> > Results;
+        int Updates;
+        RequestResults() : Updates(0) {}
+        virtual void OnRequestUpdate(KUINT32, const Header &) { ++Updates; }
+        virtual void OnRequestComplete(KUINT32 ID, Result R, const Header * Response)
+        {
+            EXPECT_EQ(R == Responded, Response != 0);
+            Results.push_back(std::make_pair(ID, R));
+        }
+    };
+
+    const KUINT64 MS = 1000000;
+}
+
+TEST(ReliableRequestManagerTests, RetransmitsUntilAcknowledged)
+{
+    Connection conn("127.0.0.1", TEST_PORT, false, true, 0, true);
+    conn.SetTransport(new LoopbackTransport());
+    ReliableRequestManager manager(conn);
+    conn.AddSubscriber(&manager);
+    RequestResults results;
+
+    const KUINT64 start = PDU_Statistics::GetTime();
+    Create_Entity_R_PDU create(EntityIdentifier(1, 2, 0), EntityIdentifier(1, 3, 0), 0, Acknowledged);
+    const KUINT32 id = manager.Send(create, &results, 100, 1);
+    EXPECT_TRUE(manager.IsPending(id));
+
+    PduUniquePtr sent = conn.GetNextPDU();
+    ASSERT_TRUE(sent.get() != 0);
+    ASSERT_EQ(CreateEntity_R_PDU_Type, sent->GetPDUType());
+    EXPECT_EQ(id, static_cast<Create_Entity_R_PDU *>(sent.get())->GetRequestID());
+
+    // Nothing has answered so the request is sent again once the timeout passes.
+    EXPECT_EQ(0u, manager.Process(start + 50 * MS));
+    EXPECT_EQ(1u, manager.Process(start + 150 * MS));
+    EXPECT_EQ(1u, manager.GetRetransmissionCount());
+    EXPECT_TRUE(conn.GetNextPDU().get() != 0);
+
+    // The receiver acknowledges, the manager sees it as the connection decodes it.
+    Acknowledge_R_PDU ack(static_cast<const Create_Entity_R_PDU &>(*sent), AbleToComply);
+    conn.SendPDU(&ack);
+    EXPECT_TRUE(conn.GetNextPDU().get() != 0);
+    ASSERT_EQ(1u, results.Results.size());
+    EXPECT_EQ(id, results.Results[0].first);
+    EXPECT_EQ(ReliableRequestHandler::Responded, results.Results[0].second);
+    EXPECT_FALSE(manager.IsPending(id));
+
+    // The acknowledgement of the second copy matches nothing.
+    conn.SendPDU(&ack);
+    EXPECT_TRUE(conn.GetNextPDU().get() != 0);
+    EXPECT_EQ(1u, manager.GetUnmatchedCount());
+    EXPECT_EQ(1u, results.Results.size());
+}
+
+TEST(ReliableRequestManagerTests, TracksThousandsOfRequests)
+{
+    Connection conn("127.0.0.1", TEST_PORT, false, true, 0, true);
+    conn.SetTransport(new LoopbackTransport(1));
+    ReliableRequestManager manager(conn);
+    RequestResults results;
+
+    const KUINT32 count = 5000;
+    const EntityIdentifier self(1, 2, 0), peer(1, 3, 0);
+    const KUINT64 start = PDU_Statistics::GetTime();
+    std::vector<KUINT32> ids;
+    for (KUINT32 i = 0; i < count; ++i)
+    {
+        Action_Request_R_PDU request(self, peer, 0, i, Acknowledged);
+        ids.push_back(manager.Send(request, &results, 100, 0));
+    }
+    EXPECT_EQ(count, manager.GetPendingCount());
+
+    // Unacknowledged requests are not tracked.
+    Action_Request_R_PDU unacknowledged(self, peer, 0, 0, Unacknowledged);
+    EXPECT_FALSE(manager.IsPending(manager.Send(unacknowledged, &results)));
+
+    // Answer every other request, a response for another entity does not match.
+    for (KUINT32 i = 0; i < count; i += 2)
+    {
+        Action_Request_R_PDU request(self, peer, ids[i], i, Acknowledged);
+        Action_Response_R_PDU response(request, Executing);
+        EXPECT_TRUE(manager.HandlePDU(response));
+    }
+    Action_Request_R_PDU other(peer, peer, ids[1], 1, Acknowledged);
+    EXPECT_FALSE(manager.HandlePDU(Action_Response_R_PDU(other, Executing)));
+    EXPECT_EQ(count / 2, manager.GetPendingCount());
+
+    // Without retries the rest time out together, however long Process was not called.
+    EXPECT_EQ(count / 2, manager.Process(start + 10000 * MS));
+    EXPECT_EQ(0u, manager.GetPendingCount());
+    ASSERT_EQ(count, results.Results.size());
+    EXPECT_EQ(ReliableRequestHandler::Responded, results.Results[0].second);
+    EXPECT_EQ(ReliableRequestHandler::TimedOut, results.Results[count - 1].second);
+
+    // Sending a PDU that is not a request is an error.
+    Action_Response_R_PDU response;
+    EXPECT_THROW(manager.Send(response), KException);
+}
+
+TEST(ReliableRequestManagerTests, CorrelatesQueriesAndPeriodicData)
+{
+    Connection conn("127.0.0.1", TEST_PORT, false, true, 0, true);
+    conn.SetTransport(new LoopbackTransport());
+    ReliableRequestManager manager(conn);
+    RequestResults results;
+    const EntityIdentifier station(1, 2, 0), sim(1, 3, 0);
+    const KUINT64 start = PDU_Statistics::GetTime();
+
+    // A single query is answered by a single Data PDU.
+    Data_Query_PDU query(station, sim, 0);
+    const KUINT32 once = manager.Send(query, &results);
+
+    // A periodic query, 59652 time stamp units is about 100 ms.
+    query.SetTimeInterval(TimeStamp(RelativeTime, 59652));
+    const KUINT32 periodic = manager.Send(query, &results, 500);
+    EXPECT_NE(once, periodic);
+
+    Data_PDU data(sim, station, once);
+    EXPECT_TRUE(manager.HandlePDU(data));
+    ASSERT_EQ(1u, results.Results.size());
+    EXPECT_EQ(once, results.Results[0].first);
+    EXPECT_EQ(ReliableRequestHandler::Responded, results.Results[0].second);
+
+    data.SetRequestID(periodic);
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(manager.HandlePDU(data));
+    }
+    EXPECT_EQ(3, results.Updates);
+    EXPECT_TRUE(manager.IsPending(periodic));
+
+    // Requests without a reliability service are never sent again.
+    Action_Request_PDU action(station, sim, 0, 1);
+    const KUINT32 unanswered = manager.Send(action, &results, 100, 5);
+
+    // The data stops arriving so the periodic query expires with the unanswered action.
+    EXPECT_EQ(2u, manager.Process(start + 10000 * MS));
+    EXPECT_EQ(0u, manager.GetRetransmissionCount());
+    ASSERT_EQ(3u, results.Results.size());
+    EXPECT_EQ(ReliableRequestHandler::TimedOut, results.Results[1].second);
+    EXPECT_EQ(ReliableRequestHandler::TimedOut, results.Results[2].second);
+    EXPECT_FALSE(manager.IsPending(periodic));
+    EXPECT_FALSE(manager.IsPending(unanswered));
+}
@@ -0,0 +1,116 @@
+#include <sys/stat.h>
+#include <cstring>
+#include "gtest/gtest.h"
+
+#include "KDIS/Network/SharedMemoryRing.h"
+
+using namespace KDIS;
+using namespace NETWORK;
+
+#if !(defined(WIN32) | defined(_WIN32) | defined(WIN64) | defined(_WIN64))
+#include <pthread.h>
+#include <unistd.h>
+
+namespace
+{
+    const KString LAP_RING = "/kdis_test_ring_writers";
+    const KUINT32 LAP_SIZE = 256;
+
+    // Each datagram is filled with one value so a mix of two writers shows.
+    void * FastWriter(void * P)
+    {
+        SharedMemoryRing ring(LAP_RING);
+        KOCTET data[LAP_SIZE];
+        for (int i = 0; i < 200; ++i)
+        {
+            memset(data, *static_cast<KOCTET *>(P), sizeof(data));
+            ring.Write(data, sizeof(data));
+        }
+        return 0;
+    }
+}
+
+TEST(SharedMemoryRingTests, LappingWriterWaitsForSlowWriter)
+{
+    SharedMemoryRing::Remove(LAP_RING);
+    SharedMemoryRing slow(LAP_RING, 4);
+    SharedMemoryRing reader(LAP_RING);
+
+    // The slow writer holds a slot half written while the others go round the ring.
+    KUINT64 pos = 0;
+    KOCTET * slot = slow.Claim(pos);
+    memset(slot, 'S', LAP_SIZE / 2);
+
+    KOCTET ids[3] = { 'A', 'B', 'C' };
+    pthread_t threads[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_EQ(0, pthread_create(&threads[i], 0, FastWriter, &ids[i]));
+    }
+
+    usleep(100000);
+    memset(slot + LAP_SIZE / 2, 'S', LAP_SIZE / 2);
+    for (KUINT32 i = 0; i < LAP_SIZE; ++i)
+    {
+        ASSERT_EQ('S', slot[i]) << "overwritten at " << i;
+    }
+    slow.Publish(pos, LAP_SIZE);
+
+    // Everything read is whole, whatever was lapped.
+    KOCTET buffer[LAP_SIZE];
+    KUINT32 read = 0;
+    while (KUINT32 size = reader.Read(buffer, sizeof(buffer), 200000))
+    {
+        ASSERT_EQ(LAP_SIZE, size);
+        for (KUINT32 i = 1; i < LAP_SIZE; ++i)
+        {
+            ASSERT_EQ(buffer[0], buffer[i]);
+        }
+        ++read;
+    }
+    EXPECT_EQ(601u, read + reader.GetDroppedCount());
+
+    for (int i = 0; i < 3; ++i)
+    {
+        pthread_join(threads[i], 0);
+    }
+    SharedMemoryRing::Remove(LAP_RING);
+}
+
+TEST(SharedMemoryRingTests, LappedReaderCountsDrops)
+{
+    const KString name = "/kdis_test_ring_lap";
+    SharedMemoryRing::Remove(name);
+    SharedMemoryRing writer(name, 4);
+    SharedMemoryRing reader(name, 16);
+    EXPECT_EQ(4u, reader.GetSlotCount());
+
+#if defined(__linux__)
+    // Only the owner can open the ring by default.
+    struct stat st;
+    ASSERT_EQ(0, stat(("/dev/shm" + name).c_str(), &st));
+    EXPECT_EQ(0600u, st.st_mode & 0777u);
+#endif
+
+    KOCTET buffer[16];
+    EXPECT_EQ(0u, reader.Read(buffer, sizeof(buffer), 0));
+
+    for (KOCTET i = 0; i < 6; ++i)
+    {
+        writer.Write(&i, 1);
+    }
+
+    // The first two were overwritten.
+    for (KOCTET i = 2; i < 6; ++i)
+    {
+        ASSERT_EQ(1u, reader.Read(buffer, sizeof(buffer), 0));
+        EXPECT_EQ(i, buffer[0]);
+    }
+    EXPECT_EQ(2u, reader.GetDroppedCount());
+    EXPECT_EQ(0u, reader.Read(buffer, sizeof(buffer), 1000));
+
+    KOCTET big[SharedMemoryRing::SLOT_SIZE + 1];
+    EXPECT_THROW(writer.Write(big, sizeof(big)), KException);
+    SharedMemoryRing::Remove(name);
+}
+#endif
@@ -0,0 +1,123 @@
+#include "gtest/gtest.h"
+
+#include "KDIS/Network/Connection.h"
+#include "KDIS/Network/TCP_Transport.h"
+#include "KDIS/PDU/Bundle.h"
+#include "KDIS/PDU/Entity_Info_Interaction/Entity_State_PDU.h"
+
+using namespace KDIS;
+using namespace PDU;
+using namespace NETWORK;
+using namespace DATA_TYPE;
+
+// Loopback port used by the connection tests.
+static const KUINT32 TEST_PORT = 43000;
+
+namespace
+{
+    // Drives both ends until the link is up, nothing must have been sent yet.
+    bool Connect(TCP_Transport & a, TCP_Transport & b)
+    {
+        KUINT32 size;
+        for (int i = 0; i < 200 && !(a.IsConnected() && b.IsConnected()); ++i)
+        {
+            a.ReceivePDU(size, 5000);
+            b.ReceivePDU(size, 5000);
+        }
+        return a.IsConnected() && b.IsConnected();
+    }
+}
+
+TEST(TCP_TransportTests, SplitsStreamInPlace)
+{
+    TCP_Transport server("127.0.0.1", TEST_PORT, true);
+    TCP_Transport client("127.0.0.1", TEST_PORT, false, MAX_PDU_SIZE, MAX_PDU_SIZE);
+    ASSERT_TRUE(Connect(server, client));
+    EXPECT_EQ(1u, client.GetConnectionCount());
+
+    // Held back until flushed.
+    client.SetCoalescingEnabled(true, 10000000);
+    Entity_State_PDU pdu;
+    KDataStream stream = pdu.Encode();
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(static_cast<KINT32>(stream.GetBufferSize()), client.Send(stream.GetBufferPtr(), stream.GetBufferSize()));
+    }
+    EXPECT_EQ(3 * stream.GetBufferSize(), client.GetPendingBytes());
+    client.Flush();
+    EXPECT_EQ(0u, client.GetPendingBytes());
+
+    // Whole PDU are returned from the read buffer in place.
+    KUINT32 size = 0;
+    const KOCTET * first = server.ReceivePDU(size, 1000000);
+    ASSERT_TRUE(first != 0);
+    EXPECT_EQ(stream.GetBufferSize(), size);
+    for (int i = 1; i < 3; ++i)
+    {
+        const KOCTET * next = server.ReceivePDU(size, 1000000);
+        ASSERT_TRUE(next != 0);
+        EXPECT_EQ(first + i * size, next);
+    }
+    EXPECT_TRUE(server.ReceivePDU(size, 0) == 0);
+
+    // Anything that is not whole PDU would break the framing.
+    EXPECT_THROW(client.Send(stream.GetBufferPtr(), stream.GetBufferSize() - 1), KException);
+
+    // The server is not reading so the write buffer fills up.
+    client.SetCoalescingEnabled(false);
+    for (int i = 0; i < 1000000 && !client.GetRejectedCount(); ++i)
+    {
+        client.Send(stream.GetBufferPtr(), stream.GetBufferSize());
+    }
+    EXPECT_LT(0u, client.GetRejectedCount());
+    EXPECT_TRUE(client.IsBackPressured());
+    EXPECT_LT(0u, client.GetPendingBytes());
+}
+
+TEST(TCP_TransportTests, ReconnectsBetweenConnections)
+{
+    Connection sender("127.0.0.1", TEST_PORT, false, true, 0, true);
+    Connection receiver("127.0.0.1", TEST_PORT, false, true, 0, true);
+    TCP_Transport * server = new TCP_Transport("127.0.0.1", TEST_PORT, true);
+    TCP_Transport * client = new TCP_Transport("127.0.0.1", TEST_PORT);
+    client->SetReconnectInterval(0);
+    receiver.SetTransport(server);
+    sender.SetTransport(client);
+    receiver.SetBlockingTimeOut(1, 0);
+    ASSERT_TRUE(Connect(*server, *client));
+
+    Entity_State_PDU pdu;
+    pdu.SetEntityIdentifier(EntityIdentifier(1, 2, 3));
+    Bundle bundle;
+    bundle.AddPDU(PduPtr(new Entity_State_PDU(pdu)));
+    bundle.AddPDU(PduPtr(new Entity_State_PDU(pdu)));
+    sender.SendBundle(bundle);
+    sender.SendPDU(&pdu);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        PduUniquePtr p = receiver.GetNextPDU();
+        ASSERT_TRUE(p.get() != 0);
+        EXPECT_EQ(3, static_cast<Entity_State_PDU *>(p.get())->GetEntityIdentifier().GetEntityID());
+    }
+    EXPECT_EQ(htonl(INADDR_LOOPBACK), receiver.GetLastSender().sin_addr.s_addr);
+
+    // Lose the server, the client notices and sends nothing until it is back.
+    receiver.SetTransport(0);
+    KUINT32 size;
+    for (int i = 0; i < 100 && client->IsConnected(); ++i)
+    {
+        client->ReceivePDU(size, 10000);
+    }
+    EXPECT_FALSE(client->IsConnected());
+    EXPECT_EQ(0, sender.SendPDU(&pdu));
+    EXPECT_LT(0u, client->GetRejectedCount());
+
+    server = new TCP_Transport("127.0.0.1", TEST_PORT, true);
+    receiver.SetTransport(server);
+    ASSERT_TRUE(Connect(*server, *client));
+    EXPECT_EQ(2u, client->GetConnectionCount());
+
+    sender.SendPDU(&pdu);
+    EXPECT_TRUE(receiver.GetNextPDU().get() != 0);
+}